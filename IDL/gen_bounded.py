@@ -0,0 +1,277 @@
+#!/usr/bin/env python3
+"""Generate the Bounded types of AMM_Extended.idl from the fastddsgen output of their originals.
+
+    gen_bounded.py <AMM_Extended.idl> <output directory>
+
+Each struct Bounded<Name> in the IDL is a copy of <Name> from AMM_Standard.idl or AMM_Extended.idl
+with string<N> members.  Its C++ class, CDR functions and PubSubType are copied from the generated
+code of <Name> and renamed, the bounded string members become eprosima::fastcdr::fixed_string<N>,
+the maximum CDR size is computed from the IDL and is_bounded() returns true.  So the Bounded code
+always matches the unbounded code of the same fastddsgen version, apart from the string members.
+
+The code is appended to the AMM_Extended sources between "gen_bounded.py" marker comments, and a
+previous run is replaced, so run it again after every run of fastddsgen or change of the Bounded
+structs.  If fastddsgen already generated the Bounded classes itself, nothing is changed.
+"""
+
+import os
+import re
+import sys
+
+BEGIN = '// Begin of the Bounded types, generated by IDL/gen_bounded.py from their unbounded originals.'
+END = '// End of the Bounded types.'
+
+FILES = ['AMM_Extended.h', 'AMM_Extended.cxx', 'AMM_ExtendedCdrAux.hpp', 'AMM_ExtendedCdrAux.ipp',
+         'AMM_ExtendedPubSubTypes.h', 'AMM_ExtendedPubSubTypes.cxx']
+
+# CDR alignment and size of the primitive IDL types; anything else not listed is an enum.
+PRIMITIVES = {
+    'boolean': 1, 'octet': 1, 'char': 1,
+    'short': 2, 'unsigned short': 2,
+    'long': 4, 'unsigned long': 4, 'float': 4,
+    'long long': 8, 'unsigned long long': 8, 'double': 8,
+}
+
+# Size of an unbounded string in the maximum CDR size fastddsgen computes.
+UNBOUNDED_STRING = 255
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def parse(text):
+    """Returns (name, members) of every Bounded struct in declaration order, name without the prefix.
+
+    Each member is (name, kind, argument): ('string', bound or None), ('struct', name) or
+    ('primitive', size).
+    """
+    types = []
+    for match in re.finditer(r'\bstruct\s+Bounded(\w+)\s*\{(.*?)\}\s*;', strip_comments(text), flags=re.S):
+        name, body = match.groups()
+        members = []
+        for decl in body.split(';'):
+            decl = ' '.join(decl.split())
+            if not decl:
+                continue
+            member = re.match(r'(.*?)\s*(\w+)$', decl)
+            type_name, member_name = member.group(1).replace(' <', '<'), member.group(2)
+            string = re.match(r'string(?:<\s*(\d+)\s*>)?$', type_name)
+            if string:
+                members.append((member_name, 'string', int(string.group(1)) if string.group(1) else None))
+            elif type_name.startswith('Bounded'):
+                members.append((member_name, 'struct', type_name[len('Bounded'):]))
+            else:
+                members.append((member_name, 'primitive', PRIMITIVES.get(type_name, 4)))
+        types.append((name, members))
+    return types
+
+
+def max_cdr_size(members, sizes):
+    """Maximum XCDR2 size of a final struct with a DHEADER, as computed by fastddsgen."""
+    size = 4
+    for _, kind, argument in members:
+        if kind == 'string':
+            size = (size + 3) & ~3
+            size += 4 + (argument + 1 if argument else UNBOUNDED_STRING + 1)
+        elif kind == 'struct':
+            size = (size + 3) & ~3
+            size += sizes[argument]
+        else:
+            size = (size + argument - 1) // argument * argument
+            size += argument
+    return size
+
+
+def find(lines, predicate, start=0):
+    for i in range(start, len(lines)):
+        if predicate(lines[i]):
+            return i
+    raise ValueError('generated code not as expected')
+
+
+def insert(lines, at, block):
+    """Inserts a block with its marker comments, preceded by a blank line."""
+    lines[at:at] = ['', BEGIN] + block + [END]
+
+
+def remove_previous(lines):
+    """Removes the blocks of a previous run, with the blank line inserted before each."""
+    while BEGIN in lines:
+        begin = lines.index(BEGIN)
+        end = lines.index(END, begin)
+        if begin > 0 and lines[begin - 1] == '':
+            begin -= 1
+        del lines[begin:end + 1]
+
+
+class Generator:
+
+    def __init__(self, out_dir, types):
+        self.out_dir = out_dir
+        self.types = types
+        self.names = [name for name, _ in types]
+        self.sources = {}
+
+    def read(self, file_name):
+        if file_name not in self.sources:
+            with open(os.path.join(self.out_dir, file_name)) as f:
+                self.sources[file_name] = f.read().split('\n')
+        return self.sources[file_name]
+
+    def rename(self, line):
+        return re.sub(r'(?<![A-Za-z])(' + '|'.join(self.names) + r')(?=PubSubType|[^A-Za-z]|$)', r'Bounded\1', line)
+
+    @staticmethod
+    def retype(lines, bounds):
+        out = []
+        for line in lines:
+            for member, bound in bounds.items():
+                if re.search(r'\b_%s\)|(?<!\w)%s\(\)|\bm_%s;' % (member, member, member), line):
+                    line = line.replace('std::string', 'eprosima::fastcdr::fixed_string<%d>' % bound)
+            out.append(line)
+        return out
+
+    def origin(self, name):
+        """The generated file set declaring the original of a Bounded type, Standard or Extended."""
+        if 'class %s' % name in self.read('AMM_Standard.h'):
+            return 'Standard'
+        if '    class %s' % name in self.read('AMM_Extended.h'):
+            return 'Extended'
+        raise ValueError('no generated class %s' % name)
+
+    def generate(self):
+        header, source, constants, declarations, cdr, pubsub_header, pubsub_source = [], [], [], [], [], [], []
+        sizes = {}
+        for name, members in self.types:
+            origin = self.origin(name)
+            bounds = {member: argument for member, kind, argument in members if kind == 'string' and argument}
+            sizes[name] = max_cdr_size(members, sizes)
+
+            # Class declaration.  AMM_Standard.h is not indented by namespace.
+            lines = self.read('AMM_%s.h' % origin)
+            if origin == 'Standard':
+                start = find(lines, lambda l: l == 'class %s' % name)
+                end = find(lines, lambda l: l == '};', start)
+                block = [('    ' + l if l else l) for l in lines[start - 4:end + 1]]
+            else:
+                start = find(lines, lambda l: l == '    class %s' % name)
+                end = find(lines, lambda l: l == '    };', start)
+                block = lines[start - 4:end + 1]
+            block = [l.replace('@ingroup AMM_Standard', '@ingroup AMM_Extended') for l in block]
+            header += self.retype([self.rename(l) for l in block], bounds)
+
+            # Class definition.  AMM_Standard.cxx defines inside the namespace, AMM_Extended.cxx qualifies.
+            lines = self.read('AMM_%s.cxx' % origin)
+            if origin == 'Standard':
+                start = find(lines, lambda l: l == '%s::%s()' % (name, name))
+                end = find(lines, lambda l: re.match(r'^(\w+)::\1\(\)$', l) or l.startswith('} // namespace AMM') or
+                           l.startswith('// Include auxiliary'), start + 1)
+                block = []
+                for line in lines[start:end]:
+                    if line and line[0] not in ' {}/*':
+                        line = re.sub(r'(?<![\w:])%s(?=::|&)' % name, 'AMM::' + name, line)
+                    block.append(line)
+            else:
+                start = find(lines, lambda l: l == 'AMM::%s::%s()' % (name, name))
+                end = find(lines, lambda l: re.match(r'^AMM::(\w+)::\1\(\)$', l) or l.startswith('// Include auxiliary'),
+                           start + 1)
+                block = lines[start:end]
+            while block and block[-1] == '':
+                block.pop()
+            source += self.retype([self.rename(l) for l in block], bounds) + ['']
+
+            constants += ['constexpr uint32_t AMM_Bounded%s_max_cdr_typesize {%dUL};' % (name, sizes[name]),
+                          'constexpr uint32_t AMM_Bounded%s_max_key_cdr_typesize {0UL};' % name, '']
+            declarations += ['eProsima_user_DllExport void serialize_key(', '        eprosima::fastcdr::Cdr& scdr,',
+                             '        const AMM::Bounded%s& data);' % name, '']
+
+            # CDR functions, from calculate_serialized_size to serialize_key.
+            lines = self.read('AMM_%sCdrAux.ipp' % origin)
+            data = find(lines, lambda l: l == '        const AMM::%s& data,' % name)
+            start = data - 3
+            if lines[start] != 'template<>':
+                raise ValueError('generated code not as expected')
+            end = find(lines, lambda l: l == '}', find(lines, lambda l: l == 'void serialize_key(', data))
+            block = [l for l in lines[start:end + 1] if l != '    using namespace AMM;']
+            block = [l for i, l in enumerate(block) if not (l == '' and i > 0 and block[i - 1] == '{')]
+            cdr += [self.rename(l) for l in block] + ['']
+
+            lines = self.read('AMM_%sPubSubTypes.h' % origin)
+            start = find(lines, lambda l: l == '    class %sPubSubType : public eprosima::fastdds::dds::TopicDataType' % name)
+            end = find(lines, lambda l: l == '    };', start)
+            block = [l.replace('@ingroup AMM_Standard', '@ingroup AMM_Extended') for l in lines[start - 4:end + 1]]
+            bounded = find(block, lambda l: 'is_bounded() const override' in l) + 2
+            if block[bounded].strip() != 'return false;':
+                raise ValueError('generated code not as expected')
+            block[bounded] = block[bounded].replace('false', 'true')
+            pubsub_header += [self.rename(l) for l in block] + ['']
+
+            lines = self.read('AMM_%sPubSubTypes.cxx' % origin)
+            start = find(lines, lambda l: l == '    %sPubSubType::%sPubSubType()' % (name, name))
+            end = find(lines, lambda l: re.match(r'^    (\w+)PubSubType::\1PubSubType\(\)$', l) or
+                       l.startswith('} //End of namespace'), start + 1)
+            block = lines[start:end]
+            while block and block[-1] == '':
+                block.pop()
+            pubsub_source += [self.rename(l) for l in block] + ['']
+
+        lines = self.read('AMM_Extended.h')
+        insert(lines, find(lines, lambda l: l == '} // namespace AMM'), header)
+
+        lines = self.read('AMM_Extended.cxx')
+        at = find(lines, lambda l: l.startswith('// Include auxiliary'))
+        while lines[at - 1] == '':
+            at -= 1
+        insert(lines, at, source[:-1])
+
+        lines = self.read('AMM_ExtendedCdrAux.hpp')
+        at = max(n for n, l in enumerate(lines) if l.startswith('constexpr uint32_t')) + 1
+        insert(lines, at, constants[:-1])
+        at = max(n for n, l in enumerate(lines) if l.startswith('        const AMM::') and l.endswith('& data);')) + 1
+        insert(lines, at, declarations[:-1])
+
+        lines = self.read('AMM_ExtendedCdrAux.ipp')
+        at = max(n for n, l in enumerate(lines) if l == 'void serialize_key(')
+        insert(lines, find(lines, lambda l: l == '}', at) + 1, cdr[:-1])
+
+        lines = self.read('AMM_ExtendedPubSubTypes.h')
+        insert(lines, max(n for n, l in enumerate(lines) if l == '    };') + 1, pubsub_header[:-1])
+
+        lines = self.read('AMM_ExtendedPubSubTypes.cxx')
+        at = find(lines, lambda l: l.startswith('} //End of namespace'))
+        while lines[at - 1] == '':
+            at -= 1
+        insert(lines, at, pubsub_source[:-1])
+
+    def write(self):
+        for file_name in FILES:
+            with open(os.path.join(self.out_dir, file_name), 'w', newline='\n') as f:
+                f.write('\n'.join(self.sources[file_name]))
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.stderr.write(__doc__)
+        return 2
+
+    idl_path, out_dir = sys.argv[1], sys.argv[2]
+    with open(idl_path) as f:
+        types = parse(f.read())
+
+    generator = Generator(out_dir, types)
+    for file_name in FILES:
+        remove_previous(generator.read(file_name))
+
+    if any('    class Bounded%s' % name in generator.read('AMM_Extended.h') for name, _ in types):
+        sys.stderr.write('The Bounded types were generated by fastddsgen, nothing to do.\n')
+        return 0
+
+    generator.generate()
+    generator.write()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""Generate compile-time field reflection for the classes fastddsgen generates from an IDL file.
+
+    gen_reflection.py <file.idl> <output directory>
+
+Writes <Name>Reflection.h next to the fastddsgen output.  Handles the IDL subset used by the AMM
+data model: modules, enums, structs, primitive members, bounded and unbounded strings, sequences
+and fixed size arrays.
+"""
+
+import os
+import re
+import sys
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def parse(text):
+    """Returns the module name, the includes and the enums and structs in declaration order."""
+    includes = re.findall(r'#include\s+"([^"]+)\.idl"', text)
+    text = strip_comments(re.sub(r'#include[^\n]*', '', text))
+
+    module = re.search(r'module\s+(\w+)', text).group(1)
+    decls = []
+
+    for match in re.finditer(r'\b(enum|struct)\s+(\w+)\s*\{(.*?)\}\s*;', text, flags=re.S):
+        kind, name, body = match.groups()
+        if kind == 'enum':
+            values = [v.strip() for v in body.split(',') if v.strip()]
+            decls.append(('enum', name, values))
+        else:
+            members = []
+            for decl in body.split(';'):
+                decl = ' '.join(decl.split())
+                if not decl:
+                    continue
+                member = re.match(r'(.*?)\s*(\w+)\s*(\[\s*\d+\s*\])?$', decl)
+                members.append(member.group(2))
+            decls.append(('struct', name, members))
+
+    return module, includes, decls
+
+
+def field_switch(members, indent):
+    """Dispatch on the name length first, then compare names of that length."""
+    by_length = {}
+    for member in members:
+        by_length.setdefault(len(member), []).append(member)
+
+    lines = [indent + 'switch (field.size()) {']
+    for length in sorted(by_length):
+        lines.append(indent + '   case %d:' % length)
+        for member in by_length[length]:
+            lines.append(indent + '      if (field == "%s") {' % member)
+            lines.append(indent + '         visitor(object.%s());' % member)
+            lines.append(indent + '         return true;')
+            lines.append(indent + '      }')
+        lines.append(indent + '      break;')
+    lines.append(indent + '   default:')
+    lines.append(indent + '      break;')
+    lines.append(indent + '}')
+    return lines
+
+
+def generate(idl_name, module, includes, decls):
+    out = []
+    out.append('// Generated from %s.idl by IDL/gen_reflection.py, do not edit.' % idl_name)
+    out.append('')
+    out.append('#pragma once')
+    out.append('')
+    out.append('#include "Reflection.h"')
+    out.append('#include "%s.h"' % idl_name)
+    for include in includes:
+        out.append('#include "%sReflection.h"' % include)
+    out.append('')
+    out.append('namespace AMM {')
+    out.append('   namespace reflection {')
+
+    for kind, name, items in decls:
+        qualified = '%s::%s' % (module, name)
+        out.append('')
+        if kind == 'enum':
+            out.append('      template<>')
+            out.append('      struct Enum<%s> {' % qualified)
+            out.append('         static const char *Name() { return "%s"; }' % name)
+            out.append('')
+            out.append('         static constexpr size_t Count = %d;' % len(items))
+            out.append('')
+            out.append('         static const char *const *Names() {')
+            out.append('            static const char *const names[] = {')
+            for value in items:
+                out.append('               "%s",' % value)
+            out.append('            };')
+            out.append('            return names;')
+            out.append('         }')
+            out.append('      };')
+        else:
+            out.append('      template<>')
+            out.append('      struct Struct<%s> {' % qualified)
+            out.append('         static const char *Name() { return "%s"; }' % name)
+            out.append('')
+            out.append('         static constexpr size_t Count = %d;' % len(items))
+            out.append('')
+            out.append('         template<class T, class Visitor>')
+            out.append('         static void ForEach(T &&object, Visitor &&visitor) {')
+            for member in items:
+                out.append('            visitor("%s", object.%s());' % (member, member))
+            out.append('         }')
+            out.append('')
+            out.append('         template<class T, class Visitor>')
+            out.append('         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {')
+            out.extend(field_switch(items, '            '))
+            out.append('            return false;')
+            out.append('         }')
+            out.append('      };')
+
+    out.append('')
+    out.append('   } // namespace reflection')
+    out.append('} // namespace AMM')
+    out.append('')
+    return '\n'.join(out)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.stderr.write(__doc__)
+        return 2
+
+    idl_path, out_dir = sys.argv[1], sys.argv[2]
+    idl_name = os.path.splitext(os.path.basename(idl_path))[0]
+
+    with open(idl_path) as f:
+        module, includes, decls = parse(f.read())
+
+    with open(os.path.join(out_dir, idl_name + 'Reflection.h'), 'w', newline='\n') as f:
+        f.write(generate(idl_name, module, includes, decls))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+/// Minimal timing helpers shared by the microbenchmarks.
+namespace bench {
+
+    /// Keeps the compiler from optimizing away a result.
+    inline void Keep(const void *p) {
+       static const void *volatile sink = nullptr;
+       sink = p;
+       (void) sink;
+    }
+
+    /// Run fn once untimed to warm up, then time it several times.
+    /// @returns Nanoseconds taken by the fastest run.
+    template<class F>
+    double Best(F &fn, int runs) {
+       fn();
+
+       double best = 0;
+       for (int i = 0; i < runs; ++i) {
+          auto start = std::chrono::steady_clock::now();
+          fn();
+          std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+          if (i == 0 || elapsed.count() < best) best = elapsed.count();
+       }
+       return best;
+    }
+
+    /// Time a loop and print the cost per operation.
+    /// @param name Label printed in front of the result.
+    /// @param operations Operations done by one call of fn.
+    /// @param fn Function running the loop.
+    /// @returns Nanoseconds per operation.
+    template<class F>
+    double Measure(const char *name, std::size_t operations, F fn, int runs = 5) {
+       const double perOp = Best(fn, runs) / operations;
+       std::printf("%-40s %10.1f ns/op\n", name, perOp);
+       return perOp;
+    }
+
+    /// Time a loop and print its throughput.
+    /// @param name Label printed in front of the result.
+    /// @param bytes Bytes processed by one call of fn.
+    /// @param fn Function running the loop.
+    /// @returns Megabytes (10^6 bytes) per second.
+    template<class F>
+    double MeasureBytes(const char *name, std::size_t bytes, F fn, int runs = 5) {
+       const double mbPerSecond = bytes * 1e3 / Best(fn, runs);
+       std::printf("%-40s %10.1f MB/s\n", name, mbPerSecond);
+       return mbPerSecond;
+    }
+
+    /// Print the median and tail of a set of per-call latencies.
+    /// @param name Label printed in front of the result.
+    /// @param ns Latencies in nanoseconds, sorted in place.
+    inline void PrintLatencies(const char *name, std::vector<double> &ns) {
+       if (ns.empty()) return;
+       std::sort(ns.begin(), ns.end());
+       auto at = [&](double q) { return ns[static_cast<std::size_t>(q * (ns.size() - 1))]; };
+       std::printf("%-40s p50 %8.0f ns  p99 %8.0f ns  p99.9 %10.0f ns\n", name, at(0.5), at(0.99), at(0.999));
+    }
+
+} // namespace bench
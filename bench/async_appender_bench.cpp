@@ -0,0 +1,68 @@
+// Per-call logging latency under contention: RollingFileAppender called directly against the same
+// appender behind AsyncAppender, with 8 threads logging at once.
+
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include <plog/Appenders/AsyncAppender.h>
+#include <plog/Appenders/RollingFileAppender.h>
+#include <plog/Formatters/TxtFormatter.h>
+#include <plog/Log.h>
+
+#include "Bench.h"
+
+namespace {
+
+   const int THREADS = 8;
+   const int RECORDS = 50000;
+
+   /// Log from THREADS threads at once, timing every call from building the record to write returning.
+   void run(const char *name, plog::IAppender &appender) {
+      std::vector<std::vector<double>> perThread(THREADS);
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < THREADS; ++t) {
+         threads.emplace_back([&, t] {
+            std::vector<double> &latencies = perThread[t];
+            latencies.reserve(RECORDS);
+            for (int i = 0; i < RECORDS; ++i) {
+               auto start = std::chrono::steady_clock::now();
+               plog::Record record(plog::info, PLOG_GET_FUNC(), __LINE__, PLOG_GET_FILE(), nullptr);
+               record << "Physiology value " << i << " from thread " << t;
+               appender.write(record);
+               std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+               latencies.push_back(elapsed.count());
+            }
+         });
+      }
+      for (auto &thread : threads) thread.join();
+
+      std::vector<double> all;
+      for (auto &latencies : perThread) all.insert(all.end(), latencies.begin(), latencies.end());
+      bench::PrintLatencies(name, all);
+   }
+
+} // namespace
+
+int main(int argc, char **argv) {
+   const char *file = argc > 1 ? argv[1] : "amm_bench_async_appender.log";
+
+   {
+      plog::RollingFileAppender<plog::TxtFormatter> appender(file);
+      run("RollingFileAppender", appender);
+   }
+   {
+      plog::RollingFileAppender<plog::TxtFormatter> appender(file);
+      plog::AsyncAppender async(&appender, 8192, plog::overflowPolicy::kBlock);
+      run("AsyncAppender, kBlock", async);
+   }
+   {
+      plog::RollingFileAppender<plog::TxtFormatter> appender(file);
+      plog::AsyncAppender async(&appender, 8192, plog::overflowPolicy::kDrop);
+      run("AsyncAppender, kDrop", async);
+   }
+
+   std::remove(file);
+   return 0;
+}
@@ -0,0 +1,79 @@
+// Base64 throughput: the boost iterator implementation Utility::encode64/decode64 used before, against
+// the buffer API (AVX2, SSSE3 or scalar, whichever the CPU supports) and the string wrappers.
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/archive/iterators/base64_from_binary.hpp>
+#include <boost/archive/iterators/binary_from_base64.hpp>
+#include <boost/archive/iterators/transform_width.hpp>
+
+#include "amm/Utility.h"
+
+#include "Bench.h"
+
+namespace {
+
+   std::string boostEncode(const std::string &val) {
+      using namespace boost::archive::iterators;
+      using It = base64_from_binary<transform_width<std::string::const_iterator, 6, 8>>;
+      auto tmp = std::string(It(std::begin(val)), It(std::end(val)));
+      return tmp.append((3 - val.size() % 3) % 3, '=');
+   }
+
+   std::string boostDecode(const std::string &val) {
+      using namespace boost::archive::iterators;
+      using It = transform_width<binary_from_base64<std::string::const_iterator>, 8, 6>;
+      return boost::algorithm::trim_right_copy_if(
+         std::string(It(std::begin(val)), It(std::end(val))), [](char c) { return c == '\0'; }
+      );
+   }
+
+} // namespace
+
+int main() {
+   const std::size_t size = 8 * 1024 * 1024;
+
+   std::mt19937 rng(42);
+   std::string binary(size, '\0');
+   for (char &c : binary) c = static_cast<char>(rng());
+   // boost cannot decode padding, so keep the input a multiple of 3.
+   binary.resize(size / 3 * 3);
+   binary.back() = 1;
+
+   const std::string encoded = AMM::Utility::encode64(binary);
+   std::vector<char> text(AMM::Utility::encode64_length(binary.size()));
+   std::vector<uint8_t> bytes(AMM::Utility::decode64_max_length(encoded.size()));
+
+   bench::MeasureBytes("boost iterators encode", binary.size(), [&] {
+      std::string out = boostEncode(binary);
+      bench::Keep(out.data());
+   }, 3);
+   bench::MeasureBytes("boost iterators decode", binary.size(), [&] {
+      std::string out = boostDecode(encoded);
+      bench::Keep(out.data());
+   }, 3);
+
+   bench::MeasureBytes("Utility::encode64 string", binary.size(), [&] {
+      std::string out = AMM::Utility::encode64(binary);
+      bench::Keep(out.data());
+   });
+   bench::MeasureBytes("Utility::decode64 string", binary.size(), [&] {
+      std::string out = AMM::Utility::decode64(encoded);
+      bench::Keep(out.data());
+   });
+
+   bench::MeasureBytes("Utility::encode64 buffer", binary.size(), [&] {
+      AMM::Utility::encode64(reinterpret_cast<const uint8_t *>(binary.data()), binary.size(), text.data());
+      bench::Keep(text.data());
+   });
+   bench::MeasureBytes("Utility::decode64 buffer", binary.size(), [&] {
+      size_t written = 0;
+      AMM::Utility::decode64(encoded.data(), encoded.size(), bytes.data(), written);
+      bench::Keep(bytes.data());
+   });
+
+   return 0;
+}
@@ -0,0 +1,62 @@
+// Log record formatting: the stream based TxtFormatter and CsvFormatter against FastTxtFormatter and
+// FastCsvFormatter, over records with mixed severities and messages with and without quotes.
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include <plog/Formatters/CsvFormatter.h>
+#include <plog/Formatters/FastCsvFormatter.h>
+#include <plog/Formatters/FastTxtFormatter.h>
+#include <plog/Formatters/TxtFormatter.h>
+#include <plog/Log.h>
+
+#include "Bench.h"
+
+namespace {
+
+   /// Formats every record with both formatters and counts the records that differ.
+   template<class Reference, class Fast>
+   size_t mismatches(const std::vector<std::unique_ptr<plog::Record>> &records) {
+      size_t count = 0;
+      for (const auto &record : records) {
+         if (Reference::format(*record) != Fast::format(*record)) ++count;
+      }
+      return count;
+   }
+
+   template<class Formatter>
+   void measure(const char *name, const std::vector<std::unique_ptr<plog::Record>> &records) {
+      bench::Measure(name, records.size(), [&] {
+         for (const auto &record : records) {
+            plog::util::nstring line = Formatter::format(*record);
+            bench::Keep(line.data());
+         }
+      });
+   }
+
+} // namespace
+
+int main() {
+   const plog::Severity severities[] = {plog::fatal, plog::error, plog::warning, plog::info, plog::debug, plog::verbose};
+
+   std::vector<std::unique_ptr<plog::Record>> records;
+   for (int i = 0; i < 50000; ++i) {
+      records.emplace_back(new plog::Record(severities[i % 6], PLOG_GET_FUNC(), __LINE__, PLOG_GET_FILE(), nullptr));
+      if (i % 4 == 0) {
+         *records.back() << "Module \"" << i << "\" reported \"EXIGENT\" for capability heart_rate";
+      } else {
+         *records.back() << "Physiology value Cardiovascular_HeartRate = " << 60.0 + i % 40;
+      }
+   }
+
+   measure<plog::TxtFormatter>("TxtFormatter", records);
+   measure<plog::FastTxtFormatter>("FastTxtFormatter", records);
+   measure<plog::CsvFormatter>("CsvFormatter", records);
+   measure<plog::FastCsvFormatter>("FastCsvFormatter", records);
+
+   const size_t txt = mismatches<plog::TxtFormatter, plog::FastTxtFormatter>(records);
+   const size_t csv = mismatches<plog::CsvFormatter, plog::FastCsvFormatter>(records);
+   std::printf("Output mismatches: txt %zu, csv %zu\n", txt, csv);
+   return txt == 0 && csv == 0 ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+// Participant user data parsing: the map based parse_key_value as it was before the view parser,
+// the map overload (now a wrapper) and the view parser, on typical user data blobs.
+
+#include <cctype>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "amm/Utility.h"
+
+#include "Bench.h"
+
+namespace {
+
+   /// parse_key_value before the view based parser, kept as the baseline.
+   std::map<std::string, std::vector<uint8_t>> oldParseKeyValue(std::vector<uint8_t> kv) {
+      std::map<std::string, std::vector<uint8_t>> m;
+      bool keyfound = false;
+      std::string key;
+      std::vector<uint8_t> value;
+      uint8_t prev = '\0';
+
+      if (kv.size() == 0) {
+         goto not_valid;
+      }
+
+      for (uint8_t u8 : kv) {
+         if (keyfound) {
+            if ((u8 == ';') && (prev != ';')) {
+               prev = u8;
+               continue;
+            } else if ((u8 != ';') && (prev == ';')) {
+               if (value.size() == 0) {
+                  goto not_valid;
+               }
+               m[key] = value;
+
+               key.clear();
+               value.clear();
+               keyfound = false;
+            } else {
+               value.push_back(u8);
+            }
+         }
+         if (!keyfound) {
+            if (u8 == '=') {
+               if (key.size() == 0) {
+                  goto not_valid;
+               }
+               keyfound = true;
+            } else if (isalnum(u8)) {
+               key.push_back(u8);
+            } else if ((u8 == '\0') && (key.size() == 0) && (m.size() > 0)) {
+               break;
+            } else if ((prev != ';') || (key.size() > 0)) {
+               goto not_valid;
+            }
+         }
+         prev = u8;
+      }
+      if (keyfound) {
+         if (value.size() == 0) {
+            goto not_valid;
+         }
+         m[key] = value;
+      } else if (key.size() > 0) {
+         goto not_valid;
+      }
+      return m;
+      not_valid:
+      return std::map<std::string, std::vector<uint8_t>>();
+   }
+
+   /// @returns True if the old and new parsers agree on the blob.
+   bool run(const char *label, const std::string &text) {
+      const std::vector<uint8_t> blob(text.begin(), text.end());
+      const std::size_t n = 200000;
+
+      std::printf("%s (%zu bytes)\n", label, blob.size());
+      if (oldParseKeyValue(blob) != AMM::Utility::parse_key_value(blob)) {
+         std::printf("  parsers disagree\n");
+         return false;
+      }
+      bench::Measure("  old parse_key_value", n, [&] {
+         for (std::size_t i = 0; i < n; ++i) {
+            auto kv = oldParseKeyValue(blob);
+            bench::Keep(&kv);
+         }
+      });
+      bench::Measure("  parse_key_value map wrapper", n, [&] {
+         for (std::size_t i = 0; i < n; ++i) {
+            auto kv = AMM::Utility::parse_key_value(blob);
+            bench::Keep(&kv);
+         }
+      });
+      bench::Measure("  parse_key_value views", n, [&] {
+         for (std::size_t i = 0; i < n; ++i) {
+            AMM::Utility::KeyValues kv;
+            AMM::Utility::parse_key_value(blob.data(), blob.size(), kv);
+            bench::Keep(&kv);
+         }
+      });
+      return true;
+   }
+
+} // namespace
+
+int main() {
+   bool agree = run("enclave only", "enclave=/;");
+   agree &= run("security context and enclave", "securitycontext=/ros/node;enclave=/;");
+   agree &= run("module identity, 6 pairs",
+                "moduleid=6f1c2d3e-4a5b-4c6d-8e7f-90a1b2c3d4e5;modulename=AMM_Physiology_Engine;"
+                "manufacturer=Vcom3D;model=BioGears;serialnumber=0001-2020;version=1.4.1;");
+   return agree ? 0 : 1;
+}
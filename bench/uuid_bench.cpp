@@ -0,0 +1,38 @@
+// UUID generation: the per-call boost generator GenerateUuidString used to build, against UuidGenerator.
+
+#include <string>
+#include <vector>
+
+#include <boost/uuid/uuid.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include "amm/Uuid.h"
+
+#include "Bench.h"
+
+int main() {
+   const std::size_t n = 200000;
+
+   bench::Measure("boost random_generator per call", n, [&] {
+      for (std::size_t i = 0; i < n; ++i) {
+         std::string id = boost::uuids::to_string(boost::uuids::random_generator()());
+         bench::Keep(id.data());
+      }
+   });
+
+   bench::Measure("UuidGenerator::GenerateString", n, [&] {
+      for (std::size_t i = 0; i < n; ++i) {
+         std::string id = AMM::UuidGenerator::GenerateString();
+         bench::Keep(id.data());
+      }
+   });
+
+   std::vector<char> buffers(n * AMM::UuidGenerator::BUFFER_SIZE);
+   bench::Measure("UuidGenerator::GenerateStrings", n, [&] {
+      AMM::UuidGenerator::GenerateStrings(n, buffers.data());
+      bench::Keep(buffers.data());
+   });
+
+   return 0;
+}
@@ -9,7 +9,7 @@ macro (DEFINE_FastRTPS_SOURCES idlfilename)
 endmacro (DEFINE_FastRTPS_SOURCES)
 
 if (NOT FASTRTP_GEN_EXECUTABLE)
-  find_program(FASTRTP_GEN_EXECUTABLE NAME fastrtpsgen
+  find_program(FASTRTP_GEN_EXECUTABLE NAMES fastddsgen fastrtpsgen
           DOC "FastRTPS code generator"
           PATH_SUFFIXES bin
           )
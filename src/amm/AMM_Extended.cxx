@@ -374,6 +374,1679 @@ std::string& AMM::Command::message()
 }
 
 
+AMM::CompactUUID::CompactUUID()
+{
+
+}
+
+AMM::CompactUUID::~CompactUUID()
+{
+}
+
+AMM::CompactUUID::CompactUUID(
+        const CompactUUID& x)
+{
+    m_id = x.m_id;
+}
+
+AMM::CompactUUID::CompactUUID(
+        CompactUUID&& x) noexcept
+{
+    m_id = std::move(x.m_id);
+}
+
+AMM::CompactUUID& AMM::CompactUUID::operator =(
+        const CompactUUID& x)
+{
+
+    m_id = x.m_id;
+
+    return *this;
+}
+
+AMM::CompactUUID& AMM::CompactUUID::operator =(
+        CompactUUID&& x) noexcept
+{
+
+    m_id = std::move(x.m_id);
+
+    return *this;
+}
+
+bool AMM::CompactUUID::operator ==(
+        const CompactUUID& x) const
+{
+    return (m_id == x.m_id);
+}
+
+bool AMM::CompactUUID::operator !=(
+        const CompactUUID& x) const
+{
+    return !(*this == x);
+}
+
+/*!
+ * @brief This function copies the value in member id
+ * @param _id New value to be copied in member id
+ */
+void AMM::CompactUUID::id(
+        const std::array<uint8_t, 16>& _id)
+{
+    m_id = _id;
+}
+
+/*!
+ * @brief This function moves the value in member id
+ * @param _id New value to be moved in member id
+ */
+void AMM::CompactUUID::id(
+        std::array<uint8_t, 16>&& _id)
+{
+    m_id = std::move(_id);
+}
+
+/*!
+ * @brief This function returns a constant reference to member id
+ * @return Constant reference to member id
+ */
+const std::array<uint8_t, 16>& AMM::CompactUUID::id() const
+{
+    return m_id;
+}
+
+/*!
+ * @brief This function returns a reference to member id
+ * @return Reference to member id
+ */
+std::array<uint8_t, 16>& AMM::CompactUUID::id()
+{
+    return m_id;
+}
+
+
+AMM::PhysiologyFrameEntry::PhysiologyFrameEntry()
+{
+
+}
+
+AMM::PhysiologyFrameEntry::~PhysiologyFrameEntry()
+{
+}
+
+AMM::PhysiologyFrameEntry::PhysiologyFrameEntry(
+        const PhysiologyFrameEntry& x)
+{
+    m_name = x.m_name;
+    m_value = x.m_value;
+}
+
+AMM::PhysiologyFrameEntry::PhysiologyFrameEntry(
+        PhysiologyFrameEntry&& x) noexcept
+{
+    m_name = std::move(x.m_name);
+    m_value = x.m_value;
+}
+
+AMM::PhysiologyFrameEntry& AMM::PhysiologyFrameEntry::operator =(
+        const PhysiologyFrameEntry& x)
+{
+
+    m_name = x.m_name;
+    m_value = x.m_value;
+
+    return *this;
+}
+
+AMM::PhysiologyFrameEntry& AMM::PhysiologyFrameEntry::operator =(
+        PhysiologyFrameEntry&& x) noexcept
+{
+
+    m_name = std::move(x.m_name);
+    m_value = x.m_value;
+
+    return *this;
+}
+
+bool AMM::PhysiologyFrameEntry::operator ==(
+        const PhysiologyFrameEntry& x) const
+{
+    return (m_name == x.m_name &&
+           m_value == x.m_value);
+}
+
+bool AMM::PhysiologyFrameEntry::operator !=(
+        const PhysiologyFrameEntry& x) const
+{
+    return !(*this == x);
+}
+
+/*!
+ * @brief This function copies the value in member name
+ * @param _name New value to be copied in member name
+ */
+void AMM::PhysiologyFrameEntry::name(
+        const std::string& _name)
+{
+    m_name = _name;
+}
+
+/*!
+ * @brief This function moves the value in member name
+ * @param _name New value to be moved in member name
+ */
+void AMM::PhysiologyFrameEntry::name(
+        std::string&& _name)
+{
+    m_name = std::move(_name);
+}
+
+/*!
+ * @brief This function returns a constant reference to member name
+ * @return Constant reference to member name
+ */
+const std::string& AMM::PhysiologyFrameEntry::name() const
+{
+    return m_name;
+}
+
+/*!
+ * @brief This function returns a reference to member name
+ * @return Reference to member name
+ */
+std::string& AMM::PhysiologyFrameEntry::name()
+{
+    return m_name;
+}
+
+
+/*!
+ * @brief This function sets a value in member value
+ * @param _value New value for member value
+ */
+void AMM::PhysiologyFrameEntry::value(
+        double _value)
+{
+    m_value = _value;
+}
+
+/*!
+ * @brief This function returns the value of member value
+ * @return Value of member value
+ */
+double AMM::PhysiologyFrameEntry::value() const
+{
+    return m_value;
+}
+
+/*!
+ * @brief This function returns a reference to member value
+ * @return Reference to member value
+ */
+double& AMM::PhysiologyFrameEntry::value()
+{
+    return m_value;
+}
+
+
+AMM::PhysiologyFrame::PhysiologyFrame()
+{
+
+}
+
+AMM::PhysiologyFrame::~PhysiologyFrame()
+{
+}
+
+AMM::PhysiologyFrame::PhysiologyFrame(
+        const PhysiologyFrame& x)
+{
+    m_educational_encounter = x.m_educational_encounter;
+    m_simulation_time = x.m_simulation_time;
+    m_timestamp = x.m_timestamp;
+    m_values = x.m_values;
+}
+
+AMM::PhysiologyFrame::PhysiologyFrame(
+        PhysiologyFrame&& x) noexcept
+{
+    m_educational_encounter = std::move(x.m_educational_encounter);
+    m_simulation_time = x.m_simulation_time;
+    m_timestamp = x.m_timestamp;
+    m_values = std::move(x.m_values);
+}
+
+AMM::PhysiologyFrame& AMM::PhysiologyFrame::operator =(
+        const PhysiologyFrame& x)
+{
+
+    m_educational_encounter = x.m_educational_encounter;
+    m_simulation_time = x.m_simulation_time;
+    m_timestamp = x.m_timestamp;
+    m_values = x.m_values;
+
+    return *this;
+}
+
+AMM::PhysiologyFrame& AMM::PhysiologyFrame::operator =(
+        PhysiologyFrame&& x) noexcept
+{
+
+    m_educational_encounter = std::move(x.m_educational_encounter);
+    m_simulation_time = x.m_simulation_time;
+    m_timestamp = x.m_timestamp;
+    m_values = std::move(x.m_values);
+
+    return *this;
+}
+
+bool AMM::PhysiologyFrame::operator ==(
+        const PhysiologyFrame& x) const
+{
+    return (m_educational_encounter == x.m_educational_encounter &&
+           m_simulation_time == x.m_simulation_time &&
+           m_timestamp == x.m_timestamp &&
+           m_values == x.m_values);
+}
+
+bool AMM::PhysiologyFrame::operator !=(
+        const PhysiologyFrame& x) const
+{
+    return !(*this == x);
+}
+
+/*!
+ * @brief This function copies the value in member educational_encounter
+ * @param _educational_encounter New value to be copied in member educational_encounter
+ */
+void AMM::PhysiologyFrame::educational_encounter(
+        const AMM::UUID& _educational_encounter)
+{
+    m_educational_encounter = _educational_encounter;
+}
+
+/*!
+ * @brief This function moves the value in member educational_encounter
+ * @param _educational_encounter New value to be moved in member educational_encounter
+ */
+void AMM::PhysiologyFrame::educational_encounter(
+        AMM::UUID&& _educational_encounter)
+{
+    m_educational_encounter = std::move(_educational_encounter);
+}
+
+/*!
+ * @brief This function returns a constant reference to member educational_encounter
+ * @return Constant reference to member educational_encounter
+ */
+const AMM::UUID& AMM::PhysiologyFrame::educational_encounter() const
+{
+    return m_educational_encounter;
+}
+
+/*!
+ * @brief This function returns a reference to member educational_encounter
+ * @return Reference to member educational_encounter
+ */
+AMM::UUID& AMM::PhysiologyFrame::educational_encounter()
+{
+    return m_educational_encounter;
+}
+
+
+/*!
+ * @brief This function sets a value in member simulation_time
+ * @param _simulation_time New value for member simulation_time
+ */
+void AMM::PhysiologyFrame::simulation_time(
+        int64_t _simulation_time)
+{
+    m_simulation_time = _simulation_time;
+}
+
+/*!
+ * @brief This function returns the value of member simulation_time
+ * @return Value of member simulation_time
+ */
+int64_t AMM::PhysiologyFrame::simulation_time() const
+{
+    return m_simulation_time;
+}
+
+/*!
+ * @brief This function returns a reference to member simulation_time
+ * @return Reference to member simulation_time
+ */
+int64_t& AMM::PhysiologyFrame::simulation_time()
+{
+    return m_simulation_time;
+}
+
+
+/*!
+ * @brief This function sets a value in member timestamp
+ * @param _timestamp New value for member timestamp
+ */
+void AMM::PhysiologyFrame::timestamp(
+        uint64_t _timestamp)
+{
+    m_timestamp = _timestamp;
+}
+
+/*!
+ * @brief This function returns the value of member timestamp
+ * @return Value of member timestamp
+ */
+uint64_t AMM::PhysiologyFrame::timestamp() const
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function returns a reference to member timestamp
+ * @return Reference to member timestamp
+ */
+uint64_t& AMM::PhysiologyFrame::timestamp()
+{
+    return m_timestamp;
+}
+
+
+/*!
+ * @brief This function copies the value in member values
+ * @param _values New value to be copied in member values
+ */
+void AMM::PhysiologyFrame::values(
+        const std::vector<AMM::PhysiologyFrameEntry>& _values)
+{
+    m_values = _values;
+}
+
+/*!
+ * @brief This function moves the value in member values
+ * @param _values New value to be moved in member values
+ */
+void AMM::PhysiologyFrame::values(
+        std::vector<AMM::PhysiologyFrameEntry>&& _values)
+{
+    m_values = std::move(_values);
+}
+
+/*!
+ * @brief This function returns a constant reference to member values
+ * @return Constant reference to member values
+ */
+const std::vector<AMM::PhysiologyFrameEntry>& AMM::PhysiologyFrame::values() const
+{
+    return m_values;
+}
+
+/*!
+ * @brief This function returns a reference to member values
+ * @return Reference to member values
+ */
+std::vector<AMM::PhysiologyFrameEntry>& AMM::PhysiologyFrame::values()
+{
+    return m_values;
+}
+
+// Begin of the Bounded types, generated by IDL/gen_bounded.py from their unbounded originals.
+AMM::BoundedUUID::BoundedUUID()
+{
+}
+
+AMM::BoundedUUID::~BoundedUUID()
+{
+}
+
+AMM::BoundedUUID::BoundedUUID(
+        const BoundedUUID& x)
+{
+    m_id = x.m_id;
+}
+
+AMM::BoundedUUID::BoundedUUID(
+        BoundedUUID&& x) noexcept
+{
+    m_id = std::move(x.m_id);
+}
+
+AMM::BoundedUUID& AMM::BoundedUUID::operator =(
+        const BoundedUUID& x)
+{
+
+    m_id = x.m_id;
+    return *this;
+}
+
+AMM::BoundedUUID& AMM::BoundedUUID::operator =(
+        BoundedUUID&& x) noexcept
+{
+
+    m_id = std::move(x.m_id);
+    return *this;
+}
+
+bool AMM::BoundedUUID::operator ==(
+        const BoundedUUID& x) const
+{
+    return (m_id == x.m_id);
+}
+
+bool AMM::BoundedUUID::operator !=(
+        const BoundedUUID& x) const
+{
+    return !(*this == x);
+}
+
+/*!
+ * @brief This function copies the value in member id
+ * @param _id New value to be copied in member id
+ */
+void AMM::BoundedUUID::id(
+        const eprosima::fastcdr::fixed_string<64>& _id)
+{
+    m_id = _id;
+}
+
+/*!
+ * @brief This function moves the value in member id
+ * @param _id New value to be moved in member id
+ */
+void AMM::BoundedUUID::id(
+        eprosima::fastcdr::fixed_string<64>&& _id)
+{
+    m_id = std::move(_id);
+}
+
+/*!
+ * @brief This function returns a constant reference to member id
+ * @return Constant reference to member id
+ */
+const eprosima::fastcdr::fixed_string<64>& AMM::BoundedUUID::id() const
+{
+    return m_id;
+}
+
+/*!
+ * @brief This function returns a reference to member id
+ * @return Reference to member id
+ */
+eprosima::fastcdr::fixed_string<64>& AMM::BoundedUUID::id()
+{
+    return m_id;
+}
+
+AMM::BoundedPhysiologyValue::BoundedPhysiologyValue()
+{
+}
+
+AMM::BoundedPhysiologyValue::~BoundedPhysiologyValue()
+{
+}
+
+AMM::BoundedPhysiologyValue::BoundedPhysiologyValue(
+        const BoundedPhysiologyValue& x)
+{
+    m_educational_encounter = x.m_educational_encounter;
+    m_simulation_time = x.m_simulation_time;
+    m_timestamp = x.m_timestamp;
+    m_name = x.m_name;
+    m_unit = x.m_unit;
+    m_value = x.m_value;
+}
+
+AMM::BoundedPhysiologyValue::BoundedPhysiologyValue(
+        BoundedPhysiologyValue&& x) noexcept
+{
+    m_educational_encounter = std::move(x.m_educational_encounter);
+    m_simulation_time = x.m_simulation_time;
+    m_timestamp = x.m_timestamp;
+    m_name = std::move(x.m_name);
+    m_unit = std::move(x.m_unit);
+    m_value = x.m_value;
+}
+
+AMM::BoundedPhysiologyValue& AMM::BoundedPhysiologyValue::operator =(
+        const BoundedPhysiologyValue& x)
+{
+
+    m_educational_encounter = x.m_educational_encounter;
+    m_simulation_time = x.m_simulation_time;
+    m_timestamp = x.m_timestamp;
+    m_name = x.m_name;
+    m_unit = x.m_unit;
+    m_value = x.m_value;
+    return *this;
+}
+
+AMM::BoundedPhysiologyValue& AMM::BoundedPhysiologyValue::operator =(
+        BoundedPhysiologyValue&& x) noexcept
+{
+
+    m_educational_encounter = std::move(x.m_educational_encounter);
+    m_simulation_time = x.m_simulation_time;
+    m_timestamp = x.m_timestamp;
+    m_name = std::move(x.m_name);
+    m_unit = std::move(x.m_unit);
+    m_value = x.m_value;
+    return *this;
+}
+
+bool AMM::BoundedPhysiologyValue::operator ==(
+        const BoundedPhysiologyValue& x) const
+{
+    return (m_educational_encounter == x.m_educational_encounter &&
+           m_simulation_time == x.m_simulation_time &&
+           m_timestamp == x.m_timestamp &&
+           m_name == x.m_name &&
+           m_unit == x.m_unit &&
+           m_value == x.m_value);
+}
+
+bool AMM::BoundedPhysiologyValue::operator !=(
+        const BoundedPhysiologyValue& x) const
+{
+    return !(*this == x);
+}
+
+/*!
+ * @brief This function copies the value in member educational_encounter
+ * @param _educational_encounter New value to be copied in member educational_encounter
+ */
+void AMM::BoundedPhysiologyValue::educational_encounter(
+        const AMM::BoundedUUID& _educational_encounter)
+{
+    m_educational_encounter = _educational_encounter;
+}
+
+/*!
+ * @brief This function moves the value in member educational_encounter
+ * @param _educational_encounter New value to be moved in member educational_encounter
+ */
+void AMM::BoundedPhysiologyValue::educational_encounter(
+        AMM::BoundedUUID&& _educational_encounter)
+{
+    m_educational_encounter = std::move(_educational_encounter);
+}
+
+/*!
+ * @brief This function returns a constant reference to member educational_encounter
+ * @return Constant reference to member educational_encounter
+ */
+const AMM::BoundedUUID& AMM::BoundedPhysiologyValue::educational_encounter() const
+{
+    return m_educational_encounter;
+}
+
+/*!
+ * @brief This function returns a reference to member educational_encounter
+ * @return Reference to member educational_encounter
+ */
+AMM::BoundedUUID& AMM::BoundedPhysiologyValue::educational_encounter()
+{
+    return m_educational_encounter;
+}
+
+
+/*!
+ * @brief This function sets a value in member simulation_time
+ * @param _simulation_time New value for member simulation_time
+ */
+void AMM::BoundedPhysiologyValue::simulation_time(
+        int64_t _simulation_time)
+{
+    m_simulation_time = _simulation_time;
+}
+
+/*!
+ * @brief This function returns the value of member simulation_time
+ * @return Value of member simulation_time
+ */
+int64_t AMM::BoundedPhysiologyValue::simulation_time() const
+{
+    return m_simulation_time;
+}
+
+/*!
+ * @brief This function returns a reference to member simulation_time
+ * @return Reference to member simulation_time
+ */
+int64_t& AMM::BoundedPhysiologyValue::simulation_time()
+{
+    return m_simulation_time;
+}
+
+
+/*!
+ * @brief This function sets a value in member timestamp
+ * @param _timestamp New value for member timestamp
+ */
+void AMM::BoundedPhysiologyValue::timestamp(
+        uint64_t _timestamp)
+{
+    m_timestamp = _timestamp;
+}
+
+/*!
+ * @brief This function returns the value of member timestamp
+ * @return Value of member timestamp
+ */
+uint64_t AMM::BoundedPhysiologyValue::timestamp() const
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function returns a reference to member timestamp
+ * @return Reference to member timestamp
+ */
+uint64_t& AMM::BoundedPhysiologyValue::timestamp()
+{
+    return m_timestamp;
+}
+
+
+/*!
+ * @brief This function copies the value in member name
+ * @param _name New value to be copied in member name
+ */
+void AMM::BoundedPhysiologyValue::name(
+        const eprosima::fastcdr::fixed_string<128>& _name)
+{
+    m_name = _name;
+}
+
+/*!
+ * @brief This function moves the value in member name
+ * @param _name New value to be moved in member name
+ */
+void AMM::BoundedPhysiologyValue::name(
+        eprosima::fastcdr::fixed_string<128>&& _name)
+{
+    m_name = std::move(_name);
+}
+
+/*!
+ * @brief This function returns a constant reference to member name
+ * @return Constant reference to member name
+ */
+const eprosima::fastcdr::fixed_string<128>& AMM::BoundedPhysiologyValue::name() const
+{
+    return m_name;
+}
+
+/*!
+ * @brief This function returns a reference to member name
+ * @return Reference to member name
+ */
+eprosima::fastcdr::fixed_string<128>& AMM::BoundedPhysiologyValue::name()
+{
+    return m_name;
+}
+
+
+/*!
+ * @brief This function copies the value in member unit
+ * @param _unit New value to be copied in member unit
+ */
+void AMM::BoundedPhysiologyValue::unit(
+        const eprosima::fastcdr::fixed_string<32>& _unit)
+{
+    m_unit = _unit;
+}
+
+/*!
+ * @brief This function moves the value in member unit
+ * @param _unit New value to be moved in member unit
+ */
+void AMM::BoundedPhysiologyValue::unit(
+        eprosima::fastcdr::fixed_string<32>&& _unit)
+{
+    m_unit = std::move(_unit);
+}
+
+/*!
+ * @brief This function returns a constant reference to member unit
+ * @return Constant reference to member unit
+ */
+const eprosima::fastcdr::fixed_string<32>& AMM::BoundedPhysiologyValue::unit() const
+{
+    return m_unit;
+}
+
+/*!
+ * @brief This function returns a reference to member unit
+ * @return Reference to member unit
+ */
+eprosima::fastcdr::fixed_string<32>& AMM::BoundedPhysiologyValue::unit()
+{
+    return m_unit;
+}
+
+
+/*!
+ * @brief This function sets a value in member value
+ * @param _value New value for member value
+ */
+void AMM::BoundedPhysiologyValue::value(
+        double _value)
+{
+    m_value = _value;
+}
+
+/*!
+ * @brief This function returns the value of member value
+ * @return Value of member value
+ */
+double AMM::BoundedPhysiologyValue::value() const
+{
+    return m_value;
+}
+
+/*!
+ * @brief This function returns a reference to member value
+ * @return Reference to member value
+ */
+double& AMM::BoundedPhysiologyValue::value()
+{
+    return m_value;
+}
+
+AMM::BoundedPhysiologyWaveform::BoundedPhysiologyWaveform()
+{
+}
+
+AMM::BoundedPhysiologyWaveform::~BoundedPhysiologyWaveform()
+{
+}
+
+AMM::BoundedPhysiologyWaveform::BoundedPhysiologyWaveform(
+        const BoundedPhysiologyWaveform& x)
+{
+    m_educational_encounter = x.m_educational_encounter;
+    m_simulation_time = x.m_simulation_time;
+    m_timestamp = x.m_timestamp;
+    m_name = x.m_name;
+    m_unit = x.m_unit;
+    m_value = x.m_value;
+}
+
+AMM::BoundedPhysiologyWaveform::BoundedPhysiologyWaveform(
+        BoundedPhysiologyWaveform&& x) noexcept
+{
+    m_educational_encounter = std::move(x.m_educational_encounter);
+    m_simulation_time = x.m_simulation_time;
+    m_timestamp = x.m_timestamp;
+    m_name = std::move(x.m_name);
+    m_unit = std::move(x.m_unit);
+    m_value = x.m_value;
+}
+
+AMM::BoundedPhysiologyWaveform& AMM::BoundedPhysiologyWaveform::operator =(
+        const BoundedPhysiologyWaveform& x)
+{
+
+    m_educational_encounter = x.m_educational_encounter;
+    m_simulation_time = x.m_simulation_time;
+    m_timestamp = x.m_timestamp;
+    m_name = x.m_name;
+    m_unit = x.m_unit;
+    m_value = x.m_value;
+    return *this;
+}
+
+AMM::BoundedPhysiologyWaveform& AMM::BoundedPhysiologyWaveform::operator =(
+        BoundedPhysiologyWaveform&& x) noexcept
+{
+
+    m_educational_encounter = std::move(x.m_educational_encounter);
+    m_simulation_time = x.m_simulation_time;
+    m_timestamp = x.m_timestamp;
+    m_name = std::move(x.m_name);
+    m_unit = std::move(x.m_unit);
+    m_value = x.m_value;
+    return *this;
+}
+
+bool AMM::BoundedPhysiologyWaveform::operator ==(
+        const BoundedPhysiologyWaveform& x) const
+{
+    return (m_educational_encounter == x.m_educational_encounter &&
+           m_simulation_time == x.m_simulation_time &&
+           m_timestamp == x.m_timestamp &&
+           m_name == x.m_name &&
+           m_unit == x.m_unit &&
+           m_value == x.m_value);
+}
+
+bool AMM::BoundedPhysiologyWaveform::operator !=(
+        const BoundedPhysiologyWaveform& x) const
+{
+    return !(*this == x);
+}
+
+/*!
+ * @brief This function copies the value in member educational_encounter
+ * @param _educational_encounter New value to be copied in member educational_encounter
+ */
+void AMM::BoundedPhysiologyWaveform::educational_encounter(
+        const AMM::BoundedUUID& _educational_encounter)
+{
+    m_educational_encounter = _educational_encounter;
+}
+
+/*!
+ * @brief This function moves the value in member educational_encounter
+ * @param _educational_encounter New value to be moved in member educational_encounter
+ */
+void AMM::BoundedPhysiologyWaveform::educational_encounter(
+        AMM::BoundedUUID&& _educational_encounter)
+{
+    m_educational_encounter = std::move(_educational_encounter);
+}
+
+/*!
+ * @brief This function returns a constant reference to member educational_encounter
+ * @return Constant reference to member educational_encounter
+ */
+const AMM::BoundedUUID& AMM::BoundedPhysiologyWaveform::educational_encounter() const
+{
+    return m_educational_encounter;
+}
+
+/*!
+ * @brief This function returns a reference to member educational_encounter
+ * @return Reference to member educational_encounter
+ */
+AMM::BoundedUUID& AMM::BoundedPhysiologyWaveform::educational_encounter()
+{
+    return m_educational_encounter;
+}
+
+
+/*!
+ * @brief This function sets a value in member simulation_time
+ * @param _simulation_time New value for member simulation_time
+ */
+void AMM::BoundedPhysiologyWaveform::simulation_time(
+        int64_t _simulation_time)
+{
+    m_simulation_time = _simulation_time;
+}
+
+/*!
+ * @brief This function returns the value of member simulation_time
+ * @return Value of member simulation_time
+ */
+int64_t AMM::BoundedPhysiologyWaveform::simulation_time() const
+{
+    return m_simulation_time;
+}
+
+/*!
+ * @brief This function returns a reference to member simulation_time
+ * @return Reference to member simulation_time
+ */
+int64_t& AMM::BoundedPhysiologyWaveform::simulation_time()
+{
+    return m_simulation_time;
+}
+
+
+/*!
+ * @brief This function sets a value in member timestamp
+ * @param _timestamp New value for member timestamp
+ */
+void AMM::BoundedPhysiologyWaveform::timestamp(
+        uint64_t _timestamp)
+{
+    m_timestamp = _timestamp;
+}
+
+/*!
+ * @brief This function returns the value of member timestamp
+ * @return Value of member timestamp
+ */
+uint64_t AMM::BoundedPhysiologyWaveform::timestamp() const
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function returns a reference to member timestamp
+ * @return Reference to member timestamp
+ */
+uint64_t& AMM::BoundedPhysiologyWaveform::timestamp()
+{
+    return m_timestamp;
+}
+
+
+/*!
+ * @brief This function copies the value in member name
+ * @param _name New value to be copied in member name
+ */
+void AMM::BoundedPhysiologyWaveform::name(
+        const eprosima::fastcdr::fixed_string<128>& _name)
+{
+    m_name = _name;
+}
+
+/*!
+ * @brief This function moves the value in member name
+ * @param _name New value to be moved in member name
+ */
+void AMM::BoundedPhysiologyWaveform::name(
+        eprosima::fastcdr::fixed_string<128>&& _name)
+{
+    m_name = std::move(_name);
+}
+
+/*!
+ * @brief This function returns a constant reference to member name
+ * @return Constant reference to member name
+ */
+const eprosima::fastcdr::fixed_string<128>& AMM::BoundedPhysiologyWaveform::name() const
+{
+    return m_name;
+}
+
+/*!
+ * @brief This function returns a reference to member name
+ * @return Reference to member name
+ */
+eprosima::fastcdr::fixed_string<128>& AMM::BoundedPhysiologyWaveform::name()
+{
+    return m_name;
+}
+
+
+/*!
+ * @brief This function copies the value in member unit
+ * @param _unit New value to be copied in member unit
+ */
+void AMM::BoundedPhysiologyWaveform::unit(
+        const eprosima::fastcdr::fixed_string<32>& _unit)
+{
+    m_unit = _unit;
+}
+
+/*!
+ * @brief This function moves the value in member unit
+ * @param _unit New value to be moved in member unit
+ */
+void AMM::BoundedPhysiologyWaveform::unit(
+        eprosima::fastcdr::fixed_string<32>&& _unit)
+{
+    m_unit = std::move(_unit);
+}
+
+/*!
+ * @brief This function returns a constant reference to member unit
+ * @return Constant reference to member unit
+ */
+const eprosima::fastcdr::fixed_string<32>& AMM::BoundedPhysiologyWaveform::unit() const
+{
+    return m_unit;
+}
+
+/*!
+ * @brief This function returns a reference to member unit
+ * @return Reference to member unit
+ */
+eprosima::fastcdr::fixed_string<32>& AMM::BoundedPhysiologyWaveform::unit()
+{
+    return m_unit;
+}
+
+
+/*!
+ * @brief This function sets a value in member value
+ * @param _value New value for member value
+ */
+void AMM::BoundedPhysiologyWaveform::value(
+        double _value)
+{
+    m_value = _value;
+}
+
+/*!
+ * @brief This function returns the value of member value
+ * @return Value of member value
+ */
+double AMM::BoundedPhysiologyWaveform::value() const
+{
+    return m_value;
+}
+
+/*!
+ * @brief This function returns a reference to member value
+ * @return Reference to member value
+ */
+double& AMM::BoundedPhysiologyWaveform::value()
+{
+    return m_value;
+}
+
+AMM::BoundedLog::BoundedLog()
+{
+}
+
+AMM::BoundedLog::~BoundedLog()
+{
+}
+
+AMM::BoundedLog::BoundedLog(
+        const BoundedLog& x)
+{
+    m_timestamp = x.m_timestamp;
+    m_module_id = x.m_module_id;
+    m_level = x.m_level;
+    m_message = x.m_message;
+}
+
+AMM::BoundedLog::BoundedLog(
+        BoundedLog&& x) noexcept
+{
+    m_timestamp = x.m_timestamp;
+    m_module_id = std::move(x.m_module_id);
+    m_level = x.m_level;
+    m_message = std::move(x.m_message);
+}
+
+AMM::BoundedLog& AMM::BoundedLog::operator =(
+        const BoundedLog& x)
+{
+
+    m_timestamp = x.m_timestamp;
+    m_module_id = x.m_module_id;
+    m_level = x.m_level;
+    m_message = x.m_message;
+    return *this;
+}
+
+AMM::BoundedLog& AMM::BoundedLog::operator =(
+        BoundedLog&& x) noexcept
+{
+
+    m_timestamp = x.m_timestamp;
+    m_module_id = std::move(x.m_module_id);
+    m_level = x.m_level;
+    m_message = std::move(x.m_message);
+    return *this;
+}
+
+bool AMM::BoundedLog::operator ==(
+        const BoundedLog& x) const
+{
+    return (m_timestamp == x.m_timestamp &&
+           m_module_id == x.m_module_id &&
+           m_level == x.m_level &&
+           m_message == x.m_message);
+}
+
+bool AMM::BoundedLog::operator !=(
+        const BoundedLog& x) const
+{
+    return !(*this == x);
+}
+
+/*!
+ * @brief This function sets a value in member timestamp
+ * @param _timestamp New value for member timestamp
+ */
+void AMM::BoundedLog::timestamp(
+        uint64_t _timestamp)
+{
+    m_timestamp = _timestamp;
+}
+
+/*!
+ * @brief This function returns the value of member timestamp
+ * @return Value of member timestamp
+ */
+uint64_t AMM::BoundedLog::timestamp() const
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function returns a reference to member timestamp
+ * @return Reference to member timestamp
+ */
+uint64_t& AMM::BoundedLog::timestamp()
+{
+    return m_timestamp;
+}
+
+
+/*!
+ * @brief This function copies the value in member module_id
+ * @param _module_id New value to be copied in member module_id
+ */
+void AMM::BoundedLog::module_id(
+        const AMM::BoundedUUID& _module_id)
+{
+    m_module_id = _module_id;
+}
+
+/*!
+ * @brief This function moves the value in member module_id
+ * @param _module_id New value to be moved in member module_id
+ */
+void AMM::BoundedLog::module_id(
+        AMM::BoundedUUID&& _module_id)
+{
+    m_module_id = std::move(_module_id);
+}
+
+/*!
+ * @brief This function returns a constant reference to member module_id
+ * @return Constant reference to member module_id
+ */
+const AMM::BoundedUUID& AMM::BoundedLog::module_id() const
+{
+    return m_module_id;
+}
+
+/*!
+ * @brief This function returns a reference to member module_id
+ * @return Reference to member module_id
+ */
+AMM::BoundedUUID& AMM::BoundedLog::module_id()
+{
+    return m_module_id;
+}
+
+
+/*!
+ * @brief This function sets a value in member level
+ * @param _level New value for member level
+ */
+void AMM::BoundedLog::level(
+        AMM::LogLevel _level)
+{
+    m_level = _level;
+}
+
+/*!
+ * @brief This function returns the value of member level
+ * @return Value of member level
+ */
+AMM::LogLevel AMM::BoundedLog::level() const
+{
+    return m_level;
+}
+
+/*!
+ * @brief This function returns a reference to member level
+ * @return Reference to member level
+ */
+AMM::LogLevel& AMM::BoundedLog::level()
+{
+    return m_level;
+}
+
+
+/*!
+ * @brief This function copies the value in member message
+ * @param _message New value to be copied in member message
+ */
+void AMM::BoundedLog::message(
+        const eprosima::fastcdr::fixed_string<1024>& _message)
+{
+    m_message = _message;
+}
+
+/*!
+ * @brief This function moves the value in member message
+ * @param _message New value to be moved in member message
+ */
+void AMM::BoundedLog::message(
+        eprosima::fastcdr::fixed_string<1024>&& _message)
+{
+    m_message = std::move(_message);
+}
+
+/*!
+ * @brief This function returns a constant reference to member message
+ * @return Constant reference to member message
+ */
+const eprosima::fastcdr::fixed_string<1024>& AMM::BoundedLog::message() const
+{
+    return m_message;
+}
+
+/*!
+ * @brief This function returns a reference to member message
+ * @return Reference to member message
+ */
+eprosima::fastcdr::fixed_string<1024>& AMM::BoundedLog::message()
+{
+    return m_message;
+}
+
+AMM::BoundedStatus::BoundedStatus()
+{
+}
+
+AMM::BoundedStatus::~BoundedStatus()
+{
+}
+
+AMM::BoundedStatus::BoundedStatus(
+        const BoundedStatus& x)
+{
+    m_module_id = x.m_module_id;
+    m_module_name = x.m_module_name;
+    m_educational_encounter = x.m_educational_encounter;
+    m_capability = x.m_capability;
+    m_timestamp = x.m_timestamp;
+    m_value = x.m_value;
+    m_message = x.m_message;
+}
+
+AMM::BoundedStatus::BoundedStatus(
+        BoundedStatus&& x) noexcept
+{
+    m_module_id = std::move(x.m_module_id);
+    m_module_name = std::move(x.m_module_name);
+    m_educational_encounter = std::move(x.m_educational_encounter);
+    m_capability = std::move(x.m_capability);
+    m_timestamp = x.m_timestamp;
+    m_value = x.m_value;
+    m_message = std::move(x.m_message);
+}
+
+AMM::BoundedStatus& AMM::BoundedStatus::operator =(
+        const BoundedStatus& x)
+{
+
+    m_module_id = x.m_module_id;
+    m_module_name = x.m_module_name;
+    m_educational_encounter = x.m_educational_encounter;
+    m_capability = x.m_capability;
+    m_timestamp = x.m_timestamp;
+    m_value = x.m_value;
+    m_message = x.m_message;
+    return *this;
+}
+
+AMM::BoundedStatus& AMM::BoundedStatus::operator =(
+        BoundedStatus&& x) noexcept
+{
+
+    m_module_id = std::move(x.m_module_id);
+    m_module_name = std::move(x.m_module_name);
+    m_educational_encounter = std::move(x.m_educational_encounter);
+    m_capability = std::move(x.m_capability);
+    m_timestamp = x.m_timestamp;
+    m_value = x.m_value;
+    m_message = std::move(x.m_message);
+    return *this;
+}
+
+bool AMM::BoundedStatus::operator ==(
+        const BoundedStatus& x) const
+{
+    return (m_module_id == x.m_module_id &&
+           m_module_name == x.m_module_name &&
+           m_educational_encounter == x.m_educational_encounter &&
+           m_capability == x.m_capability &&
+           m_timestamp == x.m_timestamp &&
+           m_value == x.m_value &&
+           m_message == x.m_message);
+}
+
+bool AMM::BoundedStatus::operator !=(
+        const BoundedStatus& x) const
+{
+    return !(*this == x);
+}
+
+/*!
+ * @brief This function copies the value in member module_id
+ * @param _module_id New value to be copied in member module_id
+ */
+void AMM::BoundedStatus::module_id(
+        const AMM::BoundedUUID& _module_id)
+{
+    m_module_id = _module_id;
+}
+
+/*!
+ * @brief This function moves the value in member module_id
+ * @param _module_id New value to be moved in member module_id
+ */
+void AMM::BoundedStatus::module_id(
+        AMM::BoundedUUID&& _module_id)
+{
+    m_module_id = std::move(_module_id);
+}
+
+/*!
+ * @brief This function returns a constant reference to member module_id
+ * @return Constant reference to member module_id
+ */
+const AMM::BoundedUUID& AMM::BoundedStatus::module_id() const
+{
+    return m_module_id;
+}
+
+/*!
+ * @brief This function returns a reference to member module_id
+ * @return Reference to member module_id
+ */
+AMM::BoundedUUID& AMM::BoundedStatus::module_id()
+{
+    return m_module_id;
+}
+
+
+/*!
+ * @brief This function copies the value in member module_name
+ * @param _module_name New value to be copied in member module_name
+ */
+void AMM::BoundedStatus::module_name(
+        const eprosima::fastcdr::fixed_string<128>& _module_name)
+{
+    m_module_name = _module_name;
+}
+
+/*!
+ * @brief This function moves the value in member module_name
+ * @param _module_name New value to be moved in member module_name
+ */
+void AMM::BoundedStatus::module_name(
+        eprosima::fastcdr::fixed_string<128>&& _module_name)
+{
+    m_module_name = std::move(_module_name);
+}
+
+/*!
+ * @brief This function returns a constant reference to member module_name
+ * @return Constant reference to member module_name
+ */
+const eprosima::fastcdr::fixed_string<128>& AMM::BoundedStatus::module_name() const
+{
+    return m_module_name;
+}
+
+/*!
+ * @brief This function returns a reference to member module_name
+ * @return Reference to member module_name
+ */
+eprosima::fastcdr::fixed_string<128>& AMM::BoundedStatus::module_name()
+{
+    return m_module_name;
+}
+
+
+/*!
+ * @brief This function copies the value in member educational_encounter
+ * @param _educational_encounter New value to be copied in member educational_encounter
+ */
+void AMM::BoundedStatus::educational_encounter(
+        const AMM::BoundedUUID& _educational_encounter)
+{
+    m_educational_encounter = _educational_encounter;
+}
+
+/*!
+ * @brief This function moves the value in member educational_encounter
+ * @param _educational_encounter New value to be moved in member educational_encounter
+ */
+void AMM::BoundedStatus::educational_encounter(
+        AMM::BoundedUUID&& _educational_encounter)
+{
+    m_educational_encounter = std::move(_educational_encounter);
+}
+
+/*!
+ * @brief This function returns a constant reference to member educational_encounter
+ * @return Constant reference to member educational_encounter
+ */
+const AMM::BoundedUUID& AMM::BoundedStatus::educational_encounter() const
+{
+    return m_educational_encounter;
+}
+
+/*!
+ * @brief This function returns a reference to member educational_encounter
+ * @return Reference to member educational_encounter
+ */
+AMM::BoundedUUID& AMM::BoundedStatus::educational_encounter()
+{
+    return m_educational_encounter;
+}
+
+
+/*!
+ * @brief This function copies the value in member capability
+ * @param _capability New value to be copied in member capability
+ */
+void AMM::BoundedStatus::capability(
+        const eprosima::fastcdr::fixed_string<128>& _capability)
+{
+    m_capability = _capability;
+}
+
+/*!
+ * @brief This function moves the value in member capability
+ * @param _capability New value to be moved in member capability
+ */
+void AMM::BoundedStatus::capability(
+        eprosima::fastcdr::fixed_string<128>&& _capability)
+{
+    m_capability = std::move(_capability);
+}
+
+/*!
+ * @brief This function returns a constant reference to member capability
+ * @return Constant reference to member capability
+ */
+const eprosima::fastcdr::fixed_string<128>& AMM::BoundedStatus::capability() const
+{
+    return m_capability;
+}
+
+/*!
+ * @brief This function returns a reference to member capability
+ * @return Reference to member capability
+ */
+eprosima::fastcdr::fixed_string<128>& AMM::BoundedStatus::capability()
+{
+    return m_capability;
+}
+
+
+/*!
+ * @brief This function sets a value in member timestamp
+ * @param _timestamp New value for member timestamp
+ */
+void AMM::BoundedStatus::timestamp(
+        uint64_t _timestamp)
+{
+    m_timestamp = _timestamp;
+}
+
+/*!
+ * @brief This function returns the value of member timestamp
+ * @return Value of member timestamp
+ */
+uint64_t AMM::BoundedStatus::timestamp() const
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function returns a reference to member timestamp
+ * @return Reference to member timestamp
+ */
+uint64_t& AMM::BoundedStatus::timestamp()
+{
+    return m_timestamp;
+}
+
+
+/*!
+ * @brief This function sets a value in member value
+ * @param _value New value for member value
+ */
+void AMM::BoundedStatus::value(
+        AMM::StatusValue _value)
+{
+    m_value = _value;
+}
+
+/*!
+ * @brief This function returns the value of member value
+ * @return Value of member value
+ */
+AMM::StatusValue AMM::BoundedStatus::value() const
+{
+    return m_value;
+}
+
+/*!
+ * @brief This function returns a reference to member value
+ * @return Reference to member value
+ */
+AMM::StatusValue& AMM::BoundedStatus::value()
+{
+    return m_value;
+}
+
+
+/*!
+ * @brief This function copies the value in member message
+ * @param _message New value to be copied in member message
+ */
+void AMM::BoundedStatus::message(
+        const eprosima::fastcdr::fixed_string<1024>& _message)
+{
+    m_message = _message;
+}
+
+/*!
+ * @brief This function moves the value in member message
+ * @param _message New value to be moved in member message
+ */
+void AMM::BoundedStatus::message(
+        eprosima::fastcdr::fixed_string<1024>&& _message)
+{
+    m_message = std::move(_message);
+}
+
+/*!
+ * @brief This function returns a constant reference to member message
+ * @return Constant reference to member message
+ */
+const eprosima::fastcdr::fixed_string<1024>& AMM::BoundedStatus::message() const
+{
+    return m_message;
+}
+
+/*!
+ * @brief This function returns a reference to member message
+ * @return Reference to member message
+ */
+eprosima::fastcdr::fixed_string<1024>& AMM::BoundedStatus::message()
+{
+    return m_message;
+}
+
+AMM::BoundedCommand::BoundedCommand()
+{
+
+}
+
+AMM::BoundedCommand::~BoundedCommand()
+{
+}
+
+AMM::BoundedCommand::BoundedCommand(
+        const BoundedCommand& x)
+{
+    m_message = x.m_message;
+}
+
+AMM::BoundedCommand::BoundedCommand(
+        BoundedCommand&& x) noexcept
+{
+    m_message = std::move(x.m_message);
+}
+
+AMM::BoundedCommand& AMM::BoundedCommand::operator =(
+        const BoundedCommand& x)
+{
+
+    m_message = x.m_message;
+
+    return *this;
+}
+
+AMM::BoundedCommand& AMM::BoundedCommand::operator =(
+        BoundedCommand&& x) noexcept
+{
+
+    m_message = std::move(x.m_message);
+
+    return *this;
+}
+
+bool AMM::BoundedCommand::operator ==(
+        const BoundedCommand& x) const
+{
+    return (m_message == x.m_message);
+}
+
+bool AMM::BoundedCommand::operator !=(
+        const BoundedCommand& x) const
+{
+    return !(*this == x);
+}
+
+/*!
+ * @brief This function copies the value in member message
+ * @param _message New value to be copied in member message
+ */
+void AMM::BoundedCommand::message(
+        const eprosima::fastcdr::fixed_string<1024>& _message)
+{
+    m_message = _message;
+}
+
+/*!
+ * @brief This function moves the value in member message
+ * @param _message New value to be moved in member message
+ */
+void AMM::BoundedCommand::message(
+        eprosima::fastcdr::fixed_string<1024>&& _message)
+{
+    m_message = std::move(_message);
+}
+
+/*!
+ * @brief This function returns a constant reference to member message
+ * @return Constant reference to member message
+ */
+const eprosima::fastcdr::fixed_string<1024>& AMM::BoundedCommand::message() const
+{
+    return m_message;
+}
+
+/*!
+ * @brief This function returns a reference to member message
+ * @return Reference to member message
+ */
+eprosima::fastcdr::fixed_string<1024>& AMM::BoundedCommand::message()
+{
+    return m_message;
+}
+// End of the Bounded types.
+
+
 
 // Include auxiliary functions like for serializing/deserializing.
 #include "AMM_ExtendedCdrAux.ipp"
@@ -32,6 +32,8 @@
 #include <fastcdr/cdr/fixed_size_string.hpp>
 #include <fastcdr/xcdr/optional.hpp>
 
+#include "AMM_Standard.h"
+
 
 
 #if defined(_WIN32)
@@ -383,6 +385,1381 @@ namespace AMM {
         std::string m_message;
 
     };
+    /*!
+     * @brief This class represents the structure CompactUUID defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class CompactUUID
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport CompactUUID();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~CompactUUID();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object AMM::CompactUUID that will be copied.
+         */
+        eProsima_user_DllExport CompactUUID(
+                const CompactUUID& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object AMM::CompactUUID that will be copied.
+         */
+        eProsima_user_DllExport CompactUUID(
+                CompactUUID&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object AMM::CompactUUID that will be copied.
+         */
+        eProsima_user_DllExport CompactUUID& operator =(
+                const CompactUUID& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object AMM::CompactUUID that will be copied.
+         */
+        eProsima_user_DllExport CompactUUID& operator =(
+                CompactUUID&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::CompactUUID object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const CompactUUID& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::CompactUUID object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const CompactUUID& x) const;
+
+        /*!
+         * @brief This function copies the value in member id
+         * @param _id New value to be copied in member id
+         */
+        eProsima_user_DllExport void id(
+                const std::array<uint8_t, 16>& _id);
+
+        /*!
+         * @brief This function moves the value in member id
+         * @param _id New value to be moved in member id
+         */
+        eProsima_user_DllExport void id(
+                std::array<uint8_t, 16>&& _id);
+
+        /*!
+         * @brief This function returns a constant reference to member id
+         * @return Constant reference to member id
+         */
+        eProsima_user_DllExport const std::array<uint8_t, 16>& id() const;
+
+        /*!
+         * @brief This function returns a reference to member id
+         * @return Reference to member id
+         */
+        eProsima_user_DllExport std::array<uint8_t, 16>& id();
+
+    private:
+
+        std::array<uint8_t, 16> m_id{0};
+
+    };
+    /*!
+     * @brief This class represents the structure PhysiologyFrameEntry defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class PhysiologyFrameEntry
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport PhysiologyFrameEntry();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~PhysiologyFrameEntry();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object AMM::PhysiologyFrameEntry that will be copied.
+         */
+        eProsima_user_DllExport PhysiologyFrameEntry(
+                const PhysiologyFrameEntry& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object AMM::PhysiologyFrameEntry that will be copied.
+         */
+        eProsima_user_DllExport PhysiologyFrameEntry(
+                PhysiologyFrameEntry&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object AMM::PhysiologyFrameEntry that will be copied.
+         */
+        eProsima_user_DllExport PhysiologyFrameEntry& operator =(
+                const PhysiologyFrameEntry& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object AMM::PhysiologyFrameEntry that will be copied.
+         */
+        eProsima_user_DllExport PhysiologyFrameEntry& operator =(
+                PhysiologyFrameEntry&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::PhysiologyFrameEntry object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const PhysiologyFrameEntry& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::PhysiologyFrameEntry object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const PhysiologyFrameEntry& x) const;
+
+        /*!
+         * @brief This function copies the value in member name
+         * @param _name New value to be copied in member name
+         */
+        eProsima_user_DllExport void name(
+                const std::string& _name);
+
+        /*!
+         * @brief This function moves the value in member name
+         * @param _name New value to be moved in member name
+         */
+        eProsima_user_DllExport void name(
+                std::string&& _name);
+
+        /*!
+         * @brief This function returns a constant reference to member name
+         * @return Constant reference to member name
+         */
+        eProsima_user_DllExport const std::string& name() const;
+
+        /*!
+         * @brief This function returns a reference to member name
+         * @return Reference to member name
+         */
+        eProsima_user_DllExport std::string& name();
+
+
+        /*!
+         * @brief This function sets a value in member value
+         * @param _value New value for member value
+         */
+        eProsima_user_DllExport void value(
+                double _value);
+
+        /*!
+         * @brief This function returns the value of member value
+         * @return Value of member value
+         */
+        eProsima_user_DllExport double value() const;
+
+        /*!
+         * @brief This function returns a reference to member value
+         * @return Reference to member value
+         */
+        eProsima_user_DllExport double& value();
+
+    private:
+
+        std::string m_name;
+        double m_value{0.0};
+
+    };
+    /*!
+     * @brief This class represents the structure PhysiologyFrame defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class PhysiologyFrame
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport PhysiologyFrame();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~PhysiologyFrame();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object AMM::PhysiologyFrame that will be copied.
+         */
+        eProsima_user_DllExport PhysiologyFrame(
+                const PhysiologyFrame& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object AMM::PhysiologyFrame that will be copied.
+         */
+        eProsima_user_DllExport PhysiologyFrame(
+                PhysiologyFrame&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object AMM::PhysiologyFrame that will be copied.
+         */
+        eProsima_user_DllExport PhysiologyFrame& operator =(
+                const PhysiologyFrame& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object AMM::PhysiologyFrame that will be copied.
+         */
+        eProsima_user_DllExport PhysiologyFrame& operator =(
+                PhysiologyFrame&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::PhysiologyFrame object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const PhysiologyFrame& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::PhysiologyFrame object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const PhysiologyFrame& x) const;
+
+        /*!
+         * @brief This function copies the value in member educational_encounter
+         * @param _educational_encounter New value to be copied in member educational_encounter
+         */
+        eProsima_user_DllExport void educational_encounter(
+                const AMM::UUID& _educational_encounter);
+
+        /*!
+         * @brief This function moves the value in member educational_encounter
+         * @param _educational_encounter New value to be moved in member educational_encounter
+         */
+        eProsima_user_DllExport void educational_encounter(
+                AMM::UUID&& _educational_encounter);
+
+        /*!
+         * @brief This function returns a constant reference to member educational_encounter
+         * @return Constant reference to member educational_encounter
+         */
+        eProsima_user_DllExport const AMM::UUID& educational_encounter() const;
+
+        /*!
+         * @brief This function returns a reference to member educational_encounter
+         * @return Reference to member educational_encounter
+         */
+        eProsima_user_DllExport AMM::UUID& educational_encounter();
+
+
+        /*!
+         * @brief This function sets a value in member simulation_time
+         * @param _simulation_time New value for member simulation_time
+         */
+        eProsima_user_DllExport void simulation_time(
+                int64_t _simulation_time);
+
+        /*!
+         * @brief This function returns the value of member simulation_time
+         * @return Value of member simulation_time
+         */
+        eProsima_user_DllExport int64_t simulation_time() const;
+
+        /*!
+         * @brief This function returns a reference to member simulation_time
+         * @return Reference to member simulation_time
+         */
+        eProsima_user_DllExport int64_t& simulation_time();
+
+
+        /*!
+         * @brief This function sets a value in member timestamp
+         * @param _timestamp New value for member timestamp
+         */
+        eProsima_user_DllExport void timestamp(
+                uint64_t _timestamp);
+
+        /*!
+         * @brief This function returns the value of member timestamp
+         * @return Value of member timestamp
+         */
+        eProsima_user_DllExport uint64_t timestamp() const;
+
+        /*!
+         * @brief This function returns a reference to member timestamp
+         * @return Reference to member timestamp
+         */
+        eProsima_user_DllExport uint64_t& timestamp();
+
+
+        /*!
+         * @brief This function copies the value in member values
+         * @param _values New value to be copied in member values
+         */
+        eProsima_user_DllExport void values(
+                const std::vector<AMM::PhysiologyFrameEntry>& _values);
+
+        /*!
+         * @brief This function moves the value in member values
+         * @param _values New value to be moved in member values
+         */
+        eProsima_user_DllExport void values(
+                std::vector<AMM::PhysiologyFrameEntry>&& _values);
+
+        /*!
+         * @brief This function returns a constant reference to member values
+         * @return Constant reference to member values
+         */
+        eProsima_user_DllExport const std::vector<AMM::PhysiologyFrameEntry>& values() const;
+
+        /*!
+         * @brief This function returns a reference to member values
+         * @return Reference to member values
+         */
+        eProsima_user_DllExport std::vector<AMM::PhysiologyFrameEntry>& values();
+
+    private:
+
+        AMM::UUID m_educational_encounter;
+        int64_t m_simulation_time{0};
+        uint64_t m_timestamp{0};
+        std::vector<AMM::PhysiologyFrameEntry> m_values;
+
+    };
+
+// Begin of the Bounded types, generated by IDL/gen_bounded.py from their unbounded originals.
+    /*!
+     * @brief This class represents the structure BoundedUUID defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class BoundedUUID
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport BoundedUUID();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~BoundedUUID();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object AMM::BoundedUUID that will be copied.
+         */
+        eProsima_user_DllExport BoundedUUID(
+                const BoundedUUID& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object AMM::BoundedUUID that will be copied.
+         */
+        eProsima_user_DllExport BoundedUUID(
+                BoundedUUID&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object AMM::BoundedUUID that will be copied.
+         */
+        eProsima_user_DllExport BoundedUUID& operator =(
+                const BoundedUUID& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object AMM::BoundedUUID that will be copied.
+         */
+        eProsima_user_DllExport BoundedUUID& operator =(
+                BoundedUUID&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::BoundedUUID object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const BoundedUUID& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::BoundedUUID object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const BoundedUUID& x) const;
+
+        /*!
+         * @brief This function copies the value in member id
+         * @param _id New value to be copied in member id
+         */
+        eProsima_user_DllExport void id(
+                const eprosima::fastcdr::fixed_string<64>& _id);
+
+        /*!
+         * @brief This function moves the value in member id
+         * @param _id New value to be moved in member id
+         */
+        eProsima_user_DllExport void id(
+                eprosima::fastcdr::fixed_string<64>&& _id);
+
+        /*!
+         * @brief This function returns a constant reference to member id
+         * @return Constant reference to member id
+         */
+        eProsima_user_DllExport const eprosima::fastcdr::fixed_string<64>& id() const;
+
+        /*!
+         * @brief This function returns a reference to member id
+         * @return Reference to member id
+         */
+        eProsima_user_DllExport eprosima::fastcdr::fixed_string<64>& id();
+
+    private:
+
+        eprosima::fastcdr::fixed_string<64> m_id;
+
+    };
+    /*!
+     * @brief This class represents the structure BoundedPhysiologyValue defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class BoundedPhysiologyValue
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport BoundedPhysiologyValue();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~BoundedPhysiologyValue();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object AMM::BoundedPhysiologyValue that will be copied.
+         */
+        eProsima_user_DllExport BoundedPhysiologyValue(
+                const BoundedPhysiologyValue& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object AMM::BoundedPhysiologyValue that will be copied.
+         */
+        eProsima_user_DllExport BoundedPhysiologyValue(
+                BoundedPhysiologyValue&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object AMM::BoundedPhysiologyValue that will be copied.
+         */
+        eProsima_user_DllExport BoundedPhysiologyValue& operator =(
+                const BoundedPhysiologyValue& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object AMM::BoundedPhysiologyValue that will be copied.
+         */
+        eProsima_user_DllExport BoundedPhysiologyValue& operator =(
+                BoundedPhysiologyValue&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::BoundedPhysiologyValue object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const BoundedPhysiologyValue& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::BoundedPhysiologyValue object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const BoundedPhysiologyValue& x) const;
+
+        /*!
+         * @brief This function copies the value in member educational_encounter
+         * @param _educational_encounter New value to be copied in member educational_encounter
+         */
+        eProsima_user_DllExport void educational_encounter(
+                const AMM::BoundedUUID& _educational_encounter);
+
+        /*!
+         * @brief This function moves the value in member educational_encounter
+         * @param _educational_encounter New value to be moved in member educational_encounter
+         */
+        eProsima_user_DllExport void educational_encounter(
+                AMM::BoundedUUID&& _educational_encounter);
+
+        /*!
+         * @brief This function returns a constant reference to member educational_encounter
+         * @return Constant reference to member educational_encounter
+         */
+        eProsima_user_DllExport const AMM::BoundedUUID& educational_encounter() const;
+
+        /*!
+         * @brief This function returns a reference to member educational_encounter
+         * @return Reference to member educational_encounter
+         */
+        eProsima_user_DllExport AMM::BoundedUUID& educational_encounter();
+
+
+        /*!
+         * @brief This function sets a value in member simulation_time
+         * @param _simulation_time New value for member simulation_time
+         */
+        eProsima_user_DllExport void simulation_time(
+                int64_t _simulation_time);
+
+        /*!
+         * @brief This function returns the value of member simulation_time
+         * @return Value of member simulation_time
+         */
+        eProsima_user_DllExport int64_t simulation_time() const;
+
+        /*!
+         * @brief This function returns a reference to member simulation_time
+         * @return Reference to member simulation_time
+         */
+        eProsima_user_DllExport int64_t& simulation_time();
+
+
+        /*!
+         * @brief This function sets a value in member timestamp
+         * @param _timestamp New value for member timestamp
+         */
+        eProsima_user_DllExport void timestamp(
+                uint64_t _timestamp);
+
+        /*!
+         * @brief This function returns the value of member timestamp
+         * @return Value of member timestamp
+         */
+        eProsima_user_DllExport uint64_t timestamp() const;
+
+        /*!
+         * @brief This function returns a reference to member timestamp
+         * @return Reference to member timestamp
+         */
+        eProsima_user_DllExport uint64_t& timestamp();
+
+
+        /*!
+         * @brief This function copies the value in member name
+         * @param _name New value to be copied in member name
+         */
+        eProsima_user_DllExport void name(
+                const eprosima::fastcdr::fixed_string<128>& _name);
+
+        /*!
+         * @brief This function moves the value in member name
+         * @param _name New value to be moved in member name
+         */
+        eProsima_user_DllExport void name(
+                eprosima::fastcdr::fixed_string<128>&& _name);
+
+        /*!
+         * @brief This function returns a constant reference to member name
+         * @return Constant reference to member name
+         */
+        eProsima_user_DllExport const eprosima::fastcdr::fixed_string<128>& name() const;
+
+        /*!
+         * @brief This function returns a reference to member name
+         * @return Reference to member name
+         */
+        eProsima_user_DllExport eprosima::fastcdr::fixed_string<128>& name();
+
+
+        /*!
+         * @brief This function copies the value in member unit
+         * @param _unit New value to be copied in member unit
+         */
+        eProsima_user_DllExport void unit(
+                const eprosima::fastcdr::fixed_string<32>& _unit);
+
+        /*!
+         * @brief This function moves the value in member unit
+         * @param _unit New value to be moved in member unit
+         */
+        eProsima_user_DllExport void unit(
+                eprosima::fastcdr::fixed_string<32>&& _unit);
+
+        /*!
+         * @brief This function returns a constant reference to member unit
+         * @return Constant reference to member unit
+         */
+        eProsima_user_DllExport const eprosima::fastcdr::fixed_string<32>& unit() const;
+
+        /*!
+         * @brief This function returns a reference to member unit
+         * @return Reference to member unit
+         */
+        eProsima_user_DllExport eprosima::fastcdr::fixed_string<32>& unit();
+
+
+        /*!
+         * @brief This function sets a value in member value
+         * @param _value New value for member value
+         */
+        eProsima_user_DllExport void value(
+                double _value);
+
+        /*!
+         * @brief This function returns the value of member value
+         * @return Value of member value
+         */
+        eProsima_user_DllExport double value() const;
+
+        /*!
+         * @brief This function returns a reference to member value
+         * @return Reference to member value
+         */
+        eProsima_user_DllExport double& value();
+
+    private:
+
+        AMM::BoundedUUID m_educational_encounter;
+        int64_t m_simulation_time{0};
+        uint64_t m_timestamp{0};
+        eprosima::fastcdr::fixed_string<128> m_name;
+        eprosima::fastcdr::fixed_string<32> m_unit;
+        double m_value{0.0};
+
+    };
+    /*!
+     * @brief This class represents the structure BoundedPhysiologyWaveform defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class BoundedPhysiologyWaveform
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport BoundedPhysiologyWaveform();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~BoundedPhysiologyWaveform();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object AMM::BoundedPhysiologyWaveform that will be copied.
+         */
+        eProsima_user_DllExport BoundedPhysiologyWaveform(
+                const BoundedPhysiologyWaveform& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object AMM::BoundedPhysiologyWaveform that will be copied.
+         */
+        eProsima_user_DllExport BoundedPhysiologyWaveform(
+                BoundedPhysiologyWaveform&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object AMM::BoundedPhysiologyWaveform that will be copied.
+         */
+        eProsima_user_DllExport BoundedPhysiologyWaveform& operator =(
+                const BoundedPhysiologyWaveform& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object AMM::BoundedPhysiologyWaveform that will be copied.
+         */
+        eProsima_user_DllExport BoundedPhysiologyWaveform& operator =(
+                BoundedPhysiologyWaveform&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::BoundedPhysiologyWaveform object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const BoundedPhysiologyWaveform& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::BoundedPhysiologyWaveform object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const BoundedPhysiologyWaveform& x) const;
+
+        /*!
+         * @brief This function copies the value in member educational_encounter
+         * @param _educational_encounter New value to be copied in member educational_encounter
+         */
+        eProsima_user_DllExport void educational_encounter(
+                const AMM::BoundedUUID& _educational_encounter);
+
+        /*!
+         * @brief This function moves the value in member educational_encounter
+         * @param _educational_encounter New value to be moved in member educational_encounter
+         */
+        eProsima_user_DllExport void educational_encounter(
+                AMM::BoundedUUID&& _educational_encounter);
+
+        /*!
+         * @brief This function returns a constant reference to member educational_encounter
+         * @return Constant reference to member educational_encounter
+         */
+        eProsima_user_DllExport const AMM::BoundedUUID& educational_encounter() const;
+
+        /*!
+         * @brief This function returns a reference to member educational_encounter
+         * @return Reference to member educational_encounter
+         */
+        eProsima_user_DllExport AMM::BoundedUUID& educational_encounter();
+
+
+        /*!
+         * @brief This function sets a value in member simulation_time
+         * @param _simulation_time New value for member simulation_time
+         */
+        eProsima_user_DllExport void simulation_time(
+                int64_t _simulation_time);
+
+        /*!
+         * @brief This function returns the value of member simulation_time
+         * @return Value of member simulation_time
+         */
+        eProsima_user_DllExport int64_t simulation_time() const;
+
+        /*!
+         * @brief This function returns a reference to member simulation_time
+         * @return Reference to member simulation_time
+         */
+        eProsima_user_DllExport int64_t& simulation_time();
+
+
+        /*!
+         * @brief This function sets a value in member timestamp
+         * @param _timestamp New value for member timestamp
+         */
+        eProsima_user_DllExport void timestamp(
+                uint64_t _timestamp);
+
+        /*!
+         * @brief This function returns the value of member timestamp
+         * @return Value of member timestamp
+         */
+        eProsima_user_DllExport uint64_t timestamp() const;
+
+        /*!
+         * @brief This function returns a reference to member timestamp
+         * @return Reference to member timestamp
+         */
+        eProsima_user_DllExport uint64_t& timestamp();
+
+
+        /*!
+         * @brief This function copies the value in member name
+         * @param _name New value to be copied in member name
+         */
+        eProsima_user_DllExport void name(
+                const eprosima::fastcdr::fixed_string<128>& _name);
+
+        /*!
+         * @brief This function moves the value in member name
+         * @param _name New value to be moved in member name
+         */
+        eProsima_user_DllExport void name(
+                eprosima::fastcdr::fixed_string<128>&& _name);
+
+        /*!
+         * @brief This function returns a constant reference to member name
+         * @return Constant reference to member name
+         */
+        eProsima_user_DllExport const eprosima::fastcdr::fixed_string<128>& name() const;
+
+        /*!
+         * @brief This function returns a reference to member name
+         * @return Reference to member name
+         */
+        eProsima_user_DllExport eprosima::fastcdr::fixed_string<128>& name();
+
+
+        /*!
+         * @brief This function copies the value in member unit
+         * @param _unit New value to be copied in member unit
+         */
+        eProsima_user_DllExport void unit(
+                const eprosima::fastcdr::fixed_string<32>& _unit);
+
+        /*!
+         * @brief This function moves the value in member unit
+         * @param _unit New value to be moved in member unit
+         */
+        eProsima_user_DllExport void unit(
+                eprosima::fastcdr::fixed_string<32>&& _unit);
+
+        /*!
+         * @brief This function returns a constant reference to member unit
+         * @return Constant reference to member unit
+         */
+        eProsima_user_DllExport const eprosima::fastcdr::fixed_string<32>& unit() const;
+
+        /*!
+         * @brief This function returns a reference to member unit
+         * @return Reference to member unit
+         */
+        eProsima_user_DllExport eprosima::fastcdr::fixed_string<32>& unit();
+
+
+        /*!
+         * @brief This function sets a value in member value
+         * @param _value New value for member value
+         */
+        eProsima_user_DllExport void value(
+                double _value);
+
+        /*!
+         * @brief This function returns the value of member value
+         * @return Value of member value
+         */
+        eProsima_user_DllExport double value() const;
+
+        /*!
+         * @brief This function returns a reference to member value
+         * @return Reference to member value
+         */
+        eProsima_user_DllExport double& value();
+
+    private:
+
+        AMM::BoundedUUID m_educational_encounter;
+        int64_t m_simulation_time{0};
+        uint64_t m_timestamp{0};
+        eprosima::fastcdr::fixed_string<128> m_name;
+        eprosima::fastcdr::fixed_string<32> m_unit;
+        double m_value{0.0};
+
+    };
+    /*!
+     * @brief This class represents the structure BoundedLog defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class BoundedLog
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport BoundedLog();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~BoundedLog();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object AMM::BoundedLog that will be copied.
+         */
+        eProsima_user_DllExport BoundedLog(
+                const BoundedLog& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object AMM::BoundedLog that will be copied.
+         */
+        eProsima_user_DllExport BoundedLog(
+                BoundedLog&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object AMM::BoundedLog that will be copied.
+         */
+        eProsima_user_DllExport BoundedLog& operator =(
+                const BoundedLog& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object AMM::BoundedLog that will be copied.
+         */
+        eProsima_user_DllExport BoundedLog& operator =(
+                BoundedLog&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::BoundedLog object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const BoundedLog& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::BoundedLog object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const BoundedLog& x) const;
+
+        /*!
+         * @brief This function sets a value in member timestamp
+         * @param _timestamp New value for member timestamp
+         */
+        eProsima_user_DllExport void timestamp(
+                uint64_t _timestamp);
+
+        /*!
+         * @brief This function returns the value of member timestamp
+         * @return Value of member timestamp
+         */
+        eProsima_user_DllExport uint64_t timestamp() const;
+
+        /*!
+         * @brief This function returns a reference to member timestamp
+         * @return Reference to member timestamp
+         */
+        eProsima_user_DllExport uint64_t& timestamp();
+
+
+        /*!
+         * @brief This function copies the value in member module_id
+         * @param _module_id New value to be copied in member module_id
+         */
+        eProsima_user_DllExport void module_id(
+                const AMM::BoundedUUID& _module_id);
+
+        /*!
+         * @brief This function moves the value in member module_id
+         * @param _module_id New value to be moved in member module_id
+         */
+        eProsima_user_DllExport void module_id(
+                AMM::BoundedUUID&& _module_id);
+
+        /*!
+         * @brief This function returns a constant reference to member module_id
+         * @return Constant reference to member module_id
+         */
+        eProsima_user_DllExport const AMM::BoundedUUID& module_id() const;
+
+        /*!
+         * @brief This function returns a reference to member module_id
+         * @return Reference to member module_id
+         */
+        eProsima_user_DllExport AMM::BoundedUUID& module_id();
+
+
+        /*!
+         * @brief This function sets a value in member level
+         * @param _level New value for member level
+         */
+        eProsima_user_DllExport void level(
+                AMM::LogLevel _level);
+
+        /*!
+         * @brief This function returns the value of member level
+         * @return Value of member level
+         */
+        eProsima_user_DllExport AMM::LogLevel level() const;
+
+        /*!
+         * @brief This function returns a reference to member level
+         * @return Reference to member level
+         */
+        eProsima_user_DllExport AMM::LogLevel& level();
+
+
+        /*!
+         * @brief This function copies the value in member message
+         * @param _message New value to be copied in member message
+         */
+        eProsima_user_DllExport void message(
+                const eprosima::fastcdr::fixed_string<1024>& _message);
+
+        /*!
+         * @brief This function moves the value in member message
+         * @param _message New value to be moved in member message
+         */
+        eProsima_user_DllExport void message(
+                eprosima::fastcdr::fixed_string<1024>&& _message);
+
+        /*!
+         * @brief This function returns a constant reference to member message
+         * @return Constant reference to member message
+         */
+        eProsima_user_DllExport const eprosima::fastcdr::fixed_string<1024>& message() const;
+
+        /*!
+         * @brief This function returns a reference to member message
+         * @return Reference to member message
+         */
+        eProsima_user_DllExport eprosima::fastcdr::fixed_string<1024>& message();
+
+    private:
+
+        uint64_t m_timestamp{0};
+        AMM::BoundedUUID m_module_id;
+        AMM::LogLevel m_level{AMM::L_FATAL};
+        eprosima::fastcdr::fixed_string<1024> m_message;
+
+    };
+    /*!
+     * @brief This class represents the structure BoundedStatus defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class BoundedStatus
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport BoundedStatus();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~BoundedStatus();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object AMM::BoundedStatus that will be copied.
+         */
+        eProsima_user_DllExport BoundedStatus(
+                const BoundedStatus& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object AMM::BoundedStatus that will be copied.
+         */
+        eProsima_user_DllExport BoundedStatus(
+                BoundedStatus&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object AMM::BoundedStatus that will be copied.
+         */
+        eProsima_user_DllExport BoundedStatus& operator =(
+                const BoundedStatus& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object AMM::BoundedStatus that will be copied.
+         */
+        eProsima_user_DllExport BoundedStatus& operator =(
+                BoundedStatus&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::BoundedStatus object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const BoundedStatus& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::BoundedStatus object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const BoundedStatus& x) const;
+
+        /*!
+         * @brief This function copies the value in member module_id
+         * @param _module_id New value to be copied in member module_id
+         */
+        eProsima_user_DllExport void module_id(
+                const AMM::BoundedUUID& _module_id);
+
+        /*!
+         * @brief This function moves the value in member module_id
+         * @param _module_id New value to be moved in member module_id
+         */
+        eProsima_user_DllExport void module_id(
+                AMM::BoundedUUID&& _module_id);
+
+        /*!
+         * @brief This function returns a constant reference to member module_id
+         * @return Constant reference to member module_id
+         */
+        eProsima_user_DllExport const AMM::BoundedUUID& module_id() const;
+
+        /*!
+         * @brief This function returns a reference to member module_id
+         * @return Reference to member module_id
+         */
+        eProsima_user_DllExport AMM::BoundedUUID& module_id();
+
+
+        /*!
+         * @brief This function copies the value in member module_name
+         * @param _module_name New value to be copied in member module_name
+         */
+        eProsima_user_DllExport void module_name(
+                const eprosima::fastcdr::fixed_string<128>& _module_name);
+
+        /*!
+         * @brief This function moves the value in member module_name
+         * @param _module_name New value to be moved in member module_name
+         */
+        eProsima_user_DllExport void module_name(
+                eprosima::fastcdr::fixed_string<128>&& _module_name);
+
+        /*!
+         * @brief This function returns a constant reference to member module_name
+         * @return Constant reference to member module_name
+         */
+        eProsima_user_DllExport const eprosima::fastcdr::fixed_string<128>& module_name() const;
+
+        /*!
+         * @brief This function returns a reference to member module_name
+         * @return Reference to member module_name
+         */
+        eProsima_user_DllExport eprosima::fastcdr::fixed_string<128>& module_name();
+
+
+        /*!
+         * @brief This function copies the value in member educational_encounter
+         * @param _educational_encounter New value to be copied in member educational_encounter
+         */
+        eProsima_user_DllExport void educational_encounter(
+                const AMM::BoundedUUID& _educational_encounter);
+
+        /*!
+         * @brief This function moves the value in member educational_encounter
+         * @param _educational_encounter New value to be moved in member educational_encounter
+         */
+        eProsima_user_DllExport void educational_encounter(
+                AMM::BoundedUUID&& _educational_encounter);
+
+        /*!
+         * @brief This function returns a constant reference to member educational_encounter
+         * @return Constant reference to member educational_encounter
+         */
+        eProsima_user_DllExport const AMM::BoundedUUID& educational_encounter() const;
+
+        /*!
+         * @brief This function returns a reference to member educational_encounter
+         * @return Reference to member educational_encounter
+         */
+        eProsima_user_DllExport AMM::BoundedUUID& educational_encounter();
+
+
+        /*!
+         * @brief This function copies the value in member capability
+         * @param _capability New value to be copied in member capability
+         */
+        eProsima_user_DllExport void capability(
+                const eprosima::fastcdr::fixed_string<128>& _capability);
+
+        /*!
+         * @brief This function moves the value in member capability
+         * @param _capability New value to be moved in member capability
+         */
+        eProsima_user_DllExport void capability(
+                eprosima::fastcdr::fixed_string<128>&& _capability);
+
+        /*!
+         * @brief This function returns a constant reference to member capability
+         * @return Constant reference to member capability
+         */
+        eProsima_user_DllExport const eprosima::fastcdr::fixed_string<128>& capability() const;
+
+        /*!
+         * @brief This function returns a reference to member capability
+         * @return Reference to member capability
+         */
+        eProsima_user_DllExport eprosima::fastcdr::fixed_string<128>& capability();
+
+
+        /*!
+         * @brief This function sets a value in member timestamp
+         * @param _timestamp New value for member timestamp
+         */
+        eProsima_user_DllExport void timestamp(
+                uint64_t _timestamp);
+
+        /*!
+         * @brief This function returns the value of member timestamp
+         * @return Value of member timestamp
+         */
+        eProsima_user_DllExport uint64_t timestamp() const;
+
+        /*!
+         * @brief This function returns a reference to member timestamp
+         * @return Reference to member timestamp
+         */
+        eProsima_user_DllExport uint64_t& timestamp();
+
+
+        /*!
+         * @brief This function sets a value in member value
+         * @param _value New value for member value
+         */
+        eProsima_user_DllExport void value(
+                AMM::StatusValue _value);
+
+        /*!
+         * @brief This function returns the value of member value
+         * @return Value of member value
+         */
+        eProsima_user_DllExport AMM::StatusValue value() const;
+
+        /*!
+         * @brief This function returns a reference to member value
+         * @return Reference to member value
+         */
+        eProsima_user_DllExport AMM::StatusValue& value();
+
+
+        /*!
+         * @brief This function copies the value in member message
+         * @param _message New value to be copied in member message
+         */
+        eProsima_user_DllExport void message(
+                const eprosima::fastcdr::fixed_string<1024>& _message);
+
+        /*!
+         * @brief This function moves the value in member message
+         * @param _message New value to be moved in member message
+         */
+        eProsima_user_DllExport void message(
+                eprosima::fastcdr::fixed_string<1024>&& _message);
+
+        /*!
+         * @brief This function returns a constant reference to member message
+         * @return Constant reference to member message
+         */
+        eProsima_user_DllExport const eprosima::fastcdr::fixed_string<1024>& message() const;
+
+        /*!
+         * @brief This function returns a reference to member message
+         * @return Reference to member message
+         */
+        eProsima_user_DllExport eprosima::fastcdr::fixed_string<1024>& message();
+
+    private:
+
+        AMM::BoundedUUID m_module_id;
+        eprosima::fastcdr::fixed_string<128> m_module_name;
+        AMM::BoundedUUID m_educational_encounter;
+        eprosima::fastcdr::fixed_string<128> m_capability;
+        uint64_t m_timestamp{0};
+        AMM::StatusValue m_value{AMM::OPERATIONAL};
+        eprosima::fastcdr::fixed_string<1024> m_message;
+
+    };
+    /*!
+     * @brief This class represents the structure BoundedCommand defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class BoundedCommand
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport BoundedCommand();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~BoundedCommand();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object AMM::BoundedCommand that will be copied.
+         */
+        eProsima_user_DllExport BoundedCommand(
+                const BoundedCommand& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object AMM::BoundedCommand that will be copied.
+         */
+        eProsima_user_DllExport BoundedCommand(
+                BoundedCommand&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object AMM::BoundedCommand that will be copied.
+         */
+        eProsima_user_DllExport BoundedCommand& operator =(
+                const BoundedCommand& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object AMM::BoundedCommand that will be copied.
+         */
+        eProsima_user_DllExport BoundedCommand& operator =(
+                BoundedCommand&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::BoundedCommand object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const BoundedCommand& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x AMM::BoundedCommand object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const BoundedCommand& x) const;
+
+        /*!
+         * @brief This function copies the value in member message
+         * @param _message New value to be copied in member message
+         */
+        eProsima_user_DllExport void message(
+                const eprosima::fastcdr::fixed_string<1024>& _message);
+
+        /*!
+         * @brief This function moves the value in member message
+         * @param _message New value to be moved in member message
+         */
+        eProsima_user_DllExport void message(
+                eprosima::fastcdr::fixed_string<1024>&& _message);
+
+        /*!
+         * @brief This function returns a constant reference to member message
+         * @return Constant reference to member message
+         */
+        eProsima_user_DllExport const eprosima::fastcdr::fixed_string<1024>& message() const;
+
+        /*!
+         * @brief This function returns a reference to member message
+         * @return Reference to member message
+         */
+        eProsima_user_DllExport eprosima::fastcdr::fixed_string<1024>& message();
+
+    private:
+
+        eprosima::fastcdr::fixed_string<1024> m_message;
+
+    };
+// End of the Bounded types.
 } // namespace AMM
 
 #endif // _FAST_DDS_GENERATED_AMM_AMM_EXTENDED_H_
@@ -33,6 +33,35 @@ constexpr uint32_t AMM_InstrumentData_max_key_cdr_typesize {0UL};
 constexpr uint32_t AMM_Command_max_cdr_typesize {264UL};
 constexpr uint32_t AMM_Command_max_key_cdr_typesize {0UL};
 
+constexpr uint32_t AMM_CompactUUID_max_cdr_typesize {20UL};
+constexpr uint32_t AMM_CompactUUID_max_key_cdr_typesize {0UL};
+
+constexpr uint32_t AMM_PhysiologyFrameEntry_max_cdr_typesize {272UL};
+constexpr uint32_t AMM_PhysiologyFrameEntry_max_key_cdr_typesize {0UL};
+
+constexpr uint32_t AMM_PhysiologyFrame_max_cdr_typesize {27496UL};
+constexpr uint32_t AMM_PhysiologyFrame_max_key_cdr_typesize {0UL};
+
+// Begin of the Bounded types, generated by IDL/gen_bounded.py from their unbounded originals.
+constexpr uint32_t AMM_BoundedUUID_max_cdr_typesize {73UL};
+constexpr uint32_t AMM_BoundedUUID_max_key_cdr_typesize {0UL};
+
+constexpr uint32_t AMM_BoundedPhysiologyValue_max_cdr_typesize {280UL};
+constexpr uint32_t AMM_BoundedPhysiologyValue_max_key_cdr_typesize {0UL};
+
+constexpr uint32_t AMM_BoundedPhysiologyWaveform_max_cdr_typesize {280UL};
+constexpr uint32_t AMM_BoundedPhysiologyWaveform_max_key_cdr_typesize {0UL};
+
+constexpr uint32_t AMM_BoundedLog_max_cdr_typesize {1125UL};
+constexpr uint32_t AMM_BoundedLog_max_key_cdr_typesize {0UL};
+
+constexpr uint32_t AMM_BoundedStatus_max_cdr_typesize {1473UL};
+constexpr uint32_t AMM_BoundedStatus_max_key_cdr_typesize {0UL};
+
+constexpr uint32_t AMM_BoundedCommand_max_cdr_typesize {1033UL};
+constexpr uint32_t AMM_BoundedCommand_max_key_cdr_typesize {0UL};
+// End of the Bounded types.
+
 
 namespace eprosima {
 namespace fastcdr {
@@ -52,6 +81,44 @@ eProsima_user_DllExport void serialize_key(
         eprosima::fastcdr::Cdr& scdr,
         const AMM::Command& data);
 
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const AMM::CompactUUID& data);
+
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const AMM::PhysiologyFrameEntry& data);
+
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const AMM::PhysiologyFrame& data);
+
+// Begin of the Bounded types, generated by IDL/gen_bounded.py from their unbounded originals.
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const AMM::BoundedUUID& data);
+
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const AMM::BoundedPhysiologyValue& data);
+
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const AMM::BoundedPhysiologyWaveform& data);
+
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const AMM::BoundedLog& data);
+
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const AMM::BoundedStatus& data);
+
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const AMM::BoundedCommand& data);
+// End of the Bounded types.
+
 
 
 } // namespace fastcdr
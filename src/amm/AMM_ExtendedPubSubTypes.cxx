@@ -488,6 +488,1556 @@ namespace AMM {
         return true;
     }
 
+    CompactUUIDPubSubType::CompactUUIDPubSubType()
+    {
+        setName("AMM::CompactUUID");
+        uint32_t type_size = AMM_CompactUUID_max_cdr_typesize;
+        type_size += static_cast<uint32_t>(eprosima::fastcdr::Cdr::alignment(type_size, 4)); /* possible submessage alignment */
+        m_typeSize = type_size + 4; /*encapsulation*/
+        m_isGetKeyDefined = false;
+        uint32_t keyLength = AMM_CompactUUID_max_key_cdr_typesize > 16 ? AMM_CompactUUID_max_key_cdr_typesize : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    CompactUUIDPubSubType::~CompactUUIDPubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool CompactUUIDPubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t data_representation)
+    {
+        CompactUUID* p_type = static_cast<CompactUUID*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                eprosima::fastcdr::CdrVersion::XCDRv1 : eprosima::fastcdr::CdrVersion::XCDRv2);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        ser.set_encoding_flag(
+            data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR  :
+            eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2);
+
+        try
+        {
+            // Serialize encapsulation
+            ser.serialize_encapsulation();
+            // Serialize the object.
+            ser << *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.get_serialized_data_length());
+        return true;
+    }
+
+    bool CompactUUIDPubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            // Convert DATA to pointer of your type
+            CompactUUID* p_type = static_cast<CompactUUID*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            deser >> *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> CompactUUIDPubSubType::getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t data_representation)
+    {
+        return [data, data_representation]() -> uint32_t
+               {
+                   eprosima::fastcdr::CdrSizeCalculator calculator(
+                       data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                       eprosima::fastcdr::CdrVersion::XCDRv1 :eprosima::fastcdr::CdrVersion::XCDRv2);
+                   size_t current_alignment {0};
+                   return static_cast<uint32_t>(calculator.calculate_serialized_size(
+                               *static_cast<CompactUUID*>(data), current_alignment)) +
+                           4u /*encapsulation*/;
+               };
+    }
+
+    void* CompactUUIDPubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new CompactUUID());
+    }
+
+    void CompactUUIDPubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<CompactUUID*>(data));
+    }
+
+    bool CompactUUIDPubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        CompactUUID* p_type = static_cast<CompactUUID*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                AMM_CompactUUID_max_key_cdr_typesize);
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        eprosima::fastcdr::serialize_key(ser, *p_type);
+        if (force_md5 || AMM_CompactUUID_max_key_cdr_typesize > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+    PhysiologyFrameEntryPubSubType::PhysiologyFrameEntryPubSubType()
+    {
+        setName("AMM::PhysiologyFrameEntry");
+        uint32_t type_size = AMM_PhysiologyFrameEntry_max_cdr_typesize;
+        type_size += static_cast<uint32_t>(eprosima::fastcdr::Cdr::alignment(type_size, 4)); /* possible submessage alignment */
+        m_typeSize = type_size + 4; /*encapsulation*/
+        m_isGetKeyDefined = false;
+        uint32_t keyLength = AMM_PhysiologyFrameEntry_max_key_cdr_typesize > 16 ? AMM_PhysiologyFrameEntry_max_key_cdr_typesize : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    PhysiologyFrameEntryPubSubType::~PhysiologyFrameEntryPubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool PhysiologyFrameEntryPubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t data_representation)
+    {
+        PhysiologyFrameEntry* p_type = static_cast<PhysiologyFrameEntry*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                eprosima::fastcdr::CdrVersion::XCDRv1 : eprosima::fastcdr::CdrVersion::XCDRv2);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        ser.set_encoding_flag(
+            data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR  :
+            eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2);
+
+        try
+        {
+            // Serialize encapsulation
+            ser.serialize_encapsulation();
+            // Serialize the object.
+            ser << *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.get_serialized_data_length());
+        return true;
+    }
+
+    bool PhysiologyFrameEntryPubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            // Convert DATA to pointer of your type
+            PhysiologyFrameEntry* p_type = static_cast<PhysiologyFrameEntry*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            deser >> *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> PhysiologyFrameEntryPubSubType::getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t data_representation)
+    {
+        return [data, data_representation]() -> uint32_t
+               {
+                   eprosima::fastcdr::CdrSizeCalculator calculator(
+                       data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                       eprosima::fastcdr::CdrVersion::XCDRv1 :eprosima::fastcdr::CdrVersion::XCDRv2);
+                   size_t current_alignment {0};
+                   return static_cast<uint32_t>(calculator.calculate_serialized_size(
+                               *static_cast<PhysiologyFrameEntry*>(data), current_alignment)) +
+                           4u /*encapsulation*/;
+               };
+    }
+
+    void* PhysiologyFrameEntryPubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new PhysiologyFrameEntry());
+    }
+
+    void PhysiologyFrameEntryPubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<PhysiologyFrameEntry*>(data));
+    }
+
+    bool PhysiologyFrameEntryPubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        PhysiologyFrameEntry* p_type = static_cast<PhysiologyFrameEntry*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                AMM_PhysiologyFrameEntry_max_key_cdr_typesize);
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        eprosima::fastcdr::serialize_key(ser, *p_type);
+        if (force_md5 || AMM_PhysiologyFrameEntry_max_key_cdr_typesize > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+    PhysiologyFramePubSubType::PhysiologyFramePubSubType()
+    {
+        setName("AMM::PhysiologyFrame");
+        uint32_t type_size = AMM_PhysiologyFrame_max_cdr_typesize;
+        type_size += static_cast<uint32_t>(eprosima::fastcdr::Cdr::alignment(type_size, 4)); /* possible submessage alignment */
+        m_typeSize = type_size + 4; /*encapsulation*/
+        m_isGetKeyDefined = false;
+        uint32_t keyLength = AMM_PhysiologyFrame_max_key_cdr_typesize > 16 ? AMM_PhysiologyFrame_max_key_cdr_typesize : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    PhysiologyFramePubSubType::~PhysiologyFramePubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool PhysiologyFramePubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t data_representation)
+    {
+        PhysiologyFrame* p_type = static_cast<PhysiologyFrame*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                eprosima::fastcdr::CdrVersion::XCDRv1 : eprosima::fastcdr::CdrVersion::XCDRv2);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        ser.set_encoding_flag(
+            data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR  :
+            eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2);
+
+        try
+        {
+            // Serialize encapsulation
+            ser.serialize_encapsulation();
+            // Serialize the object.
+            ser << *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.get_serialized_data_length());
+        return true;
+    }
+
+    bool PhysiologyFramePubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            // Convert DATA to pointer of your type
+            PhysiologyFrame* p_type = static_cast<PhysiologyFrame*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            deser >> *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> PhysiologyFramePubSubType::getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t data_representation)
+    {
+        return [data, data_representation]() -> uint32_t
+               {
+                   eprosima::fastcdr::CdrSizeCalculator calculator(
+                       data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                       eprosima::fastcdr::CdrVersion::XCDRv1 :eprosima::fastcdr::CdrVersion::XCDRv2);
+                   size_t current_alignment {0};
+                   return static_cast<uint32_t>(calculator.calculate_serialized_size(
+                               *static_cast<PhysiologyFrame*>(data), current_alignment)) +
+                           4u /*encapsulation*/;
+               };
+    }
+
+    void* PhysiologyFramePubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new PhysiologyFrame());
+    }
+
+    void PhysiologyFramePubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<PhysiologyFrame*>(data));
+    }
+
+    bool PhysiologyFramePubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        PhysiologyFrame* p_type = static_cast<PhysiologyFrame*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                AMM_PhysiologyFrame_max_key_cdr_typesize);
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        eprosima::fastcdr::serialize_key(ser, *p_type);
+        if (force_md5 || AMM_PhysiologyFrame_max_key_cdr_typesize > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+// Begin of the Bounded types, generated by IDL/gen_bounded.py from their unbounded originals.
+    BoundedUUIDPubSubType::BoundedUUIDPubSubType()
+    {
+        setName("AMM::BoundedUUID");
+        uint32_t type_size =
+    #if FASTCDR_VERSION_MAJOR == 1
+            static_cast<uint32_t>(BoundedUUID::getMaxCdrSerializedSize());
+    #else
+            AMM_BoundedUUID_max_cdr_typesize;
+    #endif
+        type_size += static_cast<uint32_t>(eprosima::fastcdr::Cdr::alignment(type_size, 4)); /* possible submessage alignment */
+        m_typeSize = type_size + 4; /*encapsulation*/
+        m_isGetKeyDefined = false;
+        uint32_t keyLength = AMM_BoundedUUID_max_key_cdr_typesize > 16 ? AMM_BoundedUUID_max_key_cdr_typesize : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    BoundedUUIDPubSubType::~BoundedUUIDPubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool BoundedUUIDPubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t data_representation)
+    {
+        BoundedUUID* p_type = static_cast<BoundedUUID*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                eprosima::fastcdr::CdrVersion::XCDRv1 : eprosima::fastcdr::CdrVersion::XCDRv2);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+    #if FASTCDR_VERSION_MAJOR > 1
+        ser.set_encoding_flag(
+            data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR  :
+            eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2);
+    #endif // FASTCDR_VERSION_MAJOR > 1
+
+        try
+        {
+            // Serialize encapsulation
+            ser.serialize_encapsulation();
+            // Serialize the object.
+            ser << *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+    #if FASTCDR_VERSION_MAJOR == 1
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+    #else
+        payload->length = static_cast<uint32_t>(ser.get_serialized_data_length());
+    #endif // FASTCDR_VERSION_MAJOR == 1
+        return true;
+    }
+
+    bool BoundedUUIDPubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            // Convert DATA to pointer of your type
+            BoundedUUID* p_type = static_cast<BoundedUUID*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN
+    #if FASTCDR_VERSION_MAJOR == 1
+                    , eprosima::fastcdr::Cdr::CdrType::DDS_CDR
+    #endif // FASTCDR_VERSION_MAJOR == 1
+                    );
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            deser >> *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> BoundedUUIDPubSubType::getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t data_representation)
+    {
+        return [data, data_representation]() -> uint32_t
+               {
+    #if FASTCDR_VERSION_MAJOR == 1
+                   static_cast<void>(data_representation);
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<BoundedUUID*>(data))) +
+                          4u /*encapsulation*/;
+    #else
+                   try
+                   {
+                       eprosima::fastcdr::CdrSizeCalculator calculator(
+                           data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                           eprosima::fastcdr::CdrVersion::XCDRv1 :eprosima::fastcdr::CdrVersion::XCDRv2);
+                       size_t current_alignment {0};
+                       return static_cast<uint32_t>(calculator.calculate_serialized_size(
+                                   *static_cast<BoundedUUID*>(data), current_alignment)) +
+                               4u /*encapsulation*/;
+                   }
+                   catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+                   {
+                       return 0;
+                   }
+    #endif // FASTCDR_VERSION_MAJOR == 1
+               };
+    }
+
+    void* BoundedUUIDPubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new BoundedUUID());
+    }
+
+    void BoundedUUIDPubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<BoundedUUID*>(data));
+    }
+
+    bool BoundedUUIDPubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        BoundedUUID* p_type = static_cast<BoundedUUID*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                AMM_BoundedUUID_max_key_cdr_typesize);
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS, eprosima::fastcdr::CdrVersion::XCDRv1);
+    #if FASTCDR_VERSION_MAJOR == 1
+        p_type->serializeKey(ser);
+    #else
+        eprosima::fastcdr::serialize_key(ser, *p_type);
+    #endif // FASTCDR_VERSION_MAJOR == 1
+        if (force_md5 || AMM_BoundedUUID_max_key_cdr_typesize > 16)
+        {
+            m_md5.init();
+    #if FASTCDR_VERSION_MAJOR == 1
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+    #else
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
+    #endif // FASTCDR_VERSION_MAJOR == 1
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+    BoundedPhysiologyValuePubSubType::BoundedPhysiologyValuePubSubType()
+    {
+        setName("AMM::BoundedPhysiologyValue");
+        uint32_t type_size =
+    #if FASTCDR_VERSION_MAJOR == 1
+            static_cast<uint32_t>(BoundedPhysiologyValue::getMaxCdrSerializedSize());
+    #else
+            AMM_BoundedPhysiologyValue_max_cdr_typesize;
+    #endif
+        type_size += static_cast<uint32_t>(eprosima::fastcdr::Cdr::alignment(type_size, 4)); /* possible submessage alignment */
+        m_typeSize = type_size + 4; /*encapsulation*/
+        m_isGetKeyDefined = false;
+        uint32_t keyLength = AMM_BoundedPhysiologyValue_max_key_cdr_typesize > 16 ? AMM_BoundedPhysiologyValue_max_key_cdr_typesize : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    BoundedPhysiologyValuePubSubType::~BoundedPhysiologyValuePubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool BoundedPhysiologyValuePubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t data_representation)
+    {
+        BoundedPhysiologyValue* p_type = static_cast<BoundedPhysiologyValue*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                eprosima::fastcdr::CdrVersion::XCDRv1 : eprosima::fastcdr::CdrVersion::XCDRv2);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+    #if FASTCDR_VERSION_MAJOR > 1
+        ser.set_encoding_flag(
+            data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR  :
+            eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2);
+    #endif // FASTCDR_VERSION_MAJOR > 1
+
+        try
+        {
+            // Serialize encapsulation
+            ser.serialize_encapsulation();
+            // Serialize the object.
+            ser << *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+    #if FASTCDR_VERSION_MAJOR == 1
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+    #else
+        payload->length = static_cast<uint32_t>(ser.get_serialized_data_length());
+    #endif // FASTCDR_VERSION_MAJOR == 1
+        return true;
+    }
+
+    bool BoundedPhysiologyValuePubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            // Convert DATA to pointer of your type
+            BoundedPhysiologyValue* p_type = static_cast<BoundedPhysiologyValue*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN
+    #if FASTCDR_VERSION_MAJOR == 1
+                    , eprosima::fastcdr::Cdr::CdrType::DDS_CDR
+    #endif // FASTCDR_VERSION_MAJOR == 1
+                    );
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            deser >> *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> BoundedPhysiologyValuePubSubType::getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t data_representation)
+    {
+        return [data, data_representation]() -> uint32_t
+               {
+    #if FASTCDR_VERSION_MAJOR == 1
+                   static_cast<void>(data_representation);
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<BoundedPhysiologyValue*>(data))) +
+                          4u /*encapsulation*/;
+    #else
+                   try
+                   {
+                       eprosima::fastcdr::CdrSizeCalculator calculator(
+                           data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                           eprosima::fastcdr::CdrVersion::XCDRv1 :eprosima::fastcdr::CdrVersion::XCDRv2);
+                       size_t current_alignment {0};
+                       return static_cast<uint32_t>(calculator.calculate_serialized_size(
+                                   *static_cast<BoundedPhysiologyValue*>(data), current_alignment)) +
+                               4u /*encapsulation*/;
+                   }
+                   catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+                   {
+                       return 0;
+                   }
+    #endif // FASTCDR_VERSION_MAJOR == 1
+               };
+    }
+
+    void* BoundedPhysiologyValuePubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new BoundedPhysiologyValue());
+    }
+
+    void BoundedPhysiologyValuePubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<BoundedPhysiologyValue*>(data));
+    }
+
+    bool BoundedPhysiologyValuePubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        BoundedPhysiologyValue* p_type = static_cast<BoundedPhysiologyValue*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                AMM_BoundedPhysiologyValue_max_key_cdr_typesize);
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS, eprosima::fastcdr::CdrVersion::XCDRv1);
+    #if FASTCDR_VERSION_MAJOR == 1
+        p_type->serializeKey(ser);
+    #else
+        eprosima::fastcdr::serialize_key(ser, *p_type);
+    #endif // FASTCDR_VERSION_MAJOR == 1
+        if (force_md5 || AMM_BoundedPhysiologyValue_max_key_cdr_typesize > 16)
+        {
+            m_md5.init();
+    #if FASTCDR_VERSION_MAJOR == 1
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+    #else
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
+    #endif // FASTCDR_VERSION_MAJOR == 1
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+    BoundedPhysiologyWaveformPubSubType::BoundedPhysiologyWaveformPubSubType()
+    {
+        setName("AMM::BoundedPhysiologyWaveform");
+        uint32_t type_size =
+    #if FASTCDR_VERSION_MAJOR == 1
+            static_cast<uint32_t>(BoundedPhysiologyWaveform::getMaxCdrSerializedSize());
+    #else
+            AMM_BoundedPhysiologyWaveform_max_cdr_typesize;
+    #endif
+        type_size += static_cast<uint32_t>(eprosima::fastcdr::Cdr::alignment(type_size, 4)); /* possible submessage alignment */
+        m_typeSize = type_size + 4; /*encapsulation*/
+        m_isGetKeyDefined = false;
+        uint32_t keyLength = AMM_BoundedPhysiologyWaveform_max_key_cdr_typesize > 16 ? AMM_BoundedPhysiologyWaveform_max_key_cdr_typesize : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    BoundedPhysiologyWaveformPubSubType::~BoundedPhysiologyWaveformPubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool BoundedPhysiologyWaveformPubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t data_representation)
+    {
+        BoundedPhysiologyWaveform* p_type = static_cast<BoundedPhysiologyWaveform*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                eprosima::fastcdr::CdrVersion::XCDRv1 : eprosima::fastcdr::CdrVersion::XCDRv2);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+    #if FASTCDR_VERSION_MAJOR > 1
+        ser.set_encoding_flag(
+            data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR  :
+            eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2);
+    #endif // FASTCDR_VERSION_MAJOR > 1
+
+        try
+        {
+            // Serialize encapsulation
+            ser.serialize_encapsulation();
+            // Serialize the object.
+            ser << *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+    #if FASTCDR_VERSION_MAJOR == 1
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+    #else
+        payload->length = static_cast<uint32_t>(ser.get_serialized_data_length());
+    #endif // FASTCDR_VERSION_MAJOR == 1
+        return true;
+    }
+
+    bool BoundedPhysiologyWaveformPubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            // Convert DATA to pointer of your type
+            BoundedPhysiologyWaveform* p_type = static_cast<BoundedPhysiologyWaveform*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN
+    #if FASTCDR_VERSION_MAJOR == 1
+                    , eprosima::fastcdr::Cdr::CdrType::DDS_CDR
+    #endif // FASTCDR_VERSION_MAJOR == 1
+                    );
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            deser >> *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> BoundedPhysiologyWaveformPubSubType::getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t data_representation)
+    {
+        return [data, data_representation]() -> uint32_t
+               {
+    #if FASTCDR_VERSION_MAJOR == 1
+                   static_cast<void>(data_representation);
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<BoundedPhysiologyWaveform*>(data))) +
+                          4u /*encapsulation*/;
+    #else
+                   try
+                   {
+                       eprosima::fastcdr::CdrSizeCalculator calculator(
+                           data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                           eprosima::fastcdr::CdrVersion::XCDRv1 :eprosima::fastcdr::CdrVersion::XCDRv2);
+                       size_t current_alignment {0};
+                       return static_cast<uint32_t>(calculator.calculate_serialized_size(
+                                   *static_cast<BoundedPhysiologyWaveform*>(data), current_alignment)) +
+                               4u /*encapsulation*/;
+                   }
+                   catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+                   {
+                       return 0;
+                   }
+    #endif // FASTCDR_VERSION_MAJOR == 1
+               };
+    }
+
+    void* BoundedPhysiologyWaveformPubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new BoundedPhysiologyWaveform());
+    }
+
+    void BoundedPhysiologyWaveformPubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<BoundedPhysiologyWaveform*>(data));
+    }
+
+    bool BoundedPhysiologyWaveformPubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        BoundedPhysiologyWaveform* p_type = static_cast<BoundedPhysiologyWaveform*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                AMM_BoundedPhysiologyWaveform_max_key_cdr_typesize);
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS, eprosima::fastcdr::CdrVersion::XCDRv1);
+    #if FASTCDR_VERSION_MAJOR == 1
+        p_type->serializeKey(ser);
+    #else
+        eprosima::fastcdr::serialize_key(ser, *p_type);
+    #endif // FASTCDR_VERSION_MAJOR == 1
+        if (force_md5 || AMM_BoundedPhysiologyWaveform_max_key_cdr_typesize > 16)
+        {
+            m_md5.init();
+    #if FASTCDR_VERSION_MAJOR == 1
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+    #else
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
+    #endif // FASTCDR_VERSION_MAJOR == 1
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+    BoundedLogPubSubType::BoundedLogPubSubType()
+    {
+        setName("AMM::BoundedLog");
+        uint32_t type_size =
+    #if FASTCDR_VERSION_MAJOR == 1
+            static_cast<uint32_t>(BoundedLog::getMaxCdrSerializedSize());
+    #else
+            AMM_BoundedLog_max_cdr_typesize;
+    #endif
+        type_size += static_cast<uint32_t>(eprosima::fastcdr::Cdr::alignment(type_size, 4)); /* possible submessage alignment */
+        m_typeSize = type_size + 4; /*encapsulation*/
+        m_isGetKeyDefined = false;
+        uint32_t keyLength = AMM_BoundedLog_max_key_cdr_typesize > 16 ? AMM_BoundedLog_max_key_cdr_typesize : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    BoundedLogPubSubType::~BoundedLogPubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool BoundedLogPubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t data_representation)
+    {
+        BoundedLog* p_type = static_cast<BoundedLog*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                eprosima::fastcdr::CdrVersion::XCDRv1 : eprosima::fastcdr::CdrVersion::XCDRv2);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+    #if FASTCDR_VERSION_MAJOR > 1
+        ser.set_encoding_flag(
+            data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR  :
+            eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2);
+    #endif // FASTCDR_VERSION_MAJOR > 1
+
+        try
+        {
+            // Serialize encapsulation
+            ser.serialize_encapsulation();
+            // Serialize the object.
+            ser << *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+    #if FASTCDR_VERSION_MAJOR == 1
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+    #else
+        payload->length = static_cast<uint32_t>(ser.get_serialized_data_length());
+    #endif // FASTCDR_VERSION_MAJOR == 1
+        return true;
+    }
+
+    bool BoundedLogPubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            // Convert DATA to pointer of your type
+            BoundedLog* p_type = static_cast<BoundedLog*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN
+    #if FASTCDR_VERSION_MAJOR == 1
+                    , eprosima::fastcdr::Cdr::CdrType::DDS_CDR
+    #endif // FASTCDR_VERSION_MAJOR == 1
+                    );
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            deser >> *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> BoundedLogPubSubType::getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t data_representation)
+    {
+        return [data, data_representation]() -> uint32_t
+               {
+    #if FASTCDR_VERSION_MAJOR == 1
+                   static_cast<void>(data_representation);
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<BoundedLog*>(data))) +
+                          4u /*encapsulation*/;
+    #else
+                   try
+                   {
+                       eprosima::fastcdr::CdrSizeCalculator calculator(
+                           data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                           eprosima::fastcdr::CdrVersion::XCDRv1 :eprosima::fastcdr::CdrVersion::XCDRv2);
+                       size_t current_alignment {0};
+                       return static_cast<uint32_t>(calculator.calculate_serialized_size(
+                                   *static_cast<BoundedLog*>(data), current_alignment)) +
+                               4u /*encapsulation*/;
+                   }
+                   catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+                   {
+                       return 0;
+                   }
+    #endif // FASTCDR_VERSION_MAJOR == 1
+               };
+    }
+
+    void* BoundedLogPubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new BoundedLog());
+    }
+
+    void BoundedLogPubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<BoundedLog*>(data));
+    }
+
+    bool BoundedLogPubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        BoundedLog* p_type = static_cast<BoundedLog*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                AMM_BoundedLog_max_key_cdr_typesize);
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS, eprosima::fastcdr::CdrVersion::XCDRv1);
+    #if FASTCDR_VERSION_MAJOR == 1
+        p_type->serializeKey(ser);
+    #else
+        eprosima::fastcdr::serialize_key(ser, *p_type);
+    #endif // FASTCDR_VERSION_MAJOR == 1
+        if (force_md5 || AMM_BoundedLog_max_key_cdr_typesize > 16)
+        {
+            m_md5.init();
+    #if FASTCDR_VERSION_MAJOR == 1
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+    #else
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
+    #endif // FASTCDR_VERSION_MAJOR == 1
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+    BoundedStatusPubSubType::BoundedStatusPubSubType()
+    {
+        setName("AMM::BoundedStatus");
+        uint32_t type_size =
+    #if FASTCDR_VERSION_MAJOR == 1
+            static_cast<uint32_t>(BoundedStatus::getMaxCdrSerializedSize());
+    #else
+            AMM_BoundedStatus_max_cdr_typesize;
+    #endif
+        type_size += static_cast<uint32_t>(eprosima::fastcdr::Cdr::alignment(type_size, 4)); /* possible submessage alignment */
+        m_typeSize = type_size + 4; /*encapsulation*/
+        m_isGetKeyDefined = false;
+        uint32_t keyLength = AMM_BoundedStatus_max_key_cdr_typesize > 16 ? AMM_BoundedStatus_max_key_cdr_typesize : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    BoundedStatusPubSubType::~BoundedStatusPubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool BoundedStatusPubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t data_representation)
+    {
+        BoundedStatus* p_type = static_cast<BoundedStatus*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                eprosima::fastcdr::CdrVersion::XCDRv1 : eprosima::fastcdr::CdrVersion::XCDRv2);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+    #if FASTCDR_VERSION_MAJOR > 1
+        ser.set_encoding_flag(
+            data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR  :
+            eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2);
+    #endif // FASTCDR_VERSION_MAJOR > 1
+
+        try
+        {
+            // Serialize encapsulation
+            ser.serialize_encapsulation();
+            // Serialize the object.
+            ser << *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+    #if FASTCDR_VERSION_MAJOR == 1
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+    #else
+        payload->length = static_cast<uint32_t>(ser.get_serialized_data_length());
+    #endif // FASTCDR_VERSION_MAJOR == 1
+        return true;
+    }
+
+    bool BoundedStatusPubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            // Convert DATA to pointer of your type
+            BoundedStatus* p_type = static_cast<BoundedStatus*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN
+    #if FASTCDR_VERSION_MAJOR == 1
+                    , eprosima::fastcdr::Cdr::CdrType::DDS_CDR
+    #endif // FASTCDR_VERSION_MAJOR == 1
+                    );
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            deser >> *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> BoundedStatusPubSubType::getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t data_representation)
+    {
+        return [data, data_representation]() -> uint32_t
+               {
+    #if FASTCDR_VERSION_MAJOR == 1
+                   static_cast<void>(data_representation);
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<BoundedStatus*>(data))) +
+                          4u /*encapsulation*/;
+    #else
+                   try
+                   {
+                       eprosima::fastcdr::CdrSizeCalculator calculator(
+                           data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                           eprosima::fastcdr::CdrVersion::XCDRv1 :eprosima::fastcdr::CdrVersion::XCDRv2);
+                       size_t current_alignment {0};
+                       return static_cast<uint32_t>(calculator.calculate_serialized_size(
+                                   *static_cast<BoundedStatus*>(data), current_alignment)) +
+                               4u /*encapsulation*/;
+                   }
+                   catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+                   {
+                       return 0;
+                   }
+    #endif // FASTCDR_VERSION_MAJOR == 1
+               };
+    }
+
+    void* BoundedStatusPubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new BoundedStatus());
+    }
+
+    void BoundedStatusPubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<BoundedStatus*>(data));
+    }
+
+    bool BoundedStatusPubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        BoundedStatus* p_type = static_cast<BoundedStatus*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                AMM_BoundedStatus_max_key_cdr_typesize);
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS, eprosima::fastcdr::CdrVersion::XCDRv1);
+    #if FASTCDR_VERSION_MAJOR == 1
+        p_type->serializeKey(ser);
+    #else
+        eprosima::fastcdr::serialize_key(ser, *p_type);
+    #endif // FASTCDR_VERSION_MAJOR == 1
+        if (force_md5 || AMM_BoundedStatus_max_key_cdr_typesize > 16)
+        {
+            m_md5.init();
+    #if FASTCDR_VERSION_MAJOR == 1
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+    #else
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
+    #endif // FASTCDR_VERSION_MAJOR == 1
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+    BoundedCommandPubSubType::BoundedCommandPubSubType()
+    {
+        setName("AMM::BoundedCommand");
+        uint32_t type_size = AMM_BoundedCommand_max_cdr_typesize;
+        type_size += static_cast<uint32_t>(eprosima::fastcdr::Cdr::alignment(type_size, 4)); /* possible submessage alignment */
+        m_typeSize = type_size + 4; /*encapsulation*/
+        m_isGetKeyDefined = false;
+        uint32_t keyLength = AMM_BoundedCommand_max_key_cdr_typesize > 16 ? AMM_BoundedCommand_max_key_cdr_typesize : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    BoundedCommandPubSubType::~BoundedCommandPubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool BoundedCommandPubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t data_representation)
+    {
+        BoundedCommand* p_type = static_cast<BoundedCommand*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                eprosima::fastcdr::CdrVersion::XCDRv1 : eprosima::fastcdr::CdrVersion::XCDRv2);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        ser.set_encoding_flag(
+            data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR  :
+            eprosima::fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2);
+
+        try
+        {
+            // Serialize encapsulation
+            ser.serialize_encapsulation();
+            // Serialize the object.
+            ser << *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.get_serialized_data_length());
+        return true;
+    }
+
+    bool BoundedCommandPubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            // Convert DATA to pointer of your type
+            BoundedCommand* p_type = static_cast<BoundedCommand*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            deser >> *p_type;
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> BoundedCommandPubSubType::getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t data_representation)
+    {
+        return [data, data_representation]() -> uint32_t
+               {
+                   eprosima::fastcdr::CdrSizeCalculator calculator(
+                       data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                       eprosima::fastcdr::CdrVersion::XCDRv1 :eprosima::fastcdr::CdrVersion::XCDRv2);
+                   size_t current_alignment {0};
+                   return static_cast<uint32_t>(calculator.calculate_serialized_size(
+                               *static_cast<BoundedCommand*>(data), current_alignment)) +
+                           4u /*encapsulation*/;
+               };
+    }
+
+    void* BoundedCommandPubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new BoundedCommand());
+    }
+
+    void BoundedCommandPubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<BoundedCommand*>(data));
+    }
+
+    bool BoundedCommandPubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        BoundedCommand* p_type = static_cast<BoundedCommand*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                AMM_BoundedCommand_max_key_cdr_typesize);
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        eprosima::fastcdr::serialize_key(ser, *p_type);
+        if (force_md5 || AMM_BoundedCommand_max_key_cdr_typesize > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.get_serialized_data_length()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+// End of the Bounded types.
+
 
 } //End of namespace AMM
 
@@ -303,6 +303,800 @@ namespace AMM
         unsigned char* m_keyBuffer;
 
     };
+
+    /*!
+     * @brief This class represents the TopicDataType of the type CompactUUID defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class CompactUUIDPubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef CompactUUID type;
+
+        eProsima_user_DllExport CompactUUIDPubSubType();
+
+        eProsima_user_DllExport ~CompactUUIDPubSubType() override;
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+        {
+            return serialize(data, payload, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override
+        {
+            return getSerializedSizeProvider(data, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport void* createData() override;
+
+        eProsima_user_DllExport void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return false;
+        }
+
+        eProsima_user_DllExport inline bool is_plain(
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation) const override
+        {
+            static_cast<void>(data_representation);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            static_cast<void>(memory);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+
+    };
+
+    /*!
+     * @brief This class represents the TopicDataType of the type PhysiologyFrameEntry defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class PhysiologyFrameEntryPubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef PhysiologyFrameEntry type;
+
+        eProsima_user_DllExport PhysiologyFrameEntryPubSubType();
+
+        eProsima_user_DllExport ~PhysiologyFrameEntryPubSubType() override;
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+        {
+            return serialize(data, payload, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override
+        {
+            return getSerializedSizeProvider(data, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport void* createData() override;
+
+        eProsima_user_DllExport void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return false;
+        }
+
+        eProsima_user_DllExport inline bool is_plain(
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation) const override
+        {
+            static_cast<void>(data_representation);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            static_cast<void>(memory);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+
+    };
+
+    /*!
+     * @brief This class represents the TopicDataType of the type PhysiologyFrame defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class PhysiologyFramePubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef PhysiologyFrame type;
+
+        eProsima_user_DllExport PhysiologyFramePubSubType();
+
+        eProsima_user_DllExport ~PhysiologyFramePubSubType() override;
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+        {
+            return serialize(data, payload, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override
+        {
+            return getSerializedSizeProvider(data, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport void* createData() override;
+
+        eProsima_user_DllExport void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return false;
+        }
+
+        eProsima_user_DllExport inline bool is_plain(
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation) const override
+        {
+            static_cast<void>(data_representation);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            static_cast<void>(memory);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+
+    };
+
+// Begin of the Bounded types, generated by IDL/gen_bounded.py from their unbounded originals.
+    /*!
+     * @brief This class represents the TopicDataType of the type BoundedUUID defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class BoundedUUIDPubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef BoundedUUID type;
+
+        eProsima_user_DllExport BoundedUUIDPubSubType();
+
+        eProsima_user_DllExport ~BoundedUUIDPubSubType() override;
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+        {
+            return serialize(data, payload, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override
+        {
+            return getSerializedSizeProvider(data, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport void* createData() override;
+
+        eProsima_user_DllExport void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return false;
+        }
+
+        eProsima_user_DllExport inline bool is_plain(
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation) const override
+        {
+            static_cast<void>(data_representation);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            static_cast<void>(memory);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+
+    };
+
+    /*!
+     * @brief This class represents the TopicDataType of the type BoundedPhysiologyValue defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class BoundedPhysiologyValuePubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef BoundedPhysiologyValue type;
+
+        eProsima_user_DllExport BoundedPhysiologyValuePubSubType();
+
+        eProsima_user_DllExport ~BoundedPhysiologyValuePubSubType() override;
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+        {
+            return serialize(data, payload, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override
+        {
+            return getSerializedSizeProvider(data, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport void* createData() override;
+
+        eProsima_user_DllExport void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return false;
+        }
+
+        eProsima_user_DllExport inline bool is_plain(
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation) const override
+        {
+            static_cast<void>(data_representation);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            static_cast<void>(memory);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+
+    };
+
+    /*!
+     * @brief This class represents the TopicDataType of the type BoundedPhysiologyWaveform defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class BoundedPhysiologyWaveformPubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef BoundedPhysiologyWaveform type;
+
+        eProsima_user_DllExport BoundedPhysiologyWaveformPubSubType();
+
+        eProsima_user_DllExport ~BoundedPhysiologyWaveformPubSubType() override;
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+        {
+            return serialize(data, payload, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override
+        {
+            return getSerializedSizeProvider(data, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport void* createData() override;
+
+        eProsima_user_DllExport void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return false;
+        }
+
+        eProsima_user_DllExport inline bool is_plain(
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation) const override
+        {
+            static_cast<void>(data_representation);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            static_cast<void>(memory);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+
+    };
+
+    /*!
+     * @brief This class represents the TopicDataType of the type BoundedLog defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class BoundedLogPubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef BoundedLog type;
+
+        eProsima_user_DllExport BoundedLogPubSubType();
+
+        eProsima_user_DllExport ~BoundedLogPubSubType() override;
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+        {
+            return serialize(data, payload, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override
+        {
+            return getSerializedSizeProvider(data, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport void* createData() override;
+
+        eProsima_user_DllExport void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return false;
+        }
+
+        eProsima_user_DllExport inline bool is_plain(
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation) const override
+        {
+            static_cast<void>(data_representation);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            static_cast<void>(memory);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+
+    };
+
+    /*!
+     * @brief This class represents the TopicDataType of the type BoundedStatus defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class BoundedStatusPubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef BoundedStatus type;
+
+        eProsima_user_DllExport BoundedStatusPubSubType();
+
+        eProsima_user_DllExport ~BoundedStatusPubSubType() override;
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+        {
+            return serialize(data, payload, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override
+        {
+            return getSerializedSizeProvider(data, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport void* createData() override;
+
+        eProsima_user_DllExport void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return false;
+        }
+
+        eProsima_user_DllExport inline bool is_plain(
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation) const override
+        {
+            static_cast<void>(data_representation);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            static_cast<void>(memory);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+
+    };
+
+    /*!
+     * @brief This class represents the TopicDataType of the type BoundedCommand defined by the user in the IDL file.
+     * @ingroup AMM_Extended
+     */
+    class BoundedCommandPubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef BoundedCommand type;
+
+        eProsima_user_DllExport BoundedCommandPubSubType();
+
+        eProsima_user_DllExport ~BoundedCommandPubSubType() override;
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+        {
+            return serialize(data, payload, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override
+        {
+            return getSerializedSizeProvider(data, eprosima::fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+        }
+
+        eProsima_user_DllExport std::function<uint32_t()> getSerializedSizeProvider(
+                void* data,
+                eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+        eProsima_user_DllExport bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport void* createData() override;
+
+        eProsima_user_DllExport void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return false;
+        }
+
+        eProsima_user_DllExport inline bool is_plain(
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation) const override
+        {
+            static_cast<void>(data_representation);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            static_cast<void>(memory);
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+
+    };
+// End of the Bounded types.
 }
 
 #endif // _FAST_DDS_GENERATED_AMM_AMM_EXTENDED_PUBSUBTYPES_H_
@@ -0,0 +1,504 @@
+// Generated from AMM_Extended.idl by IDL/gen_reflection.py, do not edit.
+
+#pragma once
+
+#include "Reflection.h"
+#include "AMM_Extended.h"
+#include "AMM_StandardReflection.h"
+
+namespace AMM {
+   namespace reflection {
+
+      template<>
+      struct Struct<AMM::Tick> {
+         static const char *Name() { return "Tick"; }
+
+         static constexpr size_t Count = 2;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("frame", object.frame());
+            visitor("time", object.time());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 4:
+                  if (field == "time") {
+                     visitor(object.time());
+                     return true;
+                  }
+                  break;
+               case 5:
+                  if (field == "frame") {
+                     visitor(object.frame());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::InstrumentData> {
+         static const char *Name() { return "InstrumentData"; }
+
+         static constexpr size_t Count = 2;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("instrument", object.instrument());
+            visitor("payload", object.payload());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 7:
+                  if (field == "payload") {
+                     visitor(object.payload());
+                     return true;
+                  }
+                  break;
+               case 10:
+                  if (field == "instrument") {
+                     visitor(object.instrument());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::Command> {
+         static const char *Name() { return "Command"; }
+
+         static constexpr size_t Count = 1;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("message", object.message());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 7:
+                  if (field == "message") {
+                     visitor(object.message());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::CompactUUID> {
+         static const char *Name() { return "CompactUUID"; }
+
+         static constexpr size_t Count = 1;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("id", object.id());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 2:
+                  if (field == "id") {
+                     visitor(object.id());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::PhysiologyFrameEntry> {
+         static const char *Name() { return "PhysiologyFrameEntry"; }
+
+         static constexpr size_t Count = 2;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("name", object.name());
+            visitor("value", object.value());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 4:
+                  if (field == "name") {
+                     visitor(object.name());
+                     return true;
+                  }
+                  break;
+               case 5:
+                  if (field == "value") {
+                     visitor(object.value());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::PhysiologyFrame> {
+         static const char *Name() { return "PhysiologyFrame"; }
+
+         static constexpr size_t Count = 4;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("educational_encounter", object.educational_encounter());
+            visitor("simulation_time", object.simulation_time());
+            visitor("timestamp", object.timestamp());
+            visitor("values", object.values());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 6:
+                  if (field == "values") {
+                     visitor(object.values());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  break;
+               case 15:
+                  if (field == "simulation_time") {
+                     visitor(object.simulation_time());
+                     return true;
+                  }
+                  break;
+               case 21:
+                  if (field == "educational_encounter") {
+                     visitor(object.educational_encounter());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::BoundedUUID> {
+         static const char *Name() { return "BoundedUUID"; }
+
+         static constexpr size_t Count = 1;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("id", object.id());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 2:
+                  if (field == "id") {
+                     visitor(object.id());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::BoundedPhysiologyValue> {
+         static const char *Name() { return "BoundedPhysiologyValue"; }
+
+         static constexpr size_t Count = 6;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("educational_encounter", object.educational_encounter());
+            visitor("simulation_time", object.simulation_time());
+            visitor("timestamp", object.timestamp());
+            visitor("name", object.name());
+            visitor("unit", object.unit());
+            visitor("value", object.value());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 4:
+                  if (field == "name") {
+                     visitor(object.name());
+                     return true;
+                  }
+                  if (field == "unit") {
+                     visitor(object.unit());
+                     return true;
+                  }
+                  break;
+               case 5:
+                  if (field == "value") {
+                     visitor(object.value());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  break;
+               case 15:
+                  if (field == "simulation_time") {
+                     visitor(object.simulation_time());
+                     return true;
+                  }
+                  break;
+               case 21:
+                  if (field == "educational_encounter") {
+                     visitor(object.educational_encounter());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::BoundedPhysiologyWaveform> {
+         static const char *Name() { return "BoundedPhysiologyWaveform"; }
+
+         static constexpr size_t Count = 6;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("educational_encounter", object.educational_encounter());
+            visitor("simulation_time", object.simulation_time());
+            visitor("timestamp", object.timestamp());
+            visitor("name", object.name());
+            visitor("unit", object.unit());
+            visitor("value", object.value());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 4:
+                  if (field == "name") {
+                     visitor(object.name());
+                     return true;
+                  }
+                  if (field == "unit") {
+                     visitor(object.unit());
+                     return true;
+                  }
+                  break;
+               case 5:
+                  if (field == "value") {
+                     visitor(object.value());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  break;
+               case 15:
+                  if (field == "simulation_time") {
+                     visitor(object.simulation_time());
+                     return true;
+                  }
+                  break;
+               case 21:
+                  if (field == "educational_encounter") {
+                     visitor(object.educational_encounter());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::BoundedLog> {
+         static const char *Name() { return "BoundedLog"; }
+
+         static constexpr size_t Count = 4;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("timestamp", object.timestamp());
+            visitor("module_id", object.module_id());
+            visitor("level", object.level());
+            visitor("message", object.message());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 5:
+                  if (field == "level") {
+                     visitor(object.level());
+                     return true;
+                  }
+                  break;
+               case 7:
+                  if (field == "message") {
+                     visitor(object.message());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  if (field == "module_id") {
+                     visitor(object.module_id());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::BoundedStatus> {
+         static const char *Name() { return "BoundedStatus"; }
+
+         static constexpr size_t Count = 7;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("module_id", object.module_id());
+            visitor("module_name", object.module_name());
+            visitor("educational_encounter", object.educational_encounter());
+            visitor("capability", object.capability());
+            visitor("timestamp", object.timestamp());
+            visitor("value", object.value());
+            visitor("message", object.message());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 5:
+                  if (field == "value") {
+                     visitor(object.value());
+                     return true;
+                  }
+                  break;
+               case 7:
+                  if (field == "message") {
+                     visitor(object.message());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "module_id") {
+                     visitor(object.module_id());
+                     return true;
+                  }
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  break;
+               case 10:
+                  if (field == "capability") {
+                     visitor(object.capability());
+                     return true;
+                  }
+                  break;
+               case 11:
+                  if (field == "module_name") {
+                     visitor(object.module_name());
+                     return true;
+                  }
+                  break;
+               case 21:
+                  if (field == "educational_encounter") {
+                     visitor(object.educational_encounter());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::BoundedCommand> {
+         static const char *Name() { return "BoundedCommand"; }
+
+         static constexpr size_t Count = 1;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("message", object.message());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 7:
+                  if (field == "message") {
+                     visitor(object.message());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+   } // namespace reflection
+} // namespace AMM
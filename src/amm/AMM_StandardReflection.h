@@ -0,0 +1,1050 @@
+// Generated from AMM_Standard.idl by IDL/gen_reflection.py, do not edit.
+
+#pragma once
+
+#include "Reflection.h"
+#include "AMM_Standard.h"
+
+namespace AMM {
+   namespace reflection {
+
+      template<>
+      struct Struct<AMM::FMA_Location> {
+         static const char *Name() { return "FMA_Location"; }
+
+         static constexpr size_t Count = 2;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("FMAID", object.FMAID());
+            visitor("name", object.name());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 4:
+                  if (field == "name") {
+                     visitor(object.name());
+                     return true;
+                  }
+                  break;
+               case 5:
+                  if (field == "FMAID") {
+                     visitor(object.FMAID());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::UUID> {
+         static const char *Name() { return "UUID"; }
+
+         static constexpr size_t Count = 1;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("id", object.id());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 2:
+                  if (field == "id") {
+                     visitor(object.id());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Enum<AMM::AssessmentValue> {
+         static const char *Name() { return "AssessmentValue"; }
+
+         static constexpr size_t Count = 4;
+
+         static const char *const *Names() {
+            static const char *const names[] = {
+               "OMISSION_ERROR",
+               "COMMISSION_ERROR",
+               "EXECUTION_ERROR",
+               "SUCCESS",
+            };
+            return names;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::Assessment> {
+         static const char *Name() { return "Assessment"; }
+
+         static constexpr size_t Count = 4;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("id", object.id());
+            visitor("event_id", object.event_id());
+            visitor("value", object.value());
+            visitor("comment", object.comment());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 2:
+                  if (field == "id") {
+                     visitor(object.id());
+                     return true;
+                  }
+                  break;
+               case 5:
+                  if (field == "value") {
+                     visitor(object.value());
+                     return true;
+                  }
+                  break;
+               case 7:
+                  if (field == "comment") {
+                     visitor(object.comment());
+                     return true;
+                  }
+                  break;
+               case 8:
+                  if (field == "event_id") {
+                     visitor(object.event_id());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Enum<AMM::EventAgentType> {
+         static const char *Name() { return "EventAgentType"; }
+
+         static constexpr size_t Count = 4;
+
+         static const char *const *Names() {
+            static const char *const names[] = {
+               "LEARNER",
+               "INSTRUCTOR",
+               "SCENARIO",
+               "PHYSIOLOGY",
+            };
+            return names;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::EventFragment> {
+         static const char *Name() { return "EventFragment"; }
+
+         static constexpr size_t Count = 8;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("id", object.id());
+            visitor("timestamp", object.timestamp());
+            visitor("educational_encounter", object.educational_encounter());
+            visitor("location", object.location());
+            visitor("agent_type", object.agent_type());
+            visitor("agent_id", object.agent_id());
+            visitor("type", object.type());
+            visitor("data", object.data());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 2:
+                  if (field == "id") {
+                     visitor(object.id());
+                     return true;
+                  }
+                  break;
+               case 4:
+                  if (field == "type") {
+                     visitor(object.type());
+                     return true;
+                  }
+                  if (field == "data") {
+                     visitor(object.data());
+                     return true;
+                  }
+                  break;
+               case 8:
+                  if (field == "location") {
+                     visitor(object.location());
+                     return true;
+                  }
+                  if (field == "agent_id") {
+                     visitor(object.agent_id());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  break;
+               case 10:
+                  if (field == "agent_type") {
+                     visitor(object.agent_type());
+                     return true;
+                  }
+                  break;
+               case 21:
+                  if (field == "educational_encounter") {
+                     visitor(object.educational_encounter());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::EventRecord> {
+         static const char *Name() { return "EventRecord"; }
+
+         static constexpr size_t Count = 8;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("id", object.id());
+            visitor("timestamp", object.timestamp());
+            visitor("educational_encounter", object.educational_encounter());
+            visitor("location", object.location());
+            visitor("agent_type", object.agent_type());
+            visitor("agent_id", object.agent_id());
+            visitor("type", object.type());
+            visitor("data", object.data());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 2:
+                  if (field == "id") {
+                     visitor(object.id());
+                     return true;
+                  }
+                  break;
+               case 4:
+                  if (field == "type") {
+                     visitor(object.type());
+                     return true;
+                  }
+                  if (field == "data") {
+                     visitor(object.data());
+                     return true;
+                  }
+                  break;
+               case 8:
+                  if (field == "location") {
+                     visitor(object.location());
+                     return true;
+                  }
+                  if (field == "agent_id") {
+                     visitor(object.agent_id());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  break;
+               case 10:
+                  if (field == "agent_type") {
+                     visitor(object.agent_type());
+                     return true;
+                  }
+                  break;
+               case 21:
+                  if (field == "educational_encounter") {
+                     visitor(object.educational_encounter());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Enum<AMM::FAR_Status> {
+         static const char *Name() { return "FAR_Status"; }
+
+         static constexpr size_t Count = 3;
+
+         static const char *const *Names() {
+            static const char *const names[] = {
+               "REQUESTING",
+               "ACCEPTED",
+               "REJECTED",
+            };
+            return names;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::FragmentAmendmentRequest> {
+         static const char *Name() { return "FragmentAmendmentRequest"; }
+
+         static constexpr size_t Count = 6;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("id", object.id());
+            visitor("fragment_id", object.fragment_id());
+            visitor("status", object.status());
+            visitor("location", object.location());
+            visitor("agent_type", object.agent_type());
+            visitor("agent_id", object.agent_id());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 2:
+                  if (field == "id") {
+                     visitor(object.id());
+                     return true;
+                  }
+                  break;
+               case 6:
+                  if (field == "status") {
+                     visitor(object.status());
+                     return true;
+                  }
+                  break;
+               case 8:
+                  if (field == "location") {
+                     visitor(object.location());
+                     return true;
+                  }
+                  if (field == "agent_id") {
+                     visitor(object.agent_id());
+                     return true;
+                  }
+                  break;
+               case 10:
+                  if (field == "agent_type") {
+                     visitor(object.agent_type());
+                     return true;
+                  }
+                  break;
+               case 11:
+                  if (field == "fragment_id") {
+                     visitor(object.fragment_id());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Enum<AMM::LogLevel> {
+         static const char *Name() { return "LogLevel"; }
+
+         static constexpr size_t Count = 6;
+
+         static const char *const *Names() {
+            static const char *const names[] = {
+               "L_FATAL",
+               "L_ERROR",
+               "L_WARN",
+               "L_INFO",
+               "L_DEBUG",
+               "L_TRACE",
+            };
+            return names;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::Log> {
+         static const char *Name() { return "Log"; }
+
+         static constexpr size_t Count = 4;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("timestamp", object.timestamp());
+            visitor("module_id", object.module_id());
+            visitor("level", object.level());
+            visitor("message", object.message());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 5:
+                  if (field == "level") {
+                     visitor(object.level());
+                     return true;
+                  }
+                  break;
+               case 7:
+                  if (field == "message") {
+                     visitor(object.message());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  if (field == "module_id") {
+                     visitor(object.module_id());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::ModuleConfiguration> {
+         static const char *Name() { return "ModuleConfiguration"; }
+
+         static constexpr size_t Count = 5;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("name", object.name());
+            visitor("module_id", object.module_id());
+            visitor("educational_encounter", object.educational_encounter());
+            visitor("timestamp", object.timestamp());
+            visitor("capabilities_configuration", object.capabilities_configuration());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 4:
+                  if (field == "name") {
+                     visitor(object.name());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "module_id") {
+                     visitor(object.module_id());
+                     return true;
+                  }
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  break;
+               case 21:
+                  if (field == "educational_encounter") {
+                     visitor(object.educational_encounter());
+                     return true;
+                  }
+                  break;
+               case 26:
+                  if (field == "capabilities_configuration") {
+                     visitor(object.capabilities_configuration());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::OmittedEvent> {
+         static const char *Name() { return "OmittedEvent"; }
+
+         static constexpr size_t Count = 8;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("id", object.id());
+            visitor("timestamp", object.timestamp());
+            visitor("educational_encounter", object.educational_encounter());
+            visitor("location", object.location());
+            visitor("agent_type", object.agent_type());
+            visitor("agent_id", object.agent_id());
+            visitor("type", object.type());
+            visitor("data", object.data());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 2:
+                  if (field == "id") {
+                     visitor(object.id());
+                     return true;
+                  }
+                  break;
+               case 4:
+                  if (field == "type") {
+                     visitor(object.type());
+                     return true;
+                  }
+                  if (field == "data") {
+                     visitor(object.data());
+                     return true;
+                  }
+                  break;
+               case 8:
+                  if (field == "location") {
+                     visitor(object.location());
+                     return true;
+                  }
+                  if (field == "agent_id") {
+                     visitor(object.agent_id());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  break;
+               case 10:
+                  if (field == "agent_type") {
+                     visitor(object.agent_type());
+                     return true;
+                  }
+                  break;
+               case 21:
+                  if (field == "educational_encounter") {
+                     visitor(object.educational_encounter());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::Semantic_Version> {
+         static const char *Name() { return "Semantic_Version"; }
+
+         static constexpr size_t Count = 3;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("major", object.major());
+            visitor("minor", object.minor());
+            visitor("patch", object.patch());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 5:
+                  if (field == "major") {
+                     visitor(object.major());
+                     return true;
+                  }
+                  if (field == "minor") {
+                     visitor(object.minor());
+                     return true;
+                  }
+                  if (field == "patch") {
+                     visitor(object.patch());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::OperationalDescription> {
+         static const char *Name() { return "OperationalDescription"; }
+
+         static constexpr size_t Count = 11;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("name", object.name());
+            visitor("description", object.description());
+            visitor("manufacturer", object.manufacturer());
+            visitor("model", object.model());
+            visitor("serial_number", object.serial_number());
+            visitor("module_id", object.module_id());
+            visitor("module_version", object.module_version());
+            visitor("configuration_version", object.configuration_version());
+            visitor("AMM_version", object.AMM_version());
+            visitor("ip_address", object.ip_address());
+            visitor("capabilities_schema", object.capabilities_schema());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 4:
+                  if (field == "name") {
+                     visitor(object.name());
+                     return true;
+                  }
+                  break;
+               case 5:
+                  if (field == "model") {
+                     visitor(object.model());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "module_id") {
+                     visitor(object.module_id());
+                     return true;
+                  }
+                  break;
+               case 10:
+                  if (field == "ip_address") {
+                     visitor(object.ip_address());
+                     return true;
+                  }
+                  break;
+               case 11:
+                  if (field == "description") {
+                     visitor(object.description());
+                     return true;
+                  }
+                  if (field == "AMM_version") {
+                     visitor(object.AMM_version());
+                     return true;
+                  }
+                  break;
+               case 12:
+                  if (field == "manufacturer") {
+                     visitor(object.manufacturer());
+                     return true;
+                  }
+                  break;
+               case 13:
+                  if (field == "serial_number") {
+                     visitor(object.serial_number());
+                     return true;
+                  }
+                  break;
+               case 14:
+                  if (field == "module_version") {
+                     visitor(object.module_version());
+                     return true;
+                  }
+                  break;
+               case 19:
+                  if (field == "capabilities_schema") {
+                     visitor(object.capabilities_schema());
+                     return true;
+                  }
+                  break;
+               case 21:
+                  if (field == "configuration_version") {
+                     visitor(object.configuration_version());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::PhysiologyModification> {
+         static const char *Name() { return "PhysiologyModification"; }
+
+         static constexpr size_t Count = 4;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("id", object.id());
+            visitor("event_id", object.event_id());
+            visitor("type", object.type());
+            visitor("data", object.data());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 2:
+                  if (field == "id") {
+                     visitor(object.id());
+                     return true;
+                  }
+                  break;
+               case 4:
+                  if (field == "type") {
+                     visitor(object.type());
+                     return true;
+                  }
+                  if (field == "data") {
+                     visitor(object.data());
+                     return true;
+                  }
+                  break;
+               case 8:
+                  if (field == "event_id") {
+                     visitor(object.event_id());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::PhysiologyValue> {
+         static const char *Name() { return "PhysiologyValue"; }
+
+         static constexpr size_t Count = 6;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("educational_encounter", object.educational_encounter());
+            visitor("simulation_time", object.simulation_time());
+            visitor("timestamp", object.timestamp());
+            visitor("name", object.name());
+            visitor("unit", object.unit());
+            visitor("value", object.value());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 4:
+                  if (field == "name") {
+                     visitor(object.name());
+                     return true;
+                  }
+                  if (field == "unit") {
+                     visitor(object.unit());
+                     return true;
+                  }
+                  break;
+               case 5:
+                  if (field == "value") {
+                     visitor(object.value());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  break;
+               case 15:
+                  if (field == "simulation_time") {
+                     visitor(object.simulation_time());
+                     return true;
+                  }
+                  break;
+               case 21:
+                  if (field == "educational_encounter") {
+                     visitor(object.educational_encounter());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::PhysiologyWaveform> {
+         static const char *Name() { return "PhysiologyWaveform"; }
+
+         static constexpr size_t Count = 6;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("educational_encounter", object.educational_encounter());
+            visitor("simulation_time", object.simulation_time());
+            visitor("timestamp", object.timestamp());
+            visitor("name", object.name());
+            visitor("unit", object.unit());
+            visitor("value", object.value());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 4:
+                  if (field == "name") {
+                     visitor(object.name());
+                     return true;
+                  }
+                  if (field == "unit") {
+                     visitor(object.unit());
+                     return true;
+                  }
+                  break;
+               case 5:
+                  if (field == "value") {
+                     visitor(object.value());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  break;
+               case 15:
+                  if (field == "simulation_time") {
+                     visitor(object.simulation_time());
+                     return true;
+                  }
+                  break;
+               case 21:
+                  if (field == "educational_encounter") {
+                     visitor(object.educational_encounter());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::RenderModification> {
+         static const char *Name() { return "RenderModification"; }
+
+         static constexpr size_t Count = 4;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("id", object.id());
+            visitor("event_id", object.event_id());
+            visitor("type", object.type());
+            visitor("data", object.data());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 2:
+                  if (field == "id") {
+                     visitor(object.id());
+                     return true;
+                  }
+                  break;
+               case 4:
+                  if (field == "type") {
+                     visitor(object.type());
+                     return true;
+                  }
+                  if (field == "data") {
+                     visitor(object.data());
+                     return true;
+                  }
+                  break;
+               case 8:
+                  if (field == "event_id") {
+                     visitor(object.event_id());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Enum<AMM::ControlType> {
+         static const char *Name() { return "ControlType"; }
+
+         static constexpr size_t Count = 4;
+
+         static const char *const *Names() {
+            static const char *const names[] = {
+               "RUN",
+               "HALT",
+               "RESET",
+               "SAVE",
+            };
+            return names;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::SimulationControl> {
+         static const char *Name() { return "SimulationControl"; }
+
+         static constexpr size_t Count = 3;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("timestamp", object.timestamp());
+            visitor("type", object.type());
+            visitor("educational_encounter", object.educational_encounter());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 4:
+                  if (field == "type") {
+                     visitor(object.type());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  break;
+               case 21:
+                  if (field == "educational_encounter") {
+                     visitor(object.educational_encounter());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+      template<>
+      struct Enum<AMM::StatusValue> {
+         static const char *Name() { return "StatusValue"; }
+
+         static constexpr size_t Count = 3;
+
+         static const char *const *Names() {
+            static const char *const names[] = {
+               "OPERATIONAL",
+               "INOPERATIVE",
+               "EXIGENT",
+            };
+            return names;
+         }
+      };
+
+      template<>
+      struct Struct<AMM::Status> {
+         static const char *Name() { return "Status"; }
+
+         static constexpr size_t Count = 7;
+
+         template<class T, class Visitor>
+         static void ForEach(T &&object, Visitor &&visitor) {
+            visitor("module_id", object.module_id());
+            visitor("module_name", object.module_name());
+            visitor("educational_encounter", object.educational_encounter());
+            visitor("capability", object.capability());
+            visitor("timestamp", object.timestamp());
+            visitor("value", object.value());
+            visitor("message", object.message());
+         }
+
+         template<class T, class Visitor>
+         static bool Visit(T &&object, boost::string_view field, Visitor &&visitor) {
+            switch (field.size()) {
+               case 5:
+                  if (field == "value") {
+                     visitor(object.value());
+                     return true;
+                  }
+                  break;
+               case 7:
+                  if (field == "message") {
+                     visitor(object.message());
+                     return true;
+                  }
+                  break;
+               case 9:
+                  if (field == "module_id") {
+                     visitor(object.module_id());
+                     return true;
+                  }
+                  if (field == "timestamp") {
+                     visitor(object.timestamp());
+                     return true;
+                  }
+                  break;
+               case 10:
+                  if (field == "capability") {
+                     visitor(object.capability());
+                     return true;
+                  }
+                  break;
+               case 11:
+                  if (field == "module_name") {
+                     visitor(object.module_name());
+                     return true;
+                  }
+                  break;
+               case 21:
+                  if (field == "educational_encounter") {
+                     visitor(object.educational_encounter());
+                     return true;
+                  }
+                  break;
+               default:
+                  break;
+            }
+            return false;
+         }
+      };
+
+   } // namespace reflection
+} // namespace AMM
@@ -1,7 +1,13 @@
 
 #pragma once
 
+#include <deque>
+#include <mutex>
+#include <set>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <fastrtps/Domain.h>
 #include <fastrtps/participant/Participant.h>
@@ -10,6 +16,10 @@
 #include <fastrtps/subscriber/SampleInfo.h>
 
 #include "amm/DDS_Listeners.h"
+#include "amm/PayloadCodec.h"
+#include "amm/ParticipantRegistry.h"
+#include "amm/StaticDiscovery.h"
+#include "amm/TopicMemory.h"
 
 namespace AMM {
 
@@ -38,21 +48,22 @@ namespace AMM {
 
         /// Pointer to the Amm PubSub Type defined in this template.
         ///
-        /// @note Is managed internally by this template class.
+        /// @note Is managed internally by this template class and describes the type; the instance
+        /// registered with the participant is owned by ParticipantRegistry.
         /// @note e.g. T = AMM::AssessmentPubSubType
-        T *m_type;
+        T *m_type = nullptr;
 
         /// Pointer to the Subscriber Listener defined in this template.
         ///
         /// @note Is managed internally by this template class.
         /// @note e.g. L = DDS_Listeners::AssessmentListener.
-        L *m_listener;
+        L *m_listener = nullptr;
 
         /// Publisher of the Amm Data Type defined by this template.
-        eprosima::fastrtps::Publisher *m_publisher;
+        eprosima::fastrtps::Publisher *m_publisher = nullptr;
 
         /// Subscriber of the Amm Data Type defined by this template.
-        eprosima::fastrtps::Subscriber *m_subscriber;
+        eprosima::fastrtps::Subscriber *m_subscriber = nullptr;
 
         /// Is the publisher of this type initialized?
         ///
@@ -64,6 +75,17 @@ namespace AMM {
         /// @note Prevent access to a null subscriber pointer.
         bool m_isSubInit = false;
 
+        /// Does this instance count as a user of its registered type?
+        ///
+        /// @note The type is unregistered by ParticipantRegistry after its last user.
+        bool m_isTypeHeld = false;
+
+        /// History memory reserved by the Publisher, valid while m_isPubInit.
+        EndpointMemory m_pubMemory;
+
+        /// History memory reserved by the Subscriber, valid while m_isSubInit.
+        EndpointMemory m_subMemory;
+
         /// Name of this AMM Data Type that is to be registered on the DDS network.
         std::string m_topicName;
 
@@ -71,12 +93,41 @@ namespace AMM {
         ///
         /// @note Takes data from an object type that is defined by this template.
         /// @note e.g A = AMM::Assessment.
-        void (U::*m_onEvent)(A &, eprosima::fastrtps::SampleInfo_t *);
+        void (U::*m_onEvent)(A &, eprosima::fastrtps::SampleInfo_t *) = nullptr;
 
         /// Pointer to the parent object that is receiving subscribed events.
         ///
         /// @note This is an outside reference. It is not managed by this class.
-        U *m_parentClass;
+        U *m_parentClass = nullptr;
+
+        /// Guards m_onEvent, m_parentClass and the held samples, which may change while the Subscriber
+        /// is receiving.
+        std::mutex m_callbackMutex;
+
+        /// Samples received while holding, oldest first, delivered when a callback is bound.
+        std::deque<std::pair<A, eprosima::fastrtps::SampleInfo_t>> m_held;
+
+        /// Are received samples held until a callback is bound?
+        ///
+        /// @note Set by HoldUntilBound.
+        bool m_holding = false;
+
+        /// Most samples held, the size of the Subscriber's history.
+        std::size_t m_heldLimit = 0;
+
+        /// Held samples dropped because the limit was reached.
+        std::size_t m_heldDropped = 0;
+
+        /// Does the next Subscriber created request a liveliness lease?
+        ///
+        /// @note Set by RequestLivelinessLease.
+        bool m_requestLiveliness = false;
+
+        /// Lease the next Subscriber requests, valid while m_requestLiveliness.
+        eprosima::fastrtps::Duration_t m_livelinessLease;
+
+        /// Does the Subscriber request a liveliness lease? Valid while m_isSubInit.
+        bool m_subLiveliness = false;
 
     private:
 
@@ -84,6 +135,35 @@ namespace AMM {
         /// @note Will throw silent errors if any occur during cleanup, but will continue to remove all used objects.
         void ForceDelete();
 
+        /// Register the type of this template, counting this instance as one of its users.
+        /// @returns True if the type is registered.
+        bool HoldType();
+
+        /// History memory policy and resource limits for the Publisher and Subscriber of this type.
+        ///
+        /// Chosen by TopicMemory from the maximum serialized size of the type and the expected rate of
+        /// the topic.  Samples of bounded types (e.g. AMM::BoundedPhysiologyValue) never exceed the type
+        /// size, so a Publisher's history is fully preallocated.  A Subscriber's history is preallocated
+        /// at the same size but may grow: a module built without AMM_BOUNDED_TYPES can send a longer
+        /// string, which a fully preallocated reader would drop, and which is instead truncated to the
+        /// bound when deserialized.  Neither allocates once warmed up while samples stay in bounds.
+        /// @param publisher True for the Publisher, false for the Subscriber.
+        /// @returns Memory settings for an endpoint of this type.
+        TopicMemory::Policy MemoryPolicy(bool publisher) const;
+
+        /// Bind the subscription callback, first delivering the held samples to it.
+        ///
+        /// Held samples are taken one at a time, so samples received meanwhile are held behind them and
+        /// the callback sees every sample in order.
+        /// @param parentClass Object receiving subscribed events.
+        /// @param onEvent Callback, null to unbind.
+        void Bind(U *parentClass, void (U::*onEvent)(A &, eprosima::fastrtps::SampleInfo_t *));
+
+        /// Keep a received sample for the callback, called with m_callbackMutex held.
+        /// @param a Received sample.
+        /// @param info Sample info, may be null.
+        void Hold(A &a, eprosima::fastrtps::SampleInfo_t *info);
+
     public:
 
         /// Constructor for initializing an Amm Data Type.
@@ -132,9 +212,13 @@ namespace AMM {
         /// @returns Topic Name defined in the constructor of this type.
         std::string TopicName() { return m_topicName; }
 
+        /// State of whether a Publisher has been created for this Amm Data Type.
+        bool HasPublisher() { return m_publisher != nullptr; }
+
         /// Is this Amm Data Type registered on the DDS network?
         ///
         /// Runs a check if the topic name defined in the constructor has been registered on the DDS network.
+        /// CreatePublisher and CreateSubscriber skip it when this instance registered the type itself.
         /// @returns True if the name defined in the constructor is registered.
         bool IsTypeRegistered();
 
@@ -182,6 +266,30 @@ namespace AMM {
         /// @returns 0 if the write was successful.
         int Write(std::string &errmsg, A &a);
 
+        /// Hold the samples the Subscriber receives until a callback is bound.
+        ///
+        /// For Subscribers created before their callback, as DDSManager::Setup does.  Call it before
+        /// CreateSubscriber: the CreateSubscriber call that binds a callback delivers the held samples
+        /// to it, in order, on the calling thread.  At most as many samples as the Subscriber's history
+        /// are held, dropping the oldest first like the history does.  Binding no callback, e.g. for a
+        /// TickScheduler, stops holding and discards the held samples, which have no receiver.
+        void HoldUntilBound();
+
+        /// Request an automatic liveliness lease from the writers, for the next Subscriber created.
+        ///
+        /// The Subscriber is then told through its listener when a writer misses its lease.  Under
+        /// request vs offered matching it only matches writers offering a lease at least as short, and
+        /// writers offering none, like those of modules built before Status writers offered one, are not
+        /// matched at all.  So only readers that need liveliness, like the one feeding a
+        /// ModuleHealthMonitor, request it; every other reader keeps the default infinite lease and
+        /// matches any writer.  A CreateSubscriber call that finds the Subscriber created discards the
+        /// request.
+        /// @param lease Longest time between two liveliness assertions of a writer.
+        void RequestLivelinessLease(const eprosima::fastrtps::Duration_t &lease);
+
+        /// @returns True if the Subscriber is created and requested a liveliness lease.
+        bool SubscriberRequestsLiveliness() const { return m_isSubInit && m_subLiveliness; }
+
         /// Callback for subscriber events.
         ///
         /// Calls the function pointer m_onEvent passing these same parameters.
@@ -206,6 +314,19 @@ namespace AMM {
         /// @returns 0 if delete is successful.
         int Delete(std::string &errmsg);
 
+        /// Register the type again after Delete.
+        ///
+        /// Lets the DDS Manager reuse this object, and its type and callback, when a topic is
+        /// initialized again (e.g. on every scenario reset) instead of allocating a new one.
+        /// @returns 0 if successful.
+        int Reinitialize();
+
+        /// Register the type again after Delete.
+        ///
+        /// @param a Error message output.
+        /// @returns 0 if successful.
+        int Reinitialize(std::string &errmsg);
+
         /// Attempts to remove the Publisher associated with this type if one exists.
         ///
         /// @returns 0 if removal is successful or if publisher doesn't exist.
@@ -227,6 +348,16 @@ namespace AMM {
         /// @param a Error message output.
         /// @returns 0 if removal is successful or if subscriber doesn't exist.
         int RemoveSubscriber(std::string &errmsg);
+
+        /// Appends the history memory reserved by the Publisher and Subscriber of this type, if created.
+        ///
+        /// @param a Endpoint list output.
+        void AppendMemoryUsage(std::vector<EndpointMemory> &endpoints) const;
+
+        /// Appends the Publisher and Subscriber of this type, if created.
+        ///
+        /// @param a Endpoint set output.
+        void AppendEndpoints(std::set<const void *> &endpoints) const;
     };
 
     template<class T, class L, class A, class U>
@@ -242,13 +373,7 @@ namespace AMM {
         m_type = new T();
         m_type->setName(topicName.c_str());
 
-        if (IsTypeRegistered()) {
-            return;
-        }
-
-        eprosima::fastrtps::Domain::registerType(
-                p, (eprosima::fastdds::dds::TopicDataType *) m_type
-        );
+        HoldType();
 
     }
 
@@ -265,18 +390,7 @@ namespace AMM {
         m_type = new T();
         m_type->setName(topicName.c_str());
 
-        if (IsTypeRegistered()) {
-            err = 0;
-            return;
-        }
-
-        bool isRegistered = false;
-
-        isRegistered = eprosima::fastrtps::Domain::registerType(
-                p, (eprosima::fastdds::dds::TopicDataType *) m_type
-        );
-
-        if (isRegistered) {
+        if (HoldType()) {
             err = 0;
         } else {
             err = 1;
@@ -297,18 +411,7 @@ namespace AMM {
         m_type = new T();
         m_type->setName(topicName.c_str());
 
-        if (IsTypeRegistered()) {
-            err = 0;
-            return;
-        }
-
-        bool isRegistered = false;
-
-        isRegistered = eprosima::fastrtps::Domain::registerType(
-                p, (eprosima::fastdds::dds::TopicDataType *) m_type
-        );
-
-        if (isRegistered) {
+        if (HoldType()) {
             err = 0;
         } else {
             errmsg = topicName + " failed to initialize due to unknown error.";
@@ -316,6 +419,28 @@ namespace AMM {
         }
     }
 
+    template<class T, class L, class A, class U>
+    inline TopicMemory::Policy AmmDataType<T, L, A, U>::MemoryPolicy(bool publisher) const {
+        bool bounded = false;
+#ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        // Only our own samples are known to be in bounds.
+        bounded = publisher && m_type->is_bounded();
+#endif
+        return TopicMemory::Choose(m_type->m_typeSize, bounded, TopicMemory::ExpectedRate(m_topicName));
+    }
+
+    template<class T, class L, class A, class U>
+    inline void AmmDataType<T, L, A, U>::AppendMemoryUsage(std::vector<EndpointMemory> &endpoints) const {
+        if (m_isPubInit) endpoints.push_back(m_pubMemory);
+        if (m_isSubInit) endpoints.push_back(m_subMemory);
+    }
+
+    template<class T, class L, class A, class U>
+    inline void AmmDataType<T, L, A, U>::AppendEndpoints(std::set<const void *> &endpoints) const {
+        if (m_isPubInit) endpoints.insert(m_publisher);
+        if (m_isSubInit) endpoints.insert(m_subscriber);
+    }
+
     template<class T, class L, class A, class U>
     inline bool AmmDataType<T, L, A, U>::IsTypeRegistered() {
 
@@ -335,17 +460,37 @@ namespace AMM {
 
         if (m_isPubInit) return 0;
 
-        if (!IsTypeRegistered()) return 1;
+        if (!m_isTypeHeld && !IsTypeRegistered()) return 1;
 
         eprosima::fastrtps::PublisherAttributes pa;
 
         pa.topic.topicDataType = m_type->getName();
         pa.topic.topicName = m_topicName;
-        pa.historyMemoryPolicy = PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+        const TopicMemory::Policy memory = MemoryPolicy(true);
+        pa.historyMemoryPolicy = memory.memory;
+        TopicMemory::Apply(memory, pa.topic);
+        if (StaticDiscovery::IsEnabled(m_participant)) {
+            // Static discovery matches endpoints by the ids listed in the module manifest.
+            const int16_t id = StaticDiscovery::EndpointId(m_topicName, true);
+            pa.setUserDefinedID(id);
+            pa.setEntityID(id);
+        }
         if (m_topicName.compare("Physiology Waveform") == 0) {
             // LOG_INFO << "Setting phys waveform to Best Effort";
             pa.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
         }
+        if (m_topicName.compare("Physiology Frame") == 0) {
+            // One frame per step, a late or resent frame is already stale.
+            pa.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+            pa.qos.m_durability.kind = VOLATILE_DURABILITY_QOS;
+        }
+        if (m_topicName.compare("Status") == 0) {
+            // A reader requesting this lease sees a module that stops asserting liveliness for a second,
+            // see RequestLivelinessLease.  Offering it still matches readers that request none.
+            pa.qos.m_liveliness.kind = AUTOMATIC_LIVELINESS_QOS;
+            pa.qos.m_liveliness.lease_duration = eprosima::fastrtps::Duration_t(1, 0);
+            pa.qos.m_liveliness.announcement_period = eprosima::fastrtps::Duration_t(0, 500000000);
+        }
 
         try {
             m_publisher = eprosima::fastrtps::Domain::createPublisher(
@@ -362,6 +507,14 @@ namespace AMM {
             return 1;
         }
 
+        // A durable writer replays its history to readers discovered later, which may not decode it.
+        // Only compressed types are looked up.
+        if (std::is_base_of<PayloadEncoding, T>::value) {
+            PayloadCodec::OnWriterCreated(
+                    m_participant, m_topicName, pa.qos.m_durability.kind != VOLATILE_DURABILITY_QOS
+            );
+        }
+        m_pubMemory = TopicMemory::Describe(m_topicName, true, m_type->m_typeSize, memory);
         m_isPubInit = true;
 
         return 0;
@@ -372,7 +525,7 @@ namespace AMM {
 
         if (m_isPubInit) return 0;
 
-        if (!IsTypeRegistered()) {
+        if (!m_isTypeHeld && !IsTypeRegistered()) {
             errmsg = m_topicName + " is not properly initialized due to unknown error.";
             return 1;
         }
@@ -380,11 +533,31 @@ namespace AMM {
         eprosima::fastrtps::PublisherAttributes pa;
         pa.topic.topicDataType = m_type->getName();
         pa.topic.topicName = m_topicName;
-        pa.historyMemoryPolicy = PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+        const TopicMemory::Policy memory = MemoryPolicy(true);
+        pa.historyMemoryPolicy = memory.memory;
+        TopicMemory::Apply(memory, pa.topic);
+        if (StaticDiscovery::IsEnabled(m_participant)) {
+            // Static discovery matches endpoints by the ids listed in the module manifest.
+            const int16_t id = StaticDiscovery::EndpointId(m_topicName, true);
+            pa.setUserDefinedID(id);
+            pa.setEntityID(id);
+        }
         if (m_topicName.compare("Physiology Waveform") == 0) {
             // LOG_INFO << "Setting phys waveform to Best Effort";
             pa.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
         }
+        if (m_topicName.compare("Physiology Frame") == 0) {
+            // One frame per step, a late or resent frame is already stale.
+            pa.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+            pa.qos.m_durability.kind = VOLATILE_DURABILITY_QOS;
+        }
+        if (m_topicName.compare("Status") == 0) {
+            // A reader requesting this lease sees a module that stops asserting liveliness for a second,
+            // see RequestLivelinessLease.  Offering it still matches readers that request none.
+            pa.qos.m_liveliness.kind = AUTOMATIC_LIVELINESS_QOS;
+            pa.qos.m_liveliness.lease_duration = eprosima::fastrtps::Duration_t(1, 0);
+            pa.qos.m_liveliness.announcement_period = eprosima::fastrtps::Duration_t(0, 500000000);
+        }
 
         try {
             m_publisher = eprosima::fastrtps::Domain::createPublisher(
@@ -403,6 +576,14 @@ namespace AMM {
             return 1;
         }
 
+        // A durable writer replays its history to readers discovered later, which may not decode it.
+        // Only compressed types are looked up.
+        if (std::is_base_of<PayloadEncoding, T>::value) {
+            PayloadCodec::OnWriterCreated(
+                    m_participant, m_topicName, pa.qos.m_durability.kind != VOLATILE_DURABILITY_QOS
+            );
+        }
+        m_pubMemory = TopicMemory::Describe(m_topicName, true, m_type->m_typeSize, memory);
         m_isPubInit = true;
 
         return 0;
@@ -413,9 +594,23 @@ namespace AMM {
             ListenerInterface *li, U *parentClass, void (U::*onEvent)(A &, eprosima::fastrtps::SampleInfo_t *)
     ) {
 
-        if (m_isSubInit) return 0;
+        // A liveliness lease request only applies to the Subscriber this call creates.
+        const bool liveliness = m_requestLiveliness;
+        m_requestLiveliness = false;
+
+        if (m_isSubInit) {
+            // The Subscriber may have been created without a callback (e.g. by DDSManager::Setup).
+            if (onEvent != nullptr) {
+                Bind(parentClass, onEvent);
+            } else {
+                std::lock_guard<std::mutex> lock(m_callbackMutex);
+                m_holding = false;
+                m_held.clear();
+            }
+            return 0;
+        }
 
-        if (!IsTypeRegistered()) return 1;
+        if (!m_isTypeHeld && !IsTypeRegistered()) return 1;
 
         // Create a new Subscriber Listener for the type defined in this template.
         m_listener = new L();
@@ -423,12 +618,22 @@ namespace AMM {
         // Set the Subscriber Listener upstream to the Listener Interface.
         m_listener->SetUpstream(li);
 
-        m_parentClass = parentClass;
-
         eprosima::fastrtps::SubscriberAttributes sa;
         sa.topic.topicDataType = m_type->getName();
         sa.topic.topicName = m_topicName;
-        sa.historyMemoryPolicy = PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+        const TopicMemory::Policy memory = MemoryPolicy(false);
+        sa.historyMemoryPolicy = memory.memory;
+        TopicMemory::Apply(memory, sa.topic);
+        if (StaticDiscovery::IsEnabled(m_participant)) {
+            // Static discovery matches endpoints by the ids listed in the module manifest.
+            const int16_t id = StaticDiscovery::EndpointId(m_topicName, false);
+            sa.setUserDefinedID(id);
+            sa.setEntityID(id);
+        }
+        if (liveliness) {
+            sa.qos.m_liveliness.kind = AUTOMATIC_LIVELINESS_QOS;
+            sa.qos.m_liveliness.lease_duration = m_livelinessLease;
+        }
         try {
             m_subscriber = eprosima::fastrtps::Domain::createSubscriber(
                     m_participant,
@@ -438,15 +643,19 @@ namespace AMM {
         } catch (std::exception &e) {
             std::cerr << e.what() << std::endl;
             delete m_listener;
+            m_listener = nullptr;
             return 1;
         }
 
         if (m_subscriber == nullptr) {
             delete m_listener;
+            m_listener = nullptr;
             return 1;
         }
 
-        m_onEvent = onEvent;
+        Bind(parentClass, onEvent);
+        m_subMemory = TopicMemory::Describe(m_topicName, false, m_type->m_typeSize, memory);
+        m_subLiveliness = liveliness;
         m_isSubInit = true;
 
         return 0;
@@ -459,9 +668,23 @@ namespace AMM {
             void (U::*onEvent)(A &, eprosima::fastrtps::SampleInfo_t *)
     ) {
 
-        if (m_isSubInit) return 0;
+        // A liveliness lease request only applies to the Subscriber this call creates.
+        const bool liveliness = m_requestLiveliness;
+        m_requestLiveliness = false;
+
+        if (m_isSubInit) {
+            // The Subscriber may have been created without a callback (e.g. by DDSManager::Setup).
+            if (onEvent != nullptr) {
+                Bind(parentClass, onEvent);
+            } else {
+                std::lock_guard<std::mutex> lock(m_callbackMutex);
+                m_holding = false;
+                m_held.clear();
+            }
+            return 0;
+        }
 
-        if (!IsTypeRegistered()) {
+        if (!m_isTypeHeld && !IsTypeRegistered()) {
             errmsg = m_topicName + " is not properly initialized due to unknown error.";
             return 1;
         }
@@ -469,12 +692,22 @@ namespace AMM {
         m_listener = new L();
         m_listener->SetUpstream(li);
 
-        m_parentClass = parentClass;
-
         eprosima::fastrtps::SubscriberAttributes sa;
         sa.topic.topicDataType = m_type->getName();
         sa.topic.topicName = m_topicName;
-        sa.historyMemoryPolicy = PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+        const TopicMemory::Policy memory = MemoryPolicy(false);
+        sa.historyMemoryPolicy = memory.memory;
+        TopicMemory::Apply(memory, sa.topic);
+        if (StaticDiscovery::IsEnabled(m_participant)) {
+            // Static discovery matches endpoints by the ids listed in the module manifest.
+            const int16_t id = StaticDiscovery::EndpointId(m_topicName, false);
+            sa.setUserDefinedID(id);
+            sa.setEntityID(id);
+        }
+        if (liveliness) {
+            sa.qos.m_liveliness.kind = AUTOMATIC_LIVELINESS_QOS;
+            sa.qos.m_liveliness.lease_duration = m_livelinessLease;
+        }
         try {
             m_subscriber = eprosima::fastrtps::Domain::createSubscriber(
                     m_participant,
@@ -485,16 +718,20 @@ namespace AMM {
             errmsg = "Create subscriber failed -- ";
             errmsg.append(e.what());
             delete m_listener;
+            m_listener = nullptr;
             return 1;
         }
 
         if (m_subscriber == nullptr) {
             errmsg = "Create subscriber failed due to unknown error.";
             delete m_listener;
+            m_listener = nullptr;
             return 1;
         }
 
-        m_onEvent = onEvent;
+        Bind(parentClass, onEvent);
+        m_subMemory = TopicMemory::Describe(m_topicName, false, m_type->m_typeSize, memory);
+        m_subLiveliness = liveliness;
         m_isSubInit = true;
 
         return 0;
@@ -548,8 +785,70 @@ namespace AMM {
         // To use function pointers that belong to classes, a reference to both the function and the class
         // it belongs to must be held and invoked.
 
+        U *parentClass;
+        void (U::*onEvent)(A &, eprosima::fastrtps::SampleInfo_t *);
+        {
+            std::lock_guard<std::mutex> lock(m_callbackMutex);
+            if (m_holding) {
+                Hold(a, info);
+                return;
+            }
+            parentClass = m_parentClass;
+            onEvent = m_onEvent;
+        }
+
+        // Subscribers created without a callback (e.g. Tick feeding a TickScheduler) have nothing to invoke.
+        if (parentClass == nullptr || onEvent == nullptr) return;
+
         // Using pointer to parent class to invoke member method.
-        (m_parentClass->*m_onEvent)(a, info);
+        (parentClass->*onEvent)(a, info);
+    }
+
+    template<class T, class L, class A, class U>
+    inline void AmmDataType<T, L, A, U>::RequestLivelinessLease(const eprosima::fastrtps::Duration_t &lease) {
+        m_livelinessLease = lease;
+        m_requestLiveliness = true;
+    }
+
+    template<class T, class L, class A, class U>
+    inline void AmmDataType<T, L, A, U>::HoldUntilBound() {
+        std::lock_guard<std::mutex> lock(m_callbackMutex);
+        if (m_onEvent != nullptr) return;
+        m_holding = true;
+        m_heldLimit = static_cast<std::size_t>(MemoryPolicy(false).maxSamples);
+        m_heldDropped = 0;
+    }
+
+    template<class T, class L, class A, class U>
+    inline void AmmDataType<T, L, A, U>::Hold(A &a, eprosima::fastrtps::SampleInfo_t *info) {
+        if (m_held.size() >= m_heldLimit) {
+            m_held.pop_front();
+            if (m_heldDropped++ == 0) {
+                std::cerr << m_topicName << ": no callback bound yet, dropping the oldest held samples." << std::endl;
+            }
+        }
+        m_held.emplace_back(a, info != nullptr ? *info : eprosima::fastrtps::SampleInfo_t());
+    }
+
+    template<class T, class L, class A, class U>
+    inline void AmmDataType<T, L, A, U>::Bind(
+            U *parentClass, void (U::*onEvent)(A &, eprosima::fastrtps::SampleInfo_t *)
+    ) {
+        for (;;) {
+            std::pair<A, eprosima::fastrtps::SampleInfo_t> sample;
+            {
+                std::lock_guard<std::mutex> lock(m_callbackMutex);
+                if (onEvent == nullptr || m_held.empty()) {
+                    m_parentClass = parentClass;
+                    m_onEvent = onEvent;
+                    if (onEvent != nullptr) m_holding = false;
+                    return;
+                }
+                sample = std::move(m_held.front());
+                m_held.pop_front();
+            }
+            (parentClass->*onEvent)(sample.first, &sample.second);
+        }
     }
 
     template<class T, class L, class A, class U>
@@ -558,12 +857,11 @@ namespace AMM {
         RemovePublisher();
         RemoveSubscriber();
 
-        if (!eprosima::fastrtps::Domain::unregisterType(m_participant, m_topicName.c_str())) {
-            return 1;
+        if (m_isTypeHeld) {
+            m_isTypeHeld = false;
+            if (!ParticipantRegistry::UnregisterType(m_participant, m_topicName)) return 1;
         }
 
-        delete m_type;
-
         return 0;
     }
 
@@ -580,16 +878,42 @@ namespace AMM {
             return 1;
         }
 
-        if (!eprosima::fastrtps::Domain::unregisterType(m_participant, m_topicName.c_str())) {
-            errmsg = "An unknown error occured while decomissioning " + m_topicName + ".";
-            return 1;
+        if (m_isTypeHeld) {
+            m_isTypeHeld = false;
+            if (!ParticipantRegistry::UnregisterType(m_participant, m_topicName)) {
+                errmsg = "An unknown error occured while decomissioning " + m_topicName + ".";
+                return 1;
+            }
         }
 
-        delete m_type;
-
         return 0;
     }
 
+    template<class T, class L, class A, class U>
+    inline int AmmDataType<T, L, A, U>::Reinitialize() {
+        return HoldType() ? 0 : 1;
+    }
+
+    template<class T, class L, class A, class U>
+    inline int AmmDataType<T, L, A, U>::Reinitialize(std::string &errmsg) {
+        if (HoldType()) return 0;
+
+        errmsg = m_topicName + " failed to initialize due to unknown error.";
+        return 1;
+    }
+
+    template<class T, class L, class A, class U>
+    inline bool AmmDataType<T, L, A, U>::HoldType() {
+        if (m_isTypeHeld) return true;
+
+        m_isTypeHeld = ParticipantRegistry::RegisterType(m_participant, m_topicName, [this]() {
+            T *type = new T();
+            type->setName(m_topicName.c_str());
+            return (eprosima::fastdds::dds::TopicDataType *) type;
+        });
+        return m_isTypeHeld;
+    }
+
     template<class T, class L, class A, class U>
     inline void AmmDataType<T, L, A, U>::ForceDelete() {
 
@@ -600,9 +924,12 @@ namespace AMM {
         m_isSubInit = false;
 
         delete m_type;
+        m_type = nullptr;
         delete m_listener;
+        m_listener = nullptr;
 
-        eprosima::fastrtps::Domain::unregisterType(m_participant, m_topicName.c_str());
+        if (m_isTypeHeld) ParticipantRegistry::UnregisterType(m_participant, m_topicName);
+        m_isTypeHeld = false;
     }
 
     template<class T, class L, class A, class U>
@@ -636,6 +963,12 @@ namespace AMM {
 
         m_isSubInit = false;
         delete m_listener;
+        m_listener = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_callbackMutex);
+            m_holding = false;
+            m_held.clear();
+        }
         return 0;
     }
 
@@ -650,6 +983,12 @@ namespace AMM {
 
         m_isSubInit = false;
         delete m_listener;
+        m_listener = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_callbackMutex);
+            m_holding = false;
+            m_held.clear();
+        }
         return 0;
     }
 
@@ -675,21 +1014,22 @@ namespace AMM {
 
         /// Pointer to the Amm PubSub Type defined in this template.
         ///
-        /// @note Is managed internally by this template class.
+        /// @note Is managed internally by this template class and describes the type; the instance
+        /// registered with the participant is owned by ParticipantRegistry.
         /// @note e.g. T = AMM::AssessmentPubSubType
-        T *m_type;
+        T *m_type = nullptr;
 
         /// Pointer to the Subscriber Listener defined in this template.
         ///
         /// @note Is managed internally by this template class.
         /// @note e.g. L = DDS_Listeners::AssessmentListener.
-        L *m_listener;
+        L *m_listener = nullptr;
 
         /// Publisher of the Amm Data Type defined by this template.
-        eprosima::fastrtps::Publisher *m_publisher;
+        eprosima::fastrtps::Publisher *m_publisher = nullptr;
 
         /// Subscriber of the Amm Data Type defined by this template.
-        eprosima::fastrtps::Subscriber *m_subscriber;
+        eprosima::fastrtps::Subscriber *m_subscriber = nullptr;
 
         /// Is the publisher of this type initialized?
         ///
@@ -701,6 +1041,17 @@ namespace AMM {
         /// @note Prevent access to a null subscriber pointer.
         bool m_isSubInit = false;
 
+        /// Does this instance count as a user of its registered type?
+        ///
+        /// @note The type is unregistered by ParticipantRegistry after its last user.
+        bool m_isTypeHeld = false;
+
+        /// History memory reserved by the Publisher, valid while m_isPubInit.
+        EndpointMemory m_pubMemory;
+
+        /// History memory reserved by the Subscriber, valid while m_isSubInit.
+        EndpointMemory m_subMemory;
+
         /// Name of this AMM Data Type that is to be registered on the DDS network.
         std::string m_topicName;
 
@@ -708,7 +1059,35 @@ namespace AMM {
         ///
         /// @note Takes data from an object type that is defined by this template.
         /// @note e.g A = AMM::Assessment.
-        void (*m_onEvent)(A &, eprosima::fastrtps::SampleInfo_t *);
+        void (*m_onEvent)(A &, eprosima::fastrtps::SampleInfo_t *) = nullptr;
+
+        /// Guards m_onEvent and the held samples, which may change while the Subscriber is receiving.
+        std::mutex m_callbackMutex;
+
+        /// Samples received while holding, oldest first, delivered when a callback is bound.
+        std::deque<std::pair<A, eprosima::fastrtps::SampleInfo_t>> m_held;
+
+        /// Are received samples held until a callback is bound?
+        ///
+        /// @note Set by HoldUntilBound.
+        bool m_holding = false;
+
+        /// Most samples held, the size of the Subscriber's history.
+        std::size_t m_heldLimit = 0;
+
+        /// Held samples dropped because the limit was reached.
+        std::size_t m_heldDropped = 0;
+
+        /// Does the next Subscriber created request a liveliness lease?
+        ///
+        /// @note Set by RequestLivelinessLease.
+        bool m_requestLiveliness = false;
+
+        /// Lease the next Subscriber requests, valid while m_requestLiveliness.
+        eprosima::fastrtps::Duration_t m_livelinessLease;
+
+        /// Does the Subscriber request a liveliness lease? Valid while m_isSubInit.
+        bool m_subLiveliness = false;
 
     private:
 
@@ -716,6 +1095,34 @@ namespace AMM {
         /// @note Will throw silent errors if any occur during cleanup, but will continue to remove all used objects.
         void ForceDelete();
 
+        /// Register the type of this template, counting this instance as one of its users.
+        /// @returns True if the type is registered.
+        bool HoldType();
+
+        /// History memory policy and resource limits for the Publisher and Subscriber of this type.
+        ///
+        /// Chosen by TopicMemory from the maximum serialized size of the type and the expected rate of
+        /// the topic.  Samples of bounded types (e.g. AMM::BoundedPhysiologyValue) never exceed the type
+        /// size, so a Publisher's history is fully preallocated.  A Subscriber's history is preallocated
+        /// at the same size but may grow: a module built without AMM_BOUNDED_TYPES can send a longer
+        /// string, which a fully preallocated reader would drop, and which is instead truncated to the
+        /// bound when deserialized.  Neither allocates once warmed up while samples stay in bounds.
+        /// @param publisher True for the Publisher, false for the Subscriber.
+        /// @returns Memory settings for an endpoint of this type.
+        TopicMemory::Policy MemoryPolicy(bool publisher) const;
+
+        /// Bind the subscription callback, first delivering the held samples to it.
+        ///
+        /// Held samples are taken one at a time, so samples received meanwhile are held behind them and
+        /// the callback sees every sample in order.
+        /// @param onEvent Callback, null to unbind.
+        void Bind(void (*onEvent)(A &, eprosima::fastrtps::SampleInfo_t *));
+
+        /// Keep a received sample for the callback, called with m_callbackMutex held.
+        /// @param a Received sample.
+        /// @param info Sample info, may be null.
+        void Hold(A &a, eprosima::fastrtps::SampleInfo_t *info);
+
     public:
 
         /// Constructor for initializing an Amm Data Type.
@@ -764,9 +1171,13 @@ namespace AMM {
         /// @returns Topic Name defined in the constructor of this type.
         std::string TopicName() { return m_topicName; }
 
+        /// State of whether a Publisher has been created for this Amm Data Type.
+        bool HasPublisher() { return m_publisher != nullptr; }
+
         /// Is this Amm Data Type registered on the DDS network?
         ///
         /// Runs a check if the topic name defined in the constructor has been registered on the DDS network.
+        /// CreatePublisher and CreateSubscriber skip it when this instance registered the type itself.
         /// @returns True if the name defined in the constructor is registered.
         bool IsTypeRegistered();
 
@@ -814,6 +1225,30 @@ namespace AMM {
         /// @returns 0 if the write was successful.
         int Write(std::string &errmsg, A &a);
 
+        /// Hold the samples the Subscriber receives until a callback is bound.
+        ///
+        /// For Subscribers created before their callback, as DDSManager::Setup does.  Call it before
+        /// CreateSubscriber: the CreateSubscriber call that binds a callback delivers the held samples
+        /// to it, in order, on the calling thread.  At most as many samples as the Subscriber's history
+        /// are held, dropping the oldest first like the history does.  Binding no callback, e.g. for a
+        /// TickScheduler, stops holding and discards the held samples, which have no receiver.
+        void HoldUntilBound();
+
+        /// Request an automatic liveliness lease from the writers, for the next Subscriber created.
+        ///
+        /// The Subscriber is then told through its listener when a writer misses its lease.  Under
+        /// request vs offered matching it only matches writers offering a lease at least as short, and
+        /// writers offering none, like those of modules built before Status writers offered one, are not
+        /// matched at all.  So only readers that need liveliness, like the one feeding a
+        /// ModuleHealthMonitor, request it; every other reader keeps the default infinite lease and
+        /// matches any writer.  A CreateSubscriber call that finds the Subscriber created discards the
+        /// request.
+        /// @param lease Longest time between two liveliness assertions of a writer.
+        void RequestLivelinessLease(const eprosima::fastrtps::Duration_t &lease);
+
+        /// @returns True if the Subscriber is created and requested a liveliness lease.
+        bool SubscriberRequestsLiveliness() const { return m_isSubInit && m_subLiveliness; }
+
         /// Callback for subscriber events.
         ///
         /// Calls the function pointer m_onEvent passing these same parameters.
@@ -838,6 +1273,19 @@ namespace AMM {
         /// @returns 0 if delete is successful.
         int Delete(std::string &errmsg);
 
+        /// Register the type again after Delete.
+        ///
+        /// Lets the DDS Manager reuse this object, and its type and callback, when a topic is
+        /// initialized again (e.g. on every scenario reset) instead of allocating a new one.
+        /// @returns 0 if successful.
+        int Reinitialize();
+
+        /// Register the type again after Delete.
+        ///
+        /// @param a Error message output.
+        /// @returns 0 if successful.
+        int Reinitialize(std::string &errmsg);
+
         /// Attempts to remove the Publisher associated with this type if one exists.
         ///
         /// @returns 0 if removal is successful or if publisher doesn't exist.
@@ -859,6 +1307,16 @@ namespace AMM {
         /// @param a Error message output.
         /// @returns 0 if removal is successful or if subscriber doesn't exist.
         int RemoveSubscriber(std::string &errmsg);
+
+        /// Appends the history memory reserved by the Publisher and Subscriber of this type, if created.
+        ///
+        /// @param a Endpoint list output.
+        void AppendMemoryUsage(std::vector<EndpointMemory> &endpoints) const;
+
+        /// Appends the Publisher and Subscriber of this type, if created.
+        ///
+        /// @param a Endpoint set output.
+        void AppendEndpoints(std::set<const void *> &endpoints) const;
     };
 
     template<class T, class L, class A>
@@ -874,13 +1332,7 @@ namespace AMM {
         m_type = new T();
         m_type->setName(topicName.c_str());
 
-        if (IsTypeRegistered()) {
-            return;
-        }
-
-        eprosima::fastrtps::Domain::registerType(
-                p, (eprosima::fastdds::dds::TopicDataType *) m_type
-        );
+        HoldType();
 
     }
 
@@ -897,18 +1349,7 @@ namespace AMM {
         m_type = new T();
         m_type->setName(topicName.c_str());
 
-        if (IsTypeRegistered()) {
-            err = 0;
-            return;
-        }
-
-        bool isRegistered = false;
-
-        isRegistered = eprosima::fastrtps::Domain::registerType(
-                p, (eprosima::fastdds::dds::TopicDataType *) m_type
-        );
-
-        if (isRegistered) {
+        if (HoldType()) {
             err = 0;
         } else {
             err = 1;
@@ -929,18 +1370,7 @@ namespace AMM {
         m_type = new T();
         m_type->setName(topicName.c_str());
 
-        if (IsTypeRegistered()) {
-            err = 0;
-            return;
-        }
-
-        bool isRegistered = false;
-
-        isRegistered = eprosima::fastrtps::Domain::registerType(
-                p, (eprosima::fastdds::dds::TopicDataType *) m_type
-        );
-
-        if (isRegistered) {
+        if (HoldType()) {
             err = 0;
         } else {
             errmsg = topicName + " failed to initialize due to unknown error.";
@@ -948,6 +1378,28 @@ namespace AMM {
         }
     }
 
+    template<class T, class L, class A>
+    inline TopicMemory::Policy AmmDataType<T, L, A, void>::MemoryPolicy(bool publisher) const {
+        bool bounded = false;
+#ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        // Only our own samples are known to be in bounds.
+        bounded = publisher && m_type->is_bounded();
+#endif
+        return TopicMemory::Choose(m_type->m_typeSize, bounded, TopicMemory::ExpectedRate(m_topicName));
+    }
+
+    template<class T, class L, class A>
+    inline void AmmDataType<T, L, A, void>::AppendMemoryUsage(std::vector<EndpointMemory> &endpoints) const {
+        if (m_isPubInit) endpoints.push_back(m_pubMemory);
+        if (m_isSubInit) endpoints.push_back(m_subMemory);
+    }
+
+    template<class T, class L, class A>
+    inline void AmmDataType<T, L, A, void>::AppendEndpoints(std::set<const void *> &endpoints) const {
+        if (m_isPubInit) endpoints.insert(m_publisher);
+        if (m_isSubInit) endpoints.insert(m_subscriber);
+    }
+
     template<class T, class L, class A>
     inline bool AmmDataType<T, L, A, void>::IsTypeRegistered() {
 
@@ -967,11 +1419,35 @@ namespace AMM {
 
         if (m_isPubInit) return 0;
 
-        if (!IsTypeRegistered()) return 1;
+        if (!m_isTypeHeld && !IsTypeRegistered()) return 1;
 
         eprosima::fastrtps::PublisherAttributes pa;
         pa.topic.topicDataType = m_type->getName();
         pa.topic.topicName = m_topicName;
+        const TopicMemory::Policy memory = MemoryPolicy(true);
+        pa.historyMemoryPolicy = memory.memory;
+        TopicMemory::Apply(memory, pa.topic);
+        if (StaticDiscovery::IsEnabled(m_participant)) {
+            // Static discovery matches endpoints by the ids listed in the module manifest.
+            const int16_t id = StaticDiscovery::EndpointId(m_topicName, true);
+            pa.setUserDefinedID(id);
+            pa.setEntityID(id);
+        }
+        if (m_topicName.compare("Physiology Waveform") == 0) {
+            pa.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+        }
+        if (m_topicName.compare("Physiology Frame") == 0) {
+            // One frame per step, a late or resent frame is already stale.
+            pa.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+            pa.qos.m_durability.kind = VOLATILE_DURABILITY_QOS;
+        }
+        if (m_topicName.compare("Status") == 0) {
+            // A reader requesting this lease sees a module that stops asserting liveliness for a second,
+            // see RequestLivelinessLease.  Offering it still matches readers that request none.
+            pa.qos.m_liveliness.kind = AUTOMATIC_LIVELINESS_QOS;
+            pa.qos.m_liveliness.lease_duration = eprosima::fastrtps::Duration_t(1, 0);
+            pa.qos.m_liveliness.announcement_period = eprosima::fastrtps::Duration_t(0, 500000000);
+        }
 
         try {
             m_publisher = eprosima::fastrtps::Domain::createPublisher(
@@ -988,6 +1464,14 @@ namespace AMM {
             return 1;
         }
 
+        // A durable writer replays its history to readers discovered later, which may not decode it.
+        // Only compressed types are looked up.
+        if (std::is_base_of<PayloadEncoding, T>::value) {
+            PayloadCodec::OnWriterCreated(
+                    m_participant, m_topicName, pa.qos.m_durability.kind != VOLATILE_DURABILITY_QOS
+            );
+        }
+        m_pubMemory = TopicMemory::Describe(m_topicName, true, m_type->m_typeSize, memory);
         m_isPubInit = true;
 
         return 0;
@@ -998,7 +1482,7 @@ namespace AMM {
 
         if (m_isPubInit) return 0;
 
-        if (!IsTypeRegistered()) {
+        if (!m_isTypeHeld && !IsTypeRegistered()) {
             errmsg = m_topicName + " is not properly initialized due to unknown error.";
             return 1;
         }
@@ -1006,6 +1490,30 @@ namespace AMM {
         eprosima::fastrtps::PublisherAttributes pa;
         pa.topic.topicDataType = m_type->getName();
         pa.topic.topicName = m_topicName;
+        const TopicMemory::Policy memory = MemoryPolicy(true);
+        pa.historyMemoryPolicy = memory.memory;
+        TopicMemory::Apply(memory, pa.topic);
+        if (StaticDiscovery::IsEnabled(m_participant)) {
+            // Static discovery matches endpoints by the ids listed in the module manifest.
+            const int16_t id = StaticDiscovery::EndpointId(m_topicName, true);
+            pa.setUserDefinedID(id);
+            pa.setEntityID(id);
+        }
+        if (m_topicName.compare("Physiology Waveform") == 0) {
+            pa.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+        }
+        if (m_topicName.compare("Physiology Frame") == 0) {
+            // One frame per step, a late or resent frame is already stale.
+            pa.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+            pa.qos.m_durability.kind = VOLATILE_DURABILITY_QOS;
+        }
+        if (m_topicName.compare("Status") == 0) {
+            // A reader requesting this lease sees a module that stops asserting liveliness for a second,
+            // see RequestLivelinessLease.  Offering it still matches readers that request none.
+            pa.qos.m_liveliness.kind = AUTOMATIC_LIVELINESS_QOS;
+            pa.qos.m_liveliness.lease_duration = eprosima::fastrtps::Duration_t(1, 0);
+            pa.qos.m_liveliness.announcement_period = eprosima::fastrtps::Duration_t(0, 500000000);
+        }
 
         try {
             m_publisher = eprosima::fastrtps::Domain::createPublisher(
@@ -1024,6 +1532,14 @@ namespace AMM {
             return 1;
         }
 
+        // A durable writer replays its history to readers discovered later, which may not decode it.
+        // Only compressed types are looked up.
+        if (std::is_base_of<PayloadEncoding, T>::value) {
+            PayloadCodec::OnWriterCreated(
+                    m_participant, m_topicName, pa.qos.m_durability.kind != VOLATILE_DURABILITY_QOS
+            );
+        }
+        m_pubMemory = TopicMemory::Describe(m_topicName, true, m_type->m_typeSize, memory);
         m_isPubInit = true;
 
         return 0;
@@ -1034,9 +1550,23 @@ namespace AMM {
             ListenerInterface *li, void (*onEvent)(A &, eprosima::fastrtps::SampleInfo_t *)
     ) {
 
-        if (m_isSubInit) return 0;
+        // A liveliness lease request only applies to the Subscriber this call creates.
+        const bool liveliness = m_requestLiveliness;
+        m_requestLiveliness = false;
+
+        if (m_isSubInit) {
+            // The Subscriber may have been created without a callback (e.g. by DDSManager::Setup).
+            if (onEvent != nullptr) {
+                Bind(onEvent);
+            } else {
+                std::lock_guard<std::mutex> lock(m_callbackMutex);
+                m_holding = false;
+                m_held.clear();
+            }
+            return 0;
+        }
 
-        if (!IsTypeRegistered()) return 1;
+        if (!m_isTypeHeld && !IsTypeRegistered()) return 1;
 
         // Create a new Subscriber Listener for the type defined in this template.
         m_listener = new L();
@@ -1048,7 +1578,19 @@ namespace AMM {
         eprosima::fastrtps::SubscriberAttributes sa;
         sa.topic.topicDataType = m_type->getName();
         sa.topic.topicName = m_topicName;
-        sa.historyMemoryPolicy = PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+        const TopicMemory::Policy memory = MemoryPolicy(false);
+        sa.historyMemoryPolicy = memory.memory;
+        TopicMemory::Apply(memory, sa.topic);
+        if (StaticDiscovery::IsEnabled(m_participant)) {
+            // Static discovery matches endpoints by the ids listed in the module manifest.
+            const int16_t id = StaticDiscovery::EndpointId(m_topicName, false);
+            sa.setUserDefinedID(id);
+            sa.setEntityID(id);
+        }
+        if (liveliness) {
+            sa.qos.m_liveliness.kind = AUTOMATIC_LIVELINESS_QOS;
+            sa.qos.m_liveliness.lease_duration = m_livelinessLease;
+        }
         try {
             m_subscriber = eprosima::fastrtps::Domain::createSubscriber(
                     m_participant,
@@ -1058,15 +1600,19 @@ namespace AMM {
         } catch (std::exception &e) {
             std::cerr << e.what() << std::endl;
             delete m_listener;
+            m_listener = nullptr;
             return 1;
         }
 
         if (m_subscriber == nullptr) {
             delete m_listener;
+            m_listener = nullptr;
             return 1;
         }
 
-        m_onEvent = onEvent;
+        Bind(onEvent);
+        m_subMemory = TopicMemory::Describe(m_topicName, false, m_type->m_typeSize, memory);
+        m_subLiveliness = liveliness;
         m_isSubInit = true;
 
         return 0;
@@ -1077,9 +1623,23 @@ namespace AMM {
             std::string &errmsg, ListenerInterface *li, void (*onEvent)(A &, eprosima::fastrtps::SampleInfo_t *)
     ) {
 
-        if (m_isSubInit) return 0;
+        // A liveliness lease request only applies to the Subscriber this call creates.
+        const bool liveliness = m_requestLiveliness;
+        m_requestLiveliness = false;
+
+        if (m_isSubInit) {
+            // The Subscriber may have been created without a callback (e.g. by DDSManager::Setup).
+            if (onEvent != nullptr) {
+                Bind(onEvent);
+            } else {
+                std::lock_guard<std::mutex> lock(m_callbackMutex);
+                m_holding = false;
+                m_held.clear();
+            }
+            return 0;
+        }
 
-        if (!IsTypeRegistered()) {
+        if (!m_isTypeHeld && !IsTypeRegistered()) {
             errmsg = m_topicName + " is not properly initialized due to unknown error.";
             return 1;
         }
@@ -1091,7 +1651,19 @@ namespace AMM {
         eprosima::fastrtps::SubscriberAttributes sa;
         sa.topic.topicDataType = m_type->getName();
         sa.topic.topicName = m_topicName;
-        sa.historyMemoryPolicy = PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+        const TopicMemory::Policy memory = MemoryPolicy(false);
+        sa.historyMemoryPolicy = memory.memory;
+        TopicMemory::Apply(memory, sa.topic);
+        if (StaticDiscovery::IsEnabled(m_participant)) {
+            // Static discovery matches endpoints by the ids listed in the module manifest.
+            const int16_t id = StaticDiscovery::EndpointId(m_topicName, false);
+            sa.setUserDefinedID(id);
+            sa.setEntityID(id);
+        }
+        if (liveliness) {
+            sa.qos.m_liveliness.kind = AUTOMATIC_LIVELINESS_QOS;
+            sa.qos.m_liveliness.lease_duration = m_livelinessLease;
+        }
         try {
             m_subscriber = eprosima::fastrtps::Domain::createSubscriber(
                     m_participant,
@@ -1102,16 +1674,20 @@ namespace AMM {
             errmsg = "Create subscriber failed -- ";
             errmsg.append(e.what());
             delete m_listener;
+            m_listener = nullptr;
             return 1;
         }
 
         if (m_subscriber == nullptr) {
             errmsg = "Create subscriber failed due to unknown error.";
             delete m_listener;
+            m_listener = nullptr;
             return 1;
         }
 
-        m_onEvent = onEvent;
+        Bind(onEvent);
+        m_subMemory = TopicMemory::Describe(m_topicName, false, m_type->m_typeSize, memory);
+        m_subLiveliness = liveliness;
         m_isSubInit = true;
 
         return 0;
@@ -1165,8 +1741,65 @@ namespace AMM {
         // To use function pointers that belong to classes, a reference to both the function and the class
         // it belongs to must be held and invoked.
 
+        void (*onEvent)(A &, eprosima::fastrtps::SampleInfo_t *);
+        {
+            std::lock_guard<std::mutex> lock(m_callbackMutex);
+            if (m_holding) {
+                Hold(a, info);
+                return;
+            }
+            onEvent = m_onEvent;
+        }
+
+        // Subscribers created without a callback (e.g. Tick feeding a TickScheduler) have nothing to invoke.
+        if (onEvent == nullptr) return;
+
         // Using pointer to parent class to invoke member method.
-        m_onEvent(a, info);
+        onEvent(a, info);
+    }
+
+    template<class T, class L, class A>
+    inline void AmmDataType<T, L, A, void>::RequestLivelinessLease(const eprosima::fastrtps::Duration_t &lease) {
+        m_livelinessLease = lease;
+        m_requestLiveliness = true;
+    }
+
+    template<class T, class L, class A>
+    inline void AmmDataType<T, L, A, void>::HoldUntilBound() {
+        std::lock_guard<std::mutex> lock(m_callbackMutex);
+        if (m_onEvent != nullptr) return;
+        m_holding = true;
+        m_heldLimit = static_cast<std::size_t>(MemoryPolicy(false).maxSamples);
+        m_heldDropped = 0;
+    }
+
+    template<class T, class L, class A>
+    inline void AmmDataType<T, L, A, void>::Hold(A &a, eprosima::fastrtps::SampleInfo_t *info) {
+        if (m_held.size() >= m_heldLimit) {
+            m_held.pop_front();
+            if (m_heldDropped++ == 0) {
+                std::cerr << m_topicName << ": no callback bound yet, dropping the oldest held samples." << std::endl;
+            }
+        }
+        m_held.emplace_back(a, info != nullptr ? *info : eprosima::fastrtps::SampleInfo_t());
+    }
+
+    template<class T, class L, class A>
+    inline void AmmDataType<T, L, A, void>::Bind(void (*onEvent)(A &, eprosima::fastrtps::SampleInfo_t *)) {
+        for (;;) {
+            std::pair<A, eprosima::fastrtps::SampleInfo_t> sample;
+            {
+                std::lock_guard<std::mutex> lock(m_callbackMutex);
+                if (onEvent == nullptr || m_held.empty()) {
+                    m_onEvent = onEvent;
+                    if (onEvent != nullptr) m_holding = false;
+                    return;
+                }
+                sample = std::move(m_held.front());
+                m_held.pop_front();
+            }
+            onEvent(sample.first, &sample.second);
+        }
     }
 
     template<class T, class L, class A>
@@ -1175,12 +1808,11 @@ namespace AMM {
         RemovePublisher();
         RemoveSubscriber();
 
-        if (!eprosima::fastrtps::Domain::unregisterType(m_participant, m_topicName.c_str())) {
-            return 1;
+        if (m_isTypeHeld) {
+            m_isTypeHeld = false;
+            if (!ParticipantRegistry::UnregisterType(m_participant, m_topicName)) return 1;
         }
 
-        delete m_type;
-
         return 0;
     }
 
@@ -1197,16 +1829,42 @@ namespace AMM {
             return 1;
         }
 
-        if (!eprosima::fastrtps::Domain::unregisterType(m_participant, m_topicName.c_str())) {
-            errmsg = "An unknown error occured while decomissioning " + m_topicName + ".";
-            return 1;
+        if (m_isTypeHeld) {
+            m_isTypeHeld = false;
+            if (!ParticipantRegistry::UnregisterType(m_participant, m_topicName)) {
+                errmsg = "An unknown error occured while decomissioning " + m_topicName + ".";
+                return 1;
+            }
         }
 
-        delete m_type;
-
         return 0;
     }
 
+    template<class T, class L, class A>
+    inline int AmmDataType<T, L, A, void>::Reinitialize() {
+        return HoldType() ? 0 : 1;
+    }
+
+    template<class T, class L, class A>
+    inline int AmmDataType<T, L, A, void>::Reinitialize(std::string &errmsg) {
+        if (HoldType()) return 0;
+
+        errmsg = m_topicName + " failed to initialize due to unknown error.";
+        return 1;
+    }
+
+    template<class T, class L, class A>
+    inline bool AmmDataType<T, L, A, void>::HoldType() {
+        if (m_isTypeHeld) return true;
+
+        m_isTypeHeld = ParticipantRegistry::RegisterType(m_participant, m_topicName, [this]() {
+            T *type = new T();
+            type->setName(m_topicName.c_str());
+            return (eprosima::fastdds::dds::TopicDataType *) type;
+        });
+        return m_isTypeHeld;
+    }
+
     template<class T, class L, class A>
     inline void AmmDataType<T, L, A, void>::ForceDelete() {
 
@@ -1217,9 +1875,12 @@ namespace AMM {
         m_isSubInit = false;
 
         delete m_type;
+        m_type = nullptr;
         delete m_listener;
+        m_listener = nullptr;
 
-        eprosima::fastrtps::Domain::unregisterType(m_participant, m_topicName.c_str());
+        if (m_isTypeHeld) ParticipantRegistry::UnregisterType(m_participant, m_topicName);
+        m_isTypeHeld = false;
     }
 
     template<class T, class L, class A>
@@ -1253,6 +1914,12 @@ namespace AMM {
 
         m_isSubInit = false;
         delete m_listener;
+        m_listener = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_callbackMutex);
+            m_holding = false;
+            m_held.clear();
+        }
         return 0;
     }
 
@@ -1267,6 +1934,12 @@ namespace AMM {
 
         m_isSubInit = false;
         delete m_listener;
+        m_listener = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_callbackMutex);
+            m_holding = false;
+            m_held.clear();
+        }
         return 0;
     }
 
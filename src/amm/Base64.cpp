@@ -0,0 +1,330 @@
+#include "Utility.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define AMM_BASE64_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define AMM_TARGET(isa)
+#else
+#define AMM_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+namespace AMM {
+
+   namespace {
+
+      const char ENCODE_TABLE[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+      /// 0-63 for base64 characters, 64 for everything else.
+      struct DecodeTable {
+         uint8_t values[256];
+
+         DecodeTable() {
+            std::memset(values, 64, sizeof(values));
+            for (uint8_t i = 0; i < 64; ++i) {
+               values[static_cast<uint8_t>(ENCODE_TABLE[i])] = i;
+            }
+         }
+      };
+
+      const DecodeTable DECODE_TABLE;
+
+      size_t EncodeScalar(const uint8_t *in, size_t size, char *out) {
+         char *start = out;
+         size_t i = 0;
+         for (; i + 3 <= size; i += 3) {
+            const uint32_t v = (uint32_t(in[i]) << 16) | (uint32_t(in[i + 1]) << 8) | in[i + 2];
+            *out++ = ENCODE_TABLE[v >> 18];
+            *out++ = ENCODE_TABLE[(v >> 12) & 0x3f];
+            *out++ = ENCODE_TABLE[(v >> 6) & 0x3f];
+            *out++ = ENCODE_TABLE[v & 0x3f];
+         }
+
+         if (i + 1 == size) {
+            const uint32_t v = uint32_t(in[i]) << 16;
+            *out++ = ENCODE_TABLE[v >> 18];
+            *out++ = ENCODE_TABLE[(v >> 12) & 0x3f];
+            *out++ = '=';
+            *out++ = '=';
+         } else if (i + 2 == size) {
+            const uint32_t v = (uint32_t(in[i]) << 16) | (uint32_t(in[i + 1]) << 8);
+            *out++ = ENCODE_TABLE[v >> 18];
+            *out++ = ENCODE_TABLE[(v >> 12) & 0x3f];
+            *out++ = ENCODE_TABLE[(v >> 6) & 0x3f];
+            *out++ = '=';
+         }
+         return static_cast<size_t>(out - start);
+      }
+
+      /// Decodes the tail of the input, which may hold padding.  Returns false on invalid input.
+      bool DecodeScalar(const char *in, size_t size, uint8_t *out, size_t &written) {
+         const uint8_t *table = DECODE_TABLE.values;
+         uint8_t *start = out;
+
+         // Strip up to two padding characters, they are only allowed to complete the last quad.
+         size_t padding = 0;
+         while (padding < 2 && size > 0 && in[size - 1] == '=') {
+            --size;
+            ++padding;
+         }
+         if (size % 4 == 1 || (padding > 0 && (size + padding) % 4 != 0)) return false;
+
+         size_t i = 0;
+         for (; i + 4 <= size; i += 4) {
+            const uint8_t a = table[uint8_t(in[i])], b = table[uint8_t(in[i + 1])];
+            const uint8_t c = table[uint8_t(in[i + 2])], d = table[uint8_t(in[i + 3])];
+            if ((a | b | c | d) & 64) return false;
+            const uint32_t v = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6) | d;
+            *out++ = uint8_t(v >> 16);
+            *out++ = uint8_t(v >> 8);
+            *out++ = uint8_t(v);
+         }
+
+         const size_t rest = size - i;
+         if (rest >= 2) {
+            const uint8_t a = table[uint8_t(in[i])], b = table[uint8_t(in[i + 1])];
+            const uint8_t c = rest == 3 ? table[uint8_t(in[i + 2])] : 0;
+            if ((a | b | c) & 64) return false;
+            const uint32_t v = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6);
+            *out++ = uint8_t(v >> 16);
+            if (rest == 3) *out++ = uint8_t(v >> 8);
+         }
+
+         written = static_cast<size_t>(out - start);
+         return true;
+      }
+
+#ifdef AMM_BASE64_X86
+      // Vector codecs after Wojciech Mula and Daniel Lemire, "Faster Base64 Encoding and Decoding
+      // Using AVX2 Instructions".  Each handles whole blocks and leaves the tail to the scalar code.
+
+      AMM_TARGET("ssse3")
+      inline __m128i EncodeLookup128(__m128i indices) {
+         const __m128i shift = _mm_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+         __m128i reduced = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+         const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+         reduced = _mm_or_si128(reduced, _mm_and_si128(less, _mm_set1_epi8(13)));
+         return _mm_add_epi8(indices, _mm_shuffle_epi8(shift, reduced));
+      }
+
+      /// 12 input bytes in the low three quarters of the register to 16 sextets.
+      AMM_TARGET("ssse3")
+      inline __m128i EncodeSplit128(__m128i in) {
+         in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+         const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+         const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+         const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+         const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+         return _mm_or_si128(t1, t3);
+      }
+
+      AMM_TARGET("ssse3")
+      size_t EncodeSsse3(const uint8_t *in, size_t size, char *out) {
+         size_t done = 0;
+         // Loads are 16 bytes wide for 12 bytes of input.
+         for (; done + 16 <= size; done += 12) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + done));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + done / 3 * 4), EncodeLookup128(EncodeSplit128(block)));
+         }
+         return done;
+      }
+
+      AMM_TARGET("avx2")
+      size_t EncodeAvx2(const uint8_t *in, size_t size, char *out) {
+         const __m256i shuffle = _mm256_set_epi8(
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+         const __m256i lut = _mm256_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+         size_t done = 0;
+         // Two 12 byte halves per iteration, the upper load reads 16 bytes starting 12 bytes in.
+         for (; done + 28 <= size; done += 24) {
+            const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + done));
+            const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + done + 12));
+            __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+            v = _mm256_shuffle_epi8(v, shuffle);
+            const __m256i t0 = _mm256_and_si256(v, _mm256_set1_epi32(0x0fc0fc00));
+            const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+            const __m256i t2 = _mm256_and_si256(v, _mm256_set1_epi32(0x003f03f0));
+            const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+            const __m256i indices = _mm256_or_si256(t1, t3);
+
+            __m256i reduced = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+            const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+            reduced = _mm256_or_si256(reduced, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+            const __m256i chars = _mm256_add_epi8(indices, _mm256_shuffle_epi8(lut, reduced));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + done / 3 * 4), chars);
+         }
+         return done;
+      }
+
+      /// 16 characters to 12 bytes in the low three quarters, or false if any character is invalid.
+      AMM_TARGET("ssse3")
+      inline bool DecodeBlock128(__m128i in, __m128i &out) {
+         const __m128i lutLo = _mm_setr_epi8(
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+         const __m128i lutHi = _mm_setr_epi8(
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+         const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+         const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+
+         const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), nibbleMask);
+         const __m128i loNibbles = _mm_and_si128(in, nibbleMask);
+         const __m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+         const __m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+         if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0) return false;
+
+         const __m128i eq2F = _mm_cmpeq_epi8(in, _mm_set1_epi8(0x2f));
+         const __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(eq2F, hiNibbles));
+         const __m128i values = _mm_add_epi8(in, roll);
+
+         const __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+         const __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+         out = _mm_shuffle_epi8(packed, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+         return true;
+      }
+
+      AMM_TARGET("ssse3")
+      size_t DecodeSsse3(const char *in, size_t size, uint8_t *out) {
+         size_t done = 0;
+         // Stores are 16 bytes wide, keep a full block of input (and so of output space) in reserve.
+         for (; done + 24 <= size; done += 16) {
+            __m128i bytes;
+            if (!DecodeBlock128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + done)), bytes)) break;
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + done / 4 * 3), bytes);
+         }
+         return done;
+      }
+
+      AMM_TARGET("avx2")
+      size_t DecodeAvx2(const char *in, size_t size, uint8_t *out) {
+         const __m256i lutLo = _mm256_setr_epi8(
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+         const __m256i lutHi = _mm256_setr_epi8(
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+         const __m256i lutRoll = _mm256_setr_epi8(
+            0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+         const __m256i pack = _mm256_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+         const __m256i nibbleMask = _mm256_set1_epi8(0x0f);
+
+         size_t done = 0;
+         for (; done + 48 <= size; done += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + done));
+            const __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(v, 4), nibbleMask);
+            const __m256i loNibbles = _mm256_and_si256(v, nibbleMask);
+            const __m256i lo = _mm256_shuffle_epi8(lutLo, loNibbles);
+            const __m256i hi = _mm256_shuffle_epi8(lutHi, hiNibbles);
+            if (!_mm256_testz_si256(lo, hi)) break;
+
+            const __m256i eq2F = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(0x2f));
+            const __m256i roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(eq2F, hiNibbles));
+            const __m256i values = _mm256_add_epi8(v, roll);
+
+            const __m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+            __m256i packed = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+            packed = _mm256_shuffle_epi8(packed, pack);
+            packed = _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + done / 4 * 3), packed);
+         }
+         return done;
+      }
+
+      enum class Isa { Scalar, Ssse3, Avx2 };
+
+      Isa DetectIsa() {
+#ifdef _MSC_VER
+         int info[4];
+         __cpuid(info, 0);
+         const int maxLeaf = info[0];
+         __cpuid(info, 1);
+         const bool ssse3 = (info[2] & (1 << 9)) != 0;
+         const bool osxsave = (info[2] & (1 << 27)) != 0;
+         bool avx2 = false;
+         if (maxLeaf >= 7 && osxsave && (_xgetbv(0) & 0x6) == 0x6) {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
+         }
+#else
+         __builtin_cpu_init();
+         const bool ssse3 = __builtin_cpu_supports("ssse3");
+         const bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+         return avx2 ? Isa::Avx2 : (ssse3 ? Isa::Ssse3 : Isa::Scalar);
+      }
+
+      const Isa ISA = DetectIsa();
+#endif
+
+   } // namespace
+
+   size_t Utility::encode64(const uint8_t *in, size_t size, char *out) {
+      size_t done = 0;
+#ifdef AMM_BASE64_X86
+      if (ISA == Isa::Avx2) {
+         done = EncodeAvx2(in, size, out);
+      } else if (ISA == Isa::Ssse3) {
+         done = EncodeSsse3(in, size, out);
+      }
+#endif
+      return done / 3 * 4 + EncodeScalar(in + done, size - done, out + done / 3 * 4);
+   }
+
+   int Utility::decode64(const char *in, size_t size, uint8_t *out, size_t &written) {
+      size_t done = 0;
+#ifdef AMM_BASE64_X86
+      // Blocks with invalid characters or padding stop the vector loop, the scalar code then decides.
+      if (ISA == Isa::Avx2) {
+         done = DecodeAvx2(in, size, out);
+      }
+      if (ISA != Isa::Scalar) {
+         done += DecodeSsse3(in + done, size - done, out + done / 4 * 3);
+      }
+#endif
+      size_t tail = 0;
+      if (!DecodeScalar(in + done, size - done, out + done / 4 * 3, tail)) {
+         written = 0;
+         return 1;
+      }
+      written = done / 4 * 3 + tail;
+      return 0;
+   }
+
+   std::string Utility::decode64(const std::string &val) {
+      std::string result(decode64_max_length(val.size()), '\0');
+      size_t written = 0;
+      if (decode64(val.data(), val.size(), reinterpret_cast<uint8_t *>(&result[0]), written) != 0) {
+         throw std::invalid_argument("Invalid base64 input");
+      }
+
+      // Kept from the original implementation, callers rely on trailing NULs being dropped.
+      while (written > 0 && result[written - 1] == '\0') --written;
+      result.resize(written);
+      return result;
+   }
+
+   std::string Utility::encode64(const std::string &val) {
+      std::string result(encode64_length(val.size()), '\0');
+      result.resize(encode64(reinterpret_cast<const uint8_t *>(val.data()), val.size(), &result[0]));
+      return result;
+   }
+
+} // namespace AMM
@@ -0,0 +1,582 @@
+#include "BridgeServer.h"
+
+#include <deque>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include "CommandRouter.h"
+
+#ifdef __linux__
+
+#include <cerrno>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#endif
+
+namespace AMM {
+
+   struct BridgeServer::Client {
+      int fd;
+
+      // Guarded by m_mutex.
+      std::deque<Frame> queue;
+      size_t queuedBytes = 0;
+      bool dirty = false;
+      bool waitingWritable = false;
+      bool closed = false;
+
+      /// Node filters per subscribed topic, empty for every node.
+      std::unordered_map<std::string, std::vector<std::string>> subscriptions;
+
+      // Only touched by the server thread.
+      size_t offset = 0;
+      std::string input;
+
+      explicit Client(int socket) : fd(socket) {}
+   };
+
+   BridgeServer::BridgeServer() : m_wakePending(false), m_stopRequested(false), m_running(false) {
+   }
+
+   BridgeServer::~BridgeServer() {
+      Stop();
+   }
+
+   int BridgeServer::Start(const Options &options) {
+      std::string errmsg;
+      return Start(options, errmsg);
+   }
+
+   bool BridgeServer::IsRunning() const {
+      return m_running;
+   }
+
+   uint16_t BridgeServer::Port() const {
+      return m_port;
+   }
+
+   bool BridgeServer::HasSubscribers(View topic) const {
+      static thread_local std::string key;
+      key.assign(topic.data(), topic.size());
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_topics.find(key);
+      return it != m_topics.end() && !it->second.empty();
+   }
+
+   BridgeServer::Stats BridgeServer::GetStats() const {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      Stats stats = m_stats;
+      stats.clients = m_clients.size();
+      return stats;
+   }
+
+   void BridgeServer::PublishEncoded(View topic, View node, View line) {
+      static thread_local std::string key;
+      key.assign(topic.data(), topic.size());
+
+      // Built outside the lock, then shared by every queue it goes to.
+      std::shared_ptr<std::string> text = std::make_shared<std::string>();
+      text->reserve(line.size() + 1);
+      text->append(line.data(), line.size());
+      text->push_back('\n');
+      const Frame frame(std::move(text));
+
+      bool wake = false;
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         auto it = m_topics.find(key);
+         if (it == m_topics.end() || it->second.empty()) return;
+         ++m_stats.samplesPublished;
+
+         for (const auto &client : it->second) {
+            const std::vector<std::string> &nodes = client->subscriptions[key];
+            if (!nodes.empty()) {
+               bool match = false;
+               for (const auto &name : nodes) {
+                  if (name == node) {
+                     match = true;
+                     break;
+                  }
+               }
+               if (!match) continue;
+            }
+
+            if (Enqueue(client, frame, wake)) {
+               ++m_stats.samplesQueued;
+            } else {
+               ++m_stats.samplesDropped;
+            }
+         }
+      }
+
+      if (wake) Wake();
+   }
+
+   bool BridgeServer::Enqueue(const std::shared_ptr<Client> &client, const Frame &frame, bool &wake) {
+      if (client->queuedBytes + frame->size() > m_options.maxQueuedBytes) return false;
+
+      client->queue.push_back(frame);
+      client->queuedBytes += frame->size();
+
+      if (!client->dirty && !client->waitingWritable) {
+         client->dirty = true;
+         m_dirty.push_back(client);
+         wake = true;
+      }
+      return true;
+   }
+
+   void BridgeServer::Wake() {
+#ifdef __linux__
+      if (!m_wakePending.exchange(true)) {
+         const uint64_t one = 1;
+         ssize_t ignored = ::write(m_wakeFd, &one, sizeof(one));
+         (void) ignored;
+      }
+#endif
+   }
+
+#ifdef __linux__
+
+   namespace {
+
+      std::string errorText(const char *what) {
+         return std::string(what) + ": " + std::strerror(errno);
+      }
+
+   } // namespace
+
+   int BridgeServer::Start(const Options &options, std::string &errmsg) {
+      if (m_thread.joinable()) {
+         errmsg = "Bridge server already running";
+         return 1;
+      }
+      if (options.tcpPort < 0 && options.unixPath.empty()) {
+         errmsg = "No TCP port or Unix socket path configured";
+         return 1;
+      }
+      if (options.tcpPort > 65535) {
+         errmsg = "Invalid TCP port " + std::to_string(options.tcpPort);
+         return 1;
+      }
+
+      m_options = options;
+      m_stats = Stats();
+      m_port = 0;
+
+      auto fail = [this, &errmsg](const std::string &message) {
+         errmsg = message;
+         CloseAll();
+         return 1;
+      };
+
+      m_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+      if (m_epollFd < 0) return fail(errorText("epoll_create1"));
+
+      m_wakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+      if (m_wakeFd < 0) return fail(errorText("eventfd"));
+
+      if (options.tcpPort >= 0) {
+         sockaddr_in address;
+         std::memset(&address, 0, sizeof(address));
+         address.sin_family = AF_INET;
+         address.sin_port = htons(static_cast<uint16_t>(options.tcpPort));
+         if (::inet_pton(AF_INET, options.tcpAddress.c_str(), &address.sin_addr) != 1) {
+            return fail("Invalid TCP address " + options.tcpAddress);
+         }
+
+         m_tcpFd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+         if (m_tcpFd < 0) return fail(errorText("socket"));
+
+         const int on = 1;
+         ::setsockopt(m_tcpFd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+         if (::bind(m_tcpFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+            return fail(errorText("bind"));
+         }
+         if (::listen(m_tcpFd, SOMAXCONN) != 0) return fail(errorText("listen"));
+
+         socklen_t length = sizeof(address);
+         ::getsockname(m_tcpFd, reinterpret_cast<sockaddr *>(&address), &length);
+         m_port = ntohs(address.sin_port);
+      }
+
+      if (!options.unixPath.empty()) {
+         sockaddr_un address;
+         std::memset(&address, 0, sizeof(address));
+         address.sun_family = AF_UNIX;
+         if (options.unixPath.size() >= sizeof(address.sun_path)) {
+            return fail("Unix socket path too long: " + options.unixPath);
+         }
+         std::memcpy(address.sun_path, options.unixPath.c_str(), options.unixPath.size());
+
+         m_unixFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+         if (m_unixFd < 0) return fail(errorText("socket"));
+
+         ::unlink(options.unixPath.c_str());
+         if (::bind(m_unixFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+            return fail(errorText("bind"));
+         }
+         if (::listen(m_unixFd, SOMAXCONN) != 0) return fail(errorText("listen"));
+      }
+
+      for (int fd : {m_wakeFd, m_tcpFd, m_unixFd}) {
+         if (fd < 0) continue;
+         epoll_event event;
+         std::memset(&event, 0, sizeof(event));
+         event.events = EPOLLIN;
+         event.data.fd = fd;
+         if (::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &event) != 0) return fail(errorText("epoll_ctl"));
+      }
+
+      m_stopRequested = false;
+      m_wakePending = false;
+      try {
+         m_thread = std::thread(&BridgeServer::Run, this);
+      } catch (std::exception &e) {
+         return fail(e.what());
+      }
+      m_running = true;
+      return 0;
+   }
+
+   void BridgeServer::Stop() {
+      if (!m_thread.joinable()) return;
+
+      m_stopRequested = true;
+      const uint64_t one = 1;
+      ssize_t ignored = ::write(m_wakeFd, &one, sizeof(one));
+      (void) ignored;
+
+      m_thread.join();
+      m_running = false;
+      CloseAll();
+   }
+
+   void BridgeServer::Run() {
+      epoll_event events[64];
+      std::vector<std::shared_ptr<Client>> dirty;
+
+      while (!m_stopRequested) {
+         const int count = ::epoll_wait(m_epollFd, events, 64, -1);
+         if (count < 0) {
+            if (errno == EINTR) continue;
+            // Nothing is served anymore, IsRunning reports that until Stop cleans up.
+            m_running = false;
+            break;
+         }
+
+         for (int i = 0; i < count; ++i) {
+            const int fd = events[i].data.fd;
+
+            if (fd == m_wakeFd) {
+               uint64_t value;
+               ssize_t ignored = ::read(m_wakeFd, &value, sizeof(value));
+               (void) ignored;
+               m_wakePending = false;
+
+               {
+                  std::lock_guard<std::mutex> lock(m_mutex);
+                  dirty.swap(m_dirty);
+                  for (const auto &client : dirty) client->dirty = false;
+               }
+               for (const auto &client : dirty) {
+                  if (!Flush(client)) Close(client);
+               }
+               dirty.clear();
+               continue;
+            }
+
+            if (fd == m_tcpFd || fd == m_unixFd) {
+               Accept(fd);
+               continue;
+            }
+
+            std::shared_ptr<Client> client;
+            {
+               std::lock_guard<std::mutex> lock(m_mutex);
+               auto it = m_clients.find(fd);
+               if (it != m_clients.end()) client = it->second;
+            }
+            if (!client) continue;
+
+            if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+               Close(client);
+               continue;
+            }
+            if (events[i].events & EPOLLIN) {
+               Read(client);
+            }
+            if (events[i].events & EPOLLOUT) {
+               if (!Flush(client)) Close(client);
+            }
+         }
+      }
+   }
+
+   void BridgeServer::Accept(int listenFd) {
+      for (;;) {
+         const int fd = ::accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+         if (fd < 0) {
+            if (errno == EINTR) continue;
+            return;
+         }
+
+         std::lock_guard<std::mutex> lock(m_mutex);
+         if (m_clients.size() >= m_options.maxClients) {
+            ::close(fd);
+            continue;
+         }
+
+         if (listenFd == m_tcpFd) {
+            const int on = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+         }
+
+         epoll_event event;
+         std::memset(&event, 0, sizeof(event));
+         event.events = EPOLLIN | EPOLLRDHUP;
+         event.data.fd = fd;
+         if (::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+            ::close(fd);
+            continue;
+         }
+         m_clients[fd] = std::make_shared<Client>(fd);
+      }
+   }
+
+   void BridgeServer::Read(const std::shared_ptr<Client> &client) {
+      // Commands are short, a client sending a longer line is not speaking the protocol.
+      static const size_t MAX_LINE = 64 * 1024;
+
+      char buffer[4096];
+      for (;;) {
+         const ssize_t count = ::read(client->fd, buffer, sizeof(buffer));
+         if (count < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            Close(client);
+            return;
+         }
+         if (count == 0) {
+            Close(client);
+            return;
+         }
+         client->input.append(buffer, static_cast<size_t>(count));
+      }
+
+      size_t start = 0;
+      for (;;) {
+         const size_t end = client->input.find('\n', start);
+         if (end == std::string::npos) break;
+         HandleLine(client, View(client->input.data() + start, end - start));
+         start = end + 1;
+      }
+      client->input.erase(0, start);
+
+      if (client->input.size() > MAX_LINE || !Flush(client)) Close(client);
+   }
+
+   void BridgeServer::HandleLine(const std::shared_ptr<Client> &client, View line) {
+      CommandRouter::Tokenizer tokens(CommandRouter::Trim(line), ' ');
+      View command;
+      View topic;
+      while (tokens.Next(command) && command.empty()) {}
+      while (tokens.Next(topic) && topic.empty()) {}
+      if (command.empty()) return;
+
+      const bool subscribe = boost::iequals(command, "SUBSCRIBE");
+      const bool known = subscribe || boost::iequals(command, "UNSUBSCRIBE");
+      if (!known || topic.empty()) {
+         JsonWriter writer;
+         writer.BeginObject();
+         writer.Key("error");
+         writer.Value(known ? "Missing topic" : "Unknown command");
+         writer.Key("command");
+         writer.Value(CommandRouter::Trim(line));
+         writer.EndObject();
+
+         std::shared_ptr<std::string> text = std::make_shared<std::string>(writer.str());
+         text->push_back('\n');
+         bool wake = false;
+         {
+            // Same limit as samples, a client flooding bad commands cannot grow its queue without bound.
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Enqueue(client, Frame(std::move(text)), wake);
+         }
+         if (wake) Wake();
+         return;
+      }
+
+      const std::string name(topic.data(), topic.size());
+      std::vector<std::string> nodes;
+      View node;
+      while (tokens.Next(node)) {
+         if (!node.empty()) nodes.emplace_back(node.data(), node.size());
+      }
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto existing = client->subscriptions.find(name);
+
+      if (subscribe) {
+         if (existing == client->subscriptions.end()) {
+            m_topics[name].push_back(client);
+            client->subscriptions.emplace(name, std::move(nodes));
+         } else {
+            existing->second = std::move(nodes);
+         }
+      } else if (existing != client->subscriptions.end()) {
+         client->subscriptions.erase(existing);
+         auto &subscribers = m_topics[name];
+         for (auto it = subscribers.begin(); it != subscribers.end(); ++it) {
+            if (*it == client) {
+               subscribers.erase(it);
+               break;
+            }
+         }
+      }
+   }
+
+   bool BridgeServer::Flush(const std::shared_ptr<Client> &client) {
+      static const size_t MAX_IOV = 64;
+
+      for (;;) {
+         iovec iov[MAX_IOV];
+         size_t count = 0;
+         size_t total = 0;
+         {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (client->closed) return true;
+
+            for (auto it = client->queue.begin(); it != client->queue.end() && count < MAX_IOV; ++it, ++count) {
+               const size_t skip = count == 0 ? client->offset : 0;
+               iov[count].iov_base = const_cast<char *>((*it)->data() + skip);
+               iov[count].iov_len = (*it)->size() - skip;
+               total += iov[count].iov_len;
+            }
+
+            if (count == 0) {
+               if (client->waitingWritable) {
+                  epoll_event event;
+                  std::memset(&event, 0, sizeof(event));
+                  event.events = EPOLLIN | EPOLLRDHUP;
+                  event.data.fd = client->fd;
+                  ::epoll_ctl(m_epollFd, EPOLL_CTL_MOD, client->fd, &event);
+                  client->waitingWritable = false;
+               }
+               return true;
+            }
+         }
+
+         // Frames are only removed by this thread, so the iovecs stay valid outside the lock.
+         msghdr message;
+         std::memset(&message, 0, sizeof(message));
+         message.msg_iov = iov;
+         message.msg_iovlen = count;
+         const ssize_t written = ::sendmsg(client->fd, &message, MSG_NOSIGNAL);
+
+         std::lock_guard<std::mutex> lock(m_mutex);
+         if (written < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) return false;
+         } else {
+            m_stats.bytesSent += static_cast<uint64_t>(written);
+            size_t remaining = static_cast<size_t>(written);
+            while (remaining > 0) {
+               const size_t left = client->queue.front()->size() - client->offset;
+               if (remaining < left) {
+                  client->offset += remaining;
+                  break;
+               }
+               remaining -= left;
+               client->queuedBytes -= client->queue.front()->size();
+               client->queue.pop_front();
+               client->offset = 0;
+            }
+            if (static_cast<size_t>(written) == total) continue;
+         }
+
+         // Socket buffer full, resume when it drains.
+         if (!client->waitingWritable) {
+            epoll_event event;
+            std::memset(&event, 0, sizeof(event));
+            event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP;
+            event.data.fd = client->fd;
+            ::epoll_ctl(m_epollFd, EPOLL_CTL_MOD, client->fd, &event);
+            client->waitingWritable = true;
+         }
+         return true;
+      }
+   }
+
+   void BridgeServer::Close(const std::shared_ptr<Client> &client) {
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         if (client->closed) return;
+         client->closed = true;
+
+         for (const auto &subscription : client->subscriptions) {
+            auto &subscribers = m_topics[subscription.first];
+            for (auto it = subscribers.begin(); it != subscribers.end(); ++it) {
+               if (*it == client) {
+                  subscribers.erase(it);
+                  break;
+               }
+            }
+         }
+         client->subscriptions.clear();
+         client->queue.clear();
+         client->queuedBytes = 0;
+         m_clients.erase(client->fd);
+      }
+
+      ::epoll_ctl(m_epollFd, EPOLL_CTL_DEL, client->fd, nullptr);
+      ::close(client->fd);
+   }
+
+   void BridgeServer::CloseAll() {
+      std::vector<std::shared_ptr<Client>> clients;
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         for (const auto &entry : m_clients) clients.push_back(entry.second);
+      }
+      for (const auto &client : clients) Close(client);
+
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         m_topics.clear();
+         m_dirty.clear();
+      }
+
+      for (int *fd : {&m_tcpFd, &m_unixFd, &m_wakeFd, &m_epollFd}) {
+         if (*fd >= 0) ::close(*fd);
+         *fd = -1;
+      }
+      if (!m_options.unixPath.empty()) ::unlink(m_options.unixPath.c_str());
+      m_port = 0;
+   }
+
+#else
+
+   int BridgeServer::Start(const Options &, std::string &errmsg) {
+      errmsg = "Bridge server is only available on Linux";
+      return 1;
+   }
+
+   void BridgeServer::Stop() {
+   }
+
+#endif
+
+} // namespace AMM
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/utility/string_view.hpp>
+
+#include "Json.h"
+
+namespace AMM {
+
+    /// Serves DDS samples to local non-DDS clients over TCP or Unix domain sockets.
+    ///
+    /// One epoll thread handles every connection.  Clients send text commands, one per line:
+    ///
+    ///     SUBSCRIBE <topic> [<node> ...]
+    ///     UNSUBSCRIBE <topic>
+    ///
+    /// Without nodes a subscription receives every sample of the topic, otherwise only samples
+    /// published for one of the listed nodes.  Samples are sent as one JSON object per line:
+    ///
+    ///     {"topic":"AMM_PhysiologyValue","node":"Cardiovascular/HeartRate","sample":{...}}
+    ///
+    /// Modules call Publish from their DDS callbacks.  A sample is encoded once, only if someone
+    /// subscribed, and the same buffer is queued on every interested connection and written with
+    /// scatter/gather I/O from the server thread, so Publish never waits on a socket.  A client whose
+    /// queue exceeds Options::maxQueuedBytes loses new samples, and error replies, until it catches up.
+    ///
+    ///     AMM::BridgeServer bridge;
+    ///     AMM::BridgeServer::Options options;
+    ///     options.unixPath = "/tmp/amm_bridge.sock";
+    ///     bridge.Start(options);
+    ///     ...
+    ///     void onPhysiologyValue(AMM::PhysiologyValue &value, eprosima::fastrtps::SampleInfo_t *info) {
+    ///        bridge.Publish("AMM_PhysiologyValue", value.name(), value);
+    ///     }
+    ///
+    /// Available on Linux only; Start fails elsewhere.
+    class BridgeServer {
+
+    public:
+        typedef boost::string_view View;
+
+        struct Options {
+            /// Address to listen on for TCP clients.
+            std::string tcpAddress = "127.0.0.1";
+
+            /// TCP port, 0 to pick a free one (see Port()), -1 to disable TCP.
+            int tcpPort = -1;
+
+            /// Unix domain socket path, empty to disable.  An existing socket file is replaced.
+            std::string unixPath;
+
+            /// Bytes that may wait in a client queue before new samples are dropped for that client.
+            size_t maxQueuedBytes = 4 * 1024 * 1024;
+
+            /// Connections beyond this are refused.
+            size_t maxClients = 64;
+        };
+
+        struct Stats {
+            uint64_t clients = 0;
+
+            /// Samples encoded because at least one client was subscribed.
+            uint64_t samplesPublished = 0;
+
+            /// Sample copies queued on client connections.
+            uint64_t samplesQueued = 0;
+
+            /// Sample copies dropped because a client queue was full.
+            uint64_t samplesDropped = 0;
+
+            uint64_t bytesSent = 0;
+        };
+
+        BridgeServer();
+
+        /// Stops the server if still running.
+        ~BridgeServer();
+
+        BridgeServer(const BridgeServer &) = delete;
+
+        BridgeServer &operator=(const BridgeServer &) = delete;
+
+        /// Open the listening sockets and start the server thread.
+        /// @param options Listening sockets and limits.
+        /// @returns 0 if successful.
+        int Start(const Options &options);
+
+        /// Open the listening sockets and start the server thread.
+        /// @param options Listening sockets and limits.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int Start(const Options &options, std::string &errmsg);
+
+        /// Stop the server thread and close every connection.
+        void Stop();
+
+        /// State of whether the server thread is running.  False once it stopped on a socket error.
+        bool IsRunning() const;
+
+        /// @returns The TCP port listened on, 0 if TCP is disabled.
+        uint16_t Port() const;
+
+        /// State of whether any client subscribed to a topic.  Cheap, lets callers skip work.
+        /// @param topic Topic name.
+        bool HasSubscribers(View topic) const;
+
+        /// Encode a sample and queue it for every client subscribed to the topic and node.
+        /// @param topic Topic name, as used by clients to subscribe.
+        /// @param node Node the sample belongs to, or empty.
+        /// @param sample Any reflected AMM type.
+        template<class T>
+        void Publish(View topic, View node, const T &sample) {
+           if (!HasSubscribers(topic)) return;
+
+           static thread_local JsonWriter writer;
+           writer.Clear();
+           writer.BeginObject();
+           writer.Key("topic");
+           writer.Value(topic);
+           if (!node.empty()) {
+              writer.Key("node");
+              writer.Value(node);
+           }
+           writer.Key("sample");
+           writer.Value(sample);
+           writer.EndObject();
+           PublishEncoded(topic, node, View(writer.data(), writer.size()));
+        }
+
+        /// Queue an already encoded line for every client subscribed to the topic and node.
+        /// @param topic Topic name.
+        /// @param node Node the sample belongs to, or empty.
+        /// @param line Encoded sample without line break.
+        void PublishEncoded(View topic, View node, View line);
+
+        /// @returns Server statistics.
+        Stats GetStats() const;
+
+    private:
+        struct Client;
+
+        typedef std::shared_ptr<const std::string> Frame;
+
+        void Run();
+
+        void Accept(int listenFd);
+
+        void Read(const std::shared_ptr<Client> &client);
+
+        void HandleLine(const std::shared_ptr<Client> &client, View line);
+
+        /// Queue a frame for a client and mark it for the server thread.  Called with m_mutex held.
+        /// @param wake Set if the server thread has to be woken to see the client.
+        /// @returns False if the frame would exceed Options::maxQueuedBytes and was dropped.
+        bool Enqueue(const std::shared_ptr<Client> &client, const Frame &frame, bool &wake);
+
+        /// Wake the server thread to flush the marked clients.
+        void Wake();
+
+        /// Writes queued frames of a client until done or the socket is full.
+        /// @returns False if the connection failed.
+        bool Flush(const std::shared_ptr<Client> &client);
+
+        void Close(const std::shared_ptr<Client> &client);
+
+        void CloseAll();
+
+        /// Protects clients, subscriptions, queues and statistics.  Never held during socket I/O.
+        mutable std::mutex m_mutex;
+
+        std::unordered_map<int, std::shared_ptr<Client>> m_clients;
+
+        /// Subscribed clients per topic.
+        std::unordered_map<std::string, std::vector<std::shared_ptr<Client>>> m_topics;
+
+        /// Clients with frames queued since the server thread last looked.
+        std::vector<std::shared_ptr<Client>> m_dirty;
+
+        Options m_options;
+
+        Stats m_stats;
+
+        int m_epollFd = -1;
+
+        int m_wakeFd = -1;
+
+        int m_tcpFd = -1;
+
+        int m_unixFd = -1;
+
+        uint16_t m_port = 0;
+
+        /// Set while a wakeup is pending, so a burst of publishes signals the thread once.
+        std::atomic<bool> m_wakePending;
+
+        std::atomic<bool> m_stopRequested;
+
+        std::atomic<bool> m_running;
+
+        std::thread m_thread;
+
+    }; // class BridgeServer
+
+} // namespace AMM
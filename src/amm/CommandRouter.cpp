@@ -0,0 +1,107 @@
+#include "CommandRouter.h"
+
+#include <algorithm>
+
+namespace AMM {
+
+   constexpr const char *CommandRouter::SYS_PREFIX;
+   constexpr const char *CommandRouter::ACT_PREFIX;
+   constexpr const char *CommandRouter::LOAD_STATE_PREFIX;
+   constexpr const char *CommandRouter::LOAD_SCENARIO_PREFIX;
+
+   bool CommandRouter::Tokenizer::Next(View &token) {
+      if (m_done) return false;
+
+      const size_t end = m_rest.find(m_delimiter);
+      if (end == View::npos) {
+         token = m_rest;
+         m_rest.clear();
+         m_done = true;
+      } else {
+         token = m_rest.substr(0, end);
+         m_rest.remove_prefix(end + 1);
+      }
+      return true;
+   }
+
+   int CommandRouter::Add(const std::string &route, Handler handler) {
+      if (route.empty() || !handler) return 1;
+
+      auto it = std::find_if(m_routes.begin(), m_routes.end(),
+         [&route](const Route &r) { return r.prefix == route; });
+      if (it != m_routes.end()) {
+         it->handler = std::move(handler);
+         return 0;
+      }
+
+      m_routes.push_back(Route{route, std::move(handler)});
+      Rebuild();
+      return 0;
+   }
+
+   int CommandRouter::Remove(const std::string &route) {
+      auto it = std::find_if(m_routes.begin(), m_routes.end(),
+         [&route](const Route &r) { return r.prefix == route; });
+      if (it == m_routes.end()) return 1;
+
+      m_routes.erase(it);
+      Rebuild();
+      return 0;
+   }
+
+   void CommandRouter::SetDefault(Handler handler) {
+      m_default = std::move(handler);
+   }
+
+   void CommandRouter::Rebuild() {
+      for (auto &bucket : m_table) bucket.clear();
+
+      for (size_t i = 0; i < m_routes.size(); ++i) {
+         m_table[static_cast<unsigned char>(m_routes[i].prefix[0])].push_back(static_cast<uint16_t>(i));
+      }
+
+      // Longest first, so "[SYS]LOAD_STATE:" wins over "[SYS]".
+      for (auto &bucket : m_table) {
+         std::sort(bucket.begin(), bucket.end(), [this](uint16_t a, uint16_t b) {
+            return m_routes[a].prefix.size() > m_routes[b].prefix.size();
+         });
+      }
+   }
+
+   int CommandRouter::Dispatch(View message) const {
+      if (!message.empty()) {
+         for (uint16_t index : m_table[static_cast<unsigned char>(message[0])]) {
+            const Route &route = m_routes[index];
+            if (message.starts_with(route.prefix)) {
+               Match match;
+               match.message = message;
+               match.route = View(route.prefix);
+               match.argument = message.substr(route.prefix.size());
+               route.handler(match);
+               return 0;
+            }
+         }
+      }
+
+      if (!m_default) return 1;
+
+      Match match;
+      match.message = message;
+      match.argument = message;
+      m_default(match);
+      return 0;
+   }
+
+   int CommandRouter::Dispatch(const AMM::CommandSample &command) const {
+      return Dispatch(View(command.message().c_str(), command.message().size()));
+   }
+
+   CommandRouter::View CommandRouter::Trim(View text) {
+      static const char *whitespace = " \t\r\n";
+      const size_t first = text.find_first_not_of(whitespace);
+      if (first == View::npos) return View();
+      const size_t last = text.find_last_not_of(whitespace);
+      return text.substr(first, last - first + 1);
+   }
+
+} // namespace AMM
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <boost/utility/string_view.hpp>
+
+#include "SampleTypes.h"
+
+namespace AMM {
+
+    /// Dispatches Command messages to handlers registered per message prefix.
+    ///
+    /// Routes are prefixes such as "[SYS]START_SIM", "[SYS]LOAD_STATE:" or "[ACT]".  A message goes to
+    /// the handler of the longest matching route, which receives the rest of the message as a view.
+    /// Dispatching and tokenizing never copy or allocate; views point into the message and are only
+    /// valid during the handler call.
+    ///
+    /// Register routes during setup.  Dispatch is const and may then be called from any thread.
+    class CommandRouter {
+
+    public:
+        typedef boost::string_view View;
+
+        /// Command prefixes used across AMM modules.
+        static constexpr const char *SYS_PREFIX = "[SYS]";
+        static constexpr const char *ACT_PREFIX = "[ACT]";
+        static constexpr const char *LOAD_STATE_PREFIX = "LOAD_STATE:";
+        static constexpr const char *LOAD_SCENARIO_PREFIX = "LOAD_SCENARIO:";
+
+        /// A routed message.
+        struct Match {
+            /// The whole message.
+            View message;
+
+            /// Route that matched, empty for the default handler.
+            View route;
+
+            /// Message text after the route.
+            View argument;
+        };
+
+        typedef std::function<void(const Match &)> Handler;
+
+        /// Splits text at a delimiter without copying.  Empty tokens are kept.
+        class Tokenizer {
+        public:
+            Tokenizer(View text, char delimiter) : m_rest(text), m_delimiter(delimiter), m_done(false) {}
+
+            /// @param token Next token output.
+            /// @returns False once all tokens have been returned.
+            bool Next(View &token);
+
+        private:
+            View m_rest;
+            char m_delimiter;
+            bool m_done;
+        };
+
+        /// Register a handler for messages starting with route, replacing any handler for the same route.
+        /// @param route Message prefix, copied.
+        /// @param handler Function called for matching messages.
+        /// @returns 0 if successful, 1 if the route is empty or the handler is not set.
+        int Add(const std::string &route, Handler handler);
+
+        /// Unregister the handler for a route.
+        /// @param route Message prefix.
+        /// @returns 0 if successful, 1 if no such route exists.
+        int Remove(const std::string &route);
+
+        /// Handler for messages no route matches.
+        /// @param handler Function called for unmatched messages, or an empty function to drop them.
+        void SetDefault(Handler handler);
+
+        /// Route a message.
+        /// @param message Command text.
+        /// @returns 0 if a handler ran, 1 if no route matched and there is no default handler.
+        int Dispatch(View message) const;
+
+        /// Route a received Command.
+        /// @param command Received command.
+        /// @returns 0 if a handler ran, 1 if no route matched and there is no default handler.
+        int Dispatch(const AMM::CommandSample &command) const;
+
+        /// @returns Text with leading and trailing spaces, tabs and line breaks removed.
+        static View Trim(View text);
+
+    private:
+        struct Route {
+            std::string prefix;
+            Handler handler;
+        };
+
+        void Rebuild();
+
+        std::vector<Route> m_routes;
+
+        /// Route indices per first character, longest route first.
+        std::vector<uint16_t> m_table[256];
+
+        Handler m_default;
+
+    }; // class CommandRouter
+
+} // namespace AMM
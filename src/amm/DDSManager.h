@@ -1,15 +1,33 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <set>
 #include <string>
+#include <vector>
 
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
 #include "amm/BaseLogger.h"
 
 #include "AmmDataType.h"
 #include "DDS_Listeners.h"
+#include "Uuid.h"
+#include "TickScheduler.h"
+#include "ModuleConfigurationCache.h"
+#include "ModuleHealthMonitor.h"
+#include "PayloadCodec.h"
+#include "SampleTypes.h"
+#include "StartupTimeline.h"
+#include "StaticDiscovery.h"
+#include "DiscoveryServer.h"
+#include "ParticipantRegistry.h"
 
 #include "AMM_StandardCdrAux.hpp"
 #include "AMM_StandardPubSubTypes.h"
@@ -37,6 +55,13 @@
 //  TICK = Tick
 //  IDAT = Instrument Data
 //  CMND = Command
+//  PHFR = Physiology Frame
+//
+// The types of topics with large string fields are wrapped in CompressedPubSubType,
+// see PayloadCodec.
+//
+// Log, Physiology Value, Physiology Waveform, Status and Command use the sample types from
+// SampleTypes.h, which are the bounded variants when built with AMM_BOUNDED_TYPES.
 
 #define ASMT_TYPE AMM::AssessmentPubSubType
 #define ASMT_LTNR AMM::DDS_Listeners::AssessmentListener
@@ -48,7 +73,7 @@
 #define EVFR      AMM::EventFragment
 #define EVFR_STR  "Event Fragment"
 
-#define EVRC_TYPE AMM::EventRecordPubSubType
+#define EVRC_TYPE AMM::CompressedPubSubType<AMM::EventRecordPubSubType>
 #define EVRC_LTNR AMM::DDS_Listeners::EventRecordListener
 #define EVRC      AMM::EventRecord
 #define EVRC_STR  "Event Record"
@@ -58,12 +83,12 @@
 #define FARQ      AMM::FragmentAmendmentRequest
 #define FARQ_STR  "Fragment Amendment Request"
 
-#define ALOG_TYPE AMM::LogPubSubType
+#define ALOG_TYPE AMM::LogSamplePubSubType
 #define ALOG_LTNR AMM::DDS_Listeners::LogListener
-#define ALOG      AMM::Log
+#define ALOG      AMM::LogSample
 #define ALOG_STR  "Log"
 
-#define MOCF_TYPE AMM::ModuleConfigurationPubSubType
+#define MOCF_TYPE AMM::CompressedPubSubType<AMM::ModuleConfigurationPubSubType>
 #define MOCF_LTNR AMM::DDS_Listeners::ModuleConfigurationListener
 #define MOCF      AMM::ModuleConfiguration
 #define MOCF_STR  "Module Configuration"
@@ -73,27 +98,27 @@
 #define OMEV      AMM::OmittedEvent
 #define OMEV_STR  "Omitted Event"
 
-#define OPDS_TYPE AMM::OperationalDescriptionPubSubType
+#define OPDS_TYPE AMM::CompressedPubSubType<AMM::OperationalDescriptionPubSubType>
 #define OPDS_LTNR AMM::DDS_Listeners::OperationalDescriptionListener
 #define OPDS      AMM::OperationalDescription
 #define OPDS_STR  "Operational Description"
 
-#define PHMO_TYPE AMM::PhysiologyModificationPubSubType
+#define PHMO_TYPE AMM::CompressedPubSubType<AMM::PhysiologyModificationPubSubType>
 #define PHMO_LTNR AMM::DDS_Listeners::PhysiologyModificationListener
 #define PHMO      AMM::PhysiologyModification
 #define PHMO_STR  "Physiology Modification"
 
-#define PHVA_TYPE AMM::PhysiologyValuePubSubType
+#define PHVA_TYPE AMM::PhysiologyValueSamplePubSubType
 #define PHVA_LTNR AMM::DDS_Listeners::PhysiologyValueListener
-#define PHVA      AMM::PhysiologyValue
+#define PHVA      AMM::PhysiologyValueSample
 #define PHVA_STR  "Physiology Value"
 
-#define PHWV_TYPE AMM::PhysiologyWaveformPubSubType
+#define PHWV_TYPE AMM::PhysiologyWaveformSamplePubSubType
 #define PHWV_LTNR AMM::DDS_Listeners::PhysiologyWaveformListener
-#define PHWV      AMM::PhysiologyWaveform
+#define PHWV      AMM::PhysiologyWaveformSample
 #define PHWV_STR  "Physiology Waveform"
 
-#define RDMO_TYPE AMM::RenderModificationPubSubType
+#define RDMO_TYPE AMM::CompressedPubSubType<AMM::RenderModificationPubSubType>
 #define RDMO_LTNR AMM::DDS_Listeners::RenderModificationListener
 #define RDMO      AMM::RenderModification
 #define RDMO_STR  "Render Modification"
@@ -103,9 +128,9 @@
 #define SMCN      AMM::SimulationControl
 #define SMCN_STR  "Simulation Control"
 
-#define STAT_TYPE AMM::StatusPubSubType
+#define STAT_TYPE AMM::StatusSamplePubSubType
 #define STAT_LTNR AMM::DDS_Listeners::StatusListener
-#define STAT      AMM::Status
+#define STAT      AMM::StatusSample
 #define STAT_STR  "Status"
 
 #define TICK_TYPE AMM::TickPubSubType
@@ -118,11 +143,16 @@
 #define IDAT      AMM::InstrumentData
 #define IDAT_STR  "Instrument Data"
 
-#define CMND_TYPE AMM::CommandPubSubType
+#define CMND_TYPE AMM::CommandSamplePubSubType
 #define CMND_LTNR AMM::DDS_Listeners::CommandListener
-#define CMND      AMM::Command
+#define CMND      AMM::CommandSample
 #define CMND_STR  "Command"
 
+#define PHFR_TYPE AMM::PhysiologyFramePubSubType
+#define PHFR_LTNR AMM::DDS_Listeners::PhysiologyFrameListener
+#define PHFR      AMM::PhysiologyFrame
+#define PHFR_STR  "Physiology Frame"
+
 
 namespace AMM {
 
@@ -139,71 +169,75 @@ namespace AMM {
 
         /// Assessment type handler.
         /// Handler for registering, publishering, and subscribing data for Assessment.
-        AmmDataType<ASMT_TYPE, ASMT_LTNR, ASMT, U> *m_assessment;
+        AmmDataType<ASMT_TYPE, ASMT_LTNR, ASMT, U> *m_assessment = nullptr;
 
         /// Event Fragment type handler.
         /// Handler for registering, publishering, and subscribing data for Event Fragment.
-        AmmDataType<EVFR_TYPE, EVFR_LTNR, EVFR, U> *m_eventFragment;
+        AmmDataType<EVFR_TYPE, EVFR_LTNR, EVFR, U> *m_eventFragment = nullptr;
 
         /// Event Record type handler.
         /// Handler for registering, publishering, and subscribing data for Event Record.
-        AmmDataType<EVRC_TYPE, EVRC_LTNR, EVRC, U> *m_eventRecord;
+        AmmDataType<EVRC_TYPE, EVRC_LTNR, EVRC, U> *m_eventRecord = nullptr;
 
         /// Fragment Amendment Request type handler.
         /// Handler for registering, publishering, and subscribing data for Fragment Amendment Request.
-        AmmDataType<FARQ_TYPE, FARQ_LTNR, FARQ, U> *m_fragmentAmendmentRequest;
+        AmmDataType<FARQ_TYPE, FARQ_LTNR, FARQ, U> *m_fragmentAmendmentRequest = nullptr;
 
         /// Log type handler.
         /// Handler for registering, publishering, and subscribing data for Log.
-        AmmDataType<ALOG_TYPE, ALOG_LTNR, ALOG, U> *m_log;
+        AmmDataType<ALOG_TYPE, ALOG_LTNR, ALOG, U> *m_log = nullptr;
 
         /// Module Configuration type handler.
         /// Handler for registering, publishering, and subscribing data for Module Configuration.
-        AmmDataType<MOCF_TYPE, MOCF_LTNR, MOCF, U> *m_moduleConfiguration;
+        AmmDataType<MOCF_TYPE, MOCF_LTNR, MOCF, U> *m_moduleConfiguration = nullptr;
 
         /// Omitted Description type handler.
         /// Handler for registering, publishering, and subscribing data for Omitted Description.
-        AmmDataType<OMEV_TYPE, OMEV_LTNR, OMEV, U> *m_omittedEvent;
+        AmmDataType<OMEV_TYPE, OMEV_LTNR, OMEV, U> *m_omittedEvent = nullptr;
 
         /// Operational Description type handler.
         /// Handler for registering, publishering, and subscribing data for Operational Description.
-        AmmDataType<OPDS_TYPE, OPDS_LTNR, OPDS, U> *m_operationalDescription;
+        AmmDataType<OPDS_TYPE, OPDS_LTNR, OPDS, U> *m_operationalDescription = nullptr;
 
         /// Physiology Modification type handler.
         /// Handler for registering, publishering, and subscribing data for Physiology Modification.
-        AmmDataType<PHMO_TYPE, PHMO_LTNR, PHMO, U> *m_physiologyModification;
+        AmmDataType<PHMO_TYPE, PHMO_LTNR, PHMO, U> *m_physiologyModification = nullptr;
 
         /// Physiology Value type handler.
         /// Handler for registering, publishering, and subscribing data for Physiology Value.
-        AmmDataType<PHVA_TYPE, PHVA_LTNR, PHVA, U> *m_physiologyValue;
+        AmmDataType<PHVA_TYPE, PHVA_LTNR, PHVA, U> *m_physiologyValue = nullptr;
 
         /// Physiology Waveform type handler.
         /// Handler for registering, publishering, and subscribing data for Physiology Waveform.
-        AmmDataType<PHWV_TYPE, PHWV_LTNR, PHWV, U> *m_physiologyWaveform;
+        AmmDataType<PHWV_TYPE, PHWV_LTNR, PHWV, U> *m_physiologyWaveform = nullptr;
 
         /// Render Modification type handler.
         /// Handler for registering, publishering, and subscribing data for Render Modification.
-        AmmDataType<RDMO_TYPE, RDMO_LTNR, RDMO, U> *m_renderModification;
+        AmmDataType<RDMO_TYPE, RDMO_LTNR, RDMO, U> *m_renderModification = nullptr;
 
         /// Simulation Control type handler.
         /// Handler for registering, publishering, and subscribing data for Simulation Control.
-        AmmDataType<SMCN_TYPE, SMCN_LTNR, SMCN, U> *m_simulationControl;
+        AmmDataType<SMCN_TYPE, SMCN_LTNR, SMCN, U> *m_simulationControl = nullptr;
 
         /// Status type handler.
         /// Handler for registering, publishering, and subscribing data for Status.
-        AmmDataType<STAT_TYPE, STAT_LTNR, STAT, U> *m_status;
+        AmmDataType<STAT_TYPE, STAT_LTNR, STAT, U> *m_status = nullptr;
 
         /// Tick type handler.
         /// Handler for registering, publishering, and subscribing data for Tick.
-        AmmDataType<TICK_TYPE, TICK_LTNR, TICK, U> *m_tick;
+        AmmDataType<TICK_TYPE, TICK_LTNR, TICK, U> *m_tick = nullptr;
 
         /// Instrument Data type handler.
         /// Handler for registering, publishering, and subscribing data for Instrument Data.
-        AmmDataType<IDAT_TYPE, IDAT_LTNR, IDAT, U> *m_instrumentData;
+        AmmDataType<IDAT_TYPE, IDAT_LTNR, IDAT, U> *m_instrumentData = nullptr;
 
         /// Command type handler.
         /// Handler for registering, publishering, and subscribing data for Command.
-        AmmDataType<CMND_TYPE, CMND_LTNR, CMND, U> *m_command;
+        AmmDataType<CMND_TYPE, CMND_LTNR, CMND, U> *m_command = nullptr;
+
+        /// Physiology Frame type handler.
+        /// Handler for registering, publishering, and subscribing data for Physiology Frame.
+        AmmDataType<PHFR_TYPE, PHFR_LTNR, PHFR, U> *m_physiologyFrame = nullptr;
 
         /// Initializer flag for Assessment.
         /// State of whether the AMMDataType pointer for Assessment is valid.
@@ -229,6 +263,11 @@ namespace AMM {
         /// State of whether the AMMDataType pointer for Module Configuration is valid.
         bool m_isModConfigInit = false;
 
+        /// Cache fed by received Module Configuration events, if one is attached.
+        /// Read by the DDS receive thread, so it is set before the subscriber exists and cleared after it is gone.
+        /// @note This is an outside reference. It is not managed by this class.
+        std::atomic<ModuleConfigurationCache *> m_moduleConfigurationCache{nullptr};
+
         /// Initializer flag for Omitted Event.
         /// State of whether the AMMDataType pointer for Omitted Event is valid.
         bool m_isOmitEventInit = false;
@@ -237,6 +276,11 @@ namespace AMM {
         /// State of whether the AMMDataType pointer for Operational Description is valid.
         bool m_isOpDescriptInit = false;
 
+        /// Health monitor fed by received Operational Description events, if one is attached.
+        /// Read by the DDS receive thread, so it is set before the subscriber exists and cleared after it is gone.
+        /// @note This is an outside reference. It is not managed by this class.
+        std::atomic<ModuleHealthMonitor *> m_opDescriptHealthMonitor{nullptr};
+
         /// Initializer flag for Physiology Modification.
         /// State of whether the AMMDataType pointer for Physiology Modification is valid.
         bool m_isPhysModInit = false;
@@ -261,10 +305,20 @@ namespace AMM {
         /// State of whether the AMMDataType pointer for Status is valid.
         bool m_isStatusInit = false;
 
+        /// Health monitor fed by received Status and liveliness events, if one is attached.
+        /// Read by the DDS receive thread, so it is set before the subscriber exists and cleared after it is gone.
+        /// @note This is an outside reference. It is not managed by this class.
+        std::atomic<ModuleHealthMonitor *> m_statusHealthMonitor{nullptr};
+
         /// Initializer flag for Tick.
         /// State of whether the AMMDataType pointer for Tick is valid.
         bool m_isTickInit = false;
 
+        /// Scheduler fed by received Tick events, if one is attached.
+        /// Read by the DDS receive thread, so it is set before the subscriber exists and cleared after it is gone.
+        /// @note This is an outside reference. It is not managed by this class.
+        std::atomic<TickScheduler *> m_tickScheduler{nullptr};
+
         /// Initializer flag for Instrument Data.
         /// State of whether the AMMDataType pointer for Instrument Data is valid.
         bool m_isInstDataInit = false;
@@ -273,6 +327,25 @@ namespace AMM {
         /// State of whether the AMMDataType pointer for Command is valid.
         bool m_isCommandInit = false;
 
+        /// Initializer flag for Physiology Frame.
+        /// State of whether the AMMDataType pointer for Physiology Frame is valid.
+        bool m_isPhysFrameInit = false;
+
+        /// State of whether a frame is open between BeginPhysiologyFrame and EndPhysiologyFrame.
+        bool m_isPhysFrameOpen = false;
+
+        /// State of whether values written while a frame is open are left off Physiology Value.
+        bool m_divertPhysValues = false;
+
+        /// Frame being collected.  Kept between frames so its entries and their strings are reused.
+        AMM::PhysiologyFrame m_physFrame;
+
+        /// Number of entries of m_physFrame used by the open frame.
+        std::size_t m_physFrameSize = 0;
+
+        /// Entries of a larger previous frame, moved out of m_physFrame so their strings are reused.
+        std::vector<AMM::PhysiologyFrameEntry> m_physFrameSpare;
+
 
     private:
 
@@ -291,21 +364,67 @@ namespace AMM {
         /// Each AMM Module has one Participant used to register their activity on the DDS network.
         /// A Participant is created at the time of the module's inception, and removed once a module
         /// shuts down.
-        eprosima::fastrtps::Participant *m_participant;
+        eprosima::fastrtps::Participant *m_participant = nullptr;
 
         /// DDS Listener object for publishers.
         /// All publishers for each AMMDataType use the same publisher listener
         /// referenced from here.
         /// @note Is created at the time of the module's inception.
-        DDS_Listeners::PubListener *m_pubListener;
+        DDS_Listeners::PubListener *m_pubListener = nullptr;
+
+        /// Start up milestones of this module, started at construction.
+        StartupTimeline m_startup;
+
+        /// Module manifest the participant was created from, empty without static discovery.
+        std::vector<ModuleManifest> m_manifest;
+
+        /// Add a Physiology Value to the open Physiology Frame.
+        void AppendPhysiologyFrameValue(const AMM::PhysiologyValueSample &a);
+
+        /// Trim the open Physiology Frame to the values written and timestamp it, ready to publish.
+        void FinishPhysiologyFrame();
+
+        /// Setup pass registering the type of a topic.
+        /// @param topic Topic name.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int SetupType(const std::string &topic, std::string &errmsg);
+
+        /// Setup pass creating the Publisher of a topic.
+        /// @param topic Topic name.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int SetupPublisher(const std::string &topic, std::string &errmsg);
+
+        /// Setup pass creating the Subscriber of a topic, without a callback.
+        /// @param topic Topic name.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int SetupSubscriber(const std::string &topic, std::string &errmsg);
+
+        /// @returns Every Publisher and Subscriber of this module.
+        std::set<const void *> Endpoints() const;
 
     public:
         /// Default constructor taking in a module name defined by the user.
-        /// @param moduleName String name of this module.
-        DDSManager(std::string configFile, std::string profileName = std::string());
+        /// @param configFile XML profiles file.
+        /// @param profileName Participant profile, "amm_participant" if empty.
+        /// @param manifestFile Module manifest.  If set, the participant uses static endpoint discovery
+        /// generated from it instead of simple endpoint discovery, see StaticDiscovery.
+        /// @param discoveryServer Address of an amm_discovery_server, "host[:port]".  If set, the
+        /// participant is a client of that server instead of using simple discovery, see DiscoveryServer.
+        /// Cannot be combined with manifestFile.
+        /// @note Managers in one process with the same configFile, profileName and discoveryServer, and
+        /// no manifestFile, share one participant, and with it its name and GUID prefix; see
+        /// ParticipantRegistry.
+        DDSManager(
+           std::string configFile, std::string profileName = std::string(), std::string manifestFile = std::string(),
+           std::string discoveryServer = std::string()
+        );
 
-        /// Default deconstructor.
-        ~DDSManager() {};
+        /// Deletes every topic handler, removing any endpoints still open, and releases the participant
+        /// if Shutdown was not called.
+        ~DDSManager();
 
         /// Default shutdown command for the module.
         /// Should always be used before exiting the executable, because this ensures all Participant activity
@@ -318,17 +437,92 @@ namespace AMM {
         /// @note Shutdown routine will not stop if an error flag is raised. Will ignore and continue on.
         void Shutdown(std::string &errmsg);
 
+        /// UUID generated for this module at construction.
+        /// @returns A string form of the module UUID.
+        std::string GetModuleId() const;
+
+        /// History memory reserved by every publisher and subscriber created on this module.
+        /// @returns One entry per endpoint, see TopicMemory for how the policy of each topic is chosen.
+        std::vector<EndpointMemory> MemoryUsage() const;
+
+        /// Memory footprint of this module's topics as text.
+        /// Lists the memory policy, sample size and counts, and the bytes reserved up front and at most
+        /// for every publisher and subscriber, followed by the totals.
+        /// @returns Report, one line per endpoint.
+        std::string MemoryReport() const;
+
+        /// Register the types and create the endpoints of every topic this module uses in one pass.
+        ///
+        /// All types are registered first, then all Publishers and then all Subscribers are created, so
+        /// the whole set is announced to the network together instead of one endpoint at a time between
+        /// the module's own start up work.  Call this right after construction: participant discovery
+        /// runs in the background while the endpoints are created.
+        ///
+        /// Subscribers are created without a callback.  Bind one afterwards with the topic's Create
+        /// Subscriber method, which keeps the Subscriber created here and first delivers it the samples
+        /// received in between, up to the size of the topic's history, e.g.
+        /// @code
+        /// mgr->Setup({{PHVA_STR, TopicSetup::PUBLISH}, {SMCN_STR, TopicSetup::SUBSCRIBE}});
+        /// mgr->CreateSimulationControlSubscriber(this, &Module::onNewSimulationControl);
+        /// @endcode
+        /// Every endpoint created by this call is expected to match for the ENDPOINTS_MATCHED stage of the
+        /// startup timeline; endpoints that existed before are not counted.
+        /// @param topics Topics and the roles of this module on them.
+        /// @returns 0 if every topic was set up.
+        int Setup(const std::vector<TopicSetup> &topics);
+
+        /// Register the types and create the endpoints of every topic this module uses in one pass.
+        /// @see Setup(const std::vector<TopicSetup> &)
+        /// @param errmsg Error message output, one line per topic that failed.
+        /// @param topics Topics and the roles of this module on them.
+        /// @returns 0 if every topic was set up.
+        /// @note Topics that fail are reported and skipped, the others are still set up.
+        int Setup(std::string &errmsg, const std::vector<TopicSetup> &topics);
+
+        /// Start up milestones of this module, from construction to every endpoint matched.
+        /// @returns Timeline, updated as discovery progresses.
+        const StartupTimeline &Startup() const;
+
+        /// Start up milestones of this module as text, for logging.
+        /// @returns Report, one line per stage in milliseconds since construction.
+        std::string StartupReport() const;
+
+        /// Topics the module manifest lists for this module, to pass to Setup.
+        /// @returns Topics and roles, empty without static discovery.
+        std::vector<TopicSetup> ManifestTopics() const;
+
         /// Generates a random UUID.
         /// @returns A string form of a UUID.
         static std::string GenerateUuidString();
 
+        /// Generates a batch of random UUIDs into caller provided buffers.
+        /// Uses the calling thread's generator, so this is safe to call from DDS callbacks.
+        /// @param n Number of UUIDs to generate.
+        /// @param buffers Destination, the i-th null terminated UUID string is written at buffers + i * stride.
+        /// @param stride Distance between consecutive buffers, at least UuidGenerator::BUFFER_SIZE.
+        static void GenerateUuids(
+           std::size_t n, char *buffers, std::size_t stride = UuidGenerator::BUFFER_SIZE
+        );
+
+        /// Converts a textual UUID, as received from any peer, to its 16 byte form.
+        /// Ids that are not UUIDs map to a stable name based UUID.  Lossy, see BinaryUuid::FromString.
+        /// @param uuid Textual UUID.
+        /// @returns Binary UUID.
+        static BinaryUuid ToBinaryUuid(const AMM::UUID &uuid);
+
+        /// Converts a binary UUID back to the canonical textual form understood by every peer.
+        /// A legacy or non-canonical id given to ToBinaryUuid does not come back unchanged.
+        /// @param uuid Binary UUID.
+        /// @returns Textual UUID.
+        static AMM::UUID ToUuid(const BinaryUuid &uuid);
+
         /// Initializer routine for Assessment.
-        /// Initializes m_assessment with a new AmmDataType pointer.
+        /// Initializes m_assessment with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeAssessment();
 
         /// Overload initializer routine for Assessment.
-        /// Initializes m_assessment with a new AmmDataType pointer.
+        /// Initializes m_assessment with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeAssessment(std::string &errmsg);
@@ -422,12 +616,12 @@ namespace AMM {
         // - - - Event Fragment - - -
 
         /// Initializer routine for Event Fragment.
-        /// Initializes m_eventFragment with a new AmmDataType pointer.
+        /// Initializes m_eventFragment with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeEventFragment();
 
         /// Overload initializer routine for Event Fragment.
-        /// Initializes m_eventFragment with a new AmmDataType pointer.
+        /// Initializes m_eventFragment with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeEventFragment(std::string &errmsg);
@@ -522,12 +716,12 @@ namespace AMM {
         // - - - Event Record - - -
 
         /// Initializer routine for Event Record.
-        /// Initializes m_eventRecord with a new AmmDataType pointer.
+        /// Initializes m_eventRecord with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeEventRecord();
 
         /// Overload initializer routine for Event Record.
-        /// Initializes m_eventRecord with a new AmmDataType pointer.
+        /// Initializes m_eventRecord with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeEventRecord(std::string &errmsg);
@@ -621,12 +815,12 @@ namespace AMM {
         // - - - Fragment Amendment Request - - -
 
         /// Initializer routine for Fragment Amendment Request.
-        /// Initializes m_fragmentAmendmentRequest with a new AmmDataType pointer.
+        /// Initializes m_fragmentAmendmentRequest with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeFragmentAmendmentRequest();
 
         /// Overload initializer routine for Fragment Amendment Request.
-        /// Initializes m_fragmentAmendmentRequest with a new AmmDataType pointer.
+        /// Initializes m_fragmentAmendmentRequest with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeFragmentAmendmentRequest(std::string &errmsg);
@@ -721,12 +915,12 @@ namespace AMM {
         // - - - Log - - -
 
         /// Initializer routine for Log.
-        /// Initializes m_log with a new AmmDataType pointer.
+        /// Initializes m_log with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeLog();
 
         /// Overload initializer routine for Log.
-        /// Initializes m_log with a new AmmDataType pointer.
+        /// Initializes m_log with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeLog(std::string &errmsg);
@@ -761,7 +955,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreateLogSubscriber(
-           U *parentClass, void (U::*onEvent)(AMM::Log &, eprosima::fastrtps::SampleInfo_t *)
+           U *parentClass, void (U::*onEvent)(AMM::LogSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Create the data subscriber for Log published events on this module.
@@ -771,7 +965,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreateLogSubscriber(
-           std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::Log &, eprosima::fastrtps::SampleInfo_t *)
+           std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::LogSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Remove the subscriber for Log on this module from the DDS network.
@@ -787,14 +981,14 @@ namespace AMM {
         /// @param a Reference to Log data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WriteLog(AMM::Log &a);
+        int WriteLog(AMM::LogSample &a);
 
         /// Call upon the active publisher for Log to write data to the DDS network.
         /// @param errmsg Error message output.
         /// @param a Reference to Log data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WriteLog(std::string &errmsg, AMM::Log &a);
+        int WriteLog(std::string &errmsg, AMM::LogSample &a);
 
         /// Listener Interface override for handling Log subscribed events.
         /// Calls OnEvent on m_log passing along data to the handler defined by
@@ -803,7 +997,7 @@ namespace AMM {
         /// @see ListenerInterface::onNewLog
         /// @param log incoming Log data from the DDS network.
         /// @param info FastRTPS sample info.
-        void onNewLog(AMM::Log eventRec, eprosima::fastrtps::SampleInfo_t *info) override;
+        void onNewLog(AMM::LogSample eventRec, eprosima::fastrtps::SampleInfo_t *info) override;
 
         /// Clean up Log and set it to an inactive state.
         /// Calls Delete on m_log.
@@ -819,12 +1013,12 @@ namespace AMM {
         // - - - Module Configuration - - -
 
         /// Initializer routine for Module Configuration.
-        /// Initializes m_moduleConfiguration with a new AmmDataType pointer.
+        /// Initializes m_moduleConfiguration with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeModuleConfiguration();
 
         /// Overload initializer routine for Module Configuration.
-        /// Initializes m_moduleConfiguration with a new AmmDataType pointer.
+        /// Initializes m_moduleConfiguration with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeModuleConfiguration(std::string &errmsg);
@@ -873,6 +1067,19 @@ namespace AMM {
            void (U::*onEvent)(AMM::ModuleConfiguration &, eprosima::fastrtps::SampleInfo_t *)
         );
 
+        /// Create the data subscriber for Module Configuration published events and feed them to a cache.
+        /// The cache parses each module's configuration once and calls its handler only on changes.
+        /// @param cache Cache receiving configurations. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateModuleConfigurationSubscriber(ModuleConfigurationCache *cache);
+
+        /// Create the data subscriber for Module Configuration published events and feed them to a cache.
+        /// The cache parses each module's configuration once and calls its handler only on changes.
+        /// @param errmsg Error message output.
+        /// @param cache Cache receiving configurations. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateModuleConfigurationSubscriber(std::string &errmsg, ModuleConfigurationCache *cache);
+
         /// Remove the subscriber for Module Configuration on this module from the DDS network.
         /// @returns 0 if successful.
         int RemoveModuleConfigurationSubscriber();
@@ -919,12 +1126,12 @@ namespace AMM {
         // - - - Omitted Event - - -
 
         /// Initializer routine for Omitted Event.
-        /// Initializes m_omittedEvent with a new AmmDataType pointer.
+        /// Initializes m_omittedEvent with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeOmittedEvent();
 
         /// Overload initializer routine for Omitted Event.
-        /// Initializes m_omittedEvent with a new AmmDataType pointer.
+        /// Initializes m_omittedEvent with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeOmittedEvent(std::string &errmsg);
@@ -1018,12 +1225,12 @@ namespace AMM {
         // - - - Operational Description - - -
 
         /// Initializer routine for Operational Description.
-        /// Initializes m_operationalDescription with a new AmmDataType pointer.
+        /// Initializes m_operationalDescription with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeOperationalDescription();
 
         /// Overload initializer routine for Operational Description.
-        /// Initializes m_operationalDescription with a new AmmDataType pointer.
+        /// Initializes m_operationalDescription with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeOperationalDescription(std::string &errmsg);
@@ -1072,6 +1279,19 @@ namespace AMM {
            void (U::*onEvent)(AMM::OperationalDescription &, eprosima::fastrtps::SampleInfo_t *)
         );
 
+        /// Create the data subscriber for Operational Description published events and feed them to a health monitor.
+        /// The monitor takes the name and hardware of each module from its Operational Description.
+        /// @param monitor Monitor receiving descriptions. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateOperationalDescriptionSubscriber(ModuleHealthMonitor *monitor);
+
+        /// Create the data subscriber for Operational Description published events and feed them to a health monitor.
+        /// The monitor takes the name and hardware of each module from its Operational Description.
+        /// @param errmsg Error message output.
+        /// @param monitor Monitor receiving descriptions. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateOperationalDescriptionSubscriber(std::string &errmsg, ModuleHealthMonitor *monitor);
+
         /// Remove the subscriber for Operation Description on this module from the DDS network.
         /// @returns 0 if successful.
         int RemoveOperationalDescriptionSubscriber();
@@ -1118,12 +1338,12 @@ namespace AMM {
         // - - - Physiology Modification - - -
 
         /// Initializer routine for Physiology Modification.
-        /// Initializes m_physiologyModification with a new AmmDataType pointer.
+        /// Initializes m_physiologyModification with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializePhysiologyModification();
 
         /// Overload initializer routine for Physiology Modification.
-        /// Initializes m_physiologyModification with a new AmmDataType pointer.
+        /// Initializes m_physiologyModification with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializePhysiologyModification(std::string &errmsg);
@@ -1218,12 +1438,12 @@ namespace AMM {
         // - - - Physioogy Value - - -
 
         /// Initializer routine for Physiology Value.
-        /// Initializes m_physiologyValue with a new AmmDataType pointer.
+        /// Initializes m_physiologyValue with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializePhysiologyValue();
 
         /// Overload initializer routine for Physiology Value.
-        /// Initializes m_physiologyValue with a new AmmDataType pointer.
+        /// Initializes m_physiologyValue with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializePhysiologyValue(std::string &errmsg);
@@ -1258,7 +1478,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreatePhysiologyValueSubscriber(
-           U *parentClass, void (U::*onEvent)(AMM::PhysiologyValue &, eprosima::fastrtps::SampleInfo_t *)
+           U *parentClass, void (U::*onEvent)(AMM::PhysiologyValueSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Create the data subscriber for Physiology Value published events on this module.
@@ -1269,7 +1489,7 @@ namespace AMM {
         /// @returns 0 if successful.
         int CreatePhysiologyValueSubscriber(
            std::string &errmsg, U *parentClass,
-           void (U::*onEvent)(AMM::PhysiologyValue &, eprosima::fastrtps::SampleInfo_t *)
+           void (U::*onEvent)(AMM::PhysiologyValueSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Remove the subscriber for Physiology Value on this module from the DDS network.
@@ -1282,17 +1502,23 @@ namespace AMM {
         int RemovePhysiologyValueSubscriber(std::string &errmsg);
 
         /// Call upon the active publisher for Physiology Value to write data to the DDS network.
+        /// While a Physiology Frame is open (see BeginPhysiologyFrame) the name, value and educational
+        /// encounter are also added to the frame.  The value is only left off Physiology Value if
+        /// SetDivertPhysiologyValues(true) was called.
         /// @param a Reference to Physiology Value data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WritePhysiologyValue(AMM::PhysiologyValue &a);
+        int WritePhysiologyValue(AMM::PhysiologyValueSample &a);
 
         /// Call upon the active publisher for Physiology Value to write data to the DDS network.
+        /// While a Physiology Frame is open (see BeginPhysiologyFrame) the name, value and educational
+        /// encounter are also added to the frame.  The value is only left off Physiology Value if
+        /// SetDivertPhysiologyValues(true) was called.
         /// @param errmsg Error message output.
         /// @param a Reference to Physiology Value data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WritePhysiologyValue(std::string &errmsg, AMM::PhysiologyValue &a);
+        int WritePhysiologyValue(std::string &errmsg, AMM::PhysiologyValueSample &a);
 
         /// Listener Interface override for handling Physiology Value subscribed events.
         /// Calls OnEvent on m_physiologyValue passing along data to the handler defined by
@@ -1301,7 +1527,7 @@ namespace AMM {
         /// @see ListenerInterface::onNewPhysiologyValue
         /// @param physVal incoming Physiology Value data from the DDS network.
         /// @param info FastRTPS sample info.
-        void onNewPhysiologyValue(AMM::PhysiologyValue physVal, eprosima::fastrtps::SampleInfo_t *info) override;
+        void onNewPhysiologyValue(AMM::PhysiologyValueSample physVal, eprosima::fastrtps::SampleInfo_t *info) override;
 
         /// Clean up Physiology Value and set it to an inactive state.
         /// Calls Delete on m_physiologyValue.
@@ -1317,12 +1543,12 @@ namespace AMM {
         // - - - Physiology Waveform - - -
 
         /// Initializer routine for Physiology Waveform.
-        /// Initializes m_physiologyWaveform with a new AmmDataType pointer.
+        /// Initializes m_physiologyWaveform with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializePhysiologyWaveform();
 
         /// Overload initializer routine for Physiology Waveform.
-        /// Initializes m_physiolgyWaveform with a new AmmDataType pointer.
+        /// Initializes m_physiolgyWaveform with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializePhysiologyWaveform(std::string &errmsg);
@@ -1357,7 +1583,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreatePhysiologyWaveformSubscriber(
-           U *parentClass, void (U::*onEvent)(AMM::PhysiologyWaveform &, eprosima::fastrtps::SampleInfo_t *)
+           U *parentClass, void (U::*onEvent)(AMM::PhysiologyWaveformSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Create the data subscriber for Physiology Waveform published events on this module.
@@ -1368,7 +1594,7 @@ namespace AMM {
         /// @returns 0 if successful.
         int CreatePhysiologyWaveformSubscriber(
            std::string &errmsg, U *parentClass,
-           void (U::*onEvent)(AMM::PhysiologyWaveform &, eprosima::fastrtps::SampleInfo_t *)
+           void (U::*onEvent)(AMM::PhysiologyWaveformSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Remove the subscriber for Physiology Waveform on this module from the DDS network.
@@ -1384,14 +1610,14 @@ namespace AMM {
         /// @param a Reference to Physiology Waveform data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WritePhysiologyWaveform(AMM::PhysiologyWaveform &a);
+        int WritePhysiologyWaveform(AMM::PhysiologyWaveformSample &a);
 
         /// Call upon the active publisher for Physiology Waveform to write data to the DDS network.
         /// @param errmsg Error message output.
         /// @param a Reference to Physiology Waveform data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WritePhysiologyWaveform(std::string &errmsg, AMM::PhysiologyWaveform &a);
+        int WritePhysiologyWaveform(std::string &errmsg, AMM::PhysiologyWaveformSample &a);
 
         /// Listener Interface override for handling Physiology Waveform subscribed events.
         /// Calls OnEvent on m_physiologyWaveform passing along data to the handler defined by
@@ -1400,7 +1626,7 @@ namespace AMM {
         /// @see ListenerInterface::onNewPhysiologyWaveform
         /// @param eventFrag incoming Physiology Waveform data from the DDS network.
         /// @param info FastRTPS sample info.
-        void onNewPhysiologyWaveform(AMM::PhysiologyWaveform physWave, eprosima::fastrtps::SampleInfo_t *info) override;
+        void onNewPhysiologyWaveform(AMM::PhysiologyWaveformSample physWave, eprosima::fastrtps::SampleInfo_t *info) override;
 
         /// Clean up Physiology Waveform and set it to an inactive state.
         /// Calls Delete on m_physiologyWaveform.
@@ -1416,12 +1642,12 @@ namespace AMM {
         // - - - Render Modification - - -
 
         /// Initializer routine for Render Modification.
-        /// Initializes m_renderModification with a new AmmDataType pointer.
+        /// Initializes m_renderModification with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeRenderModification();
 
         /// Overload initializer routine for Render Modification.
-        /// Initializes m_renderModification with a new AmmDataType pointer.
+        /// Initializes m_renderModification with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeRenderModification(std::string &errmsg);
@@ -1515,12 +1741,12 @@ namespace AMM {
         // - - - Simulation Control - - -
 
         /// Initializer routine for Simulation Control.
-        /// Initializes m_simulationControl with a new AmmDataType pointer.
+        /// Initializes m_simulationControl with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeSimulationControl();
 
         /// Overload initializer routine for Simulation Control.
-        /// Initializes m_simulationControl with a new AmmDataType pointer.
+        /// Initializes m_simulationControl with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeSimulationControl(std::string &errmsg);
@@ -1614,12 +1840,12 @@ namespace AMM {
         // - - - Status - - -
 
         /// Initializer routine for Status.
-        /// Initializes m_stuatus with a new AmmDataType pointer.
+        /// Initializes m_stuatus with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeStatus();
 
         /// Overload initializer routine for Status.
-        /// Initializes m_status with a new AmmDataType pointer.
+        /// Initializes m_status with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeStatus(std::string &errmsg);
@@ -1654,7 +1880,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreateStatusSubscriber(
-           U *parentClass, void (U::*onEvent)(AMM::Status &, eprosima::fastrtps::SampleInfo_t *)
+           U *parentClass, void (U::*onEvent)(AMM::StatusSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Create the data subscriber for Status published events on this module.
@@ -1664,9 +1890,30 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreateStatusSubscriber(
-           std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::Status &, eprosima::fastrtps::SampleInfo_t *)
+           std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::StatusSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
+        /// Create the data subscriber for Status published events and feed them to a health monitor.
+        /// The monitor also receives the liveliness changes of the Status writers, so it reports a module
+        /// that stops without publishing a Status as lost.  For that the subscriber requests the one
+        /// second liveliness lease Status writers offer, and does not match writers of modules built
+        /// before they offered it; see AmmDataType::RequestLivelinessLease.  A Status subscriber created
+        /// without the lease, e.g. by Setup, is replaced.
+        /// @param monitor Monitor receiving Status. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateStatusSubscriber(ModuleHealthMonitor *monitor);
+
+        /// Create the data subscriber for Status published events and feed them to a health monitor.
+        /// The monitor also receives the liveliness changes of the Status writers, so it reports a module
+        /// that stops without publishing a Status as lost.  For that the subscriber requests the one
+        /// second liveliness lease Status writers offer, and does not match writers of modules built
+        /// before they offered it; see AmmDataType::RequestLivelinessLease.  A Status subscriber created
+        /// without the lease, e.g. by Setup, is replaced.
+        /// @param errmsg Error message output.
+        /// @param monitor Monitor receiving Status. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateStatusSubscriber(std::string &errmsg, ModuleHealthMonitor *monitor);
+
         /// Remove the subscriber for Status on this module from the DDS network.
         /// @returns 0 if successful.
         int RemoveStatusSubscriber();
@@ -1680,14 +1927,14 @@ namespace AMM {
         /// @param a Reference to Status data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WriteStatus(AMM::Status &a);
+        int WriteStatus(AMM::StatusSample &a);
 
         /// Call upon the active publisher for Status to write data to the DDS network.
         /// @param errmsg Error message output.
         /// @param a Reference to Status data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WriteStatus(std::string &errmsg, AMM::Status &a);
+        int WriteStatus(std::string &errmsg, AMM::StatusSample &a);
 
         /// Listener Interface override for handling Status subscribed events.
         /// Calls OnEvent on m_status passing along data to the handler defined by
@@ -1696,7 +1943,7 @@ namespace AMM {
         /// @see ListenerInterface::onNewStatus
         /// @param status incoming Status data from the DDS network.
         /// @param info FastRTPS sample info.
-        void onNewStatus(AMM::Status status, eprosima::fastrtps::SampleInfo_t *info) override;
+        void onNewStatus(AMM::StatusSample status, eprosima::fastrtps::SampleInfo_t *info) override;
 
         /// Clean up Status and set it to an inactive state.
         /// Calls Delete on m_status.
@@ -1712,12 +1959,12 @@ namespace AMM {
         // - - - Tick - - -
 
         /// Initializer routine for Tick.
-        /// Initializes m_tick with a new AmmDataType pointer.
+        /// Initializes m_tick with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeTick();
 
         /// Overload initializer routine for Tick.
-        /// Initializes m_tick with a new AmmDataType pointer.
+        /// Initializes m_tick with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeTick(std::string &errmsg);
@@ -1765,6 +2012,19 @@ namespace AMM {
            std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::Tick &, eprosima::fastrtps::SampleInfo_t *)
         );
 
+        /// Create the data subscriber for Tick published events and feed them to a scheduler.
+        /// Every received Tick is handed to scheduler, which runs its tasks on its own thread.
+        /// @param scheduler Scheduler receiving ticks. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateTickSubscriber(TickScheduler *scheduler);
+
+        /// Create the data subscriber for Tick published events and feed them to a scheduler.
+        /// Every received Tick is handed to scheduler, which runs its tasks on its own thread.
+        /// @param errmsg Error message output.
+        /// @param scheduler Scheduler receiving ticks. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateTickSubscriber(std::string &errmsg, TickScheduler *scheduler);
+
         /// Remove the subscriber for Tick on this module from the DDS network.
         /// @returns 0 if successful.
         int RemoveTickSubscriber();
@@ -1810,12 +2070,12 @@ namespace AMM {
         // - - - Instrument Data - - -
 
         /// Initializer routine for Instrument Data.
-        /// Initializes m_instrumentData with a new AmmDataType pointer.
+        /// Initializes m_instrumentData with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeInstrumentData();
 
         /// Overload initializer routine for Instrument Data.
-        /// Initializes m_instrumentData with a new AmmDataType pointer.
+        /// Initializes m_instrumentData with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeInstrumentData(std::string &errmsg);
@@ -1909,12 +2169,12 @@ namespace AMM {
         // - - - Command - - -
 
         /// Initializer routine for Command.
-        /// Initializes m_command with a new AmmDataType pointer.
+        /// Initializes m_command with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeCommand();
 
         /// Overload initializer routine for Command.
-        /// Initializes m_command with a new AmmDataType pointer.
+        /// Initializes m_command with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeCommand(std::string &errmsg);
@@ -1949,7 +2209,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreateCommandSubscriber(
-           U *parentClass, void (U::*onEvent)(AMM::Command &, eprosima::fastrtps::SampleInfo_t *)
+           U *parentClass, void (U::*onEvent)(AMM::CommandSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Create the data subscriber for Command published events on this module.
@@ -1959,7 +2219,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreateCommandSubscriber(
-           std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::Command &, eprosima::fastrtps::SampleInfo_t *)
+           std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::CommandSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Remove the subscriber for Command on this module from the DDS network.
@@ -1975,14 +2235,14 @@ namespace AMM {
         /// @param a Reference to Command data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WriteCommand(AMM::Command &a);
+        int WriteCommand(AMM::CommandSample &a);
 
         /// Call upon the active publisher for Command to write data to the DDS network.
         /// @param errmsg Error message output.
         /// @param a Reference to Command data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WriteCommand(std::string &errmsg, AMM::Command &a);
+        int WriteCommand(std::string &errmsg, AMM::CommandSample &a);
 
         /// Listener Interface override for handling Command subscribed events.
         /// Calls OnEvent on m_command passing along data to the handler defined by
@@ -1991,7 +2251,7 @@ namespace AMM {
         /// @see ListenerInterface::onNewCommand
         /// @param command incoming Command data from the DDS network.
         /// @param info FastRTPS sample info.
-        void onNewCommand(AMM::Command command, eprosima::fastrtps::SampleInfo_t *info) override;
+        void onNewCommand(AMM::CommandSample command, eprosima::fastrtps::SampleInfo_t *info) override;
 
         /// Clean up Command and set it to an inactive state.
         /// Calls Delete on m_command.
@@ -2004,11 +2264,165 @@ namespace AMM {
         /// @returns 0 if successful.
         int DecommissionCommand(std::string &errmsg);
 
+        // - - - Physiology Frame - - -
+
+        /// Initializer routine for Physiology Frame.
+        /// Initializes m_physiologyFrame with a new AmmDataType pointer, or reuses the one of an earlier initialization.
+        /// @returns 0 if successful.
+        int InitializePhysiologyFrame();
+
+        /// Overload initializer routine for Physiology Frame.
+        /// Initializes m_physiologyFrame with a new AmmDataType pointer, or reuses the one of an earlier initialization.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int InitializePhysiologyFrame(std::string &errmsg);
+
+        /// State of whether Physiology Frame is currently valid.
+        /// @returns True if m_physiologyFrame is valid pointer.
+        bool IsPhysiologyFrameInitialized();
+
+        /// Create the data publisher for Physiology Frame on this module.
+        /// Allows Physiology Frame data to be published to the DDS network.
+        /// @returns 0 if successful.
+        int CreatePhysiologyFramePublisher();
+
+        /// Create the data publisher for Physiology Frame on this module.
+        /// Allows Physiology Frame data to be published to the DDS network.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int CreatePhysiologyFramePublisher(std::string &errmsg);
+
+        /// Remove the publisher for Physiology Frame on this module from the DDS network.
+        /// @returns 0 if successful.
+        int RemovePhysiologyFramePublisher();
+
+        /// Remove the publisher for Physiology Frame on this module from the DDS network.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int RemovePhysiologyFramePublisher(std::string &errmsg);
+
+        /// Create the data subscriber for Physiology Frame published events on this module.
+        /// Allows the module to receive complete Physiology Frames when they are published on the DDS network.
+        /// @param parentClass Reference to the object that is receiving the subscribed event callback.
+        /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
+        /// @returns 0 if successful.
+        int CreatePhysiologyFrameSubscriber(
+           U *parentClass, void (U::*onEvent)(AMM::PhysiologyFrame &, eprosima::fastrtps::SampleInfo_t *)
+        );
+
+        /// Create the data subscriber for Physiology Frame published events on this module.
+        /// Allows the module to receive complete Physiology Frames when they are published on the DDS network.
+        /// @param errmsg Error message output.
+        /// @param parentClass Reference to the object that is receiving the subscribed event callback.
+        /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
+        /// @returns 0 if successful.
+        int CreatePhysiologyFrameSubscriber(
+           std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::PhysiologyFrame &, eprosima::fastrtps::SampleInfo_t *)
+        );
+
+        /// Remove the subscriber for Physiology Frame on this module from the DDS network.
+        /// @returns 0 if successful.
+        int RemovePhysiologyFrameSubscriber();
+
+        /// Remove the subscriber for Physiology Frame on this module from the DDS network.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int RemovePhysiologyFrameSubscriber(std::string &errmsg);
+
+        /// Call upon the active publisher for Physiology Frame to write data to the DDS network.
+        /// @param a Reference to Physiology Frame data to be written.
+        /// @returns 0 if successful.
+        /// @returns 1 if Publisher has not been created or if some other error occurred.
+        int WritePhysiologyFrame(AMM::PhysiologyFrame &a);
+
+        /// Call upon the active publisher for Physiology Frame to write data to the DDS network.
+        /// @param errmsg Error message output.
+        /// @param a Reference to Physiology Frame data to be written.
+        /// @returns 0 if successful.
+        /// @returns 1 if Publisher has not been created or if some other error occurred.
+        int WritePhysiologyFrame(std::string &errmsg, AMM::PhysiologyFrame &a);
+
+        /// Listener Interface override for handling Physiology Frame subscribed events.
+        /// Calls OnEvent on m_physiologyFrame passing along data to the handler defined by
+        /// the user in CreatePhysiologyFrameSubscriber.
+        /// @see AmmDataType::OnEvent
+        /// @see ListenerInterface::onNewPhysiologyFrame
+        /// @param physFrame incoming Physiology Frame data from the DDS network.
+        /// @param info FastRTPS sample info.
+        void onNewPhysiologyFrame(AMM::PhysiologyFrame physFrame, eprosima::fastrtps::SampleInfo_t *info) override;
+
+        /// Clean up Physiology Frame and set it to an inactive state.
+        /// Calls Delete on m_physiologyFrame.
+        /// @returns 0 if successful.
+        int DecommissionPhysiologyFrame();
+
+        /// Clean up Physiology Frame and set it to an inactive state.
+        /// Calls Delete on m_physiologyFrame.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int DecommissionPhysiologyFrame(std::string &errmsg);
+
+        /// Override for matched events from every Publisher.
+        /// Records the first match of each Publisher on the startup timeline.
+        /// @see ListenerInterface::onPublicationMatched
+        void onPublicationMatched(Publisher *pub, MatchingInfo &info) override;
+
+        /// Override for matched events from every Subscriber.
+        /// Records the first match of each Subscriber on the startup timeline.
+        /// @see ListenerInterface::onSubscriptionMatched
+        void onSubscriptionMatched(Subscriber *sub, MatchingInfo &info) override;
+
+        /// Override for liveliness changes seen by every Subscriber.
+        /// Passes them to the health monitor attached to the Status subscriber, if any.
+        /// @see ListenerInterface::onLivelinessChanged
+        void onLivelinessChanged(Subscriber *sub, const LivelinessChangedStatus &status) override;
+
+        /// Override for participant discovery events.
+        /// Records the first remote participant discovered on the startup timeline.
+        /// @see ListenerInterface::onParticipantDiscovery
+        void onParticipantDiscovery(Participant *participant, ParticipantDiscoveryInfo &info) override;
+
+        /// Start collecting the Physiology Values of one simulation step into a single Physiology Frame.
+        /// Until EndPhysiologyFrame is called, WritePhysiologyValue adds every value to the frame, so
+        /// subscribers see every value of a step together.  The values are still published on Physiology
+        /// Value as well, unless diverted with SetDivertPhysiologyValues.
+        /// @note Not thread safe. Begin, write and end a frame from the thread stepping the simulation.
+        /// @param simulation_time Simulation time of the step.
+        /// @returns 0 if successful.
+        /// @returns 1 if Physiology Frame has no publisher or a frame is already open.
+        int BeginPhysiologyFrame(int64_t simulation_time);
+
+        /// Start collecting the Physiology Values of one simulation step into a single Physiology Frame.
+        /// @see BeginPhysiologyFrame(int64_t)
+        /// @param errmsg Error message output.
+        /// @param simulation_time Simulation time of the step.
+        /// @returns 0 if successful.
+        int BeginPhysiologyFrame(std::string &errmsg, int64_t simulation_time);
+
+        /// Publish the open Physiology Frame as one message and close it.
+        /// @returns 0 if successful.
+        /// @returns 1 if no frame is open or the write failed.
+        int EndPhysiologyFrame();
+
+        /// Publish the open Physiology Frame as one message and close it.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int EndPhysiologyFrame(std::string &errmsg);
+
+        /// Choose whether values written while a Physiology Frame is open are published on Physiology Value.
+        /// Diverting them into the frame only sends far fewer messages, but modules that subscribe to
+        /// Physiology Value and not to Physiology Frame then receive nothing while frames are in use.
+        /// Off by default.
+        /// @param divert True to publish values of an open frame on Physiology Frame only.
+        void SetDivertPhysiologyValues(bool divert);
+
 
     }; // class DDSManager <U>
 
     template<class U>
-    inline DDSManager<U>::DDSManager(std::string configFile, std::string profileName) {
+    inline DDSManager<U>::DDSManager(
+       std::string configFile, std::string profileName, std::string manifestFile, std::string discoveryServer
+    ) {
         if (profileName.empty()) {
             profileName = defaultProfile;
         }
@@ -2016,8 +2430,36 @@ namespace AMM {
        try {
           if (!eprosima::fastrtps::Domain::loadXMLProfilesFile(configFile)) {
              std::cout << "Unable to load XML file to create FastRTPS domain participant." << std::endl;
+          } else {
+             m_startup.Mark(StartupTimeline::PROFILE_LOADED);
+          }
+          std::string errmsg;
+          if (!manifestFile.empty() && !discoveryServer.empty()) {
+             errmsg = "A module manifest and a discovery server cannot be used together.";
+          } else if (manifestFile.empty() || StaticDiscovery::LoadManifest(manifestFile, m_manifest, errmsg) == 0) {
+             // Managers with the same profiles file, profile and discovery server share one participant.
+             // Static discovery assigns entity IDs per topic, so managers with a manifest never share.
+             const std::string key = manifestFile.empty() ? configFile + "|" + profileName + "|" + discoveryServer : "";
+             m_participant = ParticipantRegistry::Acquire(
+                key, this, [&](eprosima::fastrtps::ParticipantListener *listener) -> eprosima::fastrtps::Participant * {
+                   if (!discoveryServer.empty()) {
+                      return DiscoveryServer::CreateClient(profileName, discoveryServer, listener, errmsg);
+                   }
+                   if (!manifestFile.empty()) {
+                      return StaticDiscovery::CreateParticipant(profileName, m_manifest, listener, errmsg);
+                   }
+                   eprosima::fastrtps::ParticipantAttributes attributes;
+                   if (eprosima::fastrtps::xmlparser::XMLProfileManager::fillParticipantAttributes(profileName, attributes) !=
+                       eprosima::fastrtps::xmlparser::XMLP_ret::XML_OK) {
+                      errmsg = "Unable to find participant profile " + profileName + ".";
+                      return nullptr;
+                   }
+                   PayloadCodec::Advertise(attributes.rtps.properties);
+                   return eprosima::fastrtps::Domain::createParticipant(attributes, listener);
+                }
+             );
           }
-          m_participant = eprosima::fastrtps::Domain::createParticipant(profileName);
+          if (m_participant == nullptr && !errmsg.empty()) std::cout << errmsg << std::endl;
        } catch (std::exception &e) {
           std::cerr << e.what() << std::endl;
        }
@@ -2025,14 +2467,45 @@ namespace AMM {
           std::cout << "Unable to create FastRTPS domain participant." << std::endl;
           return;
        }
+       m_startup.Mark(StartupTimeline::PARTICIPANT_CREATED);
+       if (ParticipantRegistry::DiscoveredParticipants(m_participant) > 0) {
+          m_startup.Mark(StartupTimeline::PARTICIPANT_DISCOVERED);
+       }
 
        m_pubListener = new DDS_Listeners::PubListener();
+       m_pubListener->SetUpstream(this);
 
        m_moduleId = DDSManager::GenerateUuidString();
        m_moduleName = m_participant->getAttributes().rtps.getName();
 
     }
 
+    template<class U>
+    inline DDSManager<U>::~DDSManager() {
+       // Each handler removes the endpoints and type registration it still holds.
+       delete m_assessment;
+       delete m_eventFragment;
+       delete m_eventRecord;
+       delete m_fragmentAmendmentRequest;
+       delete m_log;
+       delete m_moduleConfiguration;
+       delete m_omittedEvent;
+       delete m_operationalDescription;
+       delete m_physiologyModification;
+       delete m_physiologyValue;
+       delete m_physiologyWaveform;
+       delete m_renderModification;
+       delete m_simulationControl;
+       delete m_status;
+       delete m_tick;
+       delete m_instrumentData;
+       delete m_command;
+       delete m_physiologyFrame;
+       delete m_pubListener;
+
+       if (m_participant != nullptr) ParticipantRegistry::Release(m_participant, this);
+    }
+
     template<class U>
     inline void DDSManager<U>::Shutdown(std::string &errmsg) {
        int err = 0;
@@ -2057,8 +2530,12 @@ namespace AMM {
        if (DecommissionTick(localerrmsg) != 0) errmsg + localerrmsg + "\n";
        if (DecommissionInstrumentData(localerrmsg) != 0) errmsg + localerrmsg + "\n";
        if (DecommissionCommand(localerrmsg) != 0) errmsg + localerrmsg + "\n";
+       if (DecommissionPhysiologyFrame(localerrmsg) != 0) errmsg + localerrmsg + "\n";
 
-       eprosima::fastrtps::Domain::stopAll();
+       // The participant stays while another manager uses it.
+       ParticipantRegistry::Release(m_participant, this);
+       m_participant = nullptr;
+       if (ParticipantRegistry::Empty()) eprosima::fastrtps::Domain::stopAll();
     }
 
     template<class U>
@@ -2080,14 +2557,319 @@ namespace AMM {
        DecommissionTick();
        DecommissionInstrumentData();
        DecommissionCommand();
+       DecommissionPhysiologyFrame();
+
+       // The participant stays while another manager uses it.
+       ParticipantRegistry::Release(m_participant, this);
+       m_participant = nullptr;
+       if (ParticipantRegistry::Empty()) eprosima::fastrtps::Domain::stopAll();
+    }
+
+    template<class U>
+    inline std::string DDSManager<U>::GetModuleId() const {
+       return m_moduleId;
+    }
 
-       eprosima::fastrtps::Domain::stopAll();
+    template<class U>
+    inline std::vector<EndpointMemory> DDSManager<U>::MemoryUsage() const {
+       std::vector<EndpointMemory> endpoints;
+       if (m_isAssessmentInit) m_assessment->AppendMemoryUsage(endpoints);
+       if (m_isEventFragInit) m_eventFragment->AppendMemoryUsage(endpoints);
+       if (m_isEventRecInit) m_eventRecord->AppendMemoryUsage(endpoints);
+       if (m_isFragAmendReqInit) m_fragmentAmendmentRequest->AppendMemoryUsage(endpoints);
+       if (m_isLogInit) m_log->AppendMemoryUsage(endpoints);
+       if (m_isModConfigInit) m_moduleConfiguration->AppendMemoryUsage(endpoints);
+       if (m_isOmitEventInit) m_omittedEvent->AppendMemoryUsage(endpoints);
+       if (m_isOpDescriptInit) m_operationalDescription->AppendMemoryUsage(endpoints);
+       if (m_isPhysModInit) m_physiologyModification->AppendMemoryUsage(endpoints);
+       if (m_isPhysValInit) m_physiologyValue->AppendMemoryUsage(endpoints);
+       if (m_isPhysWaveInit) m_physiologyWaveform->AppendMemoryUsage(endpoints);
+       if (m_isRendModInit) m_renderModification->AppendMemoryUsage(endpoints);
+       if (m_isSimControlInit) m_simulationControl->AppendMemoryUsage(endpoints);
+       if (m_isStatusInit) m_status->AppendMemoryUsage(endpoints);
+       if (m_isTickInit) m_tick->AppendMemoryUsage(endpoints);
+       if (m_isInstDataInit) m_instrumentData->AppendMemoryUsage(endpoints);
+       if (m_isCommandInit) m_command->AppendMemoryUsage(endpoints);
+       if (m_isPhysFrameInit) m_physiologyFrame->AppendMemoryUsage(endpoints);
+       return endpoints;
+    }
+
+    template<class U>
+    inline std::set<const void *> DDSManager<U>::Endpoints() const {
+       std::set<const void *> endpoints;
+       if (m_isAssessmentInit) m_assessment->AppendEndpoints(endpoints);
+       if (m_isEventFragInit) m_eventFragment->AppendEndpoints(endpoints);
+       if (m_isEventRecInit) m_eventRecord->AppendEndpoints(endpoints);
+       if (m_isFragAmendReqInit) m_fragmentAmendmentRequest->AppendEndpoints(endpoints);
+       if (m_isLogInit) m_log->AppendEndpoints(endpoints);
+       if (m_isModConfigInit) m_moduleConfiguration->AppendEndpoints(endpoints);
+       if (m_isOmitEventInit) m_omittedEvent->AppendEndpoints(endpoints);
+       if (m_isOpDescriptInit) m_operationalDescription->AppendEndpoints(endpoints);
+       if (m_isPhysModInit) m_physiologyModification->AppendEndpoints(endpoints);
+       if (m_isPhysValInit) m_physiologyValue->AppendEndpoints(endpoints);
+       if (m_isPhysWaveInit) m_physiologyWaveform->AppendEndpoints(endpoints);
+       if (m_isRendModInit) m_renderModification->AppendEndpoints(endpoints);
+       if (m_isSimControlInit) m_simulationControl->AppendEndpoints(endpoints);
+       if (m_isStatusInit) m_status->AppendEndpoints(endpoints);
+       if (m_isTickInit) m_tick->AppendEndpoints(endpoints);
+       if (m_isInstDataInit) m_instrumentData->AppendEndpoints(endpoints);
+       if (m_isCommandInit) m_command->AppendEndpoints(endpoints);
+       if (m_isPhysFrameInit) m_physiologyFrame->AppendEndpoints(endpoints);
+       return endpoints;
+    }
+
+    template<class U>
+    inline std::string DDSManager<U>::MemoryReport() const {
+       return TopicMemory::Format(MemoryUsage());
+    }
+
+    template<class U>
+    inline int DDSManager<U>::Setup(const std::vector<TopicSetup> &topics) {
+       std::string errmsg;
+       return Setup(errmsg, topics);
+    }
+
+    template<class U>
+    inline int DDSManager<U>::Setup(std::string &errmsg, const std::vector<TopicSetup> &topics) {
+       if (m_participant == nullptr) {
+          errmsg = "Domain participant was not created.";
+          return 1;
+       }
+
+       int err = 0;
+
+       // Output from each topic.
+       std::string localerrmsg;
+
+       // Endpoints that already exist are not waited for by ENDPOINTS_MATCHED.
+       const std::set<const void *> existing = Endpoints();
+
+       // Topics whose type failed to register are skipped by the endpoint passes.
+       std::vector<bool> registered(topics.size(), false);
+
+       for (std::size_t i = 0; i < topics.size(); ++i) {
+          if (SetupType(topics[i].topic, localerrmsg) != 0) {
+             errmsg += localerrmsg + "\n";
+             err = 1;
+          } else {
+             registered[i] = true;
+          }
+       }
+       m_startup.Mark(StartupTimeline::TYPES_REGISTERED);
+
+       for (std::size_t i = 0; i < topics.size(); ++i) {
+          if (!registered[i] || (topics[i].roles & TopicSetup::PUBLISH) == 0) continue;
+          if (SetupPublisher(topics[i].topic, localerrmsg) != 0) {
+             errmsg += localerrmsg + "\n";
+             err = 1;
+          }
+       }
+
+       for (std::size_t i = 0; i < topics.size(); ++i) {
+          if (!registered[i] || (topics[i].roles & TopicSetup::SUBSCRIBE) == 0) continue;
+          if (SetupSubscriber(topics[i].topic, localerrmsg) != 0) {
+             errmsg += localerrmsg + "\n";
+             err = 1;
+          }
+       }
+       m_startup.Mark(StartupTimeline::ENDPOINTS_CREATED);
+
+       std::set<const void *> created;
+       const std::set<const void *> endpoints = Endpoints();
+       std::set_difference(
+          endpoints.begin(), endpoints.end(), existing.begin(), existing.end(), std::inserter(created, created.end())
+       );
+       m_startup.ExpectEndpoints(created);
+
+       return err;
+    }
+
+    template<class U>
+    inline int DDSManager<U>::SetupType(const std::string &topic, std::string &errmsg) {
+       if (topic == ASMT_STR) return InitializeAssessment(errmsg);
+       if (topic == EVFR_STR) return InitializeEventFragment(errmsg);
+       if (topic == EVRC_STR) return InitializeEventRecord(errmsg);
+       if (topic == FARQ_STR) return InitializeFragmentAmendmentRequest(errmsg);
+       if (topic == ALOG_STR) return InitializeLog(errmsg);
+       if (topic == MOCF_STR) return InitializeModuleConfiguration(errmsg);
+       if (topic == OMEV_STR) return InitializeOmittedEvent(errmsg);
+       if (topic == OPDS_STR) return InitializeOperationalDescription(errmsg);
+       if (topic == PHMO_STR) return InitializePhysiologyModification(errmsg);
+       if (topic == PHVA_STR) return InitializePhysiologyValue(errmsg);
+       if (topic == PHWV_STR) return InitializePhysiologyWaveform(errmsg);
+       if (topic == RDMO_STR) return InitializeRenderModification(errmsg);
+       if (topic == SMCN_STR) return InitializeSimulationControl(errmsg);
+       if (topic == STAT_STR) return InitializeStatus(errmsg);
+       if (topic == TICK_STR) return InitializeTick(errmsg);
+       if (topic == IDAT_STR) return InitializeInstrumentData(errmsg);
+       if (topic == CMND_STR) return InitializeCommand(errmsg);
+       if (topic == PHFR_STR) return InitializePhysiologyFrame(errmsg);
+
+       errmsg = "Unknown topic " + topic + ".";
+       return 1;
+    }
+
+    template<class U>
+    inline int DDSManager<U>::SetupPublisher(const std::string &topic, std::string &errmsg) {
+       if (topic == ASMT_STR) return CreateAssessmentPublisher(errmsg);
+       if (topic == EVFR_STR) return CreateEventFragmentPublisher(errmsg);
+       if (topic == EVRC_STR) return CreateEventRecordPublisher(errmsg);
+       if (topic == FARQ_STR) return CreateFragmentAmendmentRequestPublisher(errmsg);
+       if (topic == ALOG_STR) return CreateLogPublisher(errmsg);
+       if (topic == MOCF_STR) return CreateModuleConfigurationPublisher(errmsg);
+       if (topic == OMEV_STR) return CreateOmittedEventPublisher(errmsg);
+       if (topic == OPDS_STR) return CreateOperationalDescriptionPublisher(errmsg);
+       if (topic == PHMO_STR) return CreatePhysiologyModificationPublisher(errmsg);
+       if (topic == PHVA_STR) return CreatePhysiologyValuePublisher(errmsg);
+       if (topic == PHWV_STR) return CreatePhysiologyWaveformPublisher(errmsg);
+       if (topic == RDMO_STR) return CreateRenderModificationPublisher(errmsg);
+       if (topic == SMCN_STR) return CreateSimulationControlPublisher(errmsg);
+       if (topic == STAT_STR) return CreateStatusPublisher(errmsg);
+       if (topic == TICK_STR) return CreateTickPublisher(errmsg);
+       if (topic == IDAT_STR) return CreateInstrumentDataPublisher(errmsg);
+       if (topic == CMND_STR) return CreateCommandPublisher(errmsg);
+       if (topic == PHFR_STR) return CreatePhysiologyFramePublisher(errmsg);
+
+       errmsg = "Unknown topic " + topic + ".";
+       return 1;
+    }
+
+    template<class U>
+    inline int DDSManager<U>::SetupSubscriber(const std::string &topic, std::string &errmsg) {
+       if (topic == ASMT_STR) {
+          m_assessment->HoldUntilBound();
+          return m_assessment->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == EVFR_STR) {
+          m_eventFragment->HoldUntilBound();
+          return m_eventFragment->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == EVRC_STR) {
+          m_eventRecord->HoldUntilBound();
+          return m_eventRecord->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == FARQ_STR) {
+          m_fragmentAmendmentRequest->HoldUntilBound();
+          return m_fragmentAmendmentRequest->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == ALOG_STR) {
+          m_log->HoldUntilBound();
+          return m_log->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == MOCF_STR) {
+          m_moduleConfiguration->HoldUntilBound();
+          return m_moduleConfiguration->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == OMEV_STR) {
+          m_omittedEvent->HoldUntilBound();
+          return m_omittedEvent->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == OPDS_STR) {
+          m_operationalDescription->HoldUntilBound();
+          return m_operationalDescription->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == PHMO_STR) {
+          m_physiologyModification->HoldUntilBound();
+          return m_physiologyModification->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == PHVA_STR) {
+          m_physiologyValue->HoldUntilBound();
+          return m_physiologyValue->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == PHWV_STR) {
+          m_physiologyWaveform->HoldUntilBound();
+          return m_physiologyWaveform->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == RDMO_STR) {
+          m_renderModification->HoldUntilBound();
+          return m_renderModification->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == SMCN_STR) {
+          m_simulationControl->HoldUntilBound();
+          return m_simulationControl->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == STAT_STR) {
+          m_status->HoldUntilBound();
+          return m_status->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == TICK_STR) {
+          m_tick->HoldUntilBound();
+          return m_tick->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == IDAT_STR) {
+          m_instrumentData->HoldUntilBound();
+          return m_instrumentData->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == CMND_STR) {
+          m_command->HoldUntilBound();
+          return m_command->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+       if (topic == PHFR_STR) {
+          m_physiologyFrame->HoldUntilBound();
+          return m_physiologyFrame->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       }
+
+       errmsg = "Unknown topic " + topic + ".";
+       return 1;
+    }
+
+    template<class U>
+    inline const StartupTimeline &DDSManager<U>::Startup() const {
+       return m_startup;
+    }
+
+    template<class U>
+    inline std::string DDSManager<U>::StartupReport() const {
+       return m_startup.Format();
+    }
+
+    template<class U>
+    inline std::vector<TopicSetup> DDSManager<U>::ManifestTopics() const {
+       return StaticDiscovery::TopicsOf(m_manifest, m_moduleName);
+    }
+
+    template<class U>
+    inline void DDSManager<U>::onPublicationMatched(Publisher *pub, MatchingInfo &info) {
+       if (info.status == MATCHED_MATCHING) m_startup.EndpointMatched(pub);
+    }
+
+    template<class U>
+    inline void DDSManager<U>::onSubscriptionMatched(Subscriber *sub, MatchingInfo &info) {
+       if (info.status == MATCHED_MATCHING) m_startup.EndpointMatched(sub);
+    }
+
+    template<class U>
+    inline void DDSManager<U>::onLivelinessChanged(Subscriber *sub, const LivelinessChangedStatus &status) {
+       // Writers of other topics are unknown to the monitor, which ignores them.
+       ModuleHealthMonitor *monitor = m_statusHealthMonitor;
+       if (monitor != nullptr) monitor->OnLivelinessChanged(status);
+    }
+
+    template<class U>
+    inline void DDSManager<U>::onParticipantDiscovery(Participant *participant, ParticipantDiscoveryInfo &info) {
+       if (info.status == ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT) {
+          m_startup.Mark(StartupTimeline::PARTICIPANT_DISCOVERED);
+       }
     }
 
     template<class U>
     inline std::string DDSManager<U>::GenerateUuidString() {
-       boost::uuids::uuid uuid = boost::uuids::random_generator()();
-       return boost::uuids::to_string(uuid);
+       return UuidGenerator::GenerateString();
+    }
+
+    template<class U>
+    inline void DDSManager<U>::GenerateUuids(std::size_t n, char *buffers, std::size_t stride) {
+       UuidGenerator::GenerateStrings(n, buffers, stride);
+    }
+
+    template<class U>
+    inline BinaryUuid DDSManager<U>::ToBinaryUuid(const AMM::UUID &uuid) {
+       return BinaryUuid::FromUuid(uuid);
+    }
+
+    template<class U>
+    inline AMM::UUID DDSManager<U>::ToUuid(const BinaryUuid &uuid) {
+       return uuid.ToUuid();
     }
 
 
@@ -2099,9 +2881,13 @@ namespace AMM {
        if (m_isAssessmentInit) return 0;
 
        int err = 0;
-       m_assessment = new AmmDataType<ASMT_TYPE, ASMT_LTNR, ASMT, U>(
-          err, ASMT_STR, m_participant, m_pubListener
-       );
+       if (m_assessment == nullptr) {
+          m_assessment = new AmmDataType<ASMT_TYPE, ASMT_LTNR, ASMT, U>(
+             err, ASMT_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_assessment->Reinitialize();
+       }
 
        if (err != 0) return 1;
 
@@ -2119,9 +2905,13 @@ namespace AMM {
        }
 
        int err = 0;
-       m_assessment = new AmmDataType<ASMT_TYPE, ASMT_LTNR, ASMT, U>(
-          err, errmsg, ASMT_STR, m_participant, m_pubListener
-       );
+       if (m_assessment == nullptr) {
+          m_assessment = new AmmDataType<ASMT_TYPE, ASMT_LTNR, ASMT, U>(
+             err, errmsg, ASMT_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_assessment->Reinitialize(errmsg);
+       }
 
        if (err != 0) return 1;
 
@@ -2255,9 +3045,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_eventFragment = new AmmDataType<EVFR_TYPE, EVFR_LTNR, EVFR, U>(
-          err, EVFR_STR, m_participant, m_pubListener
-       );
+       if (m_eventFragment == nullptr) {
+          m_eventFragment = new AmmDataType<EVFR_TYPE, EVFR_LTNR, EVFR, U>(
+             err, EVFR_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_eventFragment->Reinitialize();
+       }
 
        if (err == 0) m_isEventFragInit = true;
 
@@ -2274,9 +3068,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_eventFragment = new AmmDataType<EVFR_TYPE, EVFR_LTNR, EVFR, U>(
-          err, errmsg, EVFR_STR, m_participant, m_pubListener
-       );
+       if (m_eventFragment == nullptr) {
+          m_eventFragment = new AmmDataType<EVFR_TYPE, EVFR_LTNR, EVFR, U>(
+             err, errmsg, EVFR_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_eventFragment->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isEventFragInit = true;
 
@@ -2408,9 +3206,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_eventRecord = new AmmDataType<EVRC_TYPE, EVRC_LTNR, EVRC, U>(
-          err, EVRC_STR, m_participant, m_pubListener
-       );
+       if (m_eventRecord == nullptr) {
+          m_eventRecord = new AmmDataType<EVRC_TYPE, EVRC_LTNR, EVRC, U>(
+             err, EVRC_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_eventRecord->Reinitialize();
+       }
 
        if (err == 0) m_isEventRecInit = true;
 
@@ -2427,9 +3229,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_eventRecord = new AmmDataType<EVRC_TYPE, EVRC_LTNR, EVRC, U>(
-          err, errmsg, EVRC_STR, m_participant, m_pubListener
-       );
+       if (m_eventRecord == nullptr) {
+          m_eventRecord = new AmmDataType<EVRC_TYPE, EVRC_LTNR, EVRC, U>(
+             err, errmsg, EVRC_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_eventRecord->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isEventRecInit = true;
 
@@ -2561,9 +3367,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_fragmentAmendmentRequest = new AmmDataType<FARQ_TYPE, FARQ_LTNR, FARQ, U>(
-          err, FARQ_STR, m_participant, m_pubListener
-       );
+       if (m_fragmentAmendmentRequest == nullptr) {
+          m_fragmentAmendmentRequest = new AmmDataType<FARQ_TYPE, FARQ_LTNR, FARQ, U>(
+             err, FARQ_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_fragmentAmendmentRequest->Reinitialize();
+       }
 
        if (err == 0) m_isFragAmendReqInit = true;
 
@@ -2580,9 +3390,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_fragmentAmendmentRequest = new AmmDataType<FARQ_TYPE, FARQ_LTNR, FARQ, U>(
-          err, errmsg, FARQ_STR, m_participant, m_pubListener
-       );
+       if (m_fragmentAmendmentRequest == nullptr) {
+          m_fragmentAmendmentRequest = new AmmDataType<FARQ_TYPE, FARQ_LTNR, FARQ, U>(
+             err, errmsg, FARQ_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_fragmentAmendmentRequest->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isFragAmendReqInit = true;
 
@@ -2714,9 +3528,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_log = new AmmDataType<ALOG_TYPE, ALOG_LTNR, ALOG, U>(
-          err, ALOG_STR, m_participant, m_pubListener
-       );
+       if (m_log == nullptr) {
+          m_log = new AmmDataType<ALOG_TYPE, ALOG_LTNR, ALOG, U>(
+             err, ALOG_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_log->Reinitialize();
+       }
 
        if (err == 0) m_isLogInit = true;
 
@@ -2733,9 +3551,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_log = new AmmDataType<ALOG_TYPE, ALOG_LTNR, ALOG, U>(
-          err, errmsg, ALOG_STR, m_participant, m_pubListener
-       );
+       if (m_log == nullptr) {
+          m_log = new AmmDataType<ALOG_TYPE, ALOG_LTNR, ALOG, U>(
+             err, errmsg, ALOG_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_log->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isLogInit = true;
 
@@ -2780,7 +3602,7 @@ namespace AMM {
 
     template<class U>
     inline int DDSManager<U>::CreateLogSubscriber(
-       U *parentClass, void (U::*onEvent)(AMM::Log &, eprosima::fastrtps::SampleInfo_t *)
+       U *parentClass, void (U::*onEvent)(AMM::LogSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isLogInit) return 1;
        return m_log->CreateSubscriber((ListenerInterface *) this, parentClass, onEvent);
@@ -2788,7 +3610,7 @@ namespace AMM {
 
     template<class U>
     inline int DDSManager<U>::CreateLogSubscriber(
-       std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::Log &, eprosima::fastrtps::SampleInfo_t *)
+       std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::LogSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isLogInit) {
           errmsg = "Log is not properly initialized.";
@@ -2813,13 +3635,13 @@ namespace AMM {
     }
 
     template<class U>
-    inline int DDSManager<U>::WriteLog(AMM::Log &a) {
+    inline int DDSManager<U>::WriteLog(AMM::LogSample &a) {
        if (!m_isLogInit) return 1;
        return m_log->Write(a);
     }
 
     template<class U>
-    inline int DDSManager<U>::WriteLog(std::string &errmsg, AMM::Log &a) {
+    inline int DDSManager<U>::WriteLog(std::string &errmsg, AMM::LogSample &a) {
        if (!m_isLogInit) {
           errmsg = "Log is not properly initialized.";
           return 1;
@@ -2829,7 +3651,7 @@ namespace AMM {
 
     template<class U>
     inline void DDSManager<U>::onNewLog(
-       AMM::Log log, eprosima::fastrtps::SampleInfo_t *info
+       AMM::LogSample log, eprosima::fastrtps::SampleInfo_t *info
     ) {
        m_log->OnEvent(log, info);
     }
@@ -2867,9 +3689,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_moduleConfiguration = new AmmDataType<MOCF_TYPE, MOCF_LTNR, MOCF, U>(
-          err, MOCF_STR, m_participant, m_pubListener
-       );
+       if (m_moduleConfiguration == nullptr) {
+          m_moduleConfiguration = new AmmDataType<MOCF_TYPE, MOCF_LTNR, MOCF, U>(
+             err, MOCF_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_moduleConfiguration->Reinitialize();
+       }
 
        if (err == 0) m_isModConfigInit = true;
 
@@ -2886,9 +3712,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_moduleConfiguration = new AmmDataType<MOCF_TYPE, MOCF_LTNR, MOCF, U>(
-          err, errmsg, MOCF_STR, m_participant, m_pubListener
-       );
+       if (m_moduleConfiguration == nullptr) {
+          m_moduleConfiguration = new AmmDataType<MOCF_TYPE, MOCF_LTNR, MOCF, U>(
+             err, errmsg, MOCF_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_moduleConfiguration->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isModConfigInit = true;
 
@@ -2952,39 +3782,70 @@ namespace AMM {
     }
 
     template<class U>
-    inline int DDSManager<U>::RemoveModuleConfigurationSubscriber() {
-       if (!m_isModConfigInit) return 1;
-       return m_moduleConfiguration->RemoveSubscriber();
+    inline int DDSManager<U>::CreateModuleConfigurationSubscriber(ModuleConfigurationCache *cache) {
+       if (!m_isModConfigInit || cache == nullptr) return 1;
+       m_moduleConfigurationCache = cache;
+       int err = m_moduleConfiguration->CreateSubscriber((ListenerInterface *) this, nullptr, nullptr);
+       if (err != 0) m_moduleConfigurationCache = nullptr;
+       return err;
     }
 
     template<class U>
-    inline int DDSManager<U>::RemoveModuleConfigurationSubscriber(std::string &errmsg) {
+    inline int DDSManager<U>::CreateModuleConfigurationSubscriber(std::string &errmsg, ModuleConfigurationCache *cache) {
        if (!m_isModConfigInit) {
           errmsg = "Module Configuration is not properly initialized.";
           return 1;
        }
-       return m_moduleConfiguration->RemoveSubscriber(errmsg);
+       if (cache == nullptr) {
+          errmsg = "Module Configuration cache is null.";
+          return 1;
+       }
+       m_moduleConfigurationCache = cache;
+       int err = m_moduleConfiguration->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       if (err != 0) m_moduleConfigurationCache = nullptr;
+       return err;
     }
 
     template<class U>
-    inline int DDSManager<U>::WriteModuleConfiguration(AMM::ModuleConfiguration &a) {
+    inline int DDSManager<U>::RemoveModuleConfigurationSubscriber() {
        if (!m_isModConfigInit) return 1;
-       return m_moduleConfiguration->Write(a);
+       int err = m_moduleConfiguration->RemoveSubscriber();
+       if (err == 0) m_moduleConfigurationCache = nullptr;
+       return err;
     }
 
     template<class U>
-    inline int DDSManager<U>::WriteModuleConfiguration(std::string &errmsg, AMM::ModuleConfiguration &a) {
+    inline int DDSManager<U>::RemoveModuleConfigurationSubscriber(std::string &errmsg) {
        if (!m_isModConfigInit) {
           errmsg = "Module Configuration is not properly initialized.";
           return 1;
        }
-       return m_moduleConfiguration->Write(errmsg, a);
+       int err = m_moduleConfiguration->RemoveSubscriber(errmsg);
+       if (err == 0) m_moduleConfigurationCache = nullptr;
+       return err;
+    }
+
+    template<class U>
+    inline int DDSManager<U>::WriteModuleConfiguration(AMM::ModuleConfiguration &a) {
+       if (!m_isModConfigInit) return 1;
+       return m_moduleConfiguration->Write(a);
+    }
+
+    template<class U>
+    inline int DDSManager<U>::WriteModuleConfiguration(std::string &errmsg, AMM::ModuleConfiguration &a) {
+       if (!m_isModConfigInit) {
+          errmsg = "Module Configuration is not properly initialized.";
+          return 1;
+       }
+       return m_moduleConfiguration->Write(errmsg, a);
     }
 
     template<class U>
     inline void DDSManager<U>::onNewModuleConfiguration(
        AMM::ModuleConfiguration modConfig, eprosima::fastrtps::SampleInfo_t *info
     ) {
+       ModuleConfigurationCache *cache = m_moduleConfigurationCache;
+       if (cache != nullptr) cache->OnModuleConfiguration(modConfig);
        m_moduleConfiguration->OnEvent(modConfig, info);
     }
 
@@ -2993,7 +3854,10 @@ namespace AMM {
        if (!m_isModConfigInit) return 0;
 
        int err = m_moduleConfiguration->Delete();
-       if (err == 0) m_isModConfigInit = false;
+       if (err == 0) {
+          m_isModConfigInit = false;
+          m_moduleConfigurationCache = nullptr;
+       }
 
        return err;
     }
@@ -3006,7 +3870,10 @@ namespace AMM {
        }
 
        int err = m_moduleConfiguration->Delete(errmsg);
-       if (err == 0) m_isModConfigInit = false;
+       if (err == 0) {
+          m_isModConfigInit = false;
+          m_moduleConfigurationCache = nullptr;
+       }
 
        return err;
     }
@@ -3021,9 +3888,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_omittedEvent = new AmmDataType<OMEV_TYPE, OMEV_LTNR, OMEV, U>(
-          err, OMEV_STR, m_participant, m_pubListener
-       );
+       if (m_omittedEvent == nullptr) {
+          m_omittedEvent = new AmmDataType<OMEV_TYPE, OMEV_LTNR, OMEV, U>(
+             err, OMEV_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_omittedEvent->Reinitialize();
+       }
 
        if (err == 0) m_isOmitEventInit = true;
 
@@ -3040,9 +3911,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_omittedEvent = new AmmDataType<OMEV_TYPE, OMEV_LTNR, OMEV, U>(
-          err, errmsg, OMEV_STR, m_participant, m_pubListener
-       );
+       if (m_omittedEvent == nullptr) {
+          m_omittedEvent = new AmmDataType<OMEV_TYPE, OMEV_LTNR, OMEV, U>(
+             err, errmsg, OMEV_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_omittedEvent->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isOmitEventInit = true;
 
@@ -3174,9 +4049,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_operationalDescription = new AmmDataType<OPDS_TYPE, OPDS_LTNR, OPDS, U>(
-          err, OPDS_STR, m_participant, m_pubListener
-       );
+       if (m_operationalDescription == nullptr) {
+          m_operationalDescription = new AmmDataType<OPDS_TYPE, OPDS_LTNR, OPDS, U>(
+             err, OPDS_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_operationalDescription->Reinitialize();
+       }
 
        if (err == 0) m_isOpDescriptInit = true;
 
@@ -3193,9 +4072,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_operationalDescription = new AmmDataType<OPDS_TYPE, OPDS_LTNR, OPDS, U>(
-          err, errmsg, OPDS_STR, m_participant, m_pubListener
-       );
+       if (m_operationalDescription == nullptr) {
+          m_operationalDescription = new AmmDataType<OPDS_TYPE, OPDS_LTNR, OPDS, U>(
+             err, errmsg, OPDS_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_operationalDescription->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isOpDescriptInit = true;
 
@@ -3258,10 +4141,37 @@ namespace AMM {
        return m_operationalDescription->CreateSubscriber(errmsg, (ListenerInterface *) this, parentClass, onEvent);
     }
 
+    template<class U>
+    inline int DDSManager<U>::CreateOperationalDescriptionSubscriber(ModuleHealthMonitor *monitor) {
+       if (!m_isOpDescriptInit || monitor == nullptr) return 1;
+       m_opDescriptHealthMonitor = monitor;
+       int err = m_operationalDescription->CreateSubscriber((ListenerInterface *) this, nullptr, nullptr);
+       if (err != 0) m_opDescriptHealthMonitor = nullptr;
+       return err;
+    }
+
+    template<class U>
+    inline int DDSManager<U>::CreateOperationalDescriptionSubscriber(std::string &errmsg, ModuleHealthMonitor *monitor) {
+       if (!m_isOpDescriptInit) {
+          errmsg = "Operational Description is not properly initialized.";
+          return 1;
+       }
+       if (monitor == nullptr) {
+          errmsg = "Operational Description health monitor is null.";
+          return 1;
+       }
+       m_opDescriptHealthMonitor = monitor;
+       int err = m_operationalDescription->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       if (err != 0) m_opDescriptHealthMonitor = nullptr;
+       return err;
+    }
+
     template<class U>
     inline int DDSManager<U>::RemoveOperationalDescriptionSubscriber() {
        if (!m_isOpDescriptInit) return 1;
-       return m_operationalDescription->RemoveSubscriber();
+       int err = m_operationalDescription->RemoveSubscriber();
+       if (err == 0) m_opDescriptHealthMonitor = nullptr;
+       return err;
     }
 
     template<class U>
@@ -3270,7 +4180,9 @@ namespace AMM {
           errmsg = "Operational Description is not properly initialized.";
           return 1;
        }
-       return m_operationalDescription->RemoveSubscriber(errmsg);
+       int err = m_operationalDescription->RemoveSubscriber(errmsg);
+       if (err == 0) m_opDescriptHealthMonitor = nullptr;
+       return err;
     }
 
     template<class U>
@@ -3292,6 +4204,8 @@ namespace AMM {
     inline void DDSManager<U>::onNewOperationalDescription(
        AMM::OperationalDescription opDescript, eprosima::fastrtps::SampleInfo_t *info
     ) {
+       ModuleHealthMonitor *monitor = m_opDescriptHealthMonitor;
+       if (monitor != nullptr) monitor->OnOperationalDescription(opDescript);
        m_operationalDescription->OnEvent(opDescript, info);
     }
 
@@ -3300,7 +4214,10 @@ namespace AMM {
        if (!m_isOpDescriptInit) return 0;
 
        int err = m_operationalDescription->Delete();
-       if (err == 0) m_isOpDescriptInit = false;
+       if (err == 0) {
+          m_isOpDescriptInit = false;
+          m_opDescriptHealthMonitor = nullptr;
+       }
 
        return err;
     }
@@ -3313,7 +4230,10 @@ namespace AMM {
        }
 
        int err = m_operationalDescription->Delete(errmsg);
-       if (err == 0) m_isOpDescriptInit = false;
+       if (err == 0) {
+          m_isOpDescriptInit = false;
+          m_opDescriptHealthMonitor = nullptr;
+       }
 
        return err;
     }
@@ -3328,9 +4248,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_physiologyModification = new AmmDataType<PHMO_TYPE, PHMO_LTNR, PHMO, U>(
-          err, PHMO_STR, m_participant, m_pubListener
-       );
+       if (m_physiologyModification == nullptr) {
+          m_physiologyModification = new AmmDataType<PHMO_TYPE, PHMO_LTNR, PHMO, U>(
+             err, PHMO_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyModification->Reinitialize();
+       }
 
        if (err == 0) m_isPhysModInit = true;
 
@@ -3347,9 +4271,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_physiologyModification = new AmmDataType<PHMO_TYPE, PHMO_LTNR, PHMO, U>(
-          err, errmsg, PHMO_STR, m_participant, m_pubListener
-       );
+       if (m_physiologyModification == nullptr) {
+          m_physiologyModification = new AmmDataType<PHMO_TYPE, PHMO_LTNR, PHMO, U>(
+             err, errmsg, PHMO_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyModification->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isPhysModInit = true;
 
@@ -3481,9 +4409,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_physiologyValue = new AmmDataType<PHVA_TYPE, PHVA_LTNR, PHVA, U>(
-          err, PHVA_STR, m_participant, m_pubListener
-       );
+       if (m_physiologyValue == nullptr) {
+          m_physiologyValue = new AmmDataType<PHVA_TYPE, PHVA_LTNR, PHVA, U>(
+             err, PHVA_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyValue->Reinitialize();
+       }
 
        if (err == 0) m_isPhysValInit = true;
 
@@ -3500,9 +4432,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_physiologyValue = new AmmDataType<PHVA_TYPE, PHVA_LTNR, PHVA, U>(
-          err, errmsg, PHVA_STR, m_participant, m_pubListener
-       );
+       if (m_physiologyValue == nullptr) {
+          m_physiologyValue = new AmmDataType<PHVA_TYPE, PHVA_LTNR, PHVA, U>(
+             err, errmsg, PHVA_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyValue->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isPhysValInit = true;
 
@@ -3547,7 +4483,7 @@ namespace AMM {
 
     template<class U>
     inline int DDSManager<U>::CreatePhysiologyValueSubscriber(
-       U *parentClass, void (U::*onEvent)(AMM::PhysiologyValue &, eprosima::fastrtps::SampleInfo_t *)
+       U *parentClass, void (U::*onEvent)(AMM::PhysiologyValueSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isPhysValInit) return 1;
        return m_physiologyValue->CreateSubscriber((ListenerInterface *) this, parentClass, onEvent);
@@ -3556,7 +4492,7 @@ namespace AMM {
     template<class U>
     inline int DDSManager<U>::CreatePhysiologyValueSubscriber(
        std::string &errmsg, U *parentClass,
-       void (U::*onEvent)(AMM::PhysiologyValue &, eprosima::fastrtps::SampleInfo_t *)
+       void (U::*onEvent)(AMM::PhysiologyValueSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isPhysValInit) {
           errmsg = "Physiology Value is not properly initialized.";
@@ -3581,13 +4517,21 @@ namespace AMM {
     }
 
     template<class U>
-    inline int DDSManager<U>::WritePhysiologyValue(AMM::PhysiologyValue &a) {
+    inline int DDSManager<U>::WritePhysiologyValue(AMM::PhysiologyValueSample &a) {
+       if (m_isPhysFrameOpen) {
+          AppendPhysiologyFrameValue(a);
+          if (m_divertPhysValues || !m_isPhysValInit) return 0;
+       }
        if (!m_isPhysValInit) return 1;
        return m_physiologyValue->Write(a);
     }
 
     template<class U>
-    inline int DDSManager<U>::WritePhysiologyValue(std::string &errmsg, AMM::PhysiologyValue &a) {
+    inline int DDSManager<U>::WritePhysiologyValue(std::string &errmsg, AMM::PhysiologyValueSample &a) {
+       if (m_isPhysFrameOpen) {
+          AppendPhysiologyFrameValue(a);
+          if (m_divertPhysValues || !m_isPhysValInit) return 0;
+       }
        if (!m_isPhysValInit) {
           errmsg = "Physiology Value is not properly initialized.";
           return 1;
@@ -3597,7 +4541,7 @@ namespace AMM {
 
     template<class U>
     inline void DDSManager<U>::onNewPhysiologyValue(
-       AMM::PhysiologyValue physValue, eprosima::fastrtps::SampleInfo_t *info
+       AMM::PhysiologyValueSample physValue, eprosima::fastrtps::SampleInfo_t *info
     ) {
        m_physiologyValue->OnEvent(physValue, info);
     }
@@ -3635,9 +4579,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_physiologyWaveform = new AmmDataType<PHWV_TYPE, PHWV_LTNR, PHWV, U>(
-          err, PHWV_STR, m_participant, m_pubListener
-       );
+       if (m_physiologyWaveform == nullptr) {
+          m_physiologyWaveform = new AmmDataType<PHWV_TYPE, PHWV_LTNR, PHWV, U>(
+             err, PHWV_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyWaveform->Reinitialize();
+       }
 
        if (err == 0) m_isPhysWaveInit = true;
 
@@ -3654,9 +4602,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_physiologyWaveform = new AmmDataType<PHWV_TYPE, PHWV_LTNR, PHWV, U>(
-          err, errmsg, PHWV_STR, m_participant, m_pubListener
-       );
+       if (m_physiologyWaveform == nullptr) {
+          m_physiologyWaveform = new AmmDataType<PHWV_TYPE, PHWV_LTNR, PHWV, U>(
+             err, errmsg, PHWV_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyWaveform->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isPhysWaveInit = true;
 
@@ -3701,7 +4653,7 @@ namespace AMM {
 
     template<class U>
     inline int DDSManager<U>::CreatePhysiologyWaveformSubscriber(
-       U *parentClass, void (U::*onEvent)(AMM::PhysiologyWaveform &, eprosima::fastrtps::SampleInfo_t *)
+       U *parentClass, void (U::*onEvent)(AMM::PhysiologyWaveformSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isPhysWaveInit) return 1;
        return m_physiologyWaveform->CreateSubscriber((ListenerInterface *) this, parentClass, onEvent);
@@ -3710,7 +4662,7 @@ namespace AMM {
     template<class U>
     inline int DDSManager<U>::CreatePhysiologyWaveformSubscriber(
        std::string &errmsg, U *parentClass,
-       void (U::*onEvent)(AMM::PhysiologyWaveform &, eprosima::fastrtps::SampleInfo_t *)
+       void (U::*onEvent)(AMM::PhysiologyWaveformSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isPhysWaveInit) {
           errmsg = "Physiology Waveform is not properly initialized.";
@@ -3735,13 +4687,13 @@ namespace AMM {
     }
 
     template<class U>
-    inline int DDSManager<U>::WritePhysiologyWaveform(AMM::PhysiologyWaveform &a) {
+    inline int DDSManager<U>::WritePhysiologyWaveform(AMM::PhysiologyWaveformSample &a) {
        if (!m_isPhysWaveInit) return 1;
        return m_physiologyWaveform->Write(a);
     }
 
     template<class U>
-    inline int DDSManager<U>::WritePhysiologyWaveform(std::string &errmsg, AMM::PhysiologyWaveform &a) {
+    inline int DDSManager<U>::WritePhysiologyWaveform(std::string &errmsg, AMM::PhysiologyWaveformSample &a) {
        if (!m_isPhysWaveInit) {
           errmsg = "Physiology Waveform is not properly initialized.";
           return 1;
@@ -3751,7 +4703,7 @@ namespace AMM {
 
     template<class U>
     inline void DDSManager<U>::onNewPhysiologyWaveform(
-       AMM::PhysiologyWaveform physWave, eprosima::fastrtps::SampleInfo_t *info
+       AMM::PhysiologyWaveformSample physWave, eprosima::fastrtps::SampleInfo_t *info
     ) {
        m_physiologyWaveform->OnEvent(physWave, info);
     }
@@ -3789,9 +4741,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_renderModification = new AmmDataType<RDMO_TYPE, RDMO_LTNR, RDMO, U>(
-          err, RDMO_STR, m_participant, m_pubListener
-       );
+       if (m_renderModification == nullptr) {
+          m_renderModification = new AmmDataType<RDMO_TYPE, RDMO_LTNR, RDMO, U>(
+             err, RDMO_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_renderModification->Reinitialize();
+       }
 
        if (err == 0) m_isRendModInit = true;
 
@@ -3808,9 +4764,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_renderModification = new AmmDataType<RDMO_TYPE, RDMO_LTNR, RDMO, U>(
-          err, errmsg, RDMO_STR, m_participant, m_pubListener
-       );
+       if (m_renderModification == nullptr) {
+          m_renderModification = new AmmDataType<RDMO_TYPE, RDMO_LTNR, RDMO, U>(
+             err, errmsg, RDMO_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_renderModification->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isRendModInit = true;
 
@@ -3943,9 +4903,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_simulationControl = new AmmDataType<SMCN_TYPE, SMCN_LTNR, SMCN, U>(
-          err, SMCN_STR, m_participant, m_pubListener
-       );
+       if (m_simulationControl == nullptr) {
+          m_simulationControl = new AmmDataType<SMCN_TYPE, SMCN_LTNR, SMCN, U>(
+             err, SMCN_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_simulationControl->Reinitialize();
+       }
 
        if (err == 0) m_isSimControlInit = true;
 
@@ -3962,9 +4926,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_simulationControl = new AmmDataType<SMCN_TYPE, SMCN_LTNR, SMCN, U>(
-          err, errmsg, SMCN_STR, m_participant, m_pubListener
-       );
+       if (m_simulationControl == nullptr) {
+          m_simulationControl = new AmmDataType<SMCN_TYPE, SMCN_LTNR, SMCN, U>(
+             err, errmsg, SMCN_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_simulationControl->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isSimControlInit = true;
 
@@ -4091,9 +5059,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_status = new AmmDataType<STAT_TYPE, STAT_LTNR, STAT, U>(
-          err, STAT_STR, m_participant, m_pubListener
-       );
+       if (m_status == nullptr) {
+          m_status = new AmmDataType<STAT_TYPE, STAT_LTNR, STAT, U>(
+             err, STAT_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_status->Reinitialize();
+       }
 
        if (err == 0) m_isStatusInit = true;
 
@@ -4110,9 +5082,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_status = new AmmDataType<STAT_TYPE, STAT_LTNR, STAT, U>(
-          err, errmsg, STAT_STR, m_participant, m_pubListener
-       );
+       if (m_status == nullptr) {
+          m_status = new AmmDataType<STAT_TYPE, STAT_LTNR, STAT, U>(
+             err, errmsg, STAT_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_status->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isStatusInit = true;
 
@@ -4157,7 +5133,7 @@ namespace AMM {
 
     template<class U>
     inline int DDSManager<U>::CreateStatusSubscriber(
-       U *parentClass, void (U::*onEvent)(AMM::Status &, eprosima::fastrtps::SampleInfo_t *)
+       U *parentClass, void (U::*onEvent)(AMM::StatusSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isStatusInit) return 1;
        return m_status->CreateSubscriber((ListenerInterface *) this, parentClass, onEvent);
@@ -4165,7 +5141,7 @@ namespace AMM {
 
     template<class U>
     inline int DDSManager<U>::CreateStatusSubscriber(
-       std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::Status &, eprosima::fastrtps::SampleInfo_t *)
+       std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::StatusSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isStatusInit) {
           errmsg = "Status is not properly initialized.";
@@ -4174,10 +5150,43 @@ namespace AMM {
        return m_status->CreateSubscriber(errmsg, (ListenerInterface *) this, onEvent);
     }
 
+    template<class U>
+    inline int DDSManager<U>::CreateStatusSubscriber(ModuleHealthMonitor *monitor) {
+       if (!m_isStatusInit || monitor == nullptr) return 1;
+       // A Subscriber created without the lease, e.g. by Setup, never reports lost writers.
+       if (!m_status->SubscriberRequestsLiveliness() && m_status->RemoveSubscriber() != 0) return 1;
+       m_status->RequestLivelinessLease(eprosima::fastrtps::Duration_t(1, 0));
+       m_statusHealthMonitor = monitor;
+       int err = m_status->CreateSubscriber((ListenerInterface *) this, nullptr, nullptr);
+       if (err != 0) m_statusHealthMonitor = nullptr;
+       return err;
+    }
+
+    template<class U>
+    inline int DDSManager<U>::CreateStatusSubscriber(std::string &errmsg, ModuleHealthMonitor *monitor) {
+       if (!m_isStatusInit) {
+          errmsg = "Status is not properly initialized.";
+          return 1;
+       }
+       if (monitor == nullptr) {
+          errmsg = "Status health monitor is null.";
+          return 1;
+       }
+       // A Subscriber created without the lease, e.g. by Setup, never reports lost writers.
+       if (!m_status->SubscriberRequestsLiveliness() && m_status->RemoveSubscriber(errmsg) != 0) return 1;
+       m_status->RequestLivelinessLease(eprosima::fastrtps::Duration_t(1, 0));
+       m_statusHealthMonitor = monitor;
+       int err = m_status->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       if (err != 0) m_statusHealthMonitor = nullptr;
+       return err;
+    }
+
     template<class U>
     inline int DDSManager<U>::RemoveStatusSubscriber() {
        if (!m_isStatusInit) return 1;
-       return m_status->RemoveSubscriber();
+       int err = m_status->RemoveSubscriber();
+       if (err == 0) m_statusHealthMonitor = nullptr;
+       return err;
     }
 
     template<class U>
@@ -4186,17 +5195,19 @@ namespace AMM {
           errmsg = "Status is not properly initialized.";
           return 1;
        }
-       return m_status->RemoveSubscriber(errmsg);
+       int err = m_status->RemoveSubscriber(errmsg);
+       if (err == 0) m_statusHealthMonitor = nullptr;
+       return err;
     }
 
     template<class U>
-    inline int DDSManager<U>::WriteStatus(AMM::Status &a) {
+    inline int DDSManager<U>::WriteStatus(AMM::StatusSample &a) {
        if (!m_isStatusInit) return 1;
        return m_status->Write(a);
     }
 
     template<class U>
-    inline int DDSManager<U>::WriteStatus(std::string &errmsg, AMM::Status &a) {
+    inline int DDSManager<U>::WriteStatus(std::string &errmsg, AMM::StatusSample &a) {
        if (!m_isStatusInit) {
           errmsg = "Status is not properly initialized.";
           return 1;
@@ -4206,8 +5217,10 @@ namespace AMM {
 
     template<class U>
     inline void DDSManager<U>::onNewStatus(
-       AMM::Status status, eprosima::fastrtps::SampleInfo_t *info
+       AMM::StatusSample status, eprosima::fastrtps::SampleInfo_t *info
     ) {
+       ModuleHealthMonitor *monitor = m_statusHealthMonitor;
+       if (monitor != nullptr) monitor->OnStatus(status, info);
        m_status->OnEvent(status, info);
     }
 
@@ -4216,7 +5229,10 @@ namespace AMM {
        if (!m_isStatusInit) return 0;
 
        int err = m_status->Delete();
-       if (err == 0) m_isStatusInit = false;
+       if (err == 0) {
+          m_isStatusInit = false;
+          m_statusHealthMonitor = nullptr;
+       }
 
        return err;
     }
@@ -4229,7 +5245,10 @@ namespace AMM {
        }
 
        int err = m_status->Delete(errmsg);
-       if (err == 0) m_isStatusInit = false;
+       if (err == 0) {
+          m_isStatusInit = false;
+          m_statusHealthMonitor = nullptr;
+       }
 
        return err;
     }
@@ -4244,9 +5263,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_tick = new AmmDataType<TICK_TYPE, TICK_LTNR, TICK, U>(
-          err, TICK_STR, m_participant, m_pubListener
-       );
+       if (m_tick == nullptr) {
+          m_tick = new AmmDataType<TICK_TYPE, TICK_LTNR, TICK, U>(
+             err, TICK_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_tick->Reinitialize();
+       }
 
        if (err == 0) m_isTickInit = true;
        return err;
@@ -4262,9 +5285,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_tick = new AmmDataType<TICK_TYPE, TICK_LTNR, TICK, U>(
-          err, errmsg, TICK_STR, m_participant, m_pubListener
-       );
+       if (m_tick == nullptr) {
+          m_tick = new AmmDataType<TICK_TYPE, TICK_LTNR, TICK, U>(
+             err, errmsg, TICK_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_tick->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isTickInit = true;
        return err;
@@ -4325,10 +5352,37 @@ namespace AMM {
        return m_tick->CreateSubscriber(errmsg, (ListenerInterface *) this, onEvent);
     }
 
+    template<class U>
+    inline int DDSManager<U>::CreateTickSubscriber(TickScheduler *scheduler) {
+       if (!m_isTickInit || scheduler == nullptr) return 1;
+       m_tickScheduler = scheduler;
+       int err = m_tick->CreateSubscriber((ListenerInterface *) this, nullptr, nullptr);
+       if (err != 0) m_tickScheduler = nullptr;
+       return err;
+    }
+
+    template<class U>
+    inline int DDSManager<U>::CreateTickSubscriber(std::string &errmsg, TickScheduler *scheduler) {
+       if (!m_isTickInit) {
+          errmsg = "Tick is not properly initialized.";
+          return 1;
+       }
+       if (scheduler == nullptr) {
+          errmsg = "Tick scheduler is null.";
+          return 1;
+       }
+       m_tickScheduler = scheduler;
+       int err = m_tick->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr, nullptr);
+       if (err != 0) m_tickScheduler = nullptr;
+       return err;
+    }
+
     template<class U>
     inline int DDSManager<U>::RemoveTickSubscriber() {
        if (!m_isTickInit) return 1;
-       return m_tick->RemoveSubscriber();
+       int err = m_tick->RemoveSubscriber();
+       if (err == 0) m_tickScheduler = nullptr;
+       return err;
     }
 
     template<class U>
@@ -4337,7 +5391,9 @@ namespace AMM {
           errmsg = "Tick is not properly initialized.";
           return 1;
        }
-       return m_tick->RemoveSubscriber(errmsg);
+       int err = m_tick->RemoveSubscriber(errmsg);
+       if (err == 0) m_tickScheduler = nullptr;
+       return err;
     }
 
     template<class U>
@@ -4359,6 +5415,8 @@ namespace AMM {
     inline void DDSManager<U>::onNewTick(
        AMM::Tick tick, eprosima::fastrtps::SampleInfo_t *info
     ) {
+       TickScheduler *scheduler = m_tickScheduler;
+       if (scheduler != nullptr) scheduler->OnTick(tick);
        m_tick->OnEvent(tick, info);
     }
 
@@ -4367,7 +5425,10 @@ namespace AMM {
        if (!m_isTickInit) return 0;
 
        int err = m_tick->Delete();
-       if (err == 0) m_isTickInit = false;
+       if (err == 0) {
+          m_isTickInit = false;
+          m_tickScheduler = nullptr;
+       }
 
        return err;
     }
@@ -4380,7 +5441,10 @@ namespace AMM {
        }
 
        int err = m_tick->Delete(errmsg);
-       if (err == 0) m_isTickInit = false;
+       if (err == 0) {
+          m_isTickInit = false;
+          m_tickScheduler = nullptr;
+       }
 
        return err;
     }
@@ -4395,9 +5459,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_instrumentData = new AmmDataType<IDAT_TYPE, IDAT_LTNR, IDAT, U>(
-          err, IDAT_STR, m_participant, m_pubListener
-       );
+       if (m_instrumentData == nullptr) {
+          m_instrumentData = new AmmDataType<IDAT_TYPE, IDAT_LTNR, IDAT, U>(
+             err, IDAT_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_instrumentData->Reinitialize();
+       }
 
        if (err == 0) m_isInstDataInit = true;
        return err;
@@ -4413,9 +5481,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_instrumentData = new AmmDataType<IDAT_TYPE, IDAT_LTNR, IDAT, U>(
-          err, errmsg, IDAT_STR, m_participant, m_pubListener
-       );
+       if (m_instrumentData == nullptr) {
+          m_instrumentData = new AmmDataType<IDAT_TYPE, IDAT_LTNR, IDAT, U>(
+             err, errmsg, IDAT_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_instrumentData->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isInstDataInit = true;
        return err;
@@ -4546,9 +5618,13 @@ namespace AMM {
        if (m_isCommandInit) return 0;
 
        int err = 0;
-       m_command = new AmmDataType<CMND_TYPE, CMND_LTNR, CMND, U>(
-          err, CMND_STR, m_participant, m_pubListener
-       );
+       if (m_command == nullptr) {
+          m_command = new AmmDataType<CMND_TYPE, CMND_LTNR, CMND, U>(
+             err, CMND_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_command->Reinitialize();
+       }
 
        if (err == 0) m_isCommandInit = true;
        return err;
@@ -4563,9 +5639,13 @@ namespace AMM {
        }
 
        int err = 0;
-       m_command = new AmmDataType<CMND_TYPE, CMND_LTNR, CMND, U>(
-          err, errmsg, CMND_STR, m_participant, m_pubListener
-       );
+       if (m_command == nullptr) {
+          m_command = new AmmDataType<CMND_TYPE, CMND_LTNR, CMND, U>(
+             err, errmsg, CMND_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_command->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isCommandInit = true;
        return err;
@@ -4609,7 +5689,7 @@ namespace AMM {
 
     template<class U>
     inline int DDSManager<U>::CreateCommandSubscriber(
-       U *parentClass, void (U::*onEvent)(AMM::Command &, eprosima::fastrtps::SampleInfo_t *)
+       U *parentClass, void (U::*onEvent)(AMM::CommandSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isCommandInit) return 1;
        return m_command->CreateSubscriber((ListenerInterface *) this, parentClass, onEvent);
@@ -4617,7 +5697,7 @@ namespace AMM {
 
     template<class U>
     inline int DDSManager<U>::CreateCommandSubscriber(
-       std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::Command &, eprosima::fastrtps::SampleInfo_t *)
+       std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::CommandSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isCommandInit) {
           errmsg = "Command is not properly initialized.";
@@ -4642,13 +5722,13 @@ namespace AMM {
     }
 
     template<class U>
-    inline int DDSManager<U>::WriteCommand(AMM::Command &a) {
+    inline int DDSManager<U>::WriteCommand(AMM::CommandSample &a) {
        if (!m_isCommandInit) return 1;
        return m_command->Write(a);
     }
 
     template<class U>
-    inline int DDSManager<U>::WriteCommand(std::string &errmsg, AMM::Command &a) {
+    inline int DDSManager<U>::WriteCommand(std::string &errmsg, AMM::CommandSample &a) {
        if (!m_isCommandInit) {
           errmsg = "Command is not properly initialized.";
           return 1;
@@ -4658,7 +5738,7 @@ namespace AMM {
 
     template<class U>
     inline void DDSManager<U>::onNewCommand(
-       AMM::Command command, eprosima::fastrtps::SampleInfo_t *info
+       AMM::CommandSample command, eprosima::fastrtps::SampleInfo_t *info
     ) {
        m_command->OnEvent(command, info);
     }
@@ -4687,6 +5767,259 @@ namespace AMM {
     }
 
 
+// - - - Physiology Frame - - -
+
+    template<class U>
+    inline int DDSManager<U>::InitializePhysiologyFrame() {
+
+       if (m_isPhysFrameInit) return 0;
+
+       int err = 0;
+       if (m_physiologyFrame == nullptr) {
+          m_physiologyFrame = new AmmDataType<PHFR_TYPE, PHFR_LTNR, PHFR, U>(
+             err, PHFR_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyFrame->Reinitialize();
+       }
+
+       if (err == 0) m_isPhysFrameInit = true;
+       return err;
+    }
+
+    template<class U>
+    inline int DDSManager<U>::InitializePhysiologyFrame(std::string &errmsg) {
+
+       if (m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is already initialized.";
+          return 0;
+       }
+
+       int err = 0;
+       if (m_physiologyFrame == nullptr) {
+          m_physiologyFrame = new AmmDataType<PHFR_TYPE, PHFR_LTNR, PHFR, U>(
+             err, errmsg, PHFR_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyFrame->Reinitialize(errmsg);
+       }
+
+       if (err == 0) m_isPhysFrameInit = true;
+       return err;
+    }
+
+    template<class U>
+    inline bool DDSManager<U>::IsPhysiologyFrameInitialized() {
+       if (m_isPhysFrameInit) return m_physiologyFrame->IsTypeRegistered();
+       return false;
+    }
+
+    template<class U>
+    inline int DDSManager<U>::CreatePhysiologyFramePublisher() {
+       if (!m_isPhysFrameInit) return 1;
+       return m_physiologyFrame->CreatePublisher();
+    }
+
+    template<class U>
+    inline int DDSManager<U>::CreatePhysiologyFramePublisher(std::string &errmsg) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is not properly initialized.";
+          return 1;
+       }
+       return m_physiologyFrame->CreatePublisher(errmsg);
+    }
+
+    template<class U>
+    inline int DDSManager<U>::RemovePhysiologyFramePublisher(std::string &errmsg) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is not properly initialized.";
+          return 1;
+       }
+       return m_physiologyFrame->RemovePublisher(errmsg);
+    }
+
+    template<class U>
+    inline int DDSManager<U>::RemovePhysiologyFramePublisher() {
+       if (!m_isPhysFrameInit) return 1;
+       return m_physiologyFrame->RemovePublisher();
+    }
+
+    template<class U>
+    inline int DDSManager<U>::CreatePhysiologyFrameSubscriber(
+       U *parentClass, void (U::*onEvent)(AMM::PhysiologyFrame &, eprosima::fastrtps::SampleInfo_t *)
+    ) {
+       if (!m_isPhysFrameInit) return 1;
+       return m_physiologyFrame->CreateSubscriber((ListenerInterface *) this, parentClass, onEvent);
+    }
+
+    template<class U>
+    inline int DDSManager<U>::CreatePhysiologyFrameSubscriber(
+       std::string &errmsg, U *parentClass, void (U::*onEvent)(AMM::PhysiologyFrame &, eprosima::fastrtps::SampleInfo_t *)
+    ) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is not properly initialized.";
+          return 1;
+       }
+       return m_physiologyFrame->CreateSubscriber(errmsg, (ListenerInterface *) this, parentClass, onEvent);
+    }
+
+    template<class U>
+    inline int DDSManager<U>::RemovePhysiologyFrameSubscriber() {
+       if (!m_isPhysFrameInit) return 1;
+       return m_physiologyFrame->RemoveSubscriber();
+    }
+
+    template<class U>
+    inline int DDSManager<U>::RemovePhysiologyFrameSubscriber(std::string &errmsg) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is not properly initialized.";
+          return 1;
+       }
+       return m_physiologyFrame->RemoveSubscriber(errmsg);
+    }
+
+    template<class U>
+    inline int DDSManager<U>::WritePhysiologyFrame(AMM::PhysiologyFrame &a) {
+       if (!m_isPhysFrameInit) return 1;
+       return m_physiologyFrame->Write(a);
+    }
+
+    template<class U>
+    inline int DDSManager<U>::WritePhysiologyFrame(std::string &errmsg, AMM::PhysiologyFrame &a) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is not properly initialized.";
+          return 1;
+       }
+       return m_physiologyFrame->Write(errmsg, a);
+    }
+
+    template<class U>
+    inline void DDSManager<U>::onNewPhysiologyFrame(
+       AMM::PhysiologyFrame physFrame, eprosima::fastrtps::SampleInfo_t *info
+    ) {
+       m_physiologyFrame->OnEvent(physFrame, info);
+    }
+
+    template<class U>
+    inline int DDSManager<U>::DecommissionPhysiologyFrame() {
+       if (!m_isPhysFrameInit) return 0;
+
+       // Values written after this go to Physiology Value alone, not into a frame nobody publishes.
+       m_isPhysFrameOpen = false;
+       int err = m_physiologyFrame->Delete();
+       if (err == 0) m_isPhysFrameInit = false;
+
+       return err;
+    }
+
+    template<class U>
+    inline int DDSManager<U>::DecommissionPhysiologyFrame(std::string &errmsg) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is already decommissioned.";
+          return 0;
+       }
+
+       m_isPhysFrameOpen = false;
+       int err = m_physiologyFrame->Delete(errmsg);
+       if (err == 0) m_isPhysFrameInit = false;
+
+       return err;
+    }
+
+    template<class U>
+    inline void DDSManager<U>::AppendPhysiologyFrameValue(const AMM::PhysiologyValueSample &a) {
+       std::vector<AMM::PhysiologyFrameEntry> &values = m_physFrame.values();
+       if (m_physFrameSize == values.size()) {
+          if (m_physFrameSpare.empty()) {
+             values.emplace_back();
+          } else {
+             values.push_back(std::move(m_physFrameSpare.back()));
+             m_physFrameSpare.pop_back();
+          }
+       }
+
+       AMM::PhysiologyFrameEntry &entry = values[m_physFrameSize++];
+       entry.name().assign(a.name().c_str(), a.name().size());
+       entry.value(a.value());
+
+       if (m_physFrameSize == 1) {
+          m_physFrame.educational_encounter().id().assign(
+             a.educational_encounter().id().c_str(), a.educational_encounter().id().size()
+          );
+       }
+    }
+
+    template<class U>
+    inline void DDSManager<U>::FinishPhysiologyFrame() {
+       // Entries left over from a larger previous frame are set aside rather than destroyed, so a
+       // frame that grows back reuses their string buffers.
+       std::vector<AMM::PhysiologyFrameEntry> &values = m_physFrame.values();
+       while (values.size() > m_physFrameSize) {
+          m_physFrameSpare.push_back(std::move(values.back()));
+          values.pop_back();
+       }
+       m_physFrame.timestamp(static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch()
+          ).count()
+       ));
+    }
+
+    template<class U>
+    inline int DDSManager<U>::BeginPhysiologyFrame(int64_t simulation_time) {
+       if (!m_isPhysFrameInit || !m_physiologyFrame->HasPublisher() || m_isPhysFrameOpen) return 1;
+
+       m_physFrame.simulation_time(simulation_time);
+       m_physFrame.educational_encounter().id().clear();
+       m_physFrameSize = 0;
+       m_isPhysFrameOpen = true;
+       return 0;
+    }
+
+    template<class U>
+    inline int DDSManager<U>::BeginPhysiologyFrame(std::string &errmsg, int64_t simulation_time) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is not properly initialized.";
+          return 1;
+       }
+       if (!m_physiologyFrame->HasPublisher()) {
+          errmsg = "Physiology Frame has no publisher.";
+          return 1;
+       }
+       if (m_isPhysFrameOpen) {
+          errmsg = "Physiology Frame is already open.";
+          return 1;
+       }
+       return BeginPhysiologyFrame(simulation_time);
+    }
+
+    template<class U>
+    inline int DDSManager<U>::EndPhysiologyFrame() {
+       if (!m_isPhysFrameOpen) return 1;
+       m_isPhysFrameOpen = false;
+
+       FinishPhysiologyFrame();
+       return m_physiologyFrame->Write(m_physFrame);
+    }
+
+    template<class U>
+    inline int DDSManager<U>::EndPhysiologyFrame(std::string &errmsg) {
+       if (!m_isPhysFrameOpen) {
+          errmsg = "Physiology Frame is not open.";
+          return 1;
+       }
+       m_isPhysFrameOpen = false;
+
+       FinishPhysiologyFrame();
+       return m_physiologyFrame->Write(errmsg, m_physFrame);
+    }
+
+    template<class U>
+    inline void DDSManager<U>::SetDivertPhysiologyValues(bool divert) {
+       m_divertPhysValues = divert;
+    }
+
+
 /// Wrapper interface for managing AMM Data Types.
 ///
 /// Specialization B<br>
@@ -4699,71 +6032,75 @@ namespace AMM {
 
         /// Assessment type handler.
         /// Handler for registering, publishering, and subscribing data for Assessment.
-        AmmDataType<ASMT_TYPE, ASMT_LTNR, ASMT> *m_assessment;
+        AmmDataType<ASMT_TYPE, ASMT_LTNR, ASMT> *m_assessment = nullptr;
 
         /// Event Fragment type handler.
         /// Handler for registering, publishering, and subscribing data for Event Fragment.
-        AmmDataType<EVFR_TYPE, EVFR_LTNR, EVFR> *m_eventFragment;
+        AmmDataType<EVFR_TYPE, EVFR_LTNR, EVFR> *m_eventFragment = nullptr;
 
         /// Event Record type handler.
         /// Handler for registering, publishering, and subscribing data for Event Record.
-        AmmDataType<EVRC_TYPE, EVRC_LTNR, EVRC> *m_eventRecord;
+        AmmDataType<EVRC_TYPE, EVRC_LTNR, EVRC> *m_eventRecord = nullptr;
 
         /// Fragment Amendment Request type handler.
         /// Handler for registering, publishering, and subscribing data for Fragment Amendment Request.
-        AmmDataType<FARQ_TYPE, FARQ_LTNR, FARQ> *m_fragmentAmendmentRequest;
+        AmmDataType<FARQ_TYPE, FARQ_LTNR, FARQ> *m_fragmentAmendmentRequest = nullptr;
 
         /// Log type handler.
         /// Handler for registering, publishering, and subscribing data for Log.
-        AmmDataType<ALOG_TYPE, ALOG_LTNR, ALOG> *m_log;
+        AmmDataType<ALOG_TYPE, ALOG_LTNR, ALOG> *m_log = nullptr;
 
         /// Module Configuration type handler.
         /// Handler for registering, publishering, and subscribing data for Module Configuration.
-        AmmDataType<MOCF_TYPE, MOCF_LTNR, MOCF> *m_moduleConfiguration;
+        AmmDataType<MOCF_TYPE, MOCF_LTNR, MOCF> *m_moduleConfiguration = nullptr;
 
         /// Omitted Description type handler.
         /// Handler for registering, publishering, and subscribing data for Omitted Description.
-        AmmDataType<OMEV_TYPE, OMEV_LTNR, OMEV> *m_omittedEvent;
+        AmmDataType<OMEV_TYPE, OMEV_LTNR, OMEV> *m_omittedEvent = nullptr;
 
         /// Operational Description type handler.
         /// Handler for registering, publishering, and subscribing data for Operational Description.
-        AmmDataType<OPDS_TYPE, OPDS_LTNR, OPDS> *m_operationalDescription;
+        AmmDataType<OPDS_TYPE, OPDS_LTNR, OPDS> *m_operationalDescription = nullptr;
 
         /// Physiology Modification type handler.
         /// Handler for registering, publishering, and subscribing data for Physiology Modification.
-        AmmDataType<PHMO_TYPE, PHMO_LTNR, PHMO> *m_physiologyModification;
+        AmmDataType<PHMO_TYPE, PHMO_LTNR, PHMO> *m_physiologyModification = nullptr;
 
         /// Physiology Value type handler.
         /// Handler for registering, publishering, and subscribing data for Physiology Value.
-        AmmDataType<PHVA_TYPE, PHVA_LTNR, PHVA> *m_physiologyValue;
+        AmmDataType<PHVA_TYPE, PHVA_LTNR, PHVA> *m_physiologyValue = nullptr;
 
         /// Physiology Waveform type handler.
         /// Handler for registering, publishering, and subscribing data for Physiology Waveform.
-        AmmDataType<PHWV_TYPE, PHWV_LTNR, PHWV> *m_physiologyWaveform;
+        AmmDataType<PHWV_TYPE, PHWV_LTNR, PHWV> *m_physiologyWaveform = nullptr;
 
         /// Render Modification type handler.
         /// Handler for registering, publishering, and subscribing data for Render Modification.
-        AmmDataType<RDMO_TYPE, RDMO_LTNR, RDMO> *m_renderModification;
+        AmmDataType<RDMO_TYPE, RDMO_LTNR, RDMO> *m_renderModification = nullptr;
 
         /// Simulation Control type handler.
         /// Handler for registering, publishering, and subscribing data for Simulation Control.
-        AmmDataType<SMCN_TYPE, SMCN_LTNR, SMCN> *m_simulationControl;
+        AmmDataType<SMCN_TYPE, SMCN_LTNR, SMCN> *m_simulationControl = nullptr;
 
         /// Status type handler.
         /// Handler for registering, publishering, and subscribing data for Status.
-        AmmDataType<STAT_TYPE, STAT_LTNR, STAT> *m_status;
+        AmmDataType<STAT_TYPE, STAT_LTNR, STAT> *m_status = nullptr;
 
         /// Tick type handler.
         /// Handler for registering, publishering, and subscribing data for Tick.
-        AmmDataType<TICK_TYPE, TICK_LTNR, TICK> *m_tick;
+        AmmDataType<TICK_TYPE, TICK_LTNR, TICK> *m_tick = nullptr;
 
         /// Instrument Data type handler.
         /// Handler for registering, publishering, and subscribing data for Instrument Data.
-        AmmDataType<IDAT_TYPE, IDAT_LTNR, IDAT> *m_instrumentData;
+        AmmDataType<IDAT_TYPE, IDAT_LTNR, IDAT> *m_instrumentData = nullptr;
 
         /// Command type handler.
         /// Handler for registering, publishering, and subscribing data for Command.
-        AmmDataType<CMND_TYPE, CMND_LTNR, CMND> *m_command;
+        AmmDataType<CMND_TYPE, CMND_LTNR, CMND> *m_command = nullptr;
+
+        /// Physiology Frame type handler.
+        /// Handler for registering, publishering, and subscribing data for Physiology Frame.
+        AmmDataType<PHFR_TYPE, PHFR_LTNR, PHFR> *m_physiologyFrame = nullptr;
 
         /// Initializer flag for Assessment.
         /// State of whether the AMMDataType pointer for Assessment is valid.
@@ -4789,6 +6126,11 @@ namespace AMM {
         /// State of whether the AMMDataType pointer for Module Configuration is valid.
         bool m_isModConfigInit = false;
 
+        /// Cache fed by received Module Configuration events, if one is attached.
+        /// Read by the DDS receive thread, so it is set before the subscriber exists and cleared after it is gone.
+        /// @note This is an outside reference. It is not managed by this class.
+        std::atomic<ModuleConfigurationCache *> m_moduleConfigurationCache{nullptr};
+
         /// Initializer flag for Omitted Event.
         /// State of whether the AMMDataType pointer for Omitted Event is valid.
         bool m_isOmitEventInit = false;
@@ -4797,6 +6139,11 @@ namespace AMM {
         /// State of whether the AMMDataType pointer for Operational Description is valid.
         bool m_isOpDescriptInit = false;
 
+        /// Health monitor fed by received Operational Description events, if one is attached.
+        /// Read by the DDS receive thread, so it is set before the subscriber exists and cleared after it is gone.
+        /// @note This is an outside reference. It is not managed by this class.
+        std::atomic<ModuleHealthMonitor *> m_opDescriptHealthMonitor{nullptr};
+
         /// Initializer flag for Physiology Modification.
         /// State of whether the AMMDataType pointer for Physiology Modification is valid.
         bool m_isPhysModInit = false;
@@ -4821,10 +6168,20 @@ namespace AMM {
         /// State of whether the AMMDataType pointer for Status is valid.
         bool m_isStatusInit = false;
 
+        /// Health monitor fed by received Status and liveliness events, if one is attached.
+        /// Read by the DDS receive thread, so it is set before the subscriber exists and cleared after it is gone.
+        /// @note This is an outside reference. It is not managed by this class.
+        std::atomic<ModuleHealthMonitor *> m_statusHealthMonitor{nullptr};
+
         /// Initializer flag for Tick.
         /// State of whether the AMMDataType pointer for Tick is valid.
         bool m_isTickInit = false;
 
+        /// Scheduler fed by received Tick events, if one is attached.
+        /// Read by the DDS receive thread, so it is set before the subscriber exists and cleared after it is gone.
+        /// @note This is an outside reference. It is not managed by this class.
+        std::atomic<TickScheduler *> m_tickScheduler{nullptr};
+
         /// Initializer flag for Instrument Data.
         /// State of whether the AMMDataType pointer for Instrument Data is valid.
         bool m_isInstDataInit = false;
@@ -4833,6 +6190,25 @@ namespace AMM {
         /// State of whether the AMMDataType pointer for Command is valid.
         bool m_isCommandInit = false;
 
+        /// Initializer flag for Physiology Frame.
+        /// State of whether the AMMDataType pointer for Physiology Frame is valid.
+        bool m_isPhysFrameInit = false;
+
+        /// State of whether a frame is open between BeginPhysiologyFrame and EndPhysiologyFrame.
+        bool m_isPhysFrameOpen = false;
+
+        /// State of whether values written while a frame is open are left off Physiology Value.
+        bool m_divertPhysValues = false;
+
+        /// Frame being collected.  Kept between frames so its entries and their strings are reused.
+        AMM::PhysiologyFrame m_physFrame;
+
+        /// Number of entries of m_physFrame used by the open frame.
+        std::size_t m_physFrameSize = 0;
+
+        /// Entries of a larger previous frame, moved out of m_physFrame so their strings are reused.
+        std::vector<AMM::PhysiologyFrameEntry> m_physFrameSpare;
+
 
     private:
 
@@ -4851,21 +6227,67 @@ namespace AMM {
         /// Each AMM Module has one Participant used to register their activity on the DDS network.
         /// A Participant is created at the time of the module's inception, and removed once a module
         /// shuts down.
-        eprosima::fastrtps::Participant *m_participant;
+        eprosima::fastrtps::Participant *m_participant = nullptr;
 
         /// DDS Listener object for publishers.
         /// All publishers for each AMMDataType use the same publisher listener
         /// referenced from here.
         /// @note Is created at the time of the module's inception.
-        DDS_Listeners::PubListener *m_pubListener;
+        DDS_Listeners::PubListener *m_pubListener = nullptr;
+
+        /// Start up milestones of this module, started at construction.
+        StartupTimeline m_startup;
+
+        /// Module manifest the participant was created from, empty without static discovery.
+        std::vector<ModuleManifest> m_manifest;
+
+        /// Add a Physiology Value to the open Physiology Frame.
+        void AppendPhysiologyFrameValue(const AMM::PhysiologyValueSample &a);
+
+        /// Trim the open Physiology Frame to the values written and timestamp it, ready to publish.
+        void FinishPhysiologyFrame();
+
+        /// Setup pass registering the type of a topic.
+        /// @param topic Topic name.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int SetupType(const std::string &topic, std::string &errmsg);
+
+        /// Setup pass creating the Publisher of a topic.
+        /// @param topic Topic name.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int SetupPublisher(const std::string &topic, std::string &errmsg);
+
+        /// Setup pass creating the Subscriber of a topic, without a callback.
+        /// @param topic Topic name.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int SetupSubscriber(const std::string &topic, std::string &errmsg);
+
+        /// @returns Every Publisher and Subscriber of this module.
+        std::set<const void *> Endpoints() const;
 
     public:
         /// Default constructor taking in a module name defined by the user.
-        /// @param moduleName String name of this module.
-        DDSManager(std::string configFile, std::string profileName = std::string());
+        /// @param configFile XML profiles file.
+        /// @param profileName Participant profile, "amm_participant" if empty.
+        /// @param manifestFile Module manifest.  If set, the participant uses static endpoint discovery
+        /// generated from it instead of simple endpoint discovery, see StaticDiscovery.
+        /// @param discoveryServer Address of an amm_discovery_server, "host[:port]".  If set, the
+        /// participant is a client of that server instead of using simple discovery, see DiscoveryServer.
+        /// Cannot be combined with manifestFile.
+        /// @note Managers in one process with the same configFile, profileName and discoveryServer, and
+        /// no manifestFile, share one participant, and with it its name and GUID prefix; see
+        /// ParticipantRegistry.
+        DDSManager(
+           std::string configFile, std::string profileName = std::string(), std::string manifestFile = std::string(),
+           std::string discoveryServer = std::string()
+        );
 
-        /// Default deconstructor.
-        ~DDSManager() {};
+        /// Deletes every topic handler, removing any endpoints still open, and releases the participant
+        /// if Shutdown was not called.
+        ~DDSManager();
 
         /// Default shutdown command for the module.
         /// Should always be used before exiting the executable, because this ensures all Participant activity
@@ -4878,17 +6300,92 @@ namespace AMM {
         /// @note Shutdown routine will not stop if an error flag is raised. Will ignore and continue on.
         void Shutdown(std::string &errmsg);
 
+        /// UUID generated for this module at construction.
+        /// @returns A string form of the module UUID.
+        std::string GetModuleId() const;
+
+        /// History memory reserved by every publisher and subscriber created on this module.
+        /// @returns One entry per endpoint, see TopicMemory for how the policy of each topic is chosen.
+        std::vector<EndpointMemory> MemoryUsage() const;
+
+        /// Memory footprint of this module's topics as text.
+        /// Lists the memory policy, sample size and counts, and the bytes reserved up front and at most
+        /// for every publisher and subscriber, followed by the totals.
+        /// @returns Report, one line per endpoint.
+        std::string MemoryReport() const;
+
+        /// Register the types and create the endpoints of every topic this module uses in one pass.
+        ///
+        /// All types are registered first, then all Publishers and then all Subscribers are created, so
+        /// the whole set is announced to the network together instead of one endpoint at a time between
+        /// the module's own start up work.  Call this right after construction: participant discovery
+        /// runs in the background while the endpoints are created.
+        ///
+        /// Subscribers are created without a callback.  Bind one afterwards with the topic's Create
+        /// Subscriber method, which keeps the Subscriber created here and first delivers it the samples
+        /// received in between, up to the size of the topic's history, e.g.
+        /// @code
+        /// mgr->Setup({{PHVA_STR, TopicSetup::PUBLISH}, {SMCN_STR, TopicSetup::SUBSCRIBE}});
+        /// mgr->CreateSimulationControlSubscriber(this, &Module::onNewSimulationControl);
+        /// @endcode
+        /// Every endpoint created by this call is expected to match for the ENDPOINTS_MATCHED stage of the
+        /// startup timeline; endpoints that existed before are not counted.
+        /// @param topics Topics and the roles of this module on them.
+        /// @returns 0 if every topic was set up.
+        int Setup(const std::vector<TopicSetup> &topics);
+
+        /// Register the types and create the endpoints of every topic this module uses in one pass.
+        /// @see Setup(const std::vector<TopicSetup> &)
+        /// @param errmsg Error message output, one line per topic that failed.
+        /// @param topics Topics and the roles of this module on them.
+        /// @returns 0 if every topic was set up.
+        /// @note Topics that fail are reported and skipped, the others are still set up.
+        int Setup(std::string &errmsg, const std::vector<TopicSetup> &topics);
+
+        /// Start up milestones of this module, from construction to every endpoint matched.
+        /// @returns Timeline, updated as discovery progresses.
+        const StartupTimeline &Startup() const;
+
+        /// Start up milestones of this module as text, for logging.
+        /// @returns Report, one line per stage in milliseconds since construction.
+        std::string StartupReport() const;
+
+        /// Topics the module manifest lists for this module, to pass to Setup.
+        /// @returns Topics and roles, empty without static discovery.
+        std::vector<TopicSetup> ManifestTopics() const;
+
         /// Generates a random UUID.
         /// @returns A string form of a UUID.
         static std::string GenerateUuidString();
 
+        /// Generates a batch of random UUIDs into caller provided buffers.
+        /// Uses the calling thread's generator, so this is safe to call from DDS callbacks.
+        /// @param n Number of UUIDs to generate.
+        /// @param buffers Destination, the i-th null terminated UUID string is written at buffers + i * stride.
+        /// @param stride Distance between consecutive buffers, at least UuidGenerator::BUFFER_SIZE.
+        static void GenerateUuids(
+           std::size_t n, char *buffers, std::size_t stride = UuidGenerator::BUFFER_SIZE
+        );
+
+        /// Converts a textual UUID, as received from any peer, to its 16 byte form.
+        /// Ids that are not UUIDs map to a stable name based UUID.  Lossy, see BinaryUuid::FromString.
+        /// @param uuid Textual UUID.
+        /// @returns Binary UUID.
+        static BinaryUuid ToBinaryUuid(const AMM::UUID &uuid);
+
+        /// Converts a binary UUID back to the canonical textual form understood by every peer.
+        /// A legacy or non-canonical id given to ToBinaryUuid does not come back unchanged.
+        /// @param uuid Binary UUID.
+        /// @returns Textual UUID.
+        static AMM::UUID ToUuid(const BinaryUuid &uuid);
+
         /// Initializer routine for Assessment.
-        /// Initializes m_assessment with a new AmmDataType pointer.
+        /// Initializes m_assessment with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeAssessment();
 
         /// Overload initializer routine for Assessment.
-        /// Initializes m_assessment with a new AmmDataType pointer.
+        /// Initializes m_assessment with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeAssessment(std::string &errmsg);
@@ -4981,12 +6478,12 @@ namespace AMM {
         // - - - Event Fragment - - -
 
         /// Initializer routine for Event Fragment.
-        /// Initializes m_eventFragment with a new AmmDataType pointer.
+        /// Initializes m_eventFragment with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeEventFragment();
 
         /// Overload initializer routine for Event Fragment.
-        /// Initializes m_eventFragment with a new AmmDataType pointer.
+        /// Initializes m_eventFragment with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeEventFragment(std::string &errmsg);
@@ -5080,12 +6577,12 @@ namespace AMM {
         // - - - Event Record - - -
 
         /// Initializer routine for Event Record.
-        /// Initializes m_eventRecord with a new AmmDataType pointer.
+        /// Initializes m_eventRecord with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeEventRecord();
 
         /// Overload initializer routine for Event Record.
-        /// Initializes m_eventRecord with a new AmmDataType pointer.
+        /// Initializes m_eventRecord with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeEventRecord(std::string &errmsg);
@@ -5178,12 +6675,12 @@ namespace AMM {
         // - - - Fragment Amendment Request - - -
 
         /// Initializer routine for Fragment Amendment Request.
-        /// Initializes m_fragmentAmendmentRequest with a new AmmDataType pointer.
+        /// Initializes m_fragmentAmendmentRequest with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeFragmentAmendmentRequest();
 
         /// Overload initializer routine for Fragment Amendment Request.
-        /// Initializes m_fragmentAmendmentRequest with a new AmmDataType pointer.
+        /// Initializes m_fragmentAmendmentRequest with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeFragmentAmendmentRequest(std::string &errmsg);
@@ -5277,12 +6774,12 @@ namespace AMM {
         // - - - Log - - -
 
         /// Initializer routine for Log.
-        /// Initializes m_log with a new AmmDataType pointer.
+        /// Initializes m_log with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeLog();
 
         /// Overload initializer routine for Log.
-        /// Initializes m_log with a new AmmDataType pointer.
+        /// Initializes m_log with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeLog(std::string &errmsg);
@@ -5317,7 +6814,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreateLogSubscriber(
-           void (*onEvent)(AMM::Log &, eprosima::fastrtps::SampleInfo_t *)
+           void (*onEvent)(AMM::LogSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Create the data subscriber for Log published events on this module.
@@ -5327,7 +6824,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreateLogSubscriber(
-           std::string &errmsg, void (*onEvent)(AMM::Log &, eprosima::fastrtps::SampleInfo_t *)
+           std::string &errmsg, void (*onEvent)(AMM::LogSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Remove the subscriber for Log on this module from the DDS network.
@@ -5343,14 +6840,14 @@ namespace AMM {
         /// @param a Reference to Log data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WriteLog(AMM::Log &a);
+        int WriteLog(AMM::LogSample &a);
 
         /// Call upon the active publisher for Log to write data to the DDS network.
         /// @param errmsg Error message output.
         /// @param a Reference to Log data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WriteLog(std::string &errmsg, AMM::Log &a);
+        int WriteLog(std::string &errmsg, AMM::LogSample &a);
 
         /// Listener Interface override for handling Log subscribed events.
         /// Calls OnEvent on m_log passing along data to the handler defined by
@@ -5359,7 +6856,7 @@ namespace AMM {
         /// @see ListenerInterface::onNewLog
         /// @param log incoming Log data from the DDS network.
         /// @param info FastRTPS sample info.
-        void onNewLog(AMM::Log eventRec, eprosima::fastrtps::SampleInfo_t *info) override;
+        void onNewLog(AMM::LogSample eventRec, eprosima::fastrtps::SampleInfo_t *info) override;
 
         /// Clean up Log and set it to an inactive state.
         /// Calls Delete on m_log.
@@ -5375,12 +6872,12 @@ namespace AMM {
         // - - - Module Configuration - - -
 
         /// Initializer routine for Module Configuration.
-        /// Initializes m_moduleConfiguration with a new AmmDataType pointer.
+        /// Initializes m_moduleConfiguration with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeModuleConfiguration();
 
         /// Overload initializer routine for Module Configuration.
-        /// Initializes m_moduleConfiguration with a new AmmDataType pointer.
+        /// Initializes m_moduleConfiguration with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeModuleConfiguration(std::string &errmsg);
@@ -5428,6 +6925,19 @@ namespace AMM {
            std::string &errmsg, void (*onEvent)(AMM::ModuleConfiguration &, eprosima::fastrtps::SampleInfo_t *)
         );
 
+        /// Create the data subscriber for Module Configuration published events and feed them to a cache.
+        /// The cache parses each module's configuration once and calls its handler only on changes.
+        /// @param cache Cache receiving configurations. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateModuleConfigurationSubscriber(ModuleConfigurationCache *cache);
+
+        /// Create the data subscriber for Module Configuration published events and feed them to a cache.
+        /// The cache parses each module's configuration once and calls its handler only on changes.
+        /// @param errmsg Error message output.
+        /// @param cache Cache receiving configurations. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateModuleConfigurationSubscriber(std::string &errmsg, ModuleConfigurationCache *cache);
+
         /// Remove the subscriber for Module Configuration on this module from the DDS network.
         /// @returns 0 if successful.
         int RemoveModuleConfigurationSubscriber();
@@ -5474,12 +6984,12 @@ namespace AMM {
         // - - - Omitted Event - - -
 
         /// Initializer routine for Omitted Event.
-        /// Initializes m_omittedEvent with a new AmmDataType pointer.
+        /// Initializes m_omittedEvent with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeOmittedEvent();
 
         /// Overload initializer routine for Omitted Event.
-        /// Initializes m_omittedEvent with a new AmmDataType pointer.
+        /// Initializes m_omittedEvent with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeOmittedEvent(std::string &errmsg);
@@ -5572,12 +7082,12 @@ namespace AMM {
         // - - - Operational Description - - -
 
         /// Initializer routine for Operational Description.
-        /// Initializes m_operationalDescription with a new AmmDataType pointer.
+        /// Initializes m_operationalDescription with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeOperationalDescription();
 
         /// Overload initializer routine for Operational Description.
-        /// Initializes m_operationalDescription with a new AmmDataType pointer.
+        /// Initializes m_operationalDescription with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeOperationalDescription(std::string &errmsg);
@@ -5625,6 +7135,19 @@ namespace AMM {
            std::string &errmsg, void (*onEvent)(AMM::OperationalDescription &, eprosima::fastrtps::SampleInfo_t *)
         );
 
+        /// Create the data subscriber for Operational Description published events and feed them to a health monitor.
+        /// The monitor takes the name and hardware of each module from its Operational Description.
+        /// @param monitor Monitor receiving descriptions. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateOperationalDescriptionSubscriber(ModuleHealthMonitor *monitor);
+
+        /// Create the data subscriber for Operational Description published events and feed them to a health monitor.
+        /// The monitor takes the name and hardware of each module from its Operational Description.
+        /// @param errmsg Error message output.
+        /// @param monitor Monitor receiving descriptions. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateOperationalDescriptionSubscriber(std::string &errmsg, ModuleHealthMonitor *monitor);
+
         /// Remove the subscriber for Operation Description on this module from the DDS network.
         /// @returns 0 if successful.
         int RemoveOperationalDescriptionSubscriber();
@@ -5671,12 +7194,12 @@ namespace AMM {
         // - - - Physiology Modification - - -
 
         /// Initializer routine for Physiology Modification.
-        /// Initializes m_physiologyModification with a new AmmDataType pointer.
+        /// Initializes m_physiologyModification with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializePhysiologyModification();
 
         /// Overload initializer routine for Physiology Modification.
-        /// Initializes m_physiologyModification with a new AmmDataType pointer.
+        /// Initializes m_physiologyModification with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializePhysiologyModification(std::string &errmsg);
@@ -5770,12 +7293,12 @@ namespace AMM {
         // - - - Physioogy Value - - -
 
         /// Initializer routine for Physiology Value.
-        /// Initializes m_physiologyValue with a new AmmDataType pointer.
+        /// Initializes m_physiologyValue with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializePhysiologyValue();
 
         /// Overload initializer routine for Physiology Value.
-        /// Initializes m_physiologyValue with a new AmmDataType pointer.
+        /// Initializes m_physiologyValue with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializePhysiologyValue(std::string &errmsg);
@@ -5810,7 +7333,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreatePhysiologyValueSubscriber(
-           void (*onEvent)(AMM::PhysiologyValue &, eprosima::fastrtps::SampleInfo_t *)
+           void (*onEvent)(AMM::PhysiologyValueSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Create the data subscriber for Physiology Value published events on this module.
@@ -5820,7 +7343,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreatePhysiologyValueSubscriber(
-           std::string &errmsg, void (*onEvent)(AMM::PhysiologyValue &, eprosima::fastrtps::SampleInfo_t *)
+           std::string &errmsg, void (*onEvent)(AMM::PhysiologyValueSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Remove the subscriber for Physiology Value on this module from the DDS network.
@@ -5833,17 +7356,23 @@ namespace AMM {
         int RemovePhysiologyValueSubscriber(std::string &errmsg);
 
         /// Call upon the active publisher for Physiology Value to write data to the DDS network.
+        /// While a Physiology Frame is open (see BeginPhysiologyFrame) the name, value and educational
+        /// encounter are also added to the frame.  The value is only left off Physiology Value if
+        /// SetDivertPhysiologyValues(true) was called.
         /// @param a Reference to Physiology Value data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WritePhysiologyValue(AMM::PhysiologyValue &a);
+        int WritePhysiologyValue(AMM::PhysiologyValueSample &a);
 
         /// Call upon the active publisher for Physiology Value to write data to the DDS network.
+        /// While a Physiology Frame is open (see BeginPhysiologyFrame) the name, value and educational
+        /// encounter are also added to the frame.  The value is only left off Physiology Value if
+        /// SetDivertPhysiologyValues(true) was called.
         /// @param errmsg Error message output.
         /// @param a Reference to Physiology Value data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WritePhysiologyValue(std::string &errmsg, AMM::PhysiologyValue &a);
+        int WritePhysiologyValue(std::string &errmsg, AMM::PhysiologyValueSample &a);
 
         /// Listener Interface override for handling Physiology Value subscribed events.
         /// Calls OnEvent on m_physiologyValue passing along data to the handler defined by
@@ -5852,7 +7381,7 @@ namespace AMM {
         /// @see ListenerInterface::onNewPhysiologyValue
         /// @param physVal incoming Physiology Value data from the DDS network.
         /// @param info FastRTPS sample info.
-        void onNewPhysiologyValue(AMM::PhysiologyValue physVal, eprosima::fastrtps::SampleInfo_t *info) override;
+        void onNewPhysiologyValue(AMM::PhysiologyValueSample physVal, eprosima::fastrtps::SampleInfo_t *info) override;
 
         /// Clean up Physiology Value and set it to an inactive state.
         /// Calls Delete on m_physiologyValue.
@@ -5868,12 +7397,12 @@ namespace AMM {
         // - - - Physiology Waveform - - -
 
         /// Initializer routine for Physiology Waveform.
-        /// Initializes m_physiologyWaveform with a new AmmDataType pointer.
+        /// Initializes m_physiologyWaveform with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializePhysiologyWaveform();
 
         /// Overload initializer routine for Physiology Waveform.
-        /// Initializes m_physiolgyWaveform with a new AmmDataType pointer.
+        /// Initializes m_physiolgyWaveform with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializePhysiologyWaveform(std::string &errmsg);
@@ -5908,7 +7437,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreatePhysiologyWaveformSubscriber(
-           void (*onEvent)(AMM::PhysiologyWaveform &, eprosima::fastrtps::SampleInfo_t *)
+           void (*onEvent)(AMM::PhysiologyWaveformSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Create the data subscriber for Physiology Waveform published events on this module.
@@ -5918,7 +7447,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreatePhysiologyWaveformSubscriber(
-           std::string &errmsg, void (*onEvent)(AMM::PhysiologyWaveform &, eprosima::fastrtps::SampleInfo_t *)
+           std::string &errmsg, void (*onEvent)(AMM::PhysiologyWaveformSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Remove the subscriber for Physiology Waveform on this module from the DDS network.
@@ -5934,14 +7463,14 @@ namespace AMM {
         /// @param a Reference to Physiology Waveform data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WritePhysiologyWaveform(AMM::PhysiologyWaveform &a);
+        int WritePhysiologyWaveform(AMM::PhysiologyWaveformSample &a);
 
         /// Call upon the active publisher for Physiology Waveform to write data to the DDS network.
         /// @param errmsg Error message output.
         /// @param a Reference to Physiology Waveform data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WritePhysiologyWaveform(std::string &errmsg, AMM::PhysiologyWaveform &a);
+        int WritePhysiologyWaveform(std::string &errmsg, AMM::PhysiologyWaveformSample &a);
 
         /// Listener Interface override for handling Physiology Waveform subscribed events.
         /// Calls OnEvent on m_physiologyWaveform passing along data to the handler defined by
@@ -5950,7 +7479,7 @@ namespace AMM {
         /// @see ListenerInterface::onNewPhysiologyWaveform
         /// @param eventFrag incoming Physiology Waveform data from the DDS network.
         /// @param info FastRTPS sample info.
-        void onNewPhysiologyWaveform(AMM::PhysiologyWaveform physWave, eprosima::fastrtps::SampleInfo_t *info) override;
+        void onNewPhysiologyWaveform(AMM::PhysiologyWaveformSample physWave, eprosima::fastrtps::SampleInfo_t *info) override;
 
         /// Clean up Physiology Waveform and set it to an inactive state.
         /// Calls Delete on m_physiologyWaveform.
@@ -5966,12 +7495,12 @@ namespace AMM {
         // - - - Render Modification - - -
 
         /// Initializer routine for Render Modification.
-        /// Initializes m_renderModification with a new AmmDataType pointer.
+        /// Initializes m_renderModification with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeRenderModification();
 
         /// Overload initializer routine for Render Modification.
-        /// Initializes m_renderModification with a new AmmDataType pointer.
+        /// Initializes m_renderModification with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeRenderModification(std::string &errmsg);
@@ -6064,12 +7593,12 @@ namespace AMM {
         // - - - Simulation Control - - -
 
         /// Initializer routine for Simulation Control.
-        /// Initializes m_simulationControl with a new AmmDataType pointer.
+        /// Initializes m_simulationControl with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeSimulationControl();
 
         /// Overload initializer routine for Simulation Control.
-        /// Initializes m_simulationControl with a new AmmDataType pointer.
+        /// Initializes m_simulationControl with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeSimulationControl(std::string &errmsg);
@@ -6162,12 +7691,12 @@ namespace AMM {
         // - - - Status - - -
 
         /// Initializer routine for Status.
-        /// Initializes m_stuatus with a new AmmDataType pointer.
+        /// Initializes m_stuatus with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeStatus();
 
         /// Overload initializer routine for Status.
-        /// Initializes m_status with a new AmmDataType pointer.
+        /// Initializes m_status with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeStatus(std::string &errmsg);
@@ -6202,7 +7731,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreateStatusSubscriber(
-           void (*onEvent)(AMM::Status &, eprosima::fastrtps::SampleInfo_t *)
+           void (*onEvent)(AMM::StatusSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Create the data subscriber for Status published events on this module.
@@ -6212,9 +7741,30 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreateStatusSubscriber(
-           std::string &errmsg, void (*onEvent)(AMM::Status &, eprosima::fastrtps::SampleInfo_t *)
+           std::string &errmsg, void (*onEvent)(AMM::StatusSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
+        /// Create the data subscriber for Status published events and feed them to a health monitor.
+        /// The monitor also receives the liveliness changes of the Status writers, so it reports a module
+        /// that stops without publishing a Status as lost.  For that the subscriber requests the one
+        /// second liveliness lease Status writers offer, and does not match writers of modules built
+        /// before they offered it; see AmmDataType::RequestLivelinessLease.  A Status subscriber created
+        /// without the lease, e.g. by Setup, is replaced.
+        /// @param monitor Monitor receiving Status. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateStatusSubscriber(ModuleHealthMonitor *monitor);
+
+        /// Create the data subscriber for Status published events and feed them to a health monitor.
+        /// The monitor also receives the liveliness changes of the Status writers, so it reports a module
+        /// that stops without publishing a Status as lost.  For that the subscriber requests the one
+        /// second liveliness lease Status writers offer, and does not match writers of modules built
+        /// before they offered it; see AmmDataType::RequestLivelinessLease.  A Status subscriber created
+        /// without the lease, e.g. by Setup, is replaced.
+        /// @param errmsg Error message output.
+        /// @param monitor Monitor receiving Status. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateStatusSubscriber(std::string &errmsg, ModuleHealthMonitor *monitor);
+
         /// Remove the subscriber for Status on this module from the DDS network.
         /// @returns 0 if successful.
         int RemoveStatusSubscriber();
@@ -6228,14 +7778,14 @@ namespace AMM {
         /// @param a Reference to Status data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WriteStatus(AMM::Status &a);
+        int WriteStatus(AMM::StatusSample &a);
 
         /// Call upon the active publisher for Status to write data to the DDS network.
         /// @param errmsg Error message output.
         /// @param a Reference to Status data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WriteStatus(std::string &errmsg, AMM::Status &a);
+        int WriteStatus(std::string &errmsg, AMM::StatusSample &a);
 
         /// Listener Interface override for handling Status subscribed events.
         /// Calls OnEvent on m_status passing along data to the handler defined by
@@ -6244,7 +7794,7 @@ namespace AMM {
         /// @see ListenerInterface::onNewStatus
         /// @param status incoming Status data from the DDS network.
         /// @param info FastRTPS sample info.
-        void onNewStatus(AMM::Status status, eprosima::fastrtps::SampleInfo_t *info) override;
+        void onNewStatus(AMM::StatusSample status, eprosima::fastrtps::SampleInfo_t *info) override;
 
         /// Clean up Status and set it to an inactive state.
         /// Calls Delete on m_status.
@@ -6260,12 +7810,12 @@ namespace AMM {
         // - - - Tick - - -
 
         /// Initializer routine for Tick.
-        /// Initializes m_tick with a new AmmDataType pointer.
+        /// Initializes m_tick with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeTick();
 
         /// Overload initializer routine for Tick.
-        /// Initializes m_tick with a new AmmDataType pointer.
+        /// Initializes m_tick with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeTick(std::string &errmsg);
@@ -6313,6 +7863,19 @@ namespace AMM {
            std::string &errmsg, void (*onEvent)(AMM::Tick &, eprosima::fastrtps::SampleInfo_t *)
         );
 
+        /// Create the data subscriber for Tick published events and feed them to a scheduler.
+        /// Every received Tick is handed to scheduler, which runs its tasks on its own thread.
+        /// @param scheduler Scheduler receiving ticks. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateTickSubscriber(TickScheduler *scheduler);
+
+        /// Create the data subscriber for Tick published events and feed them to a scheduler.
+        /// Every received Tick is handed to scheduler, which runs its tasks on its own thread.
+        /// @param errmsg Error message output.
+        /// @param scheduler Scheduler receiving ticks. Not owned, must outlive the subscriber.
+        /// @returns 0 if successful.
+        int CreateTickSubscriber(std::string &errmsg, TickScheduler *scheduler);
+
         /// Remove the subscriber for Tick on this module from the DDS network.
         /// @returns 0 if successful.
         int RemoveTickSubscriber();
@@ -6358,12 +7921,12 @@ namespace AMM {
         // - - - Instrument Data - - -
 
         /// Initializer routine for Instrument Data.
-        /// Initializes m_instrumentData with a new AmmDataType pointer.
+        /// Initializes m_instrumentData with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeInstrumentData();
 
         /// Overload initializer routine for Instrument Data.
-        /// Initializes m_instrumentData with a new AmmDataType pointer.
+        /// Initializes m_instrumentData with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeInstrumentData(std::string &errmsg);
@@ -6456,12 +8019,12 @@ namespace AMM {
         // - - - Command - - -
 
         /// Initializer routine for Command.
-        /// Initializes m_command with a new AmmDataType pointer.
+        /// Initializes m_command with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @returns 0 if successful.
         int InitializeCommand();
 
         /// Overload initializer routine for Command.
-        /// Initializes m_command with a new AmmDataType pointer.
+        /// Initializes m_command with a new AmmDataType pointer, or reuses the one of an earlier initialization.
         /// @param errmsg Error message output.
         /// @returns 0 if successful.
         int InitializeCommand(std::string &errmsg);
@@ -6496,7 +8059,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreateCommandSubscriber(
-           void (*onEvent)(AMM::Command &, eprosima::fastrtps::SampleInfo_t *)
+           void (*onEvent)(AMM::CommandSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Create the data subscriber for Command published events on this module.
@@ -6506,7 +8069,7 @@ namespace AMM {
         /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
         /// @returns 0 if successful.
         int CreateCommandSubscriber(
-           std::string &errmsg, void (*onEvent)(AMM::Command &, eprosima::fastrtps::SampleInfo_t *)
+           std::string &errmsg, void (*onEvent)(AMM::CommandSample &, eprosima::fastrtps::SampleInfo_t *)
         );
 
         /// Remove the subscriber for Command on this module from the DDS network.
@@ -6522,14 +8085,14 @@ namespace AMM {
         /// @param a Reference to Command data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WriteCommand(AMM::Command &a);
+        int WriteCommand(AMM::CommandSample &a);
 
         /// Call upon the active publisher for Command to write data to the DDS network.
         /// @param errmsg Error message output.
         /// @param a Reference to Command data to be written.
         /// @returns 0 if successful.
         /// @returns 1 if Publisher has not been created or if some other error occurred.
-        int WriteCommand(std::string &errmsg, AMM::Command &a);
+        int WriteCommand(std::string &errmsg, AMM::CommandSample &a);
 
         /// Listener Interface override for handling Command subscribed events.
         /// Calls OnEvent on m_command passing along data to the handler defined by
@@ -6538,7 +8101,7 @@ namespace AMM {
         /// @see ListenerInterface::onNewCommand
         /// @param command incoming Command data from the DDS network.
         /// @param info FastRTPS sample info.
-        void onNewCommand(AMM::Command command, eprosima::fastrtps::SampleInfo_t *info) override;
+        void onNewCommand(AMM::CommandSample command, eprosima::fastrtps::SampleInfo_t *info) override;
 
         /// Clean up Command and set it to an inactive state.
         /// Calls Delete on m_command.
@@ -6551,11 +8114,165 @@ namespace AMM {
         /// @returns 0 if successful.
         int DecommissionCommand(std::string &errmsg);
 
+        // - - - Physiology Frame - - -
+
+        /// Initializer routine for Physiology Frame.
+        /// Initializes m_physiologyFrame with a new AmmDataType pointer, or reuses the one of an earlier initialization.
+        /// @returns 0 if successful.
+        int InitializePhysiologyFrame();
+
+        /// Overload initializer routine for Physiology Frame.
+        /// Initializes m_physiologyFrame with a new AmmDataType pointer, or reuses the one of an earlier initialization.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int InitializePhysiologyFrame(std::string &errmsg);
+
+        /// State of whether Physiology Frame is currently valid.
+        /// @returns True if m_physiologyFrame is valid pointer.
+        bool IsPhysiologyFrameInitialized();
+
+        /// Create the data publisher for Physiology Frame on this module.
+        /// Allows Physiology Frame data to be published to the DDS network.
+        /// @returns 0 if successful.
+        int CreatePhysiologyFramePublisher();
+
+        /// Create the data publisher for Physiology Frame on this module.
+        /// Allows Physiology Frame data to be published to the DDS network.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int CreatePhysiologyFramePublisher(std::string &errmsg);
+
+        /// Remove the publisher for Physiology Frame on this module from the DDS network.
+        /// @returns 0 if successful.
+        int RemovePhysiologyFramePublisher();
+
+        /// Remove the publisher for Physiology Frame on this module from the DDS network.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int RemovePhysiologyFramePublisher(std::string &errmsg);
+
+        /// Create the data subscriber for Physiology Frame published events on this module.
+        /// Allows the module to receive complete Physiology Frames when they are published on the DDS network.
+        /// @param parentClass Reference to the object that is receiving the subscribed event callback.
+        /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
+        /// @returns 0 if successful.
+        int CreatePhysiologyFrameSubscriber(
+           void (*onEvent)(AMM::PhysiologyFrame &, eprosima::fastrtps::SampleInfo_t *)
+        );
+
+        /// Create the data subscriber for Physiology Frame published events on this module.
+        /// Allows the module to receive complete Physiology Frames when they are published on the DDS network.
+        /// @param errmsg Error message output.
+        /// @param parentClass Reference to the object that is receiving the subscribed event callback.
+        /// @param onEvent Method reference of parentClass that is be used as a callback for subscribed events.
+        /// @returns 0 if successful.
+        int CreatePhysiologyFrameSubscriber(
+           std::string &errmsg, void (*onEvent)(AMM::PhysiologyFrame &, eprosima::fastrtps::SampleInfo_t *)
+        );
+
+        /// Remove the subscriber for Physiology Frame on this module from the DDS network.
+        /// @returns 0 if successful.
+        int RemovePhysiologyFrameSubscriber();
+
+        /// Remove the subscriber for Physiology Frame on this module from the DDS network.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int RemovePhysiologyFrameSubscriber(std::string &errmsg);
+
+        /// Call upon the active publisher for Physiology Frame to write data to the DDS network.
+        /// @param a Reference to Physiology Frame data to be written.
+        /// @returns 0 if successful.
+        /// @returns 1 if Publisher has not been created or if some other error occurred.
+        int WritePhysiologyFrame(AMM::PhysiologyFrame &a);
+
+        /// Call upon the active publisher for Physiology Frame to write data to the DDS network.
+        /// @param errmsg Error message output.
+        /// @param a Reference to Physiology Frame data to be written.
+        /// @returns 0 if successful.
+        /// @returns 1 if Publisher has not been created or if some other error occurred.
+        int WritePhysiologyFrame(std::string &errmsg, AMM::PhysiologyFrame &a);
+
+        /// Listener Interface override for handling Physiology Frame subscribed events.
+        /// Calls OnEvent on m_physiologyFrame passing along data to the handler defined by
+        /// the user in CreatePhysiologyFrameSubscriber.
+        /// @see AmmDataType::OnEvent
+        /// @see ListenerInterface::onNewPhysiologyFrame
+        /// @param physFrame incoming Physiology Frame data from the DDS network.
+        /// @param info FastRTPS sample info.
+        void onNewPhysiologyFrame(AMM::PhysiologyFrame physFrame, eprosima::fastrtps::SampleInfo_t *info) override;
+
+        /// Clean up Physiology Frame and set it to an inactive state.
+        /// Calls Delete on m_physiologyFrame.
+        /// @returns 0 if successful.
+        int DecommissionPhysiologyFrame();
+
+        /// Clean up Physiology Frame and set it to an inactive state.
+        /// Calls Delete on m_physiologyFrame.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int DecommissionPhysiologyFrame(std::string &errmsg);
+
+        /// Override for matched events from every Publisher.
+        /// Records the first match of each Publisher on the startup timeline.
+        /// @see ListenerInterface::onPublicationMatched
+        void onPublicationMatched(Publisher *pub, MatchingInfo &info) override;
+
+        /// Override for matched events from every Subscriber.
+        /// Records the first match of each Subscriber on the startup timeline.
+        /// @see ListenerInterface::onSubscriptionMatched
+        void onSubscriptionMatched(Subscriber *sub, MatchingInfo &info) override;
+
+        /// Override for liveliness changes seen by every Subscriber.
+        /// Passes them to the health monitor attached to the Status subscriber, if any.
+        /// @see ListenerInterface::onLivelinessChanged
+        void onLivelinessChanged(Subscriber *sub, const LivelinessChangedStatus &status) override;
+
+        /// Override for participant discovery events.
+        /// Records the first remote participant discovered on the startup timeline.
+        /// @see ListenerInterface::onParticipantDiscovery
+        void onParticipantDiscovery(Participant *participant, ParticipantDiscoveryInfo &info) override;
+
+        /// Start collecting the Physiology Values of one simulation step into a single Physiology Frame.
+        /// Until EndPhysiologyFrame is called, WritePhysiologyValue adds every value to the frame, so
+        /// subscribers see every value of a step together.  The values are still published on Physiology
+        /// Value as well, unless diverted with SetDivertPhysiologyValues.
+        /// @note Not thread safe. Begin, write and end a frame from the thread stepping the simulation.
+        /// @param simulation_time Simulation time of the step.
+        /// @returns 0 if successful.
+        /// @returns 1 if Physiology Frame has no publisher or a frame is already open.
+        int BeginPhysiologyFrame(int64_t simulation_time);
+
+        /// Start collecting the Physiology Values of one simulation step into a single Physiology Frame.
+        /// @see BeginPhysiologyFrame(int64_t)
+        /// @param errmsg Error message output.
+        /// @param simulation_time Simulation time of the step.
+        /// @returns 0 if successful.
+        int BeginPhysiologyFrame(std::string &errmsg, int64_t simulation_time);
+
+        /// Publish the open Physiology Frame as one message and close it.
+        /// @returns 0 if successful.
+        /// @returns 1 if no frame is open or the write failed.
+        int EndPhysiologyFrame();
+
+        /// Publish the open Physiology Frame as one message and close it.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        int EndPhysiologyFrame(std::string &errmsg);
+
+        /// Choose whether values written while a Physiology Frame is open are published on Physiology Value.
+        /// Diverting them into the frame only sends far fewer messages, but modules that subscribe to
+        /// Physiology Value and not to Physiology Frame then receive nothing while frames are in use.
+        /// Off by default.
+        /// @param divert True to publish values of an open frame on Physiology Frame only.
+        void SetDivertPhysiologyValues(bool divert);
+
 
     }; // class DDSManager <>
 
 
-    inline DDSManager<void>::DDSManager(std::string configFile, std::string profileName) {
+    inline DDSManager<void>::DDSManager(
+       std::string configFile, std::string profileName, std::string manifestFile, std::string discoveryServer
+    ) {
         if (profileName.empty()) {
             profileName = defaultProfile;
         }
@@ -6563,8 +8280,36 @@ namespace AMM {
         try {
             if (!eprosima::fastrtps::Domain::loadXMLProfilesFile(configFile)) {
                 std::cout << "Unable to load XML file to create FastRTPS domain participant." << std::endl;
+            } else {
+                m_startup.Mark(StartupTimeline::PROFILE_LOADED);
+            }
+            std::string errmsg;
+            if (!manifestFile.empty() && !discoveryServer.empty()) {
+                errmsg = "A module manifest and a discovery server cannot be used together.";
+            } else if (manifestFile.empty() || StaticDiscovery::LoadManifest(manifestFile, m_manifest, errmsg) == 0) {
+                // Managers with the same profiles file, profile and discovery server share one participant.
+                // Static discovery assigns entity IDs per topic, so managers with a manifest never share.
+                const std::string key = manifestFile.empty() ? configFile + "|" + profileName + "|" + discoveryServer : "";
+                m_participant = ParticipantRegistry::Acquire(
+                   key, this, [&](eprosima::fastrtps::ParticipantListener *listener) -> eprosima::fastrtps::Participant * {
+                      if (!discoveryServer.empty()) {
+                         return DiscoveryServer::CreateClient(profileName, discoveryServer, listener, errmsg);
+                      }
+                      if (!manifestFile.empty()) {
+                         return StaticDiscovery::CreateParticipant(profileName, m_manifest, listener, errmsg);
+                      }
+                      eprosima::fastrtps::ParticipantAttributes attributes;
+                      if (eprosima::fastrtps::xmlparser::XMLProfileManager::fillParticipantAttributes(profileName, attributes) !=
+                          eprosima::fastrtps::xmlparser::XMLP_ret::XML_OK) {
+                         errmsg = "Unable to find participant profile " + profileName + ".";
+                         return nullptr;
+                      }
+                      PayloadCodec::Advertise(attributes.rtps.properties);
+                      return eprosima::fastrtps::Domain::createParticipant(attributes, listener);
+                   }
+                );
             }
-            m_participant = eprosima::fastrtps::Domain::createParticipant(profileName);
+            if (m_participant == nullptr && !errmsg.empty()) std::cout << errmsg << std::endl;
        } catch (std::exception &e) {
           std::cerr << e.what() << std::endl;
        }
@@ -6572,14 +8317,44 @@ namespace AMM {
           std::cout << "Unable to create FastRTPS domain participant." << std::endl;
           return;
        }
+       m_startup.Mark(StartupTimeline::PARTICIPANT_CREATED);
+       if (ParticipantRegistry::DiscoveredParticipants(m_participant) > 0) {
+           m_startup.Mark(StartupTimeline::PARTICIPANT_DISCOVERED);
+       }
 
        m_pubListener = new DDS_Listeners::PubListener();
+       m_pubListener->SetUpstream(this);
 
        m_moduleId = DDSManager::GenerateUuidString();
        m_moduleName = m_participant->getAttributes().rtps.getName();
 
     }
 
+    inline DDSManager<void>::~DDSManager() {
+       // Each handler removes the endpoints and type registration it still holds.
+       delete m_assessment;
+       delete m_eventFragment;
+       delete m_eventRecord;
+       delete m_fragmentAmendmentRequest;
+       delete m_log;
+       delete m_moduleConfiguration;
+       delete m_omittedEvent;
+       delete m_operationalDescription;
+       delete m_physiologyModification;
+       delete m_physiologyValue;
+       delete m_physiologyWaveform;
+       delete m_renderModification;
+       delete m_simulationControl;
+       delete m_status;
+       delete m_tick;
+       delete m_instrumentData;
+       delete m_command;
+       delete m_physiologyFrame;
+       delete m_pubListener;
+
+       if (m_participant != nullptr) ParticipantRegistry::Release(m_participant, this);
+    }
+
     inline void DDSManager<void>::Shutdown(std::string &errmsg) {
        int err = 0;
 
@@ -6603,35 +8378,325 @@ namespace AMM {
        if (DecommissionTick(localerrmsg) != 0) errmsg + localerrmsg + "\n";
        if (DecommissionInstrumentData(localerrmsg) != 0) errmsg + localerrmsg + "\n";
        if (DecommissionCommand(localerrmsg) != 0) errmsg + localerrmsg + "\n";
+       if (DecommissionPhysiologyFrame(localerrmsg) != 0) errmsg + localerrmsg + "\n";
+
+       // The participant stays while another manager uses it.
+       ParticipantRegistry::Release(m_participant, this);
+       m_participant = nullptr;
+       if (ParticipantRegistry::Empty()) eprosima::fastrtps::Domain::stopAll();
+    }
+
+    inline void DDSManager<void>::Shutdown() {
+       DecommissionAssessment();
+       DecommissionEventFragment();
+       DecommissionEventRecord();
+       DecommissionFragmentAmendmentRequest();
+       DecommissionLog();
+       DecommissionModuleConfiguration();
+       DecommissionOmittedEvent();
+       DecommissionOperationalDescription();
+       DecommissionPhysiologyModification();
+       DecommissionPhysiologyValue();
+       DecommissionPhysiologyWaveform();
+       DecommissionRenderModification();
+       DecommissionSimulationControl();
+       DecommissionStatus();
+       DecommissionTick();
+       DecommissionInstrumentData();
+       DecommissionCommand();
+       DecommissionPhysiologyFrame();
+
+       // The participant stays while another manager uses it.
+       ParticipantRegistry::Release(m_participant, this);
+       m_participant = nullptr;
+       if (ParticipantRegistry::Empty()) eprosima::fastrtps::Domain::stopAll();
+    }
+
+    inline std::string DDSManager<void>::GetModuleId() const {
+       return m_moduleId;
+    }
+
+    inline std::vector<EndpointMemory> DDSManager<void>::MemoryUsage() const {
+       std::vector<EndpointMemory> endpoints;
+       if (m_isAssessmentInit) m_assessment->AppendMemoryUsage(endpoints);
+       if (m_isEventFragInit) m_eventFragment->AppendMemoryUsage(endpoints);
+       if (m_isEventRecInit) m_eventRecord->AppendMemoryUsage(endpoints);
+       if (m_isFragAmendReqInit) m_fragmentAmendmentRequest->AppendMemoryUsage(endpoints);
+       if (m_isLogInit) m_log->AppendMemoryUsage(endpoints);
+       if (m_isModConfigInit) m_moduleConfiguration->AppendMemoryUsage(endpoints);
+       if (m_isOmitEventInit) m_omittedEvent->AppendMemoryUsage(endpoints);
+       if (m_isOpDescriptInit) m_operationalDescription->AppendMemoryUsage(endpoints);
+       if (m_isPhysModInit) m_physiologyModification->AppendMemoryUsage(endpoints);
+       if (m_isPhysValInit) m_physiologyValue->AppendMemoryUsage(endpoints);
+       if (m_isPhysWaveInit) m_physiologyWaveform->AppendMemoryUsage(endpoints);
+       if (m_isRendModInit) m_renderModification->AppendMemoryUsage(endpoints);
+       if (m_isSimControlInit) m_simulationControl->AppendMemoryUsage(endpoints);
+       if (m_isStatusInit) m_status->AppendMemoryUsage(endpoints);
+       if (m_isTickInit) m_tick->AppendMemoryUsage(endpoints);
+       if (m_isInstDataInit) m_instrumentData->AppendMemoryUsage(endpoints);
+       if (m_isCommandInit) m_command->AppendMemoryUsage(endpoints);
+       if (m_isPhysFrameInit) m_physiologyFrame->AppendMemoryUsage(endpoints);
+       return endpoints;
+    }
+
+    inline std::set<const void *> DDSManager<void>::Endpoints() const {
+       std::set<const void *> endpoints;
+       if (m_isAssessmentInit) m_assessment->AppendEndpoints(endpoints);
+       if (m_isEventFragInit) m_eventFragment->AppendEndpoints(endpoints);
+       if (m_isEventRecInit) m_eventRecord->AppendEndpoints(endpoints);
+       if (m_isFragAmendReqInit) m_fragmentAmendmentRequest->AppendEndpoints(endpoints);
+       if (m_isLogInit) m_log->AppendEndpoints(endpoints);
+       if (m_isModConfigInit) m_moduleConfiguration->AppendEndpoints(endpoints);
+       if (m_isOmitEventInit) m_omittedEvent->AppendEndpoints(endpoints);
+       if (m_isOpDescriptInit) m_operationalDescription->AppendEndpoints(endpoints);
+       if (m_isPhysModInit) m_physiologyModification->AppendEndpoints(endpoints);
+       if (m_isPhysValInit) m_physiologyValue->AppendEndpoints(endpoints);
+       if (m_isPhysWaveInit) m_physiologyWaveform->AppendEndpoints(endpoints);
+       if (m_isRendModInit) m_renderModification->AppendEndpoints(endpoints);
+       if (m_isSimControlInit) m_simulationControl->AppendEndpoints(endpoints);
+       if (m_isStatusInit) m_status->AppendEndpoints(endpoints);
+       if (m_isTickInit) m_tick->AppendEndpoints(endpoints);
+       if (m_isInstDataInit) m_instrumentData->AppendEndpoints(endpoints);
+       if (m_isCommandInit) m_command->AppendEndpoints(endpoints);
+       if (m_isPhysFrameInit) m_physiologyFrame->AppendEndpoints(endpoints);
+       return endpoints;
+    }
+
+    inline std::string DDSManager<void>::MemoryReport() const {
+       return TopicMemory::Format(MemoryUsage());
+    }
+
+    inline int DDSManager<void>::Setup(const std::vector<TopicSetup> &topics) {
+       std::string errmsg;
+       return Setup(errmsg, topics);
+    }
+
+    inline int DDSManager<void>::Setup(std::string &errmsg, const std::vector<TopicSetup> &topics) {
+       if (m_participant == nullptr) {
+          errmsg = "Domain participant was not created.";
+          return 1;
+       }
+
+       int err = 0;
+
+       // Output from each topic.
+       std::string localerrmsg;
+
+       // Endpoints that already exist are not waited for by ENDPOINTS_MATCHED.
+       const std::set<const void *> existing = Endpoints();
+
+       // Topics whose type failed to register are skipped by the endpoint passes.
+       std::vector<bool> registered(topics.size(), false);
+
+       for (std::size_t i = 0; i < topics.size(); ++i) {
+          if (SetupType(topics[i].topic, localerrmsg) != 0) {
+             errmsg += localerrmsg + "\n";
+             err = 1;
+          } else {
+             registered[i] = true;
+          }
+       }
+       m_startup.Mark(StartupTimeline::TYPES_REGISTERED);
+
+       for (std::size_t i = 0; i < topics.size(); ++i) {
+          if (!registered[i] || (topics[i].roles & TopicSetup::PUBLISH) == 0) continue;
+          if (SetupPublisher(topics[i].topic, localerrmsg) != 0) {
+             errmsg += localerrmsg + "\n";
+             err = 1;
+          }
+       }
+
+       for (std::size_t i = 0; i < topics.size(); ++i) {
+          if (!registered[i] || (topics[i].roles & TopicSetup::SUBSCRIBE) == 0) continue;
+          if (SetupSubscriber(topics[i].topic, localerrmsg) != 0) {
+             errmsg += localerrmsg + "\n";
+             err = 1;
+          }
+       }
+       m_startup.Mark(StartupTimeline::ENDPOINTS_CREATED);
 
-       eprosima::fastrtps::Domain::stopAll();
+       std::set<const void *> created;
+       const std::set<const void *> endpoints = Endpoints();
+       std::set_difference(
+          endpoints.begin(), endpoints.end(), existing.begin(), existing.end(), std::inserter(created, created.end())
+       );
+       m_startup.ExpectEndpoints(created);
+
+       return err;
+    }
+
+    inline int DDSManager<void>::SetupType(const std::string &topic, std::string &errmsg) {
+       if (topic == ASMT_STR) return InitializeAssessment(errmsg);
+       if (topic == EVFR_STR) return InitializeEventFragment(errmsg);
+       if (topic == EVRC_STR) return InitializeEventRecord(errmsg);
+       if (topic == FARQ_STR) return InitializeFragmentAmendmentRequest(errmsg);
+       if (topic == ALOG_STR) return InitializeLog(errmsg);
+       if (topic == MOCF_STR) return InitializeModuleConfiguration(errmsg);
+       if (topic == OMEV_STR) return InitializeOmittedEvent(errmsg);
+       if (topic == OPDS_STR) return InitializeOperationalDescription(errmsg);
+       if (topic == PHMO_STR) return InitializePhysiologyModification(errmsg);
+       if (topic == PHVA_STR) return InitializePhysiologyValue(errmsg);
+       if (topic == PHWV_STR) return InitializePhysiologyWaveform(errmsg);
+       if (topic == RDMO_STR) return InitializeRenderModification(errmsg);
+       if (topic == SMCN_STR) return InitializeSimulationControl(errmsg);
+       if (topic == STAT_STR) return InitializeStatus(errmsg);
+       if (topic == TICK_STR) return InitializeTick(errmsg);
+       if (topic == IDAT_STR) return InitializeInstrumentData(errmsg);
+       if (topic == CMND_STR) return InitializeCommand(errmsg);
+       if (topic == PHFR_STR) return InitializePhysiologyFrame(errmsg);
+
+       errmsg = "Unknown topic " + topic + ".";
+       return 1;
+    }
+
+    inline int DDSManager<void>::SetupPublisher(const std::string &topic, std::string &errmsg) {
+       if (topic == ASMT_STR) return CreateAssessmentPublisher(errmsg);
+       if (topic == EVFR_STR) return CreateEventFragmentPublisher(errmsg);
+       if (topic == EVRC_STR) return CreateEventRecordPublisher(errmsg);
+       if (topic == FARQ_STR) return CreateFragmentAmendmentRequestPublisher(errmsg);
+       if (topic == ALOG_STR) return CreateLogPublisher(errmsg);
+       if (topic == MOCF_STR) return CreateModuleConfigurationPublisher(errmsg);
+       if (topic == OMEV_STR) return CreateOmittedEventPublisher(errmsg);
+       if (topic == OPDS_STR) return CreateOperationalDescriptionPublisher(errmsg);
+       if (topic == PHMO_STR) return CreatePhysiologyModificationPublisher(errmsg);
+       if (topic == PHVA_STR) return CreatePhysiologyValuePublisher(errmsg);
+       if (topic == PHWV_STR) return CreatePhysiologyWaveformPublisher(errmsg);
+       if (topic == RDMO_STR) return CreateRenderModificationPublisher(errmsg);
+       if (topic == SMCN_STR) return CreateSimulationControlPublisher(errmsg);
+       if (topic == STAT_STR) return CreateStatusPublisher(errmsg);
+       if (topic == TICK_STR) return CreateTickPublisher(errmsg);
+       if (topic == IDAT_STR) return CreateInstrumentDataPublisher(errmsg);
+       if (topic == CMND_STR) return CreateCommandPublisher(errmsg);
+       if (topic == PHFR_STR) return CreatePhysiologyFramePublisher(errmsg);
+
+       errmsg = "Unknown topic " + topic + ".";
+       return 1;
+    }
+
+    inline int DDSManager<void>::SetupSubscriber(const std::string &topic, std::string &errmsg) {
+       if (topic == ASMT_STR) {
+          m_assessment->HoldUntilBound();
+          return m_assessment->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == EVFR_STR) {
+          m_eventFragment->HoldUntilBound();
+          return m_eventFragment->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == EVRC_STR) {
+          m_eventRecord->HoldUntilBound();
+          return m_eventRecord->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == FARQ_STR) {
+          m_fragmentAmendmentRequest->HoldUntilBound();
+          return m_fragmentAmendmentRequest->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == ALOG_STR) {
+          m_log->HoldUntilBound();
+          return m_log->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == MOCF_STR) {
+          m_moduleConfiguration->HoldUntilBound();
+          return m_moduleConfiguration->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == OMEV_STR) {
+          m_omittedEvent->HoldUntilBound();
+          return m_omittedEvent->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == OPDS_STR) {
+          m_operationalDescription->HoldUntilBound();
+          return m_operationalDescription->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == PHMO_STR) {
+          m_physiologyModification->HoldUntilBound();
+          return m_physiologyModification->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == PHVA_STR) {
+          m_physiologyValue->HoldUntilBound();
+          return m_physiologyValue->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == PHWV_STR) {
+          m_physiologyWaveform->HoldUntilBound();
+          return m_physiologyWaveform->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == RDMO_STR) {
+          m_renderModification->HoldUntilBound();
+          return m_renderModification->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == SMCN_STR) {
+          m_simulationControl->HoldUntilBound();
+          return m_simulationControl->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == STAT_STR) {
+          m_status->HoldUntilBound();
+          return m_status->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == TICK_STR) {
+          m_tick->HoldUntilBound();
+          return m_tick->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == IDAT_STR) {
+          m_instrumentData->HoldUntilBound();
+          return m_instrumentData->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == CMND_STR) {
+          m_command->HoldUntilBound();
+          return m_command->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+       if (topic == PHFR_STR) {
+          m_physiologyFrame->HoldUntilBound();
+          return m_physiologyFrame->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       }
+
+       errmsg = "Unknown topic " + topic + ".";
+       return 1;
+    }
+
+    inline const StartupTimeline &DDSManager<void>::Startup() const {
+       return m_startup;
+    }
+
+    inline std::string DDSManager<void>::StartupReport() const {
+       return m_startup.Format();
+    }
+
+    inline std::vector<TopicSetup> DDSManager<void>::ManifestTopics() const {
+       return StaticDiscovery::TopicsOf(m_manifest, m_moduleName);
+    }
+
+    inline void DDSManager<void>::onPublicationMatched(Publisher *pub, MatchingInfo &info) {
+       if (info.status == MATCHED_MATCHING) m_startup.EndpointMatched(pub);
+    }
+
+    inline void DDSManager<void>::onSubscriptionMatched(Subscriber *sub, MatchingInfo &info) {
+       if (info.status == MATCHED_MATCHING) m_startup.EndpointMatched(sub);
+    }
+
+    inline void DDSManager<void>::onLivelinessChanged(Subscriber *sub, const LivelinessChangedStatus &status) {
+       // Writers of other topics are unknown to the monitor, which ignores them.
+       ModuleHealthMonitor *monitor = m_statusHealthMonitor;
+       if (monitor != nullptr) monitor->OnLivelinessChanged(status);
+    }
+
+    inline void DDSManager<void>::onParticipantDiscovery(Participant *participant, ParticipantDiscoveryInfo &info) {
+       if (info.status == ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT) {
+          m_startup.Mark(StartupTimeline::PARTICIPANT_DISCOVERED);
+       }
+    }
+
+    inline std::string DDSManager<void>::GenerateUuidString() {
+       return UuidGenerator::GenerateString();
     }
 
-    inline void DDSManager<void>::Shutdown() {
-       DecommissionAssessment();
-       DecommissionEventFragment();
-       DecommissionEventRecord();
-       DecommissionFragmentAmendmentRequest();
-       DecommissionLog();
-       DecommissionModuleConfiguration();
-       DecommissionOmittedEvent();
-       DecommissionOperationalDescription();
-       DecommissionPhysiologyModification();
-       DecommissionPhysiologyValue();
-       DecommissionPhysiologyWaveform();
-       DecommissionRenderModification();
-       DecommissionSimulationControl();
-       DecommissionStatus();
-       DecommissionTick();
-       DecommissionInstrumentData();
-       DecommissionCommand();
+    inline void DDSManager<void>::GenerateUuids(std::size_t n, char *buffers, std::size_t stride) {
+       UuidGenerator::GenerateStrings(n, buffers, stride);
+    }
 
-       eprosima::fastrtps::Domain::stopAll();
+    inline BinaryUuid DDSManager<void>::ToBinaryUuid(const AMM::UUID &uuid) {
+       return BinaryUuid::FromUuid(uuid);
     }
 
-    inline std::string DDSManager<void>::GenerateUuidString() {
-       boost::uuids::uuid uuid = boost::uuids::random_generator()();
-       return boost::uuids::to_string(uuid);
+    inline AMM::UUID DDSManager<void>::ToUuid(const BinaryUuid &uuid) {
+       return uuid.ToUuid();
     }
 
 
@@ -6642,9 +8707,13 @@ namespace AMM {
        if (m_isAssessmentInit) return 0;
 
        int err = 0;
-       m_assessment = new AmmDataType<ASMT_TYPE, ASMT_LTNR, ASMT>(
-          err, ASMT_STR, m_participant, m_pubListener
-       );
+       if (m_assessment == nullptr) {
+          m_assessment = new AmmDataType<ASMT_TYPE, ASMT_LTNR, ASMT>(
+             err, ASMT_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_assessment->Reinitialize();
+       }
 
        if (err != 0) return 1;
 
@@ -6661,9 +8730,13 @@ namespace AMM {
        }
 
        int err = 0;
-       m_assessment = new AmmDataType<ASMT_TYPE, ASMT_LTNR, ASMT>(
-          err, errmsg, ASMT_STR, m_participant, m_pubListener
-       );
+       if (m_assessment == nullptr) {
+          m_assessment = new AmmDataType<ASMT_TYPE, ASMT_LTNR, ASMT>(
+             err, errmsg, ASMT_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_assessment->Reinitialize(errmsg);
+       }
 
        if (err != 0) return 1;
 
@@ -6782,9 +8855,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_eventFragment = new AmmDataType<EVFR_TYPE, EVFR_LTNR, EVFR>(
-          err, EVFR_STR, m_participant, m_pubListener
-       );
+       if (m_eventFragment == nullptr) {
+          m_eventFragment = new AmmDataType<EVFR_TYPE, EVFR_LTNR, EVFR>(
+             err, EVFR_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_eventFragment->Reinitialize();
+       }
 
        if (err == 0) m_isEventFragInit = true;
 
@@ -6800,9 +8877,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_eventFragment = new AmmDataType<EVFR_TYPE, EVFR_LTNR, EVFR>(
-          err, errmsg, EVFR_STR, m_participant, m_pubListener
-       );
+       if (m_eventFragment == nullptr) {
+          m_eventFragment = new AmmDataType<EVFR_TYPE, EVFR_LTNR, EVFR>(
+             err, errmsg, EVFR_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_eventFragment->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isEventFragInit = true;
 
@@ -6919,9 +9000,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_eventRecord = new AmmDataType<EVRC_TYPE, EVRC_LTNR, EVRC>(
-          err, EVRC_STR, m_participant, m_pubListener
-       );
+       if (m_eventRecord == nullptr) {
+          m_eventRecord = new AmmDataType<EVRC_TYPE, EVRC_LTNR, EVRC>(
+             err, EVRC_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_eventRecord->Reinitialize();
+       }
 
        if (err == 0) m_isEventRecInit = true;
 
@@ -6937,9 +9022,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_eventRecord = new AmmDataType<EVRC_TYPE, EVRC_LTNR, EVRC>(
-          err, errmsg, EVRC_STR, m_participant, m_pubListener
-       );
+       if (m_eventRecord == nullptr) {
+          m_eventRecord = new AmmDataType<EVRC_TYPE, EVRC_LTNR, EVRC>(
+             err, errmsg, EVRC_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_eventRecord->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isEventRecInit = true;
 
@@ -7056,9 +9145,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_fragmentAmendmentRequest = new AmmDataType<FARQ_TYPE, FARQ_LTNR, FARQ>(
-          err, FARQ_STR, m_participant, m_pubListener
-       );
+       if (m_fragmentAmendmentRequest == nullptr) {
+          m_fragmentAmendmentRequest = new AmmDataType<FARQ_TYPE, FARQ_LTNR, FARQ>(
+             err, FARQ_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_fragmentAmendmentRequest->Reinitialize();
+       }
 
        if (err == 0) m_isFragAmendReqInit = true;
 
@@ -7074,9 +9167,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_fragmentAmendmentRequest = new AmmDataType<FARQ_TYPE, FARQ_LTNR, FARQ>(
-          err, errmsg, FARQ_STR, m_participant, m_pubListener
-       );
+       if (m_fragmentAmendmentRequest == nullptr) {
+          m_fragmentAmendmentRequest = new AmmDataType<FARQ_TYPE, FARQ_LTNR, FARQ>(
+             err, errmsg, FARQ_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_fragmentAmendmentRequest->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isFragAmendReqInit = true;
 
@@ -7192,9 +9289,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_log = new AmmDataType<ALOG_TYPE, ALOG_LTNR, ALOG>(
-          err, ALOG_STR, m_participant, m_pubListener
-       );
+       if (m_log == nullptr) {
+          m_log = new AmmDataType<ALOG_TYPE, ALOG_LTNR, ALOG>(
+             err, ALOG_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_log->Reinitialize();
+       }
 
        if (err == 0) m_isLogInit = true;
 
@@ -7210,9 +9311,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_log = new AmmDataType<ALOG_TYPE, ALOG_LTNR, ALOG>(
-          err, errmsg, ALOG_STR, m_participant, m_pubListener
-       );
+       if (m_log == nullptr) {
+          m_log = new AmmDataType<ALOG_TYPE, ALOG_LTNR, ALOG>(
+             err, errmsg, ALOG_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_log->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isLogInit = true;
 
@@ -7251,14 +9356,14 @@ namespace AMM {
     }
 
     inline int DDSManager<void>::CreateLogSubscriber(
-       void (*onEvent)(AMM::Log &, eprosima::fastrtps::SampleInfo_t *)
+       void (*onEvent)(AMM::LogSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isLogInit) return 1;
        return m_log->CreateSubscriber((ListenerInterface *) this, onEvent);
     }
 
     inline int DDSManager<void>::CreateLogSubscriber(
-       std::string &errmsg, void (*onEvent)(AMM::Log &, eprosima::fastrtps::SampleInfo_t *)
+       std::string &errmsg, void (*onEvent)(AMM::LogSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isLogInit) {
           errmsg = "Log is not properly initialized.";
@@ -7280,12 +9385,12 @@ namespace AMM {
        return m_log->RemoveSubscriber(errmsg);
     }
 
-    inline int DDSManager<void>::WriteLog(AMM::Log &a) {
+    inline int DDSManager<void>::WriteLog(AMM::LogSample &a) {
        if (!m_isLogInit) return 1;
        return m_log->Write(a);
     }
 
-    inline int DDSManager<void>::WriteLog(std::string &errmsg, AMM::Log &a) {
+    inline int DDSManager<void>::WriteLog(std::string &errmsg, AMM::LogSample &a) {
        if (!m_isLogInit) {
           errmsg = "Log is not properly initialized.";
           return 1;
@@ -7294,7 +9399,7 @@ namespace AMM {
     }
 
     inline void DDSManager<void>::onNewLog(
-       AMM::Log log, eprosima::fastrtps::SampleInfo_t *info
+       AMM::LogSample log, eprosima::fastrtps::SampleInfo_t *info
     ) {
        m_log->OnEvent(log, info);
     }
@@ -7329,9 +9434,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_moduleConfiguration = new AmmDataType<MOCF_TYPE, MOCF_LTNR, MOCF>(
-          err, MOCF_STR, m_participant, m_pubListener
-       );
+       if (m_moduleConfiguration == nullptr) {
+          m_moduleConfiguration = new AmmDataType<MOCF_TYPE, MOCF_LTNR, MOCF>(
+             err, MOCF_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_moduleConfiguration->Reinitialize();
+       }
 
        if (err == 0) m_isModConfigInit = true;
 
@@ -7362,7 +9471,9 @@ namespace AMM {
 
     inline int DDSManager<void>::RemoveModuleConfigurationSubscriber() {
        if (!m_isModConfigInit) return 1;
-       return m_moduleConfiguration->RemoveSubscriber();
+       int err = m_moduleConfiguration->RemoveSubscriber();
+       if (err == 0) m_moduleConfigurationCache = nullptr;
+       return err;
     }
 
     inline int DDSManager<void>::WriteModuleConfiguration(AMM::ModuleConfiguration &a) {
@@ -7373,6 +9484,8 @@ namespace AMM {
     inline void DDSManager<void>::onNewModuleConfiguration(
        AMM::ModuleConfiguration modConfig, eprosima::fastrtps::SampleInfo_t *info
     ) {
+       ModuleConfigurationCache *cache = m_moduleConfigurationCache;
+       if (cache != nullptr) cache->OnModuleConfiguration(modConfig);
        m_moduleConfiguration->OnEvent(modConfig, info);
     }
 
@@ -7380,7 +9493,10 @@ namespace AMM {
        if (!m_isModConfigInit) return 0;
 
        int err = m_moduleConfiguration->Delete();
-       if (err == 0) m_isModConfigInit = false;
+       if (err == 0) {
+          m_isModConfigInit = false;
+          m_moduleConfigurationCache = nullptr;
+       }
 
        return err;
     }
@@ -7397,9 +9513,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_moduleConfiguration = new AmmDataType<MOCF_TYPE, MOCF_LTNR, MOCF>(
-          err, errmsg, MOCF_STR, m_participant, m_pubListener
-       );
+       if (m_moduleConfiguration == nullptr) {
+          m_moduleConfiguration = new AmmDataType<MOCF_TYPE, MOCF_LTNR, MOCF>(
+             err, errmsg, MOCF_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_moduleConfiguration->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isModConfigInit = true;
 
@@ -7432,12 +9552,37 @@ namespace AMM {
        return m_moduleConfiguration->CreateSubscriber(errmsg, (ListenerInterface *) this, onEvent);
     }
 
+    inline int DDSManager<void>::CreateModuleConfigurationSubscriber(ModuleConfigurationCache *cache) {
+       if (!m_isModConfigInit || cache == nullptr) return 1;
+       m_moduleConfigurationCache = cache;
+       int err = m_moduleConfiguration->CreateSubscriber((ListenerInterface *) this, nullptr);
+       if (err != 0) m_moduleConfigurationCache = nullptr;
+       return err;
+    }
+
+    inline int DDSManager<void>::CreateModuleConfigurationSubscriber(std::string &errmsg, ModuleConfigurationCache *cache) {
+       if (!m_isModConfigInit) {
+          errmsg = "Module Configuration is not properly initialized.";
+          return 1;
+       }
+       if (cache == nullptr) {
+          errmsg = "Module Configuration cache is null.";
+          return 1;
+       }
+       m_moduleConfigurationCache = cache;
+       int err = m_moduleConfiguration->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       if (err != 0) m_moduleConfigurationCache = nullptr;
+       return err;
+    }
+
     inline int DDSManager<void>::RemoveModuleConfigurationSubscriber(std::string &errmsg) {
        if (!m_isModConfigInit) {
           errmsg = "Module Configuration is not properly initialized.";
           return 1;
        }
-       return m_moduleConfiguration->RemoveSubscriber(errmsg);
+       int err = m_moduleConfiguration->RemoveSubscriber(errmsg);
+       if (err == 0) m_moduleConfigurationCache = nullptr;
+       return err;
     }
 
     inline int DDSManager<void>::WriteModuleConfiguration(std::string &errmsg, AMM::ModuleConfiguration &a) {
@@ -7455,7 +9600,10 @@ namespace AMM {
        }
 
        int err = m_moduleConfiguration->Delete(errmsg);
-       if (err == 0) m_isModConfigInit = false;
+       if (err == 0) {
+          m_isModConfigInit = false;
+          m_moduleConfigurationCache = nullptr;
+       }
 
        return err;
     }
@@ -7467,9 +9615,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_omittedEvent = new AmmDataType<OMEV_TYPE, OMEV_LTNR, OMEV>(
-          err, OMEV_STR, m_participant, m_pubListener
-       );
+       if (m_omittedEvent == nullptr) {
+          m_omittedEvent = new AmmDataType<OMEV_TYPE, OMEV_LTNR, OMEV>(
+             err, OMEV_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_omittedEvent->Reinitialize();
+       }
 
        if (err == 0) m_isOmitEventInit = true;
 
@@ -7485,9 +9637,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_omittedEvent = new AmmDataType<OMEV_TYPE, OMEV_LTNR, OMEV>(
-          err, errmsg, OMEV_STR, m_participant, m_pubListener
-       );
+       if (m_omittedEvent == nullptr) {
+          m_omittedEvent = new AmmDataType<OMEV_TYPE, OMEV_LTNR, OMEV>(
+             err, errmsg, OMEV_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_omittedEvent->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isOmitEventInit = true;
 
@@ -7604,9 +9760,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_operationalDescription = new AmmDataType<OPDS_TYPE, OPDS_LTNR, OPDS>(
-          err, OPDS_STR, m_participant, m_pubListener
-       );
+       if (m_operationalDescription == nullptr) {
+          m_operationalDescription = new AmmDataType<OPDS_TYPE, OPDS_LTNR, OPDS>(
+             err, OPDS_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_operationalDescription->Reinitialize();
+       }
 
        if (err == 0) m_isOpDescriptInit = true;
 
@@ -7622,9 +9782,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_operationalDescription = new AmmDataType<OPDS_TYPE, OPDS_LTNR, OPDS>(
-          err, errmsg, OPDS_STR, m_participant, m_pubListener
-       );
+       if (m_operationalDescription == nullptr) {
+          m_operationalDescription = new AmmDataType<OPDS_TYPE, OPDS_LTNR, OPDS>(
+             err, errmsg, OPDS_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_operationalDescription->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isOpDescriptInit = true;
 
@@ -7679,9 +9843,34 @@ namespace AMM {
        return m_operationalDescription->CreateSubscriber(errmsg, (ListenerInterface *) this, onEvent);
     }
 
+    inline int DDSManager<void>::CreateOperationalDescriptionSubscriber(ModuleHealthMonitor *monitor) {
+       if (!m_isOpDescriptInit || monitor == nullptr) return 1;
+       m_opDescriptHealthMonitor = monitor;
+       int err = m_operationalDescription->CreateSubscriber((ListenerInterface *) this, nullptr);
+       if (err != 0) m_opDescriptHealthMonitor = nullptr;
+       return err;
+    }
+
+    inline int DDSManager<void>::CreateOperationalDescriptionSubscriber(std::string &errmsg, ModuleHealthMonitor *monitor) {
+       if (!m_isOpDescriptInit) {
+          errmsg = "Operational Description is not properly initialized.";
+          return 1;
+       }
+       if (monitor == nullptr) {
+          errmsg = "Operational Description health monitor is null.";
+          return 1;
+       }
+       m_opDescriptHealthMonitor = monitor;
+       int err = m_operationalDescription->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       if (err != 0) m_opDescriptHealthMonitor = nullptr;
+       return err;
+    }
+
     inline int DDSManager<void>::RemoveOperationalDescriptionSubscriber() {
        if (!m_isOpDescriptInit) return 1;
-       return m_operationalDescription->RemoveSubscriber();
+       int err = m_operationalDescription->RemoveSubscriber();
+       if (err == 0) m_opDescriptHealthMonitor = nullptr;
+       return err;
     }
 
     inline int DDSManager<void>::RemoveOperationalDescriptionSubscriber(std::string &errmsg) {
@@ -7689,7 +9878,9 @@ namespace AMM {
           errmsg = "Operational Description is not properly initialized.";
           return 1;
        }
-       return m_operationalDescription->RemoveSubscriber(errmsg);
+       int err = m_operationalDescription->RemoveSubscriber(errmsg);
+       if (err == 0) m_opDescriptHealthMonitor = nullptr;
+       return err;
     }
 
     inline int DDSManager<void>::WriteOperationalDescription(AMM::OperationalDescription &a) {
@@ -7708,6 +9899,8 @@ namespace AMM {
     inline void DDSManager<void>::onNewOperationalDescription(
        AMM::OperationalDescription opDescript, eprosima::fastrtps::SampleInfo_t *info
     ) {
+       ModuleHealthMonitor *monitor = m_opDescriptHealthMonitor;
+       if (monitor != nullptr) monitor->OnOperationalDescription(opDescript);
        m_operationalDescription->OnEvent(opDescript, info);
     }
 
@@ -7715,7 +9908,10 @@ namespace AMM {
        if (!m_isOpDescriptInit) return 0;
 
        int err = m_operationalDescription->Delete();
-       if (err == 0) m_isOpDescriptInit = false;
+       if (err == 0) {
+          m_isOpDescriptInit = false;
+          m_opDescriptHealthMonitor = nullptr;
+       }
 
        return err;
     }
@@ -7727,7 +9923,10 @@ namespace AMM {
        }
 
        int err = m_operationalDescription->Delete(errmsg);
-       if (err == 0) m_isOpDescriptInit = false;
+       if (err == 0) {
+          m_isOpDescriptInit = false;
+          m_opDescriptHealthMonitor = nullptr;
+       }
 
        return err;
     }
@@ -7742,9 +9941,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_physiologyModification = new AmmDataType<PHMO_TYPE, PHMO_LTNR, PHMO>(
-          err, PHMO_STR, m_participant, m_pubListener
-       );
+       if (m_physiologyModification == nullptr) {
+          m_physiologyModification = new AmmDataType<PHMO_TYPE, PHMO_LTNR, PHMO>(
+             err, PHMO_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyModification->Reinitialize();
+       }
 
        if (err == 0) m_isPhysModInit = true;
 
@@ -7760,9 +9963,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_physiologyModification = new AmmDataType<PHMO_TYPE, PHMO_LTNR, PHMO>(
-          err, errmsg, PHMO_STR, m_participant, m_pubListener
-       );
+       if (m_physiologyModification == nullptr) {
+          m_physiologyModification = new AmmDataType<PHMO_TYPE, PHMO_LTNR, PHMO>(
+             err, errmsg, PHMO_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyModification->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isPhysModInit = true;
 
@@ -7878,9 +10085,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_physiologyValue = new AmmDataType<PHVA_TYPE, PHVA_LTNR, PHVA>(
-          err, PHVA_STR, m_participant, m_pubListener
-       );
+       if (m_physiologyValue == nullptr) {
+          m_physiologyValue = new AmmDataType<PHVA_TYPE, PHVA_LTNR, PHVA>(
+             err, PHVA_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyValue->Reinitialize();
+       }
 
        if (err == 0) m_isPhysValInit = true;
 
@@ -7896,9 +10107,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_physiologyValue = new AmmDataType<PHVA_TYPE, PHVA_LTNR, PHVA>(
-          err, errmsg, PHVA_STR, m_participant, m_pubListener
-       );
+       if (m_physiologyValue == nullptr) {
+          m_physiologyValue = new AmmDataType<PHVA_TYPE, PHVA_LTNR, PHVA>(
+             err, errmsg, PHVA_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyValue->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isPhysValInit = true;
 
@@ -7937,14 +10152,14 @@ namespace AMM {
     }
 
     inline int DDSManager<void>::CreatePhysiologyValueSubscriber(
-       void (*onEvent)(AMM::PhysiologyValue &, eprosima::fastrtps::SampleInfo_t *)
+       void (*onEvent)(AMM::PhysiologyValueSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isPhysValInit) return 1;
        return m_physiologyValue->CreateSubscriber((ListenerInterface *) this, onEvent);
     }
 
     inline int DDSManager<void>::CreatePhysiologyValueSubscriber(
-       std::string &errmsg, void (*onEvent)(AMM::PhysiologyValue &, eprosima::fastrtps::SampleInfo_t *)
+       std::string &errmsg, void (*onEvent)(AMM::PhysiologyValueSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isPhysValInit) {
           errmsg = "Physiology Value is not properly initialized.";
@@ -7966,12 +10181,20 @@ namespace AMM {
        return m_physiologyValue->RemoveSubscriber(errmsg);
     }
 
-    inline int DDSManager<void>::WritePhysiologyValue(AMM::PhysiologyValue &a) {
+    inline int DDSManager<void>::WritePhysiologyValue(AMM::PhysiologyValueSample &a) {
+       if (m_isPhysFrameOpen) {
+          AppendPhysiologyFrameValue(a);
+          if (m_divertPhysValues || !m_isPhysValInit) return 0;
+       }
        if (!m_isPhysValInit) return 1;
        return m_physiologyValue->Write(a);
     }
 
-    inline int DDSManager<void>::WritePhysiologyValue(std::string &errmsg, AMM::PhysiologyValue &a) {
+    inline int DDSManager<void>::WritePhysiologyValue(std::string &errmsg, AMM::PhysiologyValueSample &a) {
+       if (m_isPhysFrameOpen) {
+          AppendPhysiologyFrameValue(a);
+          if (m_divertPhysValues || !m_isPhysValInit) return 0;
+       }
        if (!m_isPhysValInit) {
           errmsg = "Physiology Value is not properly initialized.";
           return 1;
@@ -7980,7 +10203,7 @@ namespace AMM {
     }
 
     inline void DDSManager<void>::onNewPhysiologyValue(
-       AMM::PhysiologyValue physValue, eprosima::fastrtps::SampleInfo_t *info
+       AMM::PhysiologyValueSample physValue, eprosima::fastrtps::SampleInfo_t *info
     ) {
        m_physiologyValue->OnEvent(physValue, info);
     }
@@ -8015,9 +10238,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_physiologyWaveform = new AmmDataType<PHWV_TYPE, PHWV_LTNR, PHWV>(
-          err, PHWV_STR, m_participant, m_pubListener
-       );
+       if (m_physiologyWaveform == nullptr) {
+          m_physiologyWaveform = new AmmDataType<PHWV_TYPE, PHWV_LTNR, PHWV>(
+             err, PHWV_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyWaveform->Reinitialize();
+       }
 
        if (err == 0) m_isPhysWaveInit = true;
 
@@ -8033,9 +10260,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_physiologyWaveform = new AmmDataType<PHWV_TYPE, PHWV_LTNR, PHWV>(
-          err, errmsg, PHWV_STR, m_participant, m_pubListener
-       );
+       if (m_physiologyWaveform == nullptr) {
+          m_physiologyWaveform = new AmmDataType<PHWV_TYPE, PHWV_LTNR, PHWV>(
+             err, errmsg, PHWV_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyWaveform->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isPhysWaveInit = true;
 
@@ -8074,14 +10305,14 @@ namespace AMM {
     }
 
     inline int DDSManager<void>::CreatePhysiologyWaveformSubscriber(
-       void (*onEvent)(AMM::PhysiologyWaveform &, eprosima::fastrtps::SampleInfo_t *)
+       void (*onEvent)(AMM::PhysiologyWaveformSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isPhysWaveInit) return 1;
        return m_physiologyWaveform->CreateSubscriber((ListenerInterface *) this, onEvent);
     }
 
     inline int DDSManager<void>::CreatePhysiologyWaveformSubscriber(
-       std::string &errmsg, void (*onEvent)(AMM::PhysiologyWaveform &, eprosima::fastrtps::SampleInfo_t *)
+       std::string &errmsg, void (*onEvent)(AMM::PhysiologyWaveformSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isPhysWaveInit) {
           errmsg = "Physiology Waveform is not properly initialized.";
@@ -8103,12 +10334,12 @@ namespace AMM {
        return m_physiologyWaveform->RemoveSubscriber(errmsg);
     }
 
-    inline int DDSManager<void>::WritePhysiologyWaveform(AMM::PhysiologyWaveform &a) {
+    inline int DDSManager<void>::WritePhysiologyWaveform(AMM::PhysiologyWaveformSample &a) {
        if (!m_isPhysWaveInit) return 1;
        return m_physiologyWaveform->Write(a);
     }
 
-    inline int DDSManager<void>::WritePhysiologyWaveform(std::string &errmsg, AMM::PhysiologyWaveform &a) {
+    inline int DDSManager<void>::WritePhysiologyWaveform(std::string &errmsg, AMM::PhysiologyWaveformSample &a) {
        if (!m_isPhysWaveInit) {
           errmsg = "Physiology Waveform is not properly initialized.";
           return 1;
@@ -8117,7 +10348,7 @@ namespace AMM {
     }
 
     inline void DDSManager<void>::onNewPhysiologyWaveform(
-       AMM::PhysiologyWaveform physWave, eprosima::fastrtps::SampleInfo_t *info
+       AMM::PhysiologyWaveformSample physWave, eprosima::fastrtps::SampleInfo_t *info
     ) {
        m_physiologyWaveform->OnEvent(physWave, info);
     }
@@ -8152,9 +10383,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_renderModification = new AmmDataType<RDMO_TYPE, RDMO_LTNR, RDMO>(
-          err, RDMO_STR, m_participant, m_pubListener
-       );
+       if (m_renderModification == nullptr) {
+          m_renderModification = new AmmDataType<RDMO_TYPE, RDMO_LTNR, RDMO>(
+             err, RDMO_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_renderModification->Reinitialize();
+       }
 
        if (err == 0) m_isRendModInit = true;
 
@@ -8170,9 +10405,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_renderModification = new AmmDataType<RDMO_TYPE, RDMO_LTNR, RDMO>(
-          err, errmsg, RDMO_STR, m_participant, m_pubListener
-       );
+       if (m_renderModification == nullptr) {
+          m_renderModification = new AmmDataType<RDMO_TYPE, RDMO_LTNR, RDMO>(
+             err, errmsg, RDMO_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_renderModification->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isRendModInit = true;
 
@@ -8291,9 +10530,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_simulationControl = new AmmDataType<SMCN_TYPE, SMCN_LTNR, SMCN>(
-          err, SMCN_STR, m_participant, m_pubListener
-       );
+       if (m_simulationControl == nullptr) {
+          m_simulationControl = new AmmDataType<SMCN_TYPE, SMCN_LTNR, SMCN>(
+             err, SMCN_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_simulationControl->Reinitialize();
+       }
 
        if (err == 0) m_isSimControlInit = true;
 
@@ -8309,9 +10552,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_simulationControl = new AmmDataType<SMCN_TYPE, SMCN_LTNR, SMCN>(
-          err, errmsg, SMCN_STR, m_participant, m_pubListener
-       );
+       if (m_simulationControl == nullptr) {
+          m_simulationControl = new AmmDataType<SMCN_TYPE, SMCN_LTNR, SMCN>(
+             err, errmsg, SMCN_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_simulationControl->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isSimControlInit = true;
 
@@ -8423,9 +10670,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_status = new AmmDataType<STAT_TYPE, STAT_LTNR, STAT>(
-          err, STAT_STR, m_participant, m_pubListener
-       );
+       if (m_status == nullptr) {
+          m_status = new AmmDataType<STAT_TYPE, STAT_LTNR, STAT>(
+             err, STAT_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_status->Reinitialize();
+       }
 
        if (err == 0) m_isStatusInit = true;
 
@@ -8441,9 +10692,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_status = new AmmDataType<STAT_TYPE, STAT_LTNR, STAT>(
-          err, errmsg, STAT_STR, m_participant, m_pubListener
-       );
+       if (m_status == nullptr) {
+          m_status = new AmmDataType<STAT_TYPE, STAT_LTNR, STAT>(
+             err, errmsg, STAT_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_status->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isStatusInit = true;
 
@@ -8482,14 +10737,14 @@ namespace AMM {
     }
 
     inline int DDSManager<void>::CreateStatusSubscriber(
-       void (*onEvent)(AMM::Status &, eprosima::fastrtps::SampleInfo_t *)
+       void (*onEvent)(AMM::StatusSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isStatusInit) return 1;
        return m_status->CreateSubscriber((ListenerInterface *) this, onEvent);
     }
 
     inline int DDSManager<void>::CreateStatusSubscriber(
-       std::string &errmsg, void (*onEvent)(AMM::Status &, eprosima::fastrtps::SampleInfo_t *)
+       std::string &errmsg, void (*onEvent)(AMM::StatusSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isStatusInit) {
           errmsg = "Status is not properly initialized.";
@@ -8498,9 +10753,40 @@ namespace AMM {
        return m_status->CreateSubscriber(errmsg, (ListenerInterface *) this, onEvent);
     }
 
+    inline int DDSManager<void>::CreateStatusSubscriber(ModuleHealthMonitor *monitor) {
+       if (!m_isStatusInit || monitor == nullptr) return 1;
+       // A Subscriber created without the lease, e.g. by Setup, never reports lost writers.
+       if (!m_status->SubscriberRequestsLiveliness() && m_status->RemoveSubscriber() != 0) return 1;
+       m_status->RequestLivelinessLease(eprosima::fastrtps::Duration_t(1, 0));
+       m_statusHealthMonitor = monitor;
+       int err = m_status->CreateSubscriber((ListenerInterface *) this, nullptr);
+       if (err != 0) m_statusHealthMonitor = nullptr;
+       return err;
+    }
+
+    inline int DDSManager<void>::CreateStatusSubscriber(std::string &errmsg, ModuleHealthMonitor *monitor) {
+       if (!m_isStatusInit) {
+          errmsg = "Status is not properly initialized.";
+          return 1;
+       }
+       if (monitor == nullptr) {
+          errmsg = "Status health monitor is null.";
+          return 1;
+       }
+       // A Subscriber created without the lease, e.g. by Setup, never reports lost writers.
+       if (!m_status->SubscriberRequestsLiveliness() && m_status->RemoveSubscriber(errmsg) != 0) return 1;
+       m_status->RequestLivelinessLease(eprosima::fastrtps::Duration_t(1, 0));
+       m_statusHealthMonitor = monitor;
+       int err = m_status->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       if (err != 0) m_statusHealthMonitor = nullptr;
+       return err;
+    }
+
     inline int DDSManager<void>::RemoveStatusSubscriber() {
        if (!m_isStatusInit) return 1;
-       return m_status->RemoveSubscriber();
+       int err = m_status->RemoveSubscriber();
+       if (err == 0) m_statusHealthMonitor = nullptr;
+       return err;
     }
 
     inline int DDSManager<void>::RemoveStatusSubscriber(std::string &errmsg) {
@@ -8508,15 +10794,17 @@ namespace AMM {
           errmsg = "Status is not properly initialized.";
           return 1;
        }
-       return m_status->RemoveSubscriber(errmsg);
+       int err = m_status->RemoveSubscriber(errmsg);
+       if (err == 0) m_statusHealthMonitor = nullptr;
+       return err;
     }
 
-    inline int DDSManager<void>::WriteStatus(AMM::Status &a) {
+    inline int DDSManager<void>::WriteStatus(AMM::StatusSample &a) {
        if (!m_isStatusInit) return 1;
        return m_status->Write(a);
     }
 
-    inline int DDSManager<void>::WriteStatus(std::string &errmsg, AMM::Status &a) {
+    inline int DDSManager<void>::WriteStatus(std::string &errmsg, AMM::StatusSample &a) {
        if (!m_isStatusInit) {
           errmsg = "Status is not properly initialized.";
           return 1;
@@ -8525,8 +10813,10 @@ namespace AMM {
     }
 
     inline void DDSManager<void>::onNewStatus(
-       AMM::Status status, eprosima::fastrtps::SampleInfo_t *info
+       AMM::StatusSample status, eprosima::fastrtps::SampleInfo_t *info
     ) {
+       ModuleHealthMonitor *monitor = m_statusHealthMonitor;
+       if (monitor != nullptr) monitor->OnStatus(status, info);
        m_status->OnEvent(status, info);
     }
 
@@ -8534,7 +10824,10 @@ namespace AMM {
        if (!m_isStatusInit) return 0;
 
        int err = m_status->Delete();
-       if (err == 0) m_isStatusInit = false;
+       if (err == 0) {
+          m_isStatusInit = false;
+          m_statusHealthMonitor = nullptr;
+       }
 
        return err;
     }
@@ -8546,7 +10839,10 @@ namespace AMM {
        }
 
        int err = m_status->Delete(errmsg);
-       if (err == 0) m_isStatusInit = false;
+       if (err == 0) {
+          m_isStatusInit = false;
+          m_statusHealthMonitor = nullptr;
+       }
 
        return err;
     }
@@ -8560,9 +10856,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_tick = new AmmDataType<TICK_TYPE, TICK_LTNR, TICK>(
-          err, TICK_STR, m_participant, m_pubListener
-       );
+       if (m_tick == nullptr) {
+          m_tick = new AmmDataType<TICK_TYPE, TICK_LTNR, TICK>(
+             err, TICK_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_tick->Reinitialize();
+       }
 
        if (err == 0) m_isTickInit = true;
        return err;
@@ -8577,9 +10877,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_tick = new AmmDataType<TICK_TYPE, TICK_LTNR, TICK>(
-          err, errmsg, TICK_STR, m_participant, m_pubListener
-       );
+       if (m_tick == nullptr) {
+          m_tick = new AmmDataType<TICK_TYPE, TICK_LTNR, TICK>(
+             err, errmsg, TICK_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_tick->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isTickInit = true;
        return err;
@@ -8633,9 +10937,34 @@ namespace AMM {
        return m_tick->CreateSubscriber(errmsg, (ListenerInterface *) this, onEvent);
     }
 
+    inline int DDSManager<void>::CreateTickSubscriber(TickScheduler *scheduler) {
+       if (!m_isTickInit || scheduler == nullptr) return 1;
+       m_tickScheduler = scheduler;
+       int err = m_tick->CreateSubscriber((ListenerInterface *) this, nullptr);
+       if (err != 0) m_tickScheduler = nullptr;
+       return err;
+    }
+
+    inline int DDSManager<void>::CreateTickSubscriber(std::string &errmsg, TickScheduler *scheduler) {
+       if (!m_isTickInit) {
+          errmsg = "Tick is not properly initialized.";
+          return 1;
+       }
+       if (scheduler == nullptr) {
+          errmsg = "Tick scheduler is null.";
+          return 1;
+       }
+       m_tickScheduler = scheduler;
+       int err = m_tick->CreateSubscriber(errmsg, (ListenerInterface *) this, nullptr);
+       if (err != 0) m_tickScheduler = nullptr;
+       return err;
+    }
+
     inline int DDSManager<void>::RemoveTickSubscriber() {
        if (!m_isTickInit) return 1;
-       return m_tick->RemoveSubscriber();
+       int err = m_tick->RemoveSubscriber();
+       if (err == 0) m_tickScheduler = nullptr;
+       return err;
     }
 
     inline int DDSManager<void>::RemoveTickSubscriber(std::string &errmsg) {
@@ -8643,7 +10972,9 @@ namespace AMM {
           errmsg = "Tick is not properly initialized.";
           return 1;
        }
-       return m_tick->RemoveSubscriber(errmsg);
+       int err = m_tick->RemoveSubscriber(errmsg);
+       if (err == 0) m_tickScheduler = nullptr;
+       return err;
     }
 
     inline int DDSManager<void>::WriteTick(AMM::Tick &a) {
@@ -8662,6 +10993,8 @@ namespace AMM {
     inline void DDSManager<void>::onNewTick(
        AMM::Tick tick, eprosima::fastrtps::SampleInfo_t *info
     ) {
+       TickScheduler *scheduler = m_tickScheduler;
+       if (scheduler != nullptr) scheduler->OnTick(tick);
        m_tick->OnEvent(tick, info);
     }
 
@@ -8669,7 +11002,10 @@ namespace AMM {
        if (!m_isTickInit) return 0;
 
        int err = m_tick->Delete();
-       if (err == 0) m_isTickInit = false;
+       if (err == 0) {
+          m_isTickInit = false;
+          m_tickScheduler = nullptr;
+       }
 
        return err;
     }
@@ -8681,7 +11017,10 @@ namespace AMM {
        }
 
        int err = m_tick->Delete(errmsg);
-       if (err == 0) m_isTickInit = false;
+       if (err == 0) {
+          m_isTickInit = false;
+          m_tickScheduler = nullptr;
+       }
 
        return err;
     }
@@ -8695,9 +11034,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_instrumentData = new AmmDataType<IDAT_TYPE, IDAT_LTNR, IDAT>(
-          err, IDAT_STR, m_participant, m_pubListener
-       );
+       if (m_instrumentData == nullptr) {
+          m_instrumentData = new AmmDataType<IDAT_TYPE, IDAT_LTNR, IDAT>(
+             err, IDAT_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_instrumentData->Reinitialize();
+       }
 
        if (err == 0) m_isInstDataInit = true;
        return err;
@@ -8712,9 +11055,13 @@ namespace AMM {
 
        int err = 0;
 
-       m_instrumentData = new AmmDataType<IDAT_TYPE, IDAT_LTNR, IDAT>(
-          err, errmsg, IDAT_STR, m_participant, m_pubListener
-       );
+       if (m_instrumentData == nullptr) {
+          m_instrumentData = new AmmDataType<IDAT_TYPE, IDAT_LTNR, IDAT>(
+             err, errmsg, IDAT_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_instrumentData->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isInstDataInit = true;
        return err;
@@ -8829,9 +11176,13 @@ namespace AMM {
        if (m_isCommandInit) return 0;
 
        int err = 0;
-       m_command = new AmmDataType<CMND_TYPE, CMND_LTNR, CMND>(
-          err, CMND_STR, m_participant, m_pubListener
-       );
+       if (m_command == nullptr) {
+          m_command = new AmmDataType<CMND_TYPE, CMND_LTNR, CMND>(
+             err, CMND_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_command->Reinitialize();
+       }
 
        if (err == 0) m_isCommandInit = true;
        return err;
@@ -8845,9 +11196,13 @@ namespace AMM {
        }
 
        int err = 0;
-       m_command = new AmmDataType<CMND_TYPE, CMND_LTNR, CMND>(
-          err, errmsg, CMND_STR, m_participant, m_pubListener
-       );
+       if (m_command == nullptr) {
+          m_command = new AmmDataType<CMND_TYPE, CMND_LTNR, CMND>(
+             err, errmsg, CMND_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_command->Reinitialize(errmsg);
+       }
 
        if (err == 0) m_isCommandInit = true;
        return err;
@@ -8885,14 +11240,14 @@ namespace AMM {
     }
 
     inline int DDSManager<void>::CreateCommandSubscriber(
-       void (*onEvent)(AMM::Command &, eprosima::fastrtps::SampleInfo_t *)
+       void (*onEvent)(AMM::CommandSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isCommandInit) return 1;
        return m_command->CreateSubscriber((ListenerInterface *) this, onEvent);
     }
 
     inline int DDSManager<void>::CreateCommandSubscriber(
-       std::string &errmsg, void (*onEvent)(AMM::Command &, eprosima::fastrtps::SampleInfo_t *)
+       std::string &errmsg, void (*onEvent)(AMM::CommandSample &, eprosima::fastrtps::SampleInfo_t *)
     ) {
        if (!m_isCommandInit) {
           errmsg = "Command is not properly initialized.";
@@ -8914,12 +11269,12 @@ namespace AMM {
        return m_command->RemoveSubscriber(errmsg);
     }
 
-    inline int DDSManager<void>::WriteCommand(AMM::Command &a) {
+    inline int DDSManager<void>::WriteCommand(AMM::CommandSample &a) {
        if (!m_isCommandInit) return 1;
        return m_command->Write(a);
     }
 
-    inline int DDSManager<void>::WriteCommand(std::string &errmsg, AMM::Command &a) {
+    inline int DDSManager<void>::WriteCommand(std::string &errmsg, AMM::CommandSample &a) {
        if (!m_isCommandInit) {
           errmsg = "Command is not properly initialized.";
           return 1;
@@ -8928,7 +11283,7 @@ namespace AMM {
     }
 
     inline void DDSManager<void>::onNewCommand(
-       AMM::Command command, eprosima::fastrtps::SampleInfo_t *info
+       AMM::CommandSample command, eprosima::fastrtps::SampleInfo_t *info
     ) {
        m_command->OnEvent(command, info);
     }
@@ -8955,4 +11310,234 @@ namespace AMM {
     }
 
 
+// - - - Physiology Frame - - -
+
+    inline int DDSManager<void>::InitializePhysiologyFrame() {
+
+       if (m_isPhysFrameInit) return 0;
+
+       int err = 0;
+       if (m_physiologyFrame == nullptr) {
+          m_physiologyFrame = new AmmDataType<PHFR_TYPE, PHFR_LTNR, PHFR>(
+             err, PHFR_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyFrame->Reinitialize();
+       }
+
+       if (err == 0) m_isPhysFrameInit = true;
+       return err;
+    }
+
+    inline int DDSManager<void>::InitializePhysiologyFrame(std::string &errmsg) {
+
+       if (m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is already initialized.";
+          return 0;
+       }
+
+       int err = 0;
+       if (m_physiologyFrame == nullptr) {
+          m_physiologyFrame = new AmmDataType<PHFR_TYPE, PHFR_LTNR, PHFR>(
+             err, errmsg, PHFR_STR, m_participant, m_pubListener
+          );
+       } else {
+          err = m_physiologyFrame->Reinitialize(errmsg);
+       }
+
+       if (err == 0) m_isPhysFrameInit = true;
+       return err;
+    }
+
+    inline bool DDSManager<void>::IsPhysiologyFrameInitialized() {
+       if (m_isPhysFrameInit) return m_physiologyFrame->IsTypeRegistered();
+       return false;
+    }
+
+    inline int DDSManager<void>::CreatePhysiologyFramePublisher() {
+       if (!m_isPhysFrameInit) return 1;
+       return m_physiologyFrame->CreatePublisher();
+    }
+
+    inline int DDSManager<void>::CreatePhysiologyFramePublisher(std::string &errmsg) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is not properly initialized.";
+          return 1;
+       }
+       return m_physiologyFrame->CreatePublisher(errmsg);
+    }
+
+    inline int DDSManager<void>::RemovePhysiologyFramePublisher() {
+       if (!m_isPhysFrameInit) return 1;
+       return m_physiologyFrame->RemovePublisher();
+    }
+
+    inline int DDSManager<void>::RemovePhysiologyFramePublisher(std::string &errmsg) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is not properly initialized.";
+          return 1;
+       }
+       return m_physiologyFrame->RemovePublisher(errmsg);
+    }
+
+    inline int DDSManager<void>::CreatePhysiologyFrameSubscriber(
+       void (*onEvent)(AMM::PhysiologyFrame &, eprosima::fastrtps::SampleInfo_t *)
+    ) {
+       if (!m_isPhysFrameInit) return 1;
+       return m_physiologyFrame->CreateSubscriber((ListenerInterface *) this, onEvent);
+    }
+
+    inline int DDSManager<void>::CreatePhysiologyFrameSubscriber(
+       std::string &errmsg, void (*onEvent)(AMM::PhysiologyFrame &, eprosima::fastrtps::SampleInfo_t *)
+    ) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is not properly initialized.";
+          return 1;
+       }
+       return m_physiologyFrame->CreateSubscriber(errmsg, (ListenerInterface *) this, onEvent);
+    }
+
+    inline int DDSManager<void>::RemovePhysiologyFrameSubscriber() {
+       if (!m_isPhysFrameInit) return 1;
+       return m_physiologyFrame->RemoveSubscriber();
+    }
+
+    inline int DDSManager<void>::RemovePhysiologyFrameSubscriber(std::string &errmsg) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is not properly initialized.";
+          return 1;
+       }
+       return m_physiologyFrame->RemoveSubscriber(errmsg);
+    }
+
+    inline int DDSManager<void>::WritePhysiologyFrame(AMM::PhysiologyFrame &a) {
+       if (!m_isPhysFrameInit) return 1;
+       return m_physiologyFrame->Write(a);
+    }
+
+    inline int DDSManager<void>::WritePhysiologyFrame(std::string &errmsg, AMM::PhysiologyFrame &a) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is not properly initialized.";
+          return 1;
+       }
+       return m_physiologyFrame->Write(errmsg, a);
+    }
+
+    inline void DDSManager<void>::onNewPhysiologyFrame(
+       AMM::PhysiologyFrame physFrame, eprosima::fastrtps::SampleInfo_t *info
+    ) {
+       m_physiologyFrame->OnEvent(physFrame, info);
+    }
+
+    inline int DDSManager<void>::DecommissionPhysiologyFrame() {
+       if (!m_isPhysFrameInit) return 0;
+
+       // Values written after this go to Physiology Value alone, not into a frame nobody publishes.
+       m_isPhysFrameOpen = false;
+       int err = m_physiologyFrame->Delete();
+       if (err == 0) m_isPhysFrameInit = false;
+
+       return err;
+    }
+
+    inline int DDSManager<void>::DecommissionPhysiologyFrame(std::string &errmsg) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is already decommissioned.";
+          return 0;
+       }
+
+       m_isPhysFrameOpen = false;
+       int err = m_physiologyFrame->Delete(errmsg);
+       if (err == 0) m_isPhysFrameInit = false;
+
+       return err;
+    }
+
+    inline void DDSManager<void>::AppendPhysiologyFrameValue(const AMM::PhysiologyValueSample &a) {
+       std::vector<AMM::PhysiologyFrameEntry> &values = m_physFrame.values();
+       if (m_physFrameSize == values.size()) {
+          if (m_physFrameSpare.empty()) {
+             values.emplace_back();
+          } else {
+             values.push_back(std::move(m_physFrameSpare.back()));
+             m_physFrameSpare.pop_back();
+          }
+       }
+
+       AMM::PhysiologyFrameEntry &entry = values[m_physFrameSize++];
+       entry.name().assign(a.name().c_str(), a.name().size());
+       entry.value(a.value());
+
+       if (m_physFrameSize == 1) {
+          m_physFrame.educational_encounter().id().assign(
+             a.educational_encounter().id().c_str(), a.educational_encounter().id().size()
+          );
+       }
+    }
+
+    inline void DDSManager<void>::FinishPhysiologyFrame() {
+       // Entries left over from a larger previous frame are set aside rather than destroyed, so a
+       // frame that grows back reuses their string buffers.
+       std::vector<AMM::PhysiologyFrameEntry> &values = m_physFrame.values();
+       while (values.size() > m_physFrameSize) {
+          m_physFrameSpare.push_back(std::move(values.back()));
+          values.pop_back();
+       }
+       m_physFrame.timestamp(static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch()
+          ).count()
+       ));
+    }
+
+    inline int DDSManager<void>::BeginPhysiologyFrame(int64_t simulation_time) {
+       if (!m_isPhysFrameInit || !m_physiologyFrame->HasPublisher() || m_isPhysFrameOpen) return 1;
+
+       m_physFrame.simulation_time(simulation_time);
+       m_physFrame.educational_encounter().id().clear();
+       m_physFrameSize = 0;
+       m_isPhysFrameOpen = true;
+       return 0;
+    }
+
+    inline int DDSManager<void>::BeginPhysiologyFrame(std::string &errmsg, int64_t simulation_time) {
+       if (!m_isPhysFrameInit) {
+          errmsg = "Physiology Frame is not properly initialized.";
+          return 1;
+       }
+       if (!m_physiologyFrame->HasPublisher()) {
+          errmsg = "Physiology Frame has no publisher.";
+          return 1;
+       }
+       if (m_isPhysFrameOpen) {
+          errmsg = "Physiology Frame is already open.";
+          return 1;
+       }
+       return BeginPhysiologyFrame(simulation_time);
+    }
+
+    inline int DDSManager<void>::EndPhysiologyFrame() {
+       if (!m_isPhysFrameOpen) return 1;
+       m_isPhysFrameOpen = false;
+
+       FinishPhysiologyFrame();
+       return m_physiologyFrame->Write(m_physFrame);
+    }
+
+    inline int DDSManager<void>::EndPhysiologyFrame(std::string &errmsg) {
+       if (!m_isPhysFrameOpen) {
+          errmsg = "Physiology Frame is not open.";
+          return 1;
+       }
+       m_isPhysFrameOpen = false;
+
+       FinishPhysiologyFrame();
+       return m_physiologyFrame->Write(errmsg, m_physFrame);
+    }
+
+    inline void DDSManager<void>::SetDivertPhysiologyValues(bool divert) {
+       m_divertPhysValues = divert;
+    }
+
+
 } // namespace AMM
@@ -1,5 +1,7 @@
 #include "DDS_Listeners.h"
 
+#include "PayloadCodec.h"
+
 using namespace std;
 
 namespace AMM {
@@ -10,6 +12,16 @@ void DDS_Listeners::DefaultSubListener::onSubscriptionMatched(Subscriber *sub, M
    } else {
       n_matched--;
    }
+
+   if (upstream != nullptr) {
+      upstream->onSubscriptionMatched(sub, info);
+   }
+}
+
+void DDS_Listeners::DefaultSubListener::on_liveliness_changed(Subscriber *sub, const LivelinessChangedStatus &status) {
+   if (upstream != nullptr) {
+      upstream->onLivelinessChanged(sub, status);
+   }
 }
 
 void DDS_Listeners::DefaultSubListener::onNewDataMessage(Subscriber *sub) {}
@@ -40,7 +52,7 @@ void DDS_Listeners::InstrumentDataListener::onNewDataMessage(Subscriber *sub) {
 }
 
 void DDS_Listeners::CommandListener::onNewDataMessage(Subscriber *sub) {
-   AMM::Command a;
+   AMM::CommandSample a;
    if (sub->takeNextData(&a, &m_info)) {
       if (m_info.sampleKind == ALIVE) {
          if (upstream != nullptr) {
@@ -51,6 +63,19 @@ void DDS_Listeners::CommandListener::onNewDataMessage(Subscriber *sub) {
    }
 }
 
+void DDS_Listeners::PhysiologyFrameListener::onNewDataMessage(Subscriber *sub) {
+   AMM::PhysiologyFrame a;
+   if (sub->takeNextData(&a, &m_info)) {
+      if (m_info.sampleKind == ALIVE) {
+         if (upstream != nullptr) {
+            // A frame holds every value of a step, hand it over instead of copying it.
+            upstream->onNewPhysiologyFrame(std::move(a), &m_info);
+         }
+         ++n_msg;
+      }
+   }
+}
+
 void DDS_Listeners::AssessmentListener::onNewDataMessage(Subscriber *sub) {
    AMM::Assessment a;
    if (sub->takeNextData(&a, &m_info)) {
@@ -101,7 +126,7 @@ void DDS_Listeners::FragmentAmendmentRequestListener::onNewDataMessage(Subscribe
 }
 
 void DDS_Listeners::LogListener::onNewDataMessage(Subscriber *sub) {
-   AMM::Log l;
+   AMM::LogSample l;
    if (sub->takeNextData(&l, &m_info)) {
       if (m_info.sampleKind == ALIVE) {
          if (upstream != nullptr) {
@@ -149,7 +174,7 @@ void DDS_Listeners::OperationalDescriptionListener::onNewDataMessage(Subscriber
 }
 
 void DDS_Listeners::PhysiologyValueListener::onNewDataMessage(Subscriber *sub) {
-   AMM::PhysiologyValue pv;
+   AMM::PhysiologyValueSample pv;
    if (sub->takeNextData(&pv, &m_info)) {
       if (m_info.sampleKind == ALIVE) {
          if (upstream != nullptr) {
@@ -161,7 +186,7 @@ void DDS_Listeners::PhysiologyValueListener::onNewDataMessage(Subscriber *sub) {
 }
 
 void DDS_Listeners::PhysiologyWaveformListener::onNewDataMessage(Subscriber *sub) {
-   AMM::PhysiologyWaveform pw;
+   AMM::PhysiologyWaveformSample pw;
    if (sub->takeNextData(&pw, &m_info)) {
       if (m_info.sampleKind == ALIVE) {
          if (upstream != nullptr) {
@@ -185,7 +210,7 @@ void DDS_Listeners::SimulationControlListener::onNewDataMessage(Subscriber *sub)
 }
 
 void DDS_Listeners::StatusListener::onNewDataMessage(Subscriber *sub) {
-   AMM::Status st;
+   AMM::StatusSample st;
    if (sub->takeNextData(&st, &m_info)) {
       if (m_info.sampleKind == ALIVE) {
          if (upstream != nullptr) {
@@ -228,6 +253,28 @@ void DDS_Listeners::PubListener::onPublicationMatched(Publisher *pub, MatchingIn
    } else {
       n_matched--;
    }
+
+   if (upstream != nullptr) {
+      upstream->onPublicationMatched(pub, info);
+   }
+}
+
+void DDS_Listeners::ParticipantListener::onParticipantDiscovery(
+   Participant *participant, rtps::ParticipantDiscoveryInfo &&info
+) {
+   if (info.status == rtps::ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT) {
+      n_discovered++;
+   } else if (info.status == rtps::ParticipantDiscoveryInfo::REMOVED_PARTICIPANT ||
+              info.status == rtps::ParticipantDiscoveryInfo::DROPPED_PARTICIPANT) {
+      n_discovered--;
+   }
+   // Counted per local participant, so a peer seen by several of them is released by the last.
+   PayloadCodec::OnParticipantDiscovery(info);
+
+   std::lock_guard<std::mutex> lock(upstreamMutex);
+   for (ListenerInterface *upstream : upstreams) {
+      upstream->onParticipantDiscovery(participant, info);
+   }
 }
 
 } // namespace AMM
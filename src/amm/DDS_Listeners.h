@@ -1,5 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 #include <fastrtps/attributes/ParticipantAttributes.h>
 #include <fastrtps/participant/Participant.h>
 
@@ -51,6 +56,35 @@ public:
       ListenerInterface *upstream{};
    };
 
+   /// Listener for the Domain Participant.
+   ///
+   /// Passes participant discovery on to every upstream Listener Interface.
+   /// @note A participant shared by several DDS Managers has one listener with each manager upstream.
+   class ParticipantListener : public eprosima::fastrtps::ParticipantListener {
+   public:
+      ParticipantListener() : n_discovered(0) {};
+
+      ~ParticipantListener() override = default;
+
+      void onParticipantDiscovery(Participant *participant, rtps::ParticipantDiscoveryInfo &&info) override;
+
+      std::atomic<int> n_discovered;
+
+      void AddUpstream(ListenerInterface *l) {
+         std::lock_guard<std::mutex> lock(upstreamMutex);
+         upstreams.push_back(l);
+      };
+
+      void RemoveUpstream(ListenerInterface *l) {
+         std::lock_guard<std::mutex> lock(upstreamMutex);
+         upstreams.erase(std::remove(upstreams.begin(), upstreams.end(), l), upstreams.end());
+      };
+
+   private:
+      std::mutex upstreamMutex;
+      std::vector<ListenerInterface *> upstreams;
+   };
+
    /// Default listener for generic subscribers.
    ///
    /// @note Not very useful by it self. Used as a base class for other type-specifics listeners.
@@ -62,6 +96,8 @@ public:
 
       void onSubscriptionMatched(Subscriber *sub, MatchingInfo &info) override;
 
+      void on_liveliness_changed(Subscriber *sub, const LivelinessChangedStatus &status) override;
+
       void onNewDataMessage(Subscriber *sub) override;
 
       SampleInfo_t m_info;
@@ -174,6 +210,12 @@ public:
       void onNewDataMessage(Subscriber *sub) override;
    };
 
+   /// Listener for Physiology Frame data.
+   class PhysiologyFrameListener : public DefaultSubListener {
+   public:
+      void onNewDataMessage(Subscriber *sub) override;
+   };
+
 };
 
 } // namespace AMM
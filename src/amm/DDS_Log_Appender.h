@@ -3,74 +3,270 @@
 #include "DDSManager.h"
 
 #include <boost/algorithm/string.hpp>
+#include <plog/Appenders/AsyncAppender.h>
 #include <plog/Formatters/FuncMessageFormatter.h>
 #include <plog/Log.h>
 
+#include <algorithm>
+#include <chrono>
 #include <codecvt>
+#include <cstring>
+#include <iostream>
 #include <locale>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace plog {
 
 /**
  * Log appender for plog that allows us to push application logs onto the DDS bus on the AMM Log topic
  *
+ * The logging thread only copies the record into a lock-free queue and never blocks; records that do
+ * not fit are dropped and reported. A background thread then applies a token bucket per severity,
+ * collapses consecutive repeats of the same message and publishes the surviving records in batches.
+ *
  * @tparam Formatter
  */
     template<class Formatter>
     class DDS_Log_Appender : public IAppender {
     public:
-        explicit DDS_Log_Appender(AMM::DDSManager<void> *mgr)
-           : m_mgr(mgr) {
-           m_mgr->InitializeLog();
-           m_mgr->CreateLogPublisher();
+        /// Records held by the background thread before a batch is published.
+        static const size_t MAX_BATCH = 64;
+
+        explicit DDS_Log_Appender(AMM::DDSManager<void> *mgr, size_t queueCapacity = 4096)
+           : m_publisher(mgr) {
+           mgr->InitializeLog();
+           mgr->CreateLogPublisher();
+
+           m_queue.reset(new AsyncAppender(
+              &m_publisher, queueCapacity, overflowPolicy::kDrop, 1, [this] { m_publisher.Idle(); }
+           ));
+        }
+
+        /// Publishes everything still queued before returning.
+        ~DDS_Log_Appender() {
+           m_queue.reset();
+           m_publisher.Flush();
+        }
+
+        /**
+         * Limit the rate of published records of one severity.  Records over the limit are counted and
+         * reported in a single summary record.  Defaults: fatal and error unlimited, warning 50/s,
+         * info 20/s, debug 10/s and verbose 5/s, each with a burst of twice the rate.
+         * Call before the appender is added to a logger.
+         *
+         * @param severity
+         * @param perSecond Sustained rate, 0 for unlimited
+         * @param burst Records allowed at once after a quiet period
+         */
+        void SetRateLimit(Severity severity, double perSecond, double burst) {
+           m_publisher.SetRateLimit(severity, perSecond, burst);
+        }
+
+        /**
+         * Convert plog severities to AMM LogLevels
+         *
+         * @param severity
+         * @return
+         */
+        static AMM::LogLevel convert(Severity severity) {
+           switch (severity) {
+              case fatal:
+                 return AMM::L_FATAL;
+              case error:
+                 return AMM::L_ERROR;
+              case warning:
+                 return AMM::L_WARN;
+              case debug:
+                 return AMM::L_DEBUG;
+              case verbose:
+                 return AMM::L_TRACE;
+              default:
+                 return AMM::L_INFO;
+           }
         }
 
         /**
-         * Convert AMM LogLevels to strings
+         * Convert severity names to AMM LogLevels
          *
          * @param str
          * @return
          */
         AMM::LogLevel convert(const std::string &str) {
-           if (str == "FATAL") return AMM::L_FATAL;
-           else if (str == "ERROR") return AMM::L_ERROR;
-           else if (str == "WARNING") return AMM::L_WARN;
-           else if (str == "INFO")return AMM::L_INFO;
-           else if (str == "DEBUG")return AMM::L_DEBUG;
-           else if (str == "TRACE")return AMM::L_TRACE;
-
+           if (str == "TRACE") return AMM::L_TRACE;
+           return convert(plog::severityFromString(str.c_str()));
         }
 
         /**
-         * Write override to extract the message and log level and publish it to the DDS bus as an AMM Log message
+         * Write override that queues the record for publishing as an AMM Log message
          *
          * @param record
          */
         virtual void write(const Record &record) {
-           std::ostringstream message;
-           const char *cSeverity = plog::severityToString(record.getSeverity());
-           message << record.getMessage();
-           std::string severity = std::string(cSeverity);
-           const std::string &smessage = message.str();
-           const std::string &sseverity = severity;
-
-           if (boost::starts_with(smessage, "Serial debug:")) return;
-
-           try {
-              AMM::Log logInstance;
-              logInstance.level(convert(severity));
-              logInstance.message(smessage);
-              m_mgr->WriteLog(logInstance);
-           }
-           catch (std::exception &e) {
-              LOG_ERROR << e.what();
-           }
+           m_queue->write(record);
         }
 
     private:
-        // DDSManager pointer
-        AMM::DDSManager<void> *m_mgr;
+        /// Runs on the queue's consumer thread only.
+        class Publisher : public IAppender {
+        public:
+            explicit Publisher(AMM::DDSManager<void> *mgr) : m_mgr(mgr) {
+               m_moduleId.id() = mgr->GetModuleId();
+
+               const double rates[] = {0.0, 0.0, 0.0, 50.0, 20.0, 10.0, 5.0};
+               for (int s = none; s <= verbose; ++s) {
+                  m_buckets[s].rate = rates[s];
+                  m_buckets[s].burst = rates[s] * 2;
+                  m_buckets[s].tokens = m_buckets[s].burst;
+                  m_buckets[s].suppressed = 0;
+               }
+               m_last = std::chrono::steady_clock::now();
+               m_batchStart = m_last;
+               m_batch.reserve(MAX_BATCH);
+            }
+
+            void SetRateLimit(Severity severity, double perSecond, double burst) {
+               Bucket &b = m_buckets[severity];
+               b.rate = perSecond;
+               b.burst = (std::max)(burst, 1.0);
+               b.tokens = b.burst;
+            }
+
+            virtual void write(const Record &record) {
+               const char *message = record.getMessage();
+               if (boost::starts_with(message, "Serial debug:")) return;
+
+               const Severity severity = record.getSeverity();
+
+               // Consecutive repeats are folded into the pending record and do not use tokens.
+               if (m_hasPending && m_pendingSeverity == severity && std::strcmp(m_pending.message().c_str(), message) == 0) {
+                  ++m_repeats;
+                  return;
+               }
+
+               const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+               Refill(now);
+
+               Bucket &b = m_buckets[severity];
+               if (b.rate > 0.0) {
+                  if (b.tokens < 1.0) {
+                     ++b.suppressed;
+                     return;
+                  }
+                  b.tokens -= 1.0;
+               }
+
+               ClosePending();
+
+               const util::Time &t = record.getTime();
+               m_pending.timestamp(static_cast<uint64_t>(t.time) * 1000 + t.millitm);
+               m_pending.module_id(m_moduleId);
+               m_pending.level(convert(severity));
+               m_pending.message() = message;
+               m_pendingSeverity = severity;
+               m_hasPending = true;
+               m_repeats = 0;
+
+               if (m_batch.size() + 1 >= MAX_BATCH || now - m_batchStart >= BATCH_INTERVAL) Flush();
+            }
+
+            /// Queue drained, publish whatever has been waiting long enough.
+            void Idle() {
+               if ((m_hasPending || !m_batch.empty()) &&
+                   std::chrono::steady_clock::now() - m_batchStart >= BATCH_INTERVAL) {
+                  Flush();
+               }
+            }
+
+            void Flush() {
+               ClosePending();
+               ReportSuppressed();
+
+               for (AMM::LogSample &log : m_batch) {
+                  try {
+                     m_mgr->WriteLog(log);
+                  } catch (std::exception &e) {
+                     // Logging here would feed back into this appender.
+                     std::cerr << e.what() << std::endl;
+                  }
+               }
+               m_batch.clear();
+               m_batchStart = std::chrono::steady_clock::now();
+            }
+
+        private:
+            struct Bucket {
+                double rate;
+                double burst;
+                double tokens;
+                size_t suppressed;
+            };
+
+            /// Longest a record waits in a batch.
+            static constexpr std::chrono::milliseconds BATCH_INTERVAL{100};
+
+            void Refill(std::chrono::steady_clock::time_point now) {
+               const double elapsed = std::chrono::duration<double>(now - m_last).count();
+               m_last = now;
+               for (Bucket &b : m_buckets) {
+                  if (b.rate > 0.0) b.tokens = (std::min)(b.burst, b.tokens + elapsed * b.rate);
+               }
+            }
+
+            void ClosePending() {
+               if (!m_hasPending) return;
+               if (m_repeats > 0) {
+                  std::string message(m_pending.message().c_str(), m_pending.message().size());
+                  message += " (repeated " + std::to_string(m_repeats) + " more times)";
+                  m_pending.message() = message;
+               }
+               m_batch.push_back(m_pending);
+               m_hasPending = false;
+            }
+
+            void ReportSuppressed() {
+               size_t total = 0;
+               std::string detail;
+               for (int s = fatal; s <= verbose; ++s) {
+                  if (m_buckets[s].suppressed == 0) continue;
+                  total += m_buckets[s].suppressed;
+                  if (!detail.empty()) detail += ", ";
+                  detail += std::to_string(m_buckets[s].suppressed) + " " + severityToString(static_cast<Severity>(s));
+                  m_buckets[s].suppressed = 0;
+               }
+               if (total == 0) return;
+
+               AMM::LogSample log;
+               log.timestamp(static_cast<uint64_t>(
+                  std::chrono::duration_cast<std::chrono::milliseconds>(
+                     std::chrono::system_clock::now().time_since_epoch()
+                  ).count()
+               ));
+               log.module_id(m_moduleId);
+               log.level(AMM::L_WARN);
+               log.message() = "Rate limit suppressed " + std::to_string(total) + " log records (" + detail + ")";
+               m_batch.push_back(log);
+            }
+
+            AMM::DDSManager<void> *m_mgr;
+            AMM::UUIDSample m_moduleId;
+            Bucket m_buckets[verbose + 1];
+            std::chrono::steady_clock::time_point m_last;
+            std::chrono::steady_clock::time_point m_batchStart;
+            std::vector<AMM::LogSample> m_batch;
+            AMM::LogSample m_pending;
+            Severity m_pendingSeverity = none;
+            bool m_hasPending = false;
+            size_t m_repeats = 0;
+        };
+
+        Publisher m_publisher;
+
+        std::unique_ptr<AsyncAppender> m_queue;
     };
 
+    template<class Formatter>
+    constexpr std::chrono::milliseconds DDS_Log_Appender<Formatter>::Publisher::BATCH_INTERVAL;
+
 } // namepace plog
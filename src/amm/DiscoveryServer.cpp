@@ -0,0 +1,120 @@
+#include "DiscoveryServer.h"
+
+#include <cstdlib>
+
+#include <fastrtps/Domain.h>
+#include <fastrtps/rtps/attributes/ServerAttributes.h>
+#include <fastrtps/rtps/common/Locator.h>
+#include <fastrtps/utils/IPLocator.h>
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
+#include "PayloadCodec.h"
+
+namespace AMM {
+
+   namespace {
+
+      int makeLocator(
+         const std::string &address, eprosima::fastrtps::rtps::Locator_t &locator, std::string &errmsg
+      ) {
+         std::string host;
+         uint16_t port;
+         if (DiscoveryServer::ParseAddress(address, host, port, errmsg) != 0) return 1;
+
+         if (!eprosima::fastrtps::rtps::IPLocator::setIPv4(locator, host)) {
+            errmsg = "Invalid discovery server address " + address + ".";
+            return 1;
+         }
+         locator.port = port;
+         return 0;
+      }
+
+   } // namespace
+
+   constexpr uint16_t DiscoveryServer::DEFAULT_PORT;
+   constexpr const char *DiscoveryServer::GUID_PREFIX;
+   constexpr const char *DiscoveryServer::PARTICIPANT_NAME;
+
+   int DiscoveryServer::ParseAddress(const std::string &address, std::string &host, uint16_t &port, std::string &errmsg) {
+      const std::string::size_type colon = address.rfind(':');
+      host = address.substr(0, colon);
+      port = DEFAULT_PORT;
+
+      if (colon != std::string::npos) {
+         const std::string digits = address.substr(colon + 1);
+         char *end = nullptr;
+         const unsigned long value = std::strtoul(digits.c_str(), &end, 10);
+         if (digits.empty() || *end != '\0' || value == 0 || value > 65535) {
+            errmsg = "Invalid discovery server port in " + address + ".";
+            return 1;
+         }
+         port = static_cast<uint16_t>(value);
+      }
+
+      if (host == "localhost") host = "127.0.0.1";
+      if (!eprosima::fastrtps::rtps::IPLocator::isIPv4(host)) {
+         errmsg = "Discovery server address " + address + " is not an IPv4 address.";
+         return 1;
+      }
+      return 0;
+   }
+
+   eprosima::fastrtps::Participant *DiscoveryServer::CreateClient(
+      const std::string &profileName, const std::string &address,
+      eprosima::fastrtps::ParticipantListener *listener, std::string &errmsg
+   ) {
+      eprosima::fastrtps::ParticipantAttributes attributes;
+      if (eprosima::fastrtps::xmlparser::XMLProfileManager::fillParticipantAttributes(profileName, attributes) !=
+          eprosima::fastrtps::xmlparser::XMLP_ret::XML_OK) {
+         errmsg = "Unable to find participant profile " + profileName + ".";
+         return nullptr;
+      }
+
+      eprosima::fastrtps::rtps::RemoteServerAttributes server;
+      server.ReadguidPrefix(GUID_PREFIX);
+      eprosima::fastrtps::rtps::Locator_t locator;
+      if (makeLocator(address, locator, errmsg) != 0) return nullptr;
+      server.metatrafficUnicastLocatorList.push_back(locator);
+
+      attributes.rtps.builtin.discovery_config.discoveryProtocol = eprosima::fastrtps::rtps::DiscoveryProtocol_t::CLIENT;
+      attributes.rtps.builtin.discovery_config.m_DiscoveryServers.clear();
+      attributes.rtps.builtin.discovery_config.m_DiscoveryServers.push_back(server);
+
+      PayloadCodec::Advertise(attributes.rtps.properties);
+
+      eprosima::fastrtps::Participant *participant =
+         eprosima::fastrtps::Domain::createParticipant(attributes, listener);
+      if (participant == nullptr) errmsg = "Unable to create FastRTPS domain participant as a discovery client.";
+      return participant;
+   }
+
+   eprosima::fastrtps::Participant *DiscoveryServer::CreateServer(
+      const std::string &address, uint32_t domainId,
+      eprosima::fastrtps::ParticipantListener *listener, std::string &errmsg
+   ) {
+      eprosima::fastrtps::ParticipantAttributes attributes;
+      eprosima::fastrtps::Domain::getDefaultParticipantAttributes(attributes);
+
+      eprosima::fastrtps::rtps::Locator_t locator;
+      if (makeLocator(address, locator, errmsg) != 0) return nullptr;
+
+      // Take the prefix the clients are configured with.
+      eprosima::fastrtps::rtps::RemoteServerAttributes self;
+      self.ReadguidPrefix(GUID_PREFIX);
+
+      attributes.domainId = domainId;
+      attributes.rtps.setName(PARTICIPANT_NAME);
+      attributes.rtps.prefix = self.guidPrefix;
+      attributes.rtps.builtin.discovery_config.discoveryProtocol = eprosima::fastrtps::rtps::DiscoveryProtocol_t::SERVER;
+      attributes.rtps.builtin.metatrafficUnicastLocatorList.push_back(locator);
+
+      // The server reads no samples, it must not keep its clients from compressing.
+      PayloadCodec::Advertise(attributes.rtps.properties);
+
+      eprosima::fastrtps::Participant *participant =
+         eprosima::fastrtps::Domain::createParticipant(attributes, listener);
+      if (participant == nullptr) errmsg = "Unable to create discovery server participant on " + address + ".";
+      return participant;
+   }
+
+} // namespace AMM
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <fastrtps/attributes/ParticipantAttributes.h>
+#include <fastrtps/participant/Participant.h>
+#include <fastrtps/participant/ParticipantListener.h>
+
+namespace AMM {
+
+    /// Discovery server mode for networks with many modules.
+    ///
+    /// With simple discovery every participant multicasts its announcements to every other one, so
+    /// discovery traffic grows with the square of the number of participants; a lab with several
+    /// manikins floods the segment.  In discovery server mode every module is a client that only talks
+    /// to one server, amm_discovery_server, which forwards each client the participants and endpoints it
+    /// needs.  Traffic then grows linearly with the number of participants and needs no multicast.
+    ///
+    /// Start the server on the lab host, then give each module its address through the DDSManager
+    /// constructor:
+    /// @code
+    /// amm_discovery_server --listen 0.0.0.0:11811
+    /// auto *mgr = new DDSManager<Module>(config, "", "", "192.168.1.10:11811");
+    /// @endcode
+    class DiscoveryServer {
+
+    public:
+        /// Port of the server if an address has none.
+        static constexpr uint16_t DEFAULT_PORT = 11811;
+
+        /// GUID prefix of the server, which clients need along with its address.
+        ///
+        /// eProsima's default prefix for discovery server 0, the one `fastdds discovery -i 0` uses, so
+        /// that server can stand in for amm_discovery_server.  Two servers on one network need
+        /// different prefixes.
+        static constexpr const char *GUID_PREFIX = "44.53.00.5f.45.50.52.4f.53.49.4d.41";
+
+        /// Participant name of the server.
+        static constexpr const char *PARTICIPANT_NAME = "amm_discovery_server";
+
+        /// Split "host[:port]" into an IPv4 address and port.  "localhost" is 127.0.0.1.
+        /// @param address Address text.
+        /// @param host IPv4 address output.
+        /// @param port Port output, DEFAULT_PORT if the address has none.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        static int ParseAddress(const std::string &address, std::string &host, uint16_t &port, std::string &errmsg);
+
+        /// Create a participant from an XML profile, switched to a client of a discovery server.
+        /// @param profileName Participant profile, already loaded.
+        /// @param address Server address, "host[:port]".
+        /// @param listener Participant listener, may be null.
+        /// @param errmsg Error message output.
+        /// @returns Participant, or null on error.
+        static eprosima::fastrtps::Participant *CreateClient(
+           const std::string &profileName, const std::string &address,
+           eprosima::fastrtps::ParticipantListener *listener, std::string &errmsg
+        );
+
+        /// Create the discovery server participant.
+        /// @param address Address to listen on, "host[:port]".
+        /// @param domainId Domain of the modules.
+        /// @param listener Participant listener, may be null.
+        /// @param errmsg Error message output.
+        /// @returns Participant, or null on error.
+        static eprosima::fastrtps::Participant *CreateServer(
+           const std::string &address, uint32_t domainId,
+           eprosima::fastrtps::ParticipantListener *listener, std::string &errmsg
+        );
+
+    }; // class DiscoveryServer
+
+} // namespace AMM
@@ -0,0 +1,473 @@
+#include "Json.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace AMM {
+
+   namespace {
+
+      const char DIGIT_PAIRS[] =
+         "00010203040506070809"
+         "10111213141516171819"
+         "20212223242526272829"
+         "30313233343536373839"
+         "40414243444546474849"
+         "50515253545556575859"
+         "60616263646566676869"
+         "70717273747576777879"
+         "80818283848586878889"
+         "90919293949596979899";
+
+      /// Characters that need escaping in a JSON string.
+      inline bool NeedsEscape(unsigned char c) {
+         return c < 0x20 || c == '"' || c == '\\';
+      }
+
+      /// Nesting limit for skipped values, guards the recursion against hostile input.
+      const unsigned MAX_DEPTH = 64;
+
+   } // namespace
+
+   void JsonWriter::Clear() {
+      m_buffer.clear();
+      m_hasElement = 0;
+      m_depth = 0;
+      m_afterKey = false;
+   }
+
+   void JsonWriter::Separate() {
+      if (m_afterKey) {
+         m_afterKey = false;
+         return;
+      }
+      const uint64_t bit = uint64_t(1) << (m_depth & 63);
+      if (m_depth > 0 && (m_hasElement & bit)) m_buffer.push_back(',');
+      m_hasElement |= bit;
+   }
+
+   void JsonWriter::BeginObject() {
+      Separate();
+      m_buffer.push_back('{');
+      ++m_depth;
+      m_hasElement &= ~(uint64_t(1) << (m_depth & 63));
+   }
+
+   void JsonWriter::EndObject() {
+      m_buffer.push_back('}');
+      --m_depth;
+   }
+
+   void JsonWriter::BeginArray() {
+      Separate();
+      m_buffer.push_back('[');
+      ++m_depth;
+      m_hasElement &= ~(uint64_t(1) << (m_depth & 63));
+   }
+
+   void JsonWriter::EndArray() {
+      m_buffer.push_back(']');
+      --m_depth;
+   }
+
+   void JsonWriter::Key(View name) {
+      Value(name);
+      m_buffer.push_back(':');
+      m_afterKey = true;
+   }
+
+   void JsonWriter::Null() {
+      Separate();
+      m_buffer.append("null", 4);
+   }
+
+   void JsonWriter::Value(bool value) {
+      Separate();
+      if (value) {
+         m_buffer.append("true", 4);
+      } else {
+         m_buffer.append("false", 5);
+      }
+   }
+
+   void JsonWriter::Value(View value) {
+      static const char HEX[] = "0123456789abcdef";
+
+      Separate();
+      m_buffer.push_back('"');
+
+      // Copy runs of plain characters at once.
+      size_t start = 0;
+      for (size_t i = 0; i < value.size(); ++i) {
+         const unsigned char c = static_cast<unsigned char>(value[i]);
+         if (!NeedsEscape(c)) continue;
+
+         m_buffer.append(value.data() + start, i - start);
+         start = i + 1;
+         switch (c) {
+            case '"':
+               m_buffer.append("\\\"", 2);
+               break;
+            case '\\':
+               m_buffer.append("\\\\", 2);
+               break;
+            case '\n':
+               m_buffer.append("\\n", 2);
+               break;
+            case '\r':
+               m_buffer.append("\\r", 2);
+               break;
+            case '\t':
+               m_buffer.append("\\t", 2);
+               break;
+            default: {
+               const char escape[6] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xf]};
+               m_buffer.append(escape, 6);
+               break;
+            }
+         }
+      }
+      m_buffer.append(value.data() + start, value.size() - start);
+      m_buffer.push_back('"');
+   }
+
+   void JsonWriter::AppendInt(int64_t value) {
+      if (value < 0) {
+         m_buffer.push_back('-');
+         AppendUInt(0 - static_cast<uint64_t>(value));
+      } else {
+         AppendUInt(static_cast<uint64_t>(value));
+      }
+   }
+
+   void JsonWriter::AppendUInt(uint64_t value) {
+      char digits[20];
+      char *p = digits + sizeof(digits);
+
+      while (value >= 100) {
+         const unsigned pair = static_cast<unsigned>(value % 100) * 2;
+         value /= 100;
+         *--p = DIGIT_PAIRS[pair + 1];
+         *--p = DIGIT_PAIRS[pair];
+      }
+      if (value >= 10) {
+         const unsigned pair = static_cast<unsigned>(value) * 2;
+         *--p = DIGIT_PAIRS[pair + 1];
+         *--p = DIGIT_PAIRS[pair];
+      } else {
+         *--p = static_cast<char>('0' + value);
+      }
+      m_buffer.append(p, digits + sizeof(digits) - p);
+   }
+
+   void JsonWriter::AppendReal(double value, bool single) {
+      Separate();
+      if (!std::isfinite(value)) {
+         m_buffer.append("null", 4);
+         return;
+      }
+
+      // Integral values are common (timestamps, counters) and take the integer path.
+      if (value == std::floor(value) && std::fabs(value) < 1e15) {
+         AppendInt(static_cast<int64_t>(value));
+         return;
+      }
+
+      // Values with a few decimals, the bulk of physiology data, are printed from a scaled integer.
+      // r / 10^k is correctly rounded, so when it equals the value the decimal text reads back exactly.
+      if (!single && std::fabs(value) < 1e9) {
+         static const double powers[] = {1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+         for (int k = 0; k < 9; ++k) {
+            const double scaled = std::nearbyint(value * powers[k]);
+            if (scaled / powers[k] != value) continue;
+
+            const uint64_t digits = static_cast<uint64_t>(std::fabs(scaled));
+            const uint64_t divisor = static_cast<uint64_t>(powers[k]);
+            if (value < 0) m_buffer.push_back('-');
+            AppendUInt(digits / divisor);
+
+            char fraction[10];
+            uint64_t rest = digits % divisor;
+            fraction[0] = '.';
+            for (int i = k + 1; i > 0; --i, rest /= 10) fraction[i] = static_cast<char>('0' + rest % 10);
+            m_buffer.append(fraction, static_cast<size_t>(k + 2));
+            return;
+         }
+      }
+
+      // Otherwise the shortest of the usual precisions that reads back to the same value.
+      char text[32];
+      int length = 0;
+      const int precisions[] = {single ? 6 : 15, single ? 9 : 17};
+      for (int precision : precisions) {
+         length = std::snprintf(text, sizeof(text), "%.*g", precision, value);
+         if (single ? std::strtof(text, nullptr) == static_cast<float>(value) : std::strtod(text, nullptr) == value) break;
+      }
+      m_buffer.append(text, static_cast<size_t>(length));
+   }
+
+   void JsonReader::SkipWhitespace() {
+      while (m_pos < m_text.size()) {
+         const char c = m_text[m_pos];
+         if (c != ' ' && c != '\t' && c != '\n' && c != '\r') break;
+         ++m_pos;
+      }
+   }
+
+   bool JsonReader::Consume(char c) {
+      SkipWhitespace();
+      if (m_pos < m_text.size() && m_text[m_pos] == c) {
+         ++m_pos;
+         return true;
+      }
+      return false;
+   }
+
+   bool JsonReader::Expect(char c) {
+      return Consume(c);
+   }
+
+   bool JsonReader::ReadValue(bool &value) {
+      SkipWhitespace();
+      if (m_text.substr(m_pos, 4) == "true") {
+         value = true;
+         m_pos += 4;
+         return true;
+      }
+      if (m_text.substr(m_pos, 5) == "false") {
+         value = false;
+         m_pos += 5;
+         return true;
+      }
+      return false;
+   }
+
+   bool JsonReader::ReadKey(View &name) {
+      SkipWhitespace();
+      if (m_pos >= m_text.size() || m_text[m_pos] != '"') return false;
+
+      // Without escapes the name is a view into the input.
+      const size_t start = m_pos + 1;
+      for (size_t i = start; i < m_text.size(); ++i) {
+         if (m_text[i] == '"') {
+            name = m_text.substr(start, i - start);
+            m_pos = i + 1;
+            return true;
+         }
+         if (m_text[i] == '\\') break;
+      }
+
+      if (!ReadString(m_scratch)) return false;
+      name = View(m_scratch);
+      return true;
+   }
+
+   bool JsonReader::ReadString(std::string &out) {
+      SkipWhitespace();
+      if (m_pos >= m_text.size() || m_text[m_pos] != '"') return false;
+      ++m_pos;
+      out.clear();
+
+      size_t start = m_pos;
+      while (m_pos < m_text.size()) {
+         const char c = m_text[m_pos];
+         if (c == '"') {
+            out.append(m_text.data() + start, m_pos - start);
+            ++m_pos;
+            return true;
+         }
+         if (static_cast<unsigned char>(c) < 0x20) return false;
+         if (c != '\\') {
+            ++m_pos;
+            continue;
+         }
+
+         out.append(m_text.data() + start, m_pos - start);
+         if (++m_pos >= m_text.size()) return false;
+
+         const char e = m_text[m_pos++];
+         switch (e) {
+            case '"': out.push_back('"'); break;
+            case '\\': out.push_back('\\'); break;
+            case '/': out.push_back('/'); break;
+            case 'b': out.push_back('\b'); break;
+            case 'f': out.push_back('\f'); break;
+            case 'n': out.push_back('\n'); break;
+            case 'r': out.push_back('\r'); break;
+            case 't': out.push_back('\t'); break;
+            case 'u': {
+               unsigned code = 0;
+               for (int i = 0; i < 4; ++i, ++m_pos) {
+                  if (m_pos >= m_text.size()) return false;
+                  const char h = m_text[m_pos];
+                  code <<= 4;
+                  if (h >= '0' && h <= '9') code |= h - '0';
+                  else if (h >= 'a' && h <= 'f') code |= h - 'a' + 10;
+                  else if (h >= 'A' && h <= 'F') code |= h - 'A' + 10;
+                  else return false;
+               }
+
+               // A surrogate pair encodes one code point above U+FFFF.
+               if (code >= 0xD800 && code < 0xDC00 && m_text.substr(m_pos, 2) == "\\u") {
+                  const size_t save = m_pos;
+                  m_pos += 2;
+                  unsigned low = 0;
+                  bool ok = true;
+                  for (int i = 0; i < 4 && ok; ++i, ++m_pos) {
+                     if (m_pos >= m_text.size()) { ok = false; break; }
+                     const char h = m_text[m_pos];
+                     low <<= 4;
+                     if (h >= '0' && h <= '9') low |= h - '0';
+                     else if (h >= 'a' && h <= 'f') low |= h - 'a' + 10;
+                     else if (h >= 'A' && h <= 'F') low |= h - 'A' + 10;
+                     else ok = false;
+                  }
+                  if (ok && low >= 0xDC00 && low < 0xE000) {
+                     code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                  } else {
+                     m_pos = save;
+                  }
+               }
+
+               // UTF-8
+               if (code < 0x80) {
+                  out.push_back(static_cast<char>(code));
+               } else if (code < 0x800) {
+                  out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+                  out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+               } else if (code < 0x10000) {
+                  out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+                  out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                  out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+               } else {
+                  out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+                  out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+                  out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                  out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+               }
+               break;
+            }
+            default:
+               return false;
+         }
+         start = m_pos;
+      }
+      return false;
+   }
+
+   bool JsonReader::ReadValue(std::string &value) {
+      return ReadString(value);
+   }
+
+   bool JsonReader::ReadNumberToken(View &token) {
+      SkipWhitespace();
+      const size_t start = m_pos;
+      while (m_pos < m_text.size()) {
+         const char c = m_text[m_pos];
+         if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') {
+            ++m_pos;
+         } else {
+            break;
+         }
+      }
+      token = m_text.substr(start, m_pos - start);
+      return !token.empty();
+   }
+
+   bool JsonReader::ReadInteger(int64_t &number, uint64_t &unsignedNumber, bool &negative) {
+      SkipWhitespace();
+      negative = m_pos < m_text.size() && m_text[m_pos] == '-';
+      if (negative) ++m_pos;
+
+      const size_t start = m_pos;
+      uint64_t value = 0;
+      while (m_pos < m_text.size() && m_text[m_pos] >= '0' && m_text[m_pos] <= '9') {
+         const unsigned digit = static_cast<unsigned>(m_text[m_pos] - '0');
+         if (value > (UINT64_MAX - digit) / 10) return false;
+         value = value * 10 + digit;
+         ++m_pos;
+      }
+      if (m_pos == start) return false;
+
+      // Integral fields written by other encoders as 5.0 or 1e3 are not accepted.
+      if (m_pos < m_text.size() && (m_text[m_pos] == '.' || m_text[m_pos] == 'e' || m_text[m_pos] == 'E')) return false;
+
+      if (negative) {
+         if (value > static_cast<uint64_t>(INT64_MAX) + 1) return false;
+         number = static_cast<int64_t>(0 - value);
+      } else {
+         unsignedNumber = value;
+      }
+      return true;
+   }
+
+   bool JsonReader::ReadValue(double &value) {
+      SkipWhitespace();
+      if (m_text.substr(m_pos, 4) == "null") {
+         m_pos += 4;
+         value = std::numeric_limits<double>::quiet_NaN();
+         return true;
+      }
+
+      View token;
+      char text[64];
+      if (!ReadNumberToken(token) || token.size() >= sizeof(text)) return false;
+      std::memcpy(text, token.data(), token.size());
+      text[token.size()] = '\0';
+
+      char *end = nullptr;
+      value = std::strtod(text, &end);
+      return end == text + token.size();
+   }
+
+   bool JsonReader::ReadValue(float &value) {
+      double d = 0.0;
+      if (!ReadValue(d)) return false;
+      value = static_cast<float>(d);
+      return true;
+   }
+
+   bool JsonReader::SkipValue() {
+      SkipWhitespace();
+      if (m_pos >= m_text.size()) return false;
+
+      const char c = m_text[m_pos];
+      if (c == '"') return ReadString(m_scratch);
+
+      if (c == '{' || c == '[') {
+         // Checked before counting the level, so the early return leaves the depth balanced.
+         if (m_depth >= MAX_DEPTH) return false;
+         ++m_depth;
+         ++m_pos;
+         const char close = c == '{' ? '}' : ']';
+         bool ok = true;
+         if (!Consume(close)) {
+            do {
+               if (c == '{') {
+                  View name;
+                  ok = ReadKey(name) && Expect(':');
+               }
+               ok = ok && SkipValue();
+            } while (ok && Consume(','));
+            ok = ok && Expect(close);
+         }
+         --m_depth;
+         return ok;
+      }
+
+      if (m_text.substr(m_pos, 4) == "null" || m_text.substr(m_pos, 4) == "true") {
+         m_pos += 4;
+         return true;
+      }
+      if (m_text.substr(m_pos, 5) == "false") {
+         m_pos += 5;
+         return true;
+      }
+
+      View token;
+      return ReadNumberToken(token);
+   }
+
+} // namespace AMM
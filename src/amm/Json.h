@@ -0,0 +1,313 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <boost/utility/string_view.hpp>
+#include <fastcdr/cdr/fixed_size_string.hpp>
+
+#include "AMM_ExtendedReflection.h"
+
+namespace AMM {
+
+    /// Streaming JSON encoder for AMM types, built on the generated reflection.
+    ///
+    /// Samples are written straight into a buffer owned by the writer, which keeps its capacity across
+    /// Clear(), so encoding a stream of samples does not allocate once the buffer has grown.  Structs
+    /// become objects with the IDL field names, enums their enumerator names, sequences and arrays
+    /// become arrays.  Non-finite floating point values are written as null.
+    ///
+    ///     JsonWriter writer;
+    ///     writer.BeginObject();
+    ///     writer.Key("topic");
+    ///     writer.Value("AMM_Log");
+    ///     writer.Key("sample");
+    ///     writer.Value(log);
+    ///     writer.EndObject();
+    ///     send(writer.data(), writer.size());
+    class JsonWriter {
+
+    public:
+        typedef boost::string_view View;
+
+        /// Empty the buffer, keeping its capacity.
+        void Clear();
+
+        const std::string &str() const { return m_buffer; }
+
+        const char *data() const { return m_buffer.data(); }
+
+        size_t size() const { return m_buffer.size(); }
+
+        /// Encode one sample, replacing the buffer content.
+        /// @param sample Any reflected AMM type.
+        /// @returns The encoded text, valid until the writer is next modified.
+        template<class T>
+        const std::string &Write(const T &sample) {
+           Clear();
+           Value(sample);
+           return m_buffer;
+        }
+
+        void BeginObject();
+
+        void EndObject();
+
+        void BeginArray();
+
+        void EndArray();
+
+        /// Object member name, followed by exactly one value.
+        void Key(View name);
+
+        void Null();
+
+        void Value(bool value);
+
+        void Value(const char *value) { Value(View(value)); }
+
+        void Value(const std::string &value) { Value(View(value)); }
+
+        void Value(View value);
+
+        template<size_t N>
+        void Value(const eprosima::fastcdr::fixed_string<N> &value) { Value(View(value.c_str(), value.size())); }
+
+        template<class T>
+        typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type
+        Value(T value) {
+           Separate();
+           if (std::is_signed<T>::value) {
+              AppendInt(static_cast<int64_t>(value));
+           } else {
+              AppendUInt(static_cast<uint64_t>(value));
+           }
+        }
+
+        void Value(double value) { AppendReal(value, false); }
+
+        void Value(float value) { AppendReal(value, true); }
+
+        template<class T>
+        typename std::enable_if<reflection::IsEnum<T>::value>::type
+        Value(T value) {
+           const char *name = reflection::EnumName(value);
+           if (name != nullptr) {
+              Value(View(name));
+           } else {
+              Value(static_cast<uint32_t>(value));
+           }
+        }
+
+        template<class T>
+        typename std::enable_if<reflection::IsStruct<T>::value>::type
+        Value(const T &sample) {
+           BeginObject();
+           reflection::Struct<T>::ForEach(sample, [this](const char *name, const auto &field) {
+              Key(View(name));
+              Value(field);
+           });
+           EndObject();
+        }
+
+        template<class T>
+        void Value(const std::vector<T> &values) {
+           BeginArray();
+           for (const auto &value : values) Value(value);
+           EndArray();
+        }
+
+        template<class T, size_t N>
+        void Value(const std::array<T, N> &values) {
+           BeginArray();
+           for (const auto &value : values) Value(value);
+           EndArray();
+        }
+
+    private:
+        /// Writes the comma before a value or key when needed.
+        void Separate();
+
+        void AppendInt(int64_t value);
+
+        void AppendUInt(uint64_t value);
+
+        void AppendReal(double value, bool single);
+
+        std::string m_buffer;
+
+        /// Bit n set when the container at depth n already holds an element.
+        uint64_t m_hasElement = 0;
+
+        unsigned m_depth = 0;
+
+        bool m_afterKey = false;
+
+    }; // class JsonWriter
+
+    /// Pull parser decoding JSON into AMM types, built on the generated reflection.
+    ///
+    /// Object members are matched to fields by name and unknown members are skipped, so fields missing
+    /// from the input keep their previous values.  Strings are decoded into the target fields,
+    /// reusing their capacity.  Enums accept enumerator names or numbers.
+    class JsonReader {
+
+    public:
+        typedef boost::string_view View;
+
+        /// Decode a sample.
+        /// @param json Input text.
+        /// @param sample Sample output.
+        /// @returns 0 if successful, 1 if the input is not valid JSON for the type.
+        template<class T>
+        int Read(View json, T &sample) {
+           std::string errmsg;
+           return Read(json, sample, errmsg);
+        }
+
+        /// Decode a sample.
+        /// @param json Input text.
+        /// @param sample Sample output.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful, 1 if the input is not valid JSON for the type.
+        template<class T>
+        int Read(View json, T &sample, std::string &errmsg) {
+           m_text = json;
+           m_pos = 0;
+           m_depth = 0;
+           if (!ReadValue(sample) || (SkipWhitespace(), m_pos != m_text.size())) {
+              errmsg = "Invalid JSON at offset " + std::to_string(m_pos);
+              return 1;
+           }
+           return 0;
+        }
+
+    private:
+        bool ReadValue(bool &value);
+
+        bool ReadValue(std::string &value);
+
+        bool ReadValue(double &value);
+
+        bool ReadValue(float &value);
+
+        /// Bounded strings, longer input is truncated to the bound.
+        template<size_t N>
+        bool ReadValue(eprosima::fastcdr::fixed_string<N> &value) {
+           if (!ReadString(m_scratch)) return false;
+           value.assign(m_scratch.data(), m_scratch.size());
+           return true;
+        }
+
+        template<class T>
+        typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool>::type
+        ReadValue(T &value) {
+           int64_t number = 0;
+           uint64_t unsignedNumber = 0;
+           bool negative = false;
+           if (!ReadInteger(number, unsignedNumber, negative)) return false;
+
+           if (negative) {
+              if (std::is_unsigned<T>::value || number < static_cast<int64_t>(std::numeric_limits<T>::min())) return false;
+              value = static_cast<T>(number);
+           } else {
+              if (unsignedNumber > static_cast<uint64_t>(std::numeric_limits<T>::max())) return false;
+              value = static_cast<T>(unsignedNumber);
+           }
+           return true;
+        }
+
+        template<class T>
+        typename std::enable_if<reflection::IsEnum<T>::value, bool>::type
+        ReadValue(T &value) {
+           SkipWhitespace();
+           if (m_pos < m_text.size() && m_text[m_pos] == '"') {
+              View name;
+              return ReadKey(name) && reflection::EnumValue(name, value);
+           }
+           uint32_t number = 0;
+           if (!ReadValue(number) || number >= reflection::Enum<T>::Count) return false;
+           value = static_cast<T>(number);
+           return true;
+        }
+
+        template<class T>
+        typename std::enable_if<reflection::IsStruct<T>::value, bool>::type
+        ReadValue(T &sample) {
+           if (!Expect('{')) return false;
+           if (Consume('}')) return true;
+
+           do {
+              View name;
+              if (!ReadKey(name) || !Expect(':')) return false;
+
+              bool ok = true;
+              const bool known = reflection::Struct<T>::Visit(sample, name, [this, &ok](auto &&field) {
+                 ok = ReadValue(field);
+              });
+              if (!known) ok = SkipValue();
+              if (!ok) return false;
+           } while (Consume(','));
+
+           return Expect('}');
+        }
+
+        template<class T>
+        bool ReadValue(std::vector<T> &values) {
+           if (!Expect('[')) return false;
+           values.clear();
+           if (Consume(']')) return true;
+
+           do {
+              values.emplace_back();
+              if (!ReadValue(values.back())) return false;
+           } while (Consume(','));
+
+           return Expect(']');
+        }
+
+        template<class T, size_t N>
+        bool ReadValue(std::array<T, N> &values) {
+           if (!Expect('[')) return false;
+           for (size_t i = 0; i < N; ++i) {
+              if (i > 0 && !Expect(',')) return false;
+              if (!ReadValue(values[i])) return false;
+           }
+           return Expect(']');
+        }
+
+        void SkipWhitespace();
+
+        /// Skips whitespace, then consumes c if it is next.
+        bool Consume(char c);
+
+        /// Like Consume, but a missing c is an error.
+        bool Expect(char c);
+
+        /// Object member name or enumerator.  Names with escapes are decoded into m_scratch.
+        bool ReadKey(View &name);
+
+        bool ReadString(std::string &out);
+
+        bool ReadInteger(int64_t &number, uint64_t &unsignedNumber, bool &negative);
+
+        /// Number token as text.
+        bool ReadNumberToken(View &token);
+
+        bool SkipValue();
+
+        View m_text;
+
+        size_t m_pos = 0;
+
+        std::string m_scratch;
+
+        unsigned m_depth = 0;
+
+    }; // class JsonReader
+
+} // namespace AMM
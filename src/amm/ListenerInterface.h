@@ -16,6 +16,7 @@
 
 #include <fastrtps/fastrtps_fwd.h>
 #include <fastrtps/participant/ParticipantListener.h>
+#include <fastrtps/qos/LivelinessChangedStatus.h>
 #include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
 
 #include <fastrtps/rtps/builtin/BuiltinProtocols.h>
@@ -33,6 +34,7 @@
 
 #include "AMM_StandardPubSubTypes.h"
 #include "AMM_ExtendedPubSubTypes.h"
+#include "SampleTypes.h"
 
 using namespace eprosima;
 using namespace eprosima::fastrtps;
@@ -66,7 +68,7 @@ public:
    virtual void onNewFragmentAmendmentRequest(AMM::FragmentAmendmentRequest ffar, SampleInfo_t *info) {};
 
    /// Event handler for incoming Log data.
-   virtual void onNewLog(AMM::Log log, SampleInfo_t *info) {};
+   virtual void onNewLog(AMM::LogSample log, SampleInfo_t *info) {};
 
    /// Event handler for incoming Module Configuration data.
    virtual void onNewModuleConfiguration(AMM::ModuleConfiguration modConfig, SampleInfo_t *info) {};
@@ -81,10 +83,10 @@ public:
    virtual void onNewPhysiologyModification(AMM::PhysiologyModification physMod, SampleInfo_t *info) {};
 
    /// Event handler for incoming Physiology Value data.
-   virtual void onNewPhysiologyValue(AMM::PhysiologyValue physValue, SampleInfo_t *info) {};
+   virtual void onNewPhysiologyValue(AMM::PhysiologyValueSample physValue, SampleInfo_t *info) {};
 
    /// Event handler for incoming Physiology Waveform data.
-   virtual void onNewPhysiologyWaveform(AMM::PhysiologyWaveform physWave, SampleInfo_t *info) {};
+   virtual void onNewPhysiologyWaveform(AMM::PhysiologyWaveformSample physWave, SampleInfo_t *info) {};
 
    /// Event handler for incoming Render Modification data.
    virtual void onNewRenderModification(AMM::RenderModification rendMod, SampleInfo_t *info) {};
@@ -93,7 +95,7 @@ public:
    virtual void onNewSimulationControl(AMM::SimulationControl simControl, SampleInfo_t *info) {};
 
    /// Event handler for incoming Status data.
-   virtual void onNewStatus(AMM::Status status, SampleInfo_t *info) {};
+   virtual void onNewStatus(AMM::StatusSample status, SampleInfo_t *info) {};
 
    /// Event handler for incoming Tick data.
    virtual void onNewTick (AMM::Tick tick, eprosima::fastrtps::SampleInfo_t* info) {};
@@ -102,7 +104,22 @@ public:
    virtual void onNewInstrumentData (AMM::InstrumentData instData, eprosima::fastrtps::SampleInfo_t* info) {};
 
    /// Event handler for incoming Command data.
-   virtual void onNewCommand (AMM::Command command, eprosima::fastrtps::SampleInfo_t* info) {};
+   virtual void onNewCommand (AMM::CommandSample command, eprosima::fastrtps::SampleInfo_t* info) {};
+
+   /// Event handler for incoming Physiology Frame data.
+   virtual void onNewPhysiologyFrame (AMM::PhysiologyFrame physFrame, eprosima::fastrtps::SampleInfo_t* info) {};
+
+   /// Event handler for a Publisher matching or unmatching a remote Subscriber.
+   virtual void onPublicationMatched(Publisher *pub, MatchingInfo &info) {};
+
+   /// Event handler for a Subscriber matching or unmatching a remote Publisher.
+   virtual void onSubscriptionMatched(Subscriber *sub, MatchingInfo &info) {};
+
+   /// Event handler for a remote Publisher matched by a Subscriber losing or regaining liveliness.
+   virtual void onLivelinessChanged(Subscriber *sub, const LivelinessChangedStatus &status) {};
+
+   /// Event handler for remote participants being discovered, changed or removed.
+   virtual void onParticipantDiscovery(Participant *participant, ParticipantDiscoveryInfo &info) {};
 
    /// TODO
    std::string sysPrefix = "[SYS]";
@@ -0,0 +1,227 @@
+#include "ModuleConfigurationCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <sstream>
+
+#include <boost/property_tree/xml_parser.hpp>
+
+namespace AMM {
+
+   namespace {
+
+      typedef std::vector<std::pair<std::string, std::string>> Values;
+
+      void flatten(const ModuleConfigurationCache::Tree &tree, const std::string &path, Values &values) {
+         std::map<std::string, size_t> seen;
+         for (const auto &child : tree) {
+            const std::string &key = child.first;
+            if (key == "<xmlcomment>") continue;
+
+            if (key == "<xmlattr>") {
+               for (const auto &attribute : child.second) {
+                  values.emplace_back(path + "/@" + attribute.first, attribute.second.data());
+               }
+               continue;
+            }
+
+            // Numbering starts at the second occurrence, so a single element keeps its path when
+            // siblings are added or removed after it.
+            std::string childPath = path.empty() ? key : path + "/" + key;
+            const size_t index = seen[key]++;
+            if (index > 0) childPath += "[" + std::to_string(index) + "]";
+
+            values.emplace_back(childPath, child.second.data());
+            flatten(child.second, childPath, values);
+         }
+      }
+
+   } // namespace
+
+   void ModuleConfigurationCache::SetHandler(Handler handler) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_handler = std::move(handler);
+   }
+
+   int ModuleConfigurationCache::OnModuleConfiguration(const AMM::ModuleConfiguration &configuration) {
+      std::string errmsg;
+      return OnModuleConfiguration(configuration, errmsg);
+   }
+
+   int ModuleConfigurationCache::OnModuleConfiguration(
+      const AMM::ModuleConfiguration &configuration, std::string &errmsg
+   ) {
+      const std::string &moduleId = configuration.module_id().id();
+      const char *data = configuration.capabilities_configuration().c_str();
+      const size_t size = configuration.capabilities_configuration().size();
+      const uint64_t hash = Hash(data, size);
+
+      std::shared_ptr<Slot> slot;
+      uint64_t arrival;
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         ++m_stats.received;
+         arrival = ++m_arrivals;
+         std::shared_ptr<Slot> &s = m_slots[moduleId];
+         if (!s) s = std::make_shared<Slot>();
+         slot = s;
+      }
+
+      // Parsing happens outside the cache lock, so other modules' configurations can be checked
+      // meanwhile, but one module is processed at a time so an older sample never replaces a newer one.
+      std::lock_guard<std::mutex> moduleLock(slot->mutex);
+
+      std::shared_ptr<const Entry> previous;
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         if (arrival < slot->processed) {
+            ++m_stats.superseded;
+            return 0;
+         }
+         slot->processed = arrival;
+
+         if (slot->failed && slot->failedHash == hash && slot->failedConfiguration.size() == size &&
+             std::memcmp(slot->failedConfiguration.data(), data, size) == 0) {
+            ++m_stats.repeatedErrors;
+            errmsg = slot->failedError;
+            return 1;
+         }
+
+         auto it = m_entries.find(moduleId);
+         if (it != m_entries.end()) {
+            previous = it->second;
+            if (previous->hash == hash && previous->configuration.size() == size &&
+                std::memcmp(previous->configuration.data(), data, size) == 0) {
+               ++m_stats.unchanged;
+               return 0;
+            }
+         }
+      }
+
+      std::shared_ptr<Entry> entry = std::make_shared<Entry>();
+      entry->moduleId = moduleId;
+      entry->name = configuration.name();
+      entry->hash = hash;
+      entry->configuration.assign(data, size);
+
+      if (size > 0) {
+         try {
+            std::istringstream stream(entry->configuration);
+            boost::property_tree::read_xml(stream, entry->tree, boost::property_tree::xml_parser::trim_whitespace);
+         } catch (boost::property_tree::xml_parser_error &e) {
+            errmsg = "Invalid configuration from module " + moduleId + ": " + e.what();
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_stats.parseErrors;
+            slot->failed = true;
+            slot->failedHash = hash;
+            slot->failedConfiguration = std::move(entry->configuration);
+            slot->failedError = errmsg;
+            return 1;
+         }
+      }
+
+      flatten(entry->tree, std::string(), entry->values);
+      std::stable_sort(entry->values.begin(), entry->values.end(),
+         [](const Values::value_type &a, const Values::value_type &b) { return a.first < b.first; });
+
+      std::vector<Change> changes;
+      Diff(previous ? previous->values : Values(), entry->values, changes);
+
+      Handler handler;
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         ++m_stats.parsed;
+         m_entries[moduleId] = entry;
+         slot->failed = false;
+         slot->failedConfiguration.clear();
+         handler = m_handler;
+      }
+
+      // Still under the module lock, so the handler sees a module's changes in order.
+      if (handler) handler(configuration, *entry, changes);
+      return 0;
+   }
+
+   std::shared_ptr<const ModuleConfigurationCache::Entry> ModuleConfigurationCache::Find(
+      const std::string &moduleId
+   ) const {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_entries.find(moduleId);
+      return it != m_entries.end() ? it->second : nullptr;
+   }
+
+   int ModuleConfigurationCache::Remove(const std::string &moduleId) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto slot = m_slots.find(moduleId);
+      if (slot != m_slots.end()) {
+         slot->second->failed = false;
+         slot->second->failedConfiguration.clear();
+      }
+      return m_entries.erase(moduleId) > 0 ? 0 : 1;
+   }
+
+   void ModuleConfigurationCache::Clear() {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_entries.clear();
+      for (auto &slot : m_slots) {
+         slot.second->failed = false;
+         slot.second->failedConfiguration.clear();
+      }
+   }
+
+   ModuleConfigurationCache::Stats ModuleConfigurationCache::GetStats() const {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_stats;
+   }
+
+   uint64_t ModuleConfigurationCache::Hash(const char *data, size_t size) {
+      // 8 bytes per step with a multiply/xorshift mix, no need to be cryptographic.
+      static const uint64_t K0 = 0x9e3779b97f4a7c15ull;
+      static const uint64_t K1 = 0xbf58476d1ce4e5b9ull;
+      static const uint64_t K2 = 0x94d049bb133111ebull;
+
+      uint64_t hash = K0 ^ (size * K1);
+      size_t i = 0;
+      for (; i + 8 <= size; i += 8) {
+         uint64_t word;
+         std::memcpy(&word, data + i, 8);
+         word *= K1;
+         word ^= word >> 31;
+         hash = (hash ^ word) * K2;
+      }
+      if (i < size) {
+         uint64_t word = 0;
+         std::memcpy(&word, data + i, size - i);
+         word *= K1;
+         word ^= word >> 31;
+         hash = (hash ^ word) * K2;
+      }
+
+      hash ^= hash >> 30;
+      hash *= K1;
+      hash ^= hash >> 27;
+      return hash;
+   }
+
+   void ModuleConfigurationCache::Diff(const Values &before, const Values &after, std::vector<Change> &changes) {
+      changes.clear();
+      auto b = before.begin();
+      auto a = after.begin();
+
+      while (b != before.end() || a != after.end()) {
+         if (a == after.end() || (b != before.end() && b->first < a->first)) {
+            changes.push_back(Change{Change::REMOVED, b->first, b->second, std::string()});
+            ++b;
+         } else if (b == before.end() || a->first < b->first) {
+            changes.push_back(Change{Change::ADDED, a->first, std::string(), a->second});
+            ++a;
+         } else {
+            if (a->second != b->second) changes.push_back(Change{Change::MODIFIED, a->first, b->second, a->second});
+            ++a;
+            ++b;
+         }
+      }
+   }
+
+} // namespace AMM
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "AMM_Standard.h"
+
+namespace AMM {
+
+    /// Parses Module Configuration payloads once per content and reports what changed.
+    ///
+    /// Module Configuration is Transient Local, so every (re)join redelivers the configuration of
+    /// every module.  The cache keeps a hash and copy of each module's capabilities_configuration,
+    /// keyed by module_id, and only parses and calls the handler when the content differs from what
+    /// was last seen.  Redelivered configurations cost a hash and a compare, and so do redeliveries of
+    /// the last configuration of a module that failed to parse.
+    ///
+    /// The handler receives the parsed XML and the list of changed values, addressed by paths such
+    /// as "AMMModuleConfiguration/capabilities/capability[1]/@name".  Every element has a value, its
+    /// text, and attributes are written as "@name".  Repeated elements are numbered from the second
+    /// one on: capability, capability[1], capability[2].
+    ///
+    /// Feed it with DDSManager::CreateModuleConfigurationSubscriber(ModuleConfigurationCache *) or
+    /// by calling OnModuleConfiguration from an existing callback.  Safe to use from any thread.
+    /// Configurations of one module are processed one at a time in the order they arrived, and one
+    /// that arrives after a newer one was already processed is dropped.  The handler runs on the
+    /// calling thread without the cache lock held, but must not feed the cache the same module.
+    class ModuleConfigurationCache {
+
+    public:
+        typedef boost::property_tree::ptree Tree;
+
+        struct Change {
+            enum Kind {
+                ADDED, REMOVED, MODIFIED
+            };
+
+            Kind kind;
+
+            std::string path;
+
+            /// Empty for ADDED.
+            std::string oldValue;
+
+            /// Empty for REMOVED.
+            std::string newValue;
+        };
+
+        /// Parsed configuration of one module.
+        struct Entry {
+            std::string moduleId;
+
+            std::string name;
+
+            uint64_t hash = 0;
+
+            std::string configuration;
+
+            Tree tree;
+
+            /// Every value of the tree as (path, value), sorted by path.
+            std::vector<std::pair<std::string, std::string>> values;
+        };
+
+        /// Called for each module whose configuration is new or changed.
+        /// For a module seen for the first time, every value is reported as ADDED.
+        typedef std::function<void(const AMM::ModuleConfiguration &, const Entry &, const std::vector<Change> &)> Handler;
+
+        struct Stats {
+            uint64_t received = 0;
+
+            /// Received configurations identical to the cached one.
+            uint64_t unchanged = 0;
+
+            uint64_t parsed = 0;
+
+            uint64_t parseErrors = 0;
+
+            /// Received configurations identical to the last one of the module that failed to parse.
+            uint64_t repeatedErrors = 0;
+
+            /// Received configurations dropped because a newer one of the module was processed first.
+            uint64_t superseded = 0;
+        };
+
+        /// @param handler Function called for new and changed configurations.
+        void SetHandler(Handler handler);
+
+        /// Process a received configuration.
+        /// @param configuration Received Module Configuration.
+        /// @returns 0 if successful, 1 if the configuration is not valid XML.
+        int OnModuleConfiguration(const AMM::ModuleConfiguration &configuration);
+
+        /// Process a received configuration.
+        /// @param configuration Received Module Configuration.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful, 1 if the configuration is not valid XML.
+        int OnModuleConfiguration(const AMM::ModuleConfiguration &configuration, std::string &errmsg);
+
+        /// Look up the last configuration of a module.
+        /// @param moduleId Module id.
+        /// @returns The cached entry, or null if none was received.
+        std::shared_ptr<const Entry> Find(const std::string &moduleId) const;
+
+        /// Forget a module, so its next configuration is reported as new.
+        /// @param moduleId Module id.
+        /// @returns 0 if successful, 1 if the module is not cached.
+        int Remove(const std::string &moduleId);
+
+        void Clear();
+
+        /// @returns Cache statistics.
+        Stats GetStats() const;
+
+        /// @returns 64 bit hash of a configuration payload.
+        static uint64_t Hash(const char *data, size_t size);
+
+        /// Compare two sets of sorted (path, value) pairs.
+        /// @param before Previous values, sorted by path.
+        /// @param after Current values, sorted by path.
+        /// @param changes Changes output, in path order.
+        static void Diff(
+           const std::vector<std::pair<std::string, std::string>> &before,
+           const std::vector<std::pair<std::string, std::string>> &after,
+           std::vector<Change> &changes
+        );
+
+    private:
+        /// Per module ordering and the last configuration that failed to parse.
+        struct Slot {
+            /// Held while a configuration of the module is processed.
+            std::mutex mutex;
+
+            /// Arrival number of the last configuration processed.  Guarded by mutex.
+            uint64_t processed = 0;
+
+            /// Guarded by m_mutex.
+            bool failed = false;
+
+            uint64_t failedHash = 0;
+
+            std::string failedConfiguration;
+
+            std::string failedError;
+        };
+
+        mutable std::mutex m_mutex;
+
+        std::unordered_map<std::string, std::shared_ptr<const Entry>> m_entries;
+
+        /// Never erased, so two configurations of a module always serialize on the same slot.
+        std::unordered_map<std::string, std::shared_ptr<Slot>> m_slots;
+
+        uint64_t m_arrivals = 0;
+
+        Handler m_handler;
+
+        Stats m_stats;
+
+    }; // class ModuleConfigurationCache
+
+} // namespace AMM
@@ -0,0 +1,182 @@
+#include "ModuleHealthMonitor.h"
+
+#include <fastrtps/rtps/common/InstanceHandle.h>
+
+#include <utility>
+
+namespace AMM {
+
+   void ModuleHealthMonitor::SetHandler(Handler handler) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_handler = std::move(handler);
+   }
+
+   void ModuleHealthMonitor::OnStatus(const AMM::StatusSample &status, const eprosima::fastrtps::SampleInfo_t *info) {
+      const std::string moduleId = status.module_id().id().c_str();
+      const std::string capability = status.capability().c_str();
+
+      Handler handler;
+      Entry changed;
+      State previous;
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+
+         Entry &entry = m_entries[moduleId];
+         entry.moduleId = moduleId;
+         if (entry.name.empty()) entry.name = status.module_name().c_str();
+
+         if (info != nullptr) {
+            // Receiving a sample is proof enough the writer is alive.
+            const eprosima::fastrtps::rtps::GUID_t &writer = info->sample_identity.writer_guid();
+            m_writers[writer] = moduleId;
+            entry.aliveWriters.insert(writer);
+            entry.alive = true;
+         }
+
+         Capability *reported = nullptr;
+         for (auto &c : entry.capabilities) {
+            if (c.name == capability) {
+               reported = &c;
+               break;
+            }
+         }
+         if (reported == nullptr) {
+            entry.capabilities.emplace_back();
+            reported = &entry.capabilities.back();
+            reported->name = capability;
+         }
+         reported->value = status.value();
+         reported->message = status.message().c_str();
+         reported->timestamp = status.timestamp();
+
+         if (!Update(entry, previous)) return;
+         changed = entry;
+         handler = m_handler;
+      }
+
+      if (handler) handler(changed, previous);
+   }
+
+   void ModuleHealthMonitor::OnOperationalDescription(const AMM::OperationalDescription &description) {
+      const std::string &moduleId = description.module_id().id();
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      // A new module stays UNKNOWN until it reports a Status, so there is no state change to report.
+      Entry &entry = m_entries[moduleId];
+      entry.moduleId = moduleId;
+      if (!description.name().empty()) entry.name = description.name();
+      entry.manufacturer = description.manufacturer();
+      entry.model = description.model();
+      entry.serialNumber = description.serial_number();
+      entry.moduleVersion = description.module_version();
+   }
+
+   void ModuleHealthMonitor::OnLivelinessChanged(const eprosima::fastrtps::LivelinessChangedStatus &status) {
+      eprosima::fastrtps::rtps::GUID_t writer;
+      eprosima::fastrtps::rtps::iHandle2GUID(writer, status.last_publication_handle);
+
+      Handler handler;
+      Entry changed;
+      State previous;
+      {
+         std::lock_guard<std::mutex> lock(m_mutex);
+
+         auto module = m_writers.find(writer);
+         if (module == m_writers.end()) return;
+         auto it = m_entries.find(module->second);
+
+         // One count dropping without the other rising means the writer is no longer matched, not just
+         // not alive.
+         if (status.alive_count_change + status.not_alive_count_change < 0) m_writers.erase(module);
+         if (it == m_entries.end()) return;
+
+         Entry &entry = it->second;
+         if (status.alive_count_change > 0) {
+            entry.aliveWriters.insert(writer);
+         } else if (status.alive_count_change < 0) {
+            entry.aliveWriters.erase(writer);
+         }
+         entry.alive = !entry.aliveWriters.empty();
+
+         if (!Update(entry, previous)) return;
+         changed = entry;
+         handler = m_handler;
+      }
+
+      if (handler) handler(changed, previous);
+   }
+
+   int ModuleHealthMonitor::Find(const std::string &moduleId, Entry &entry) const {
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      auto it = m_entries.find(moduleId);
+      if (it == m_entries.end()) return 1;
+      entry = it->second;
+      return 0;
+   }
+
+   std::vector<ModuleHealthMonitor::Entry> ModuleHealthMonitor::Snapshot() const {
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      std::vector<Entry> entries;
+      entries.reserve(m_entries.size());
+      for (const auto &entry : m_entries) entries.push_back(entry.second);
+      return entries;
+   }
+
+   int ModuleHealthMonitor::Remove(const std::string &moduleId) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      if (m_entries.erase(moduleId) == 0) return 1;
+      for (auto it = m_writers.begin(); it != m_writers.end();) {
+         if (it->second == moduleId) {
+            it = m_writers.erase(it);
+         } else {
+            ++it;
+         }
+      }
+      return 0;
+   }
+
+   void ModuleHealthMonitor::Clear() {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_entries.clear();
+      m_writers.clear();
+   }
+
+   const char *ModuleHealthMonitor::StateName(State state) {
+      switch (state) {
+         case UNKNOWN:
+            return "UNKNOWN";
+         case OPERATIONAL:
+            return "OPERATIONAL";
+         case EXIGENT:
+            return "EXIGENT";
+         case INOPERATIVE:
+            return "INOPERATIVE";
+         case LOST:
+            return "LOST";
+      }
+      return "";
+   }
+
+   ModuleHealthMonitor::State ModuleHealthMonitor::Evaluate(const Entry &entry) {
+      if (!entry.alive) return LOST;
+      if (entry.capabilities.empty()) return UNKNOWN;
+
+      State state = OPERATIONAL;
+      for (const auto &capability : entry.capabilities) {
+         if (capability.value == AMM::INOPERATIVE) return INOPERATIVE;
+         if (capability.value == AMM::EXIGENT) state = EXIGENT;
+      }
+      return state;
+   }
+
+   bool ModuleHealthMonitor::Update(Entry &entry, State &previous) {
+      previous = entry.state;
+      entry.state = Evaluate(entry);
+      return entry.state != previous;
+   }
+
+} // namespace AMM
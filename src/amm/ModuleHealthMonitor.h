@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fastrtps/qos/LivelinessChangedStatus.h>
+#include <fastrtps/rtps/common/Guid.h>
+#include <fastrtps/subscriber/SampleInfo.h>
+
+#include "AMM_Standard.h"
+#include "SampleTypes.h"
+
+namespace AMM {
+
+    /// Tracks the health of every module on the network from Status, Operational Description and liveliness.
+    ///
+    /// Each module is one entry, keyed by module_id.  Its state is the worst value of the capabilities it
+    /// reported in Status (a Status with an empty capability stands for the whole module), or LOST once
+    /// every writer of its Status lost liveliness or went away; Status writers offer a 1 second automatic
+    /// liveliness lease and the monitor's Status subscriber requests it, so a module that crashes or
+    /// drops off the network is LOST within about a second without publishing anything.  A module
+    /// publishing Status from several writers stays up while any of them is alive.  When a writer is
+    /// alive again the state goes back to the reported one.  Operational Description fills in the name
+    /// and hardware of the module.
+    ///
+    /// Modules built before Status writers offered the lease offer an infinite one, which the monitor's
+    /// subscriber does not match: such a module only appears through its Operational Description, as
+    /// UNKNOWN.  Other Status subscribers request no lease and receive Status from every module.
+    ///
+    /// The handler is only called when the state of a module changes, not for every Status received, so
+    /// a module manager no longer has to rescan its modules on each message.  Snapshot and Find return
+    /// copies of the current entries.
+    ///
+    /// Feed it with DDSManager::CreateStatusSubscriber(ModuleHealthMonitor *) and
+    /// DDSManager::CreateOperationalDescriptionSubscriber(ModuleHealthMonitor *), or by calling the On
+    /// methods from existing callbacks.  Safe to use from any thread; the handler runs on the calling
+    /// thread without the monitor lock held.
+    class ModuleHealthMonitor {
+
+    public:
+        /// Health of a module, from best to worst.
+        enum State {
+            /// Known from its Operational Description only.
+            UNKNOWN, OPERATIONAL, EXIGENT, INOPERATIVE,
+            /// Its Status writer lost liveliness.
+            LOST
+        };
+
+        /// Last Status of one capability.
+        struct Capability {
+            std::string name;
+
+            AMM::StatusValue value = AMM::OPERATIONAL;
+
+            std::string message;
+
+            uint64_t timestamp = 0;
+        };
+
+        struct Entry {
+            std::string moduleId;
+
+            /// From Status, replaced by the Operational Description name once received.
+            std::string name;
+
+            std::string manufacturer;
+
+            std::string model;
+
+            std::string serialNumber;
+
+            std::string moduleVersion;
+
+            State state = UNKNOWN;
+
+            /// False once every Status writer of the module lost liveliness or went away.
+            bool alive = true;
+
+            /// Status writers of the module that are alive.
+            std::set<eprosima::fastrtps::rtps::GUID_t> aliveWriters;
+
+            /// In the order first reported.
+            std::vector<Capability> capabilities;
+        };
+
+        /// Called when the state of a module changes.
+        typedef std::function<void(const Entry &entry, State previous)> Handler;
+
+        /// @param handler Function called on state changes.
+        void SetHandler(Handler handler);
+
+        /// Process a received Status.
+        /// @param status Received Status.
+        /// @param info Sample info, identifying the writer for liveliness. May be null.
+        void OnStatus(const AMM::StatusSample &status, const eprosima::fastrtps::SampleInfo_t *info);
+
+        /// Process a received Operational Description.
+        /// @param description Received Operational Description.
+        void OnOperationalDescription(const AMM::OperationalDescription &description);
+
+        /// Process a liveliness change of a Status subscriber.
+        /// Changes of writers that have not published a Status are ignored, and a writer that went away is
+        /// forgotten.
+        /// @param status Liveliness change.
+        void OnLivelinessChanged(const eprosima::fastrtps::LivelinessChangedStatus &status);
+
+        /// Look up a module.
+        /// @param moduleId Module id.
+        /// @param entry Entry output.
+        /// @returns 0 if successful, 1 if the module is not known.
+        int Find(const std::string &moduleId, Entry &entry) const;
+
+        /// @returns Every known module.
+        std::vector<Entry> Snapshot() const;
+
+        /// Forget a module, e.g. after it shut down.
+        /// @param moduleId Module id.
+        /// @returns 0 if successful, 1 if the module is not known.
+        int Remove(const std::string &moduleId);
+
+        void Clear();
+
+        /// @returns Name of a state, e.g. "OPERATIONAL".
+        static const char *StateName(State state);
+
+    private:
+        /// @returns State of an entry from its liveliness and capabilities.
+        static State Evaluate(const Entry &entry);
+
+        /// Re-evaluate the state of an entry.
+        /// @param entry Entry, updated.
+        /// @param previous State before, output.
+        /// @returns True if the state changed.
+        static bool Update(Entry &entry, State &previous);
+
+        mutable std::mutex m_mutex;
+
+        std::unordered_map<std::string, Entry> m_entries;
+
+        /// Module of each Status writer seen and not gone.
+        std::map<eprosima::fastrtps::rtps::GUID_t, std::string> m_writers;
+
+        Handler m_handler;
+
+    }; // class ModuleHealthMonitor
+
+} // namespace AMM
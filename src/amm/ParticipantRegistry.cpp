@@ -0,0 +1,179 @@
+#include "ParticipantRegistry.h"
+
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <fastrtps/Domain.h>
+
+namespace AMM {
+
+   namespace {
+
+      struct ParticipantEntry {
+         eprosima::fastrtps::Participant *participant;
+         DDS_Listeners::ParticipantListener *listener;
+         int users;
+      };
+
+      struct TypeEntry {
+         /// Null if the type was registered outside the registry, which then never unregisters it.
+         eprosima::fastdds::dds::TopicDataType *type;
+         int users;
+      };
+
+      typedef std::pair<eprosima::fastrtps::Participant *, std::string> TypeKey;
+
+      std::mutex &registryMutex() {
+         static std::mutex mutex;
+         return mutex;
+      }
+
+      std::map<std::string, ParticipantEntry> &participants() {
+         static std::map<std::string, ParticipantEntry> entries;
+         return entries;
+      }
+
+      std::map<TypeKey, TypeEntry> &types() {
+         static std::map<TypeKey, TypeEntry> entries;
+         return entries;
+      }
+
+      std::map<std::string, ParticipantEntry>::iterator find(eprosima::fastrtps::Participant *participant) {
+         auto it = participants().begin();
+         for (; it != participants().end(); ++it) {
+            if (it->second.participant == participant) break;
+         }
+         return it;
+      }
+
+   } // namespace
+
+   eprosima::fastrtps::Participant *ParticipantRegistry::Acquire(
+      const std::string &key, ListenerInterface *upstream, const Factory &create
+   ) {
+      std::lock_guard<std::mutex> lock(registryMutex());
+
+      auto it = participants().find(key);
+      if (!key.empty() && it != participants().end()) {
+         it->second.listener->AddUpstream(upstream);
+         ++it->second.users;
+         return it->second.participant;
+      }
+
+      DDS_Listeners::ParticipantListener *listener = new DDS_Listeners::ParticipantListener();
+      listener->AddUpstream(upstream);
+
+      eprosima::fastrtps::Participant *participant = create(listener);
+      if (participant == nullptr) {
+         delete listener;
+         return nullptr;
+      }
+
+      // Shared keys hold a '|', so numbered entries for unshared participants never match one.
+      static unsigned long unshared = 0;
+      const std::string entry = key.empty() ? "unshared " + std::to_string(++unshared) : key;
+      participants()[entry] = ParticipantEntry{participant, listener, 1};
+      return participant;
+   }
+
+   int ParticipantRegistry::Release(eprosima::fastrtps::Participant *participant, ListenerInterface *upstream) {
+      DDS_Listeners::ParticipantListener *listener;
+      std::vector<eprosima::fastdds::dds::TopicDataType *> owned;
+      {
+         std::lock_guard<std::mutex> lock(registryMutex());
+
+         auto it = find(participant);
+         if (it == participants().end()) return 1;
+
+         it->second.listener->RemoveUpstream(upstream);
+         if (--it->second.users > 0) return 0;
+
+         listener = it->second.listener;
+         participants().erase(it);
+
+         // The participant's types go with it.
+         for (auto type = types().begin(); type != types().end();) {
+            if (type->first.first == participant) {
+               if (type->second.type != nullptr) owned.push_back(type->second.type);
+               type = types().erase(type);
+            } else {
+               ++type;
+            }
+         }
+      }
+
+      // Removing the participant waits for its listener callbacks, which may be blocked on the
+      // registry lock, so it is removed without holding it.
+      int err = eprosima::fastrtps::Domain::removeParticipant(participant) ? 0 : 1;
+      delete listener;
+      for (eprosima::fastdds::dds::TopicDataType *type : owned) delete type;
+      return err;
+   }
+
+   int ParticipantRegistry::DiscoveredParticipants(eprosima::fastrtps::Participant *participant) {
+      std::lock_guard<std::mutex> lock(registryMutex());
+
+      auto it = find(participant);
+      if (it == participants().end()) return 0;
+      return it->second.listener->n_discovered;
+   }
+
+   bool ParticipantRegistry::Empty() {
+      std::lock_guard<std::mutex> lock(registryMutex());
+      return participants().empty();
+   }
+
+   bool ParticipantRegistry::RegisterType(
+      eprosima::fastrtps::Participant *participant, const std::string &topicName, const TypeFactory &create
+   ) {
+      std::lock_guard<std::mutex> lock(registryMutex());
+
+      const TypeKey key(participant, topicName);
+      auto it = types().find(key);
+      if (it != types().end()) {
+         ++it->second.users;
+         return true;
+      }
+
+      eprosima::fastdds::dds::TopicDataType *registered;
+      if (eprosima::fastrtps::Domain::getRegisteredType(participant, topicName.c_str(), &registered)) {
+         types()[key] = TypeEntry{nullptr, 1};
+         return true;
+      }
+
+      eprosima::fastdds::dds::TopicDataType *type = create();
+      if (!eprosima::fastrtps::Domain::registerType(participant, type)) {
+         delete type;
+         return false;
+      }
+
+      types()[key] = TypeEntry{type, 1};
+      return true;
+   }
+
+   bool ParticipantRegistry::UnregisterType(eprosima::fastrtps::Participant *participant, const std::string &topicName) {
+      std::lock_guard<std::mutex> lock(registryMutex());
+
+      auto it = types().find(TypeKey(participant, topicName));
+      if (it == types().end()) return false;
+
+      if (--it->second.users > 0) return true;
+      if (it->second.type == nullptr) {
+         types().erase(it);
+         return true;
+      }
+
+      // Fails while an endpoint still uses the type; the entry is kept and reused by the next user.
+      if (!eprosima::fastrtps::Domain::unregisterType(participant, topicName.c_str())) {
+         it->second.users = 0;
+         return false;
+      }
+
+      delete it->second.type;
+      types().erase(it);
+      return true;
+   }
+
+} // namespace AMM
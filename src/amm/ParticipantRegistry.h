@@ -0,0 +1,77 @@
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include <fastrtps/participant/Participant.h>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+
+#include "DDS_Listeners.h"
+
+namespace AMM {
+
+    /// Process wide registry of the participants and types DDS Managers use.
+    ///
+    /// A process hosting several modules would otherwise create one participant per DDSManager, each
+    /// with its own threads, sockets and discovery.  DDS Managers created with the same profiles file,
+    /// profile and discovery server share one participant instead, created by the first and removed
+    /// with the last.  Endpoints of managers sharing a participant match each other as before.  The
+    /// modules then share the participant's name and GUID prefix too, so remote tools list them as a
+    /// single participant.
+    ///
+    /// Managers with a module manifest never share: static discovery gives each endpoint the entity
+    /// ID its topic has in the manifest, so two modules' endpoints of one topic would collide.
+    ///
+    /// Types are counted per participant the same way: every AmmDataType of a topic registers it, and it
+    /// is unregistered when the last one is deleted, so decommissioning a topic in one manager does not
+    /// break another manager still using it.  The registry owns the registered type objects.
+    class ParticipantRegistry {
+
+    public:
+        /// Creates a participant, reporting discovery to the listener given.
+        typedef std::function<eprosima::fastrtps::Participant *(eprosima::fastrtps::ParticipantListener *)> Factory;
+
+        /// Creates a type object, named after its topic, to register.
+        typedef std::function<eprosima::fastdds::dds::TopicDataType *()> TypeFactory;
+
+        /// Get the participant for a key, creating it if no manager holds one.
+        /// @param key Profiles file, profile and discovery settings of the participant, empty for a
+        /// participant no other manager shares.
+        /// @param upstream Manager that receives participant discovery events until Release.
+        /// @param create Creates the participant if the key has none.
+        /// @returns Participant, or null if it could not be created.
+        static eprosima::fastrtps::Participant *Acquire(
+           const std::string &key, ListenerInterface *upstream, const Factory &create
+        );
+
+        /// Stop using a participant, removing it after its last user.
+        /// @param participant Participant from Acquire.
+        /// @param upstream Manager given to Acquire.
+        /// @returns 0 if successful.
+        static int Release(eprosima::fastrtps::Participant *participant, ListenerInterface *upstream);
+
+        /// @param participant Participant from Acquire.
+        /// @returns Number of remote participants currently discovered.
+        static int DiscoveredParticipants(eprosima::fastrtps::Participant *participant);
+
+        /// @returns True if no participant is held.
+        static bool Empty();
+
+        /// Register a type on a participant, or count one more user of it.
+        /// @param participant Participant.
+        /// @param topicName Topic, which is also the type name.
+        /// @param create Creates the type object if it is not registered yet.
+        /// @returns True if the type is registered.
+        static bool RegisterType(
+           eprosima::fastrtps::Participant *participant, const std::string &topicName, const TypeFactory &create
+        );
+
+        /// Count one user less of a type, unregistering it after the last.
+        /// @param participant Participant.
+        /// @param topicName Topic, which is also the type name.
+        /// @returns True if successful.
+        static bool UnregisterType(eprosima::fastrtps::Participant *participant, const std::string &topicName);
+
+    }; // class ParticipantRegistry
+
+} // namespace AMM
@@ -0,0 +1,371 @@
+#include "PayloadCodec.h"
+
+#include <cstring>
+#include <vector>
+
+#include <fastrtps/Domain.h>
+
+namespace AMM {
+
+   namespace lz4 {
+
+      namespace {
+
+         const size_t MIN_MATCH = 4;
+
+         /// The last match must start this many bytes before the end of the input.
+         const size_t MF_LIMIT = 12;
+
+         /// The last bytes of the input are always literals.
+         const size_t LAST_LITERALS = 5;
+
+         const size_t MAX_OFFSET = 65535;
+
+         const unsigned HASH_BITS = 12;
+
+         inline uint32_t read32(const uint8_t *p) {
+            uint32_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+         }
+
+         inline uint32_t hash(uint32_t sequence) {
+            return (sequence * 2654435761u) >> (32 - HASH_BITS);
+         }
+
+         /// Writes the 255-run length extension of a token field.
+         inline uint8_t *writeLength(uint8_t *op, size_t length) {
+            for (; length >= 255; length -= 255) *op++ = 255;
+            *op++ = static_cast<uint8_t>(length);
+            return op;
+         }
+
+         /// Worst case bytes needed for a sequence with these lengths.
+         inline size_t sequenceBound(size_t literals, size_t match) {
+            return 1 + literals / 255 + 1 + literals + 2 + match / 255 + 1;
+         }
+
+      } // namespace
+
+      size_t Compress(const uint8_t *src, size_t size, uint8_t *dst, size_t capacity) {
+         if (size > 0x7E000000) return 0;
+
+         const uint8_t *const end = src + size;
+         const uint8_t *anchor = src;
+         uint8_t *op = dst;
+         uint8_t *const oend = dst + capacity;
+
+         if (size > MF_LIMIT) {
+            uint32_t table[1u << HASH_BITS] = {0};
+            const uint8_t *const mfLimit = end - MF_LIMIT;
+            const uint8_t *const matchLimit = end - LAST_LITERALS;
+            const uint8_t *ip = src + 1;
+            unsigned misses = 0;
+
+            while (ip < mfLimit) {
+               const uint32_t sequence = read32(ip);
+               const uint32_t h = hash(sequence);
+               const uint8_t *ref = src + table[h];
+               table[h] = static_cast<uint32_t>(ip - src);
+
+               if (ref >= ip || static_cast<size_t>(ip - ref) > MAX_OFFSET || read32(ref) != sequence) {
+                  // Skip faster through data that does not compress.
+                  ip += 1 + (misses++ >> 6);
+                  continue;
+               }
+               misses = 0;
+
+               while (ip > anchor && ref > src && ip[-1] == ref[-1]) {
+                  --ip;
+                  --ref;
+               }
+
+               const uint8_t *matchEnd = ip + MIN_MATCH;
+               const uint8_t *refEnd = ref + MIN_MATCH;
+               while (matchEnd < matchLimit && *matchEnd == *refEnd) {
+                  ++matchEnd;
+                  ++refEnd;
+               }
+
+               const size_t literals = static_cast<size_t>(ip - anchor);
+               const size_t match = static_cast<size_t>(matchEnd - ip) - MIN_MATCH;
+               if (sequenceBound(literals, match) > static_cast<size_t>(oend - op)) return 0;
+
+               uint8_t *token = op++;
+               if (literals >= 15) {
+                  *token = 15 << 4;
+                  op = writeLength(op, literals - 15);
+               } else {
+                  *token = static_cast<uint8_t>(literals << 4);
+               }
+               std::memcpy(op, anchor, literals);
+               op += literals;
+
+               const size_t offset = static_cast<size_t>(ip - ref);
+               *op++ = static_cast<uint8_t>(offset);
+               *op++ = static_cast<uint8_t>(offset >> 8);
+
+               if (match >= 15) {
+                  *token |= 15;
+                  op = writeLength(op, match - 15);
+               } else {
+                  *token |= static_cast<uint8_t>(match);
+               }
+
+               // Index a position inside the match so the next search has a recent candidate.
+               table[hash(read32(matchEnd - 2))] = static_cast<uint32_t>(matchEnd - 2 - src);
+
+               ip = matchEnd;
+               anchor = ip;
+            }
+         }
+
+         const size_t literals = static_cast<size_t>(end - anchor);
+         if (1 + literals / 255 + 1 + literals > static_cast<size_t>(oend - op)) return 0;
+
+         if (literals >= 15) {
+            *op++ = 15 << 4;
+            op = writeLength(op, literals - 15);
+         } else {
+            *op++ = static_cast<uint8_t>(literals << 4);
+         }
+         // An empty input may come with a null pointer, which memcpy must not get.
+         if (literals > 0) std::memcpy(op, anchor, literals);
+         op += literals;
+
+         return static_cast<size_t>(op - dst);
+      }
+
+      int Decompress(const uint8_t *src, size_t size, uint8_t *dst, size_t capacity, size_t &written) {
+         const uint8_t *ip = src;
+         const uint8_t *const iend = src + size;
+         uint8_t *op = dst;
+         uint8_t *const oend = dst + capacity;
+
+         written = 0;
+         if (size == 0) return 1;
+
+         for (;;) {
+            const uint8_t token = *ip++;
+
+            size_t literals = token >> 4;
+            if (literals == 15) {
+               uint8_t byte;
+               do {
+                  if (ip >= iend) return 1;
+                  byte = *ip++;
+                  literals += byte;
+               } while (byte == 255);
+            }
+            if (literals > static_cast<size_t>(iend - ip) || literals > static_cast<size_t>(oend - op)) return 1;
+            std::memcpy(op, ip, literals);
+            ip += literals;
+            op += literals;
+
+            // The last sequence has literals only.
+            if (ip == iend) break;
+
+            if (iend - ip < 2) return 1;
+            const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+            ip += 2;
+            if (offset == 0 || offset > static_cast<size_t>(op - dst)) return 1;
+
+            size_t match = token & 15;
+            if (match == 15) {
+               uint8_t byte;
+               do {
+                  if (ip >= iend) return 1;
+                  byte = *ip++;
+                  match += byte;
+               } while (byte == 255);
+            }
+            match += MIN_MATCH;
+            if (match > static_cast<size_t>(oend - op)) return 1;
+
+            const uint8_t *ref = op - offset;
+            if (offset >= match) {
+               std::memcpy(op, ref, match);
+               op += match;
+            } else {
+               // Overlapping copy repeats the last offset bytes.
+               for (size_t i = 0; i < match; ++i) *op++ = *ref++;
+            }
+
+            if (ip >= iend) return 1;
+         }
+
+         written = static_cast<size_t>(op - dst);
+         return 0;
+      }
+
+   } // namespace lz4
+
+   namespace {
+
+      const uint8_t MAGIC_0 = 'A';
+      const uint8_t MAGIC_1 = 'Z';
+      const uint8_t VERSION = 1;
+      const size_t HEADER_SIZE = 8;
+
+      /// Larger original sizes in a header are treated as corrupt rather than allocated.
+      const uint32_t MAX_ORIGINAL_SIZE = 64 * 1024 * 1024;
+
+   } // namespace
+
+   std::atomic<bool> PayloadCodec::s_enabled(false);
+   std::atomic<uint32_t> PayloadCodec::s_threshold(PayloadCodec::DEFAULT_THRESHOLD);
+   std::atomic<uint64_t> PayloadCodec::s_compressed(0);
+   std::atomic<uint64_t> PayloadCodec::s_incompressible(0);
+   std::atomic<uint64_t> PayloadCodec::s_bytesIn(0);
+   std::atomic<uint64_t> PayloadCodec::s_bytesOut(0);
+   std::atomic<uint64_t> PayloadCodec::s_decompressed(0);
+   std::atomic<uint64_t> PayloadCodec::s_errors(0);
+   std::atomic<uint64_t> PayloadCodec::s_withheld(0);
+   std::mutex PayloadCodec::s_peerMutex;
+   std::map<eprosima::fastrtps::rtps::GuidPrefix_t, int> PayloadCodec::s_peersWithoutCapability;
+   std::atomic<size_t> PayloadCodec::s_peerCount(0);
+
+   constexpr const char *PayloadCodec::CAPABILITY;
+   constexpr const char *PayloadCodec::CAPABILITY_VALUE;
+   constexpr uint32_t PayloadCodec::DEFAULT_THRESHOLD;
+
+   void PayloadCodec::SetEnabled(bool enabled) {
+      s_enabled = enabled;
+   }
+
+   bool PayloadCodec::IsEnabled() {
+      return s_enabled;
+   }
+
+   void PayloadCodec::SetThreshold(uint32_t bytes) {
+      s_threshold = bytes;
+   }
+
+   uint32_t PayloadCodec::Threshold() {
+      return s_threshold;
+   }
+
+   PayloadCodec::Stats PayloadCodec::GetStats() {
+      Stats stats;
+      stats.compressed = s_compressed;
+      stats.incompressible = s_incompressible;
+      stats.bytesIn = s_bytesIn;
+      stats.bytesOut = s_bytesOut;
+      stats.decompressed = s_decompressed;
+      stats.errors = s_errors;
+      stats.withheld = s_withheld;
+      return stats;
+   }
+
+   void PayloadCodec::Advertise(eprosima::fastrtps::rtps::PropertyPolicy &properties) {
+      // Propagated properties are sent with the participant announcement.
+      properties.properties().emplace_back(CAPABILITY, CAPABILITY_VALUE, true);
+   }
+
+   void PayloadCodec::OnParticipantDiscovery(const eprosima::fastrtps::rtps::ParticipantDiscoveryInfo &info) {
+      typedef eprosima::fastrtps::rtps::ParticipantDiscoveryInfo Info;
+
+      const bool discovered = info.status == Info::DISCOVERED_PARTICIPANT;
+      const bool removed = info.status == Info::REMOVED_PARTICIPANT || info.status == Info::DROPPED_PARTICIPANT;
+      if (!discovered && !removed) return;
+
+      const eprosima::fastrtps::rtps::GuidPrefix_t &prefix = info.info.m_guid.guidPrefix;
+
+      std::lock_guard<std::mutex> lock(s_peerMutex);
+      if (removed) {
+         auto it = s_peersWithoutCapability.find(prefix);
+         if (it != s_peersWithoutCapability.end() && --it->second == 0) s_peersWithoutCapability.erase(it);
+      } else {
+         for (const auto &property : info.info.m_properties) {
+            if (property.first() == CAPABILITY && property.second() == CAPABILITY_VALUE) return;
+         }
+         ++s_peersWithoutCapability[prefix];
+      }
+      s_peerCount = s_peersWithoutCapability.size();
+   }
+
+   size_t PayloadCodec::PeersWithoutCapability() {
+      return s_peerCount;
+   }
+
+   void PayloadCodec::OnWriterCreated(
+      eprosima::fastrtps::Participant *participant, const std::string &topicName, bool durable
+   ) {
+      eprosima::fastdds::dds::TopicDataType *type = nullptr;
+      if (!eprosima::fastrtps::Domain::getRegisteredType(participant, topicName.c_str(), &type)) return;
+
+      PayloadEncoding *encoding = dynamic_cast<PayloadEncoding *>(type);
+      if (encoding != nullptr) encoding->AllowEncoding(!durable);
+   }
+
+   void PayloadCodec::Encode(eprosima::fastrtps::rtps::SerializedPayload_t *payload) {
+      if (!s_enabled.load(std::memory_order_relaxed)) return;
+
+      const uint32_t length = payload->length;
+      if (length < s_threshold.load(std::memory_order_relaxed) || length <= HEADER_SIZE) return;
+
+      if (s_peerCount.load(std::memory_order_relaxed) != 0) {
+         s_withheld.fetch_add(1, std::memory_order_relaxed);
+         return;
+      }
+
+      // Only worth sending compressed if the result, header included, is smaller.
+      static thread_local std::vector<uint8_t> buffer;
+      if (buffer.size() < length) buffer.resize(length);
+
+      const size_t compressed = lz4::Compress(
+         payload->data, length, buffer.data() + HEADER_SIZE, length - HEADER_SIZE - 1
+      );
+      if (compressed == 0) {
+         s_incompressible.fetch_add(1, std::memory_order_relaxed);
+         return;
+      }
+
+      buffer[0] = MAGIC_0;
+      buffer[1] = MAGIC_1;
+      buffer[2] = VERSION;
+      buffer[3] = 0;
+      buffer[4] = static_cast<uint8_t>(length);
+      buffer[5] = static_cast<uint8_t>(length >> 8);
+      buffer[6] = static_cast<uint8_t>(length >> 16);
+      buffer[7] = static_cast<uint8_t>(length >> 24);
+
+      std::memcpy(payload->data, buffer.data(), HEADER_SIZE + compressed);
+      payload->length = static_cast<uint32_t>(HEADER_SIZE + compressed);
+
+      s_compressed.fetch_add(1, std::memory_order_relaxed);
+      s_bytesIn.fetch_add(length, std::memory_order_relaxed);
+      s_bytesOut.fetch_add(payload->length, std::memory_order_relaxed);
+   }
+
+   eprosima::fastrtps::rtps::SerializedPayload_t *PayloadCodec::Decode(
+      eprosima::fastrtps::rtps::SerializedPayload_t *payload
+   ) {
+      const uint8_t *data = payload->data;
+      if (payload->length < HEADER_SIZE || data[0] != MAGIC_0 || data[1] != MAGIC_1) return payload;
+
+      const uint32_t original = static_cast<uint32_t>(data[4]) | (static_cast<uint32_t>(data[5]) << 8) |
+                                (static_cast<uint32_t>(data[6]) << 16) | (static_cast<uint32_t>(data[7]) << 24);
+
+      static thread_local eprosima::fastrtps::rtps::SerializedPayload_t plain;
+      size_t written = 0;
+      if (data[2] != VERSION || original > MAX_ORIGINAL_SIZE) {
+         s_errors.fetch_add(1, std::memory_order_relaxed);
+         return nullptr;
+      }
+
+      plain.reserve(original);
+      if (lz4::Decompress(data + HEADER_SIZE, payload->length - HEADER_SIZE, plain.data, original, written) != 0 ||
+          written != original) {
+         s_errors.fetch_add(1, std::memory_order_relaxed);
+         return nullptr;
+      }
+
+      plain.length = original;
+      plain.encapsulation = payload->encapsulation;
+      plain.pos = 0;
+      s_decompressed.fetch_add(1, std::memory_order_relaxed);
+      return &plain;
+   }
+
+} // namespace AMM
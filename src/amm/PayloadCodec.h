@@ -0,0 +1,219 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/participant/Participant.h>
+#include <fastrtps/rtps/attributes/PropertyPolicy.h>
+#include <fastrtps/rtps/participant/ParticipantDiscoveryInfo.h>
+
+namespace AMM {
+
+    /// LZ4 block format codec, compatible with LZ4_compress_default / LZ4_decompress_safe.
+    ///
+    /// Greedy single pass matcher with a 4K entry hash table: fast rather than tight, which is
+    /// what repetitive XML and JSON payloads need to fit in fewer datagrams.
+    namespace lz4 {
+
+        /// @returns Largest compressed size for an input of the given size.
+        inline size_t CompressBound(size_t size) { return size + size / 255 + 16; }
+
+        /// Compress a block.
+        /// @param src Input.
+        /// @param size Input size.
+        /// @param dst Output buffer.
+        /// @param capacity Output buffer size.
+        /// @returns Compressed size, 0 if it does not fit in capacity.
+        size_t Compress(const uint8_t *src, size_t size, uint8_t *dst, size_t capacity);
+
+        /// Decompress a block.  Safe against malformed input.
+        /// @param src Compressed input.
+        /// @param size Compressed size.
+        /// @param dst Output buffer.
+        /// @param capacity Output buffer size.
+        /// @param written Decompressed size output.
+        /// @returns 0 if successful, 1 if the input is malformed or does not fit in capacity.
+        int Decompress(const uint8_t *src, size_t size, uint8_t *dst, size_t capacity, size_t &written);
+
+    } // namespace lz4
+
+    /// Optional compression of serialized samples for the topics with large string fields.
+    ///
+    /// Decoding is always on: a compressed payload is recognized by its header and decompressed
+    /// before the regular CDR deserialization.  Encoding is off by default and enabled per process
+    /// with SetEnabled; older readers reject compressed samples as an unknown encapsulation.
+    ///
+    /// Every participant DDSManager, StaticDiscovery and DiscoveryServer create advertises the
+    /// CAPABILITY property, and the participant listener of each reports every discovered participant
+    /// to OnParticipantDiscovery.  A writer sends the same payload to all of its readers, so even when
+    /// enabled, payloads are only compressed while every participant discovered in the process
+    /// advertises the capability; one older module joining the network turns compression off until it
+    /// leaves.
+    ///
+    /// Only volatile writers compress.  A Transient Local writer keeps its samples and replays them to
+    /// readers that match later, which may be older modules joining after the sample was compressed.
+    /// Fast-RTPS writers are Transient Local unless AmmDataType makes them volatile, so with the
+    /// standard QoS the large-string topics, Module Configuration and Operational Description among
+    /// them, are always sent plain; AmmDataType reports each writer's durability to OnWriterCreated.
+    ///
+    /// Payloads at least Threshold() bytes long are compressed whole, and sent compressed only if
+    /// that saves space.  Layout: 'A' 'Z' version reserved, original length (uint32 little endian),
+    /// LZ4 block of the original payload including its encapsulation header.
+    class PayloadCodec {
+
+    public:
+        /// Participant property announcing that a module decodes compressed payloads.
+        static constexpr const char *CAPABILITY = "amm.payload_codec";
+
+        /// Value of the CAPABILITY property for this codec.
+        static constexpr const char *CAPABILITY_VALUE = "lz4";
+
+        static constexpr uint32_t DEFAULT_THRESHOLD = 1024;
+
+        struct Stats {
+            uint64_t compressed = 0;
+
+            /// Payloads above the threshold sent plain because they did not shrink.
+            uint64_t incompressible = 0;
+
+            uint64_t bytesIn = 0;
+
+            uint64_t bytesOut = 0;
+
+            uint64_t decompressed = 0;
+
+            /// Compressed payloads that failed to decode.
+            uint64_t errors = 0;
+
+            /// Payloads above the threshold sent plain because a discovered participant cannot decode them.
+            uint64_t withheld = 0;
+        };
+
+        /// @param enabled State of whether outgoing payloads are compressed.
+        static void SetEnabled(bool enabled);
+
+        static bool IsEnabled();
+
+        /// @param bytes Smallest serialized payload that is compressed.
+        static void SetThreshold(uint32_t bytes);
+
+        static uint32_t Threshold();
+
+        /// @returns Process wide codec statistics.
+        static Stats GetStats();
+
+        /// Advertise the CAPABILITY property on a participant about to be created.
+        /// @param properties Properties of the participant attributes.
+        static void Advertise(eprosima::fastrtps::rtps::PropertyPolicy &properties);
+
+        /// Track whether a discovered participant advertises CAPABILITY.
+        /// Called by the participant listener of every DDSManager; a participant seen by several local
+        /// participants is counted until the last of them loses it.
+        /// @param info Discovery event.
+        static void OnParticipantDiscovery(const eprosima::fastrtps::rtps::ParticipantDiscoveryInfo &info);
+
+        /// @returns Number of discovered participants that do not advertise CAPABILITY.
+        static size_t PeersWithoutCapability();
+
+        /// Allow or forbid compression for the writers of a topic, from their durability.
+        /// Does nothing for types that are not a CompressedPubSubType.
+        /// @param participant Participant the topic type is registered on.
+        /// @param topicName Topic, which is also the type name.
+        /// @param durable State of whether the writer keeps samples for readers that match later.
+        static void OnWriterCreated(
+           eprosima::fastrtps::Participant *participant, const std::string &topicName, bool durable
+        );
+
+        /// Compress a serialized payload in place when enabled, large enough and compressible.
+        /// @param payload Serialized payload.
+        static void Encode(eprosima::fastrtps::rtps::SerializedPayload_t *payload);
+
+        /// Undo Encode.
+        /// @param payload Received payload.
+        /// @returns payload itself if it is not compressed, a per thread buffer holding the original
+        /// payload, or null if it is compressed but malformed.
+        static eprosima::fastrtps::rtps::SerializedPayload_t *Decode(eprosima::fastrtps::rtps::SerializedPayload_t *payload);
+
+    private:
+        static std::atomic<bool> s_enabled;
+
+        static std::atomic<uint32_t> s_threshold;
+
+        static std::atomic<uint64_t> s_compressed;
+
+        static std::atomic<uint64_t> s_incompressible;
+
+        static std::atomic<uint64_t> s_bytesIn;
+
+        static std::atomic<uint64_t> s_bytesOut;
+
+        static std::atomic<uint64_t> s_decompressed;
+
+        static std::atomic<uint64_t> s_errors;
+
+        static std::atomic<uint64_t> s_withheld;
+
+        /// Guards s_peersWithoutCapability.
+        static std::mutex s_peerMutex;
+
+        /// Discovered participants without the capability, with the number of local participants seeing each.
+        static std::map<eprosima::fastrtps::rtps::GuidPrefix_t, int> s_peersWithoutCapability;
+
+        /// Size of s_peersWithoutCapability, read by Encode without the lock.
+        static std::atomic<size_t> s_peerCount;
+
+    }; // class PayloadCodec
+
+    /// Per type switch for PayloadCodec::Encode, set by PayloadCodec::OnWriterCreated.
+    class PayloadEncoding {
+
+    public:
+        virtual ~PayloadEncoding() = default;
+
+        /// @param allowed State of whether samples of the type may be compressed.
+        void AllowEncoding(bool allowed) { m_allowed = allowed; }
+
+        bool IsEncodingAllowed() const { return m_allowed; }
+
+    private:
+        std::atomic<bool> m_allowed{false};
+
+    }; // class PayloadEncoding
+
+    /// TopicDataType wrapper adding PayloadCodec to a generated PubSubType.
+    ///
+    /// Used by DDSManager for the topics with large string fields, e.g.
+    /// CompressedPubSubType<AMM::ModuleConfigurationPubSubType>.  Behaves exactly like Base while
+    /// encoding is disabled or not allowed for the type, and the received payloads are plain.
+    template<class Base>
+    class CompressedPubSubType : public Base, public PayloadEncoding {
+
+    public:
+        using Base::serialize;
+
+        using Base::getSerializedSizeProvider;
+
+        bool serialize(
+           void *data, eprosima::fastrtps::rtps::SerializedPayload_t *payload,
+           eprosima::fastdds::dds::DataRepresentationId_t dataRepresentation
+        ) override {
+           if (!Base::serialize(data, payload, dataRepresentation)) return false;
+           if (IsEncodingAllowed()) PayloadCodec::Encode(payload);
+           return true;
+        }
+
+        bool deserialize(eprosima::fastrtps::rtps::SerializedPayload_t *payload, void *data) override {
+           eprosima::fastrtps::rtps::SerializedPayload_t *plain = PayloadCodec::Decode(payload);
+           return plain != nullptr && Base::deserialize(plain, data);
+        }
+
+    }; // class CompressedPubSubType
+
+} // namespace AMM
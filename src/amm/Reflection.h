@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include <boost/utility/string_view.hpp>
+
+namespace AMM {
+
+    /// Compile-time field reflection for the classes generated from the AMM IDL.
+    ///
+    /// Specializations are generated by IDL/gen_reflection.py into AMM_StandardReflection.h and
+    /// AMM_ExtendedReflection.h.  For a struct type T:
+    ///
+    ///     reflection::Struct<T>::Name()                       "Log"
+    ///     reflection::Struct<T>::Count                        number of fields
+    ///     reflection::Struct<T>::ForEach(sample, visitor)     visitor(name, field) per field in IDL order
+    ///     reflection::Struct<T>::Visit(sample, name, visitor) visitor(field) for one field by name
+    ///
+    /// Fields are passed as the generated accessors return them, so a non-const sample yields
+    /// references that can be assigned.  For an enum type E, reflection::Enum<E> provides Name(),
+    /// Count and Names(), indexed by enumerator value.
+    namespace reflection {
+
+        template<class T>
+        struct Struct;
+
+        template<class T>
+        struct Enum;
+
+        /// True for generated struct types.
+        template<class T, class = void>
+        struct IsStruct : std::false_type {
+        };
+
+        template<class T>
+        struct IsStruct<T, decltype(void(Struct<T>::Count))> : std::true_type {
+        };
+
+        /// True for generated enum types.
+        template<class T, class = void>
+        struct IsEnum : std::false_type {
+        };
+
+        template<class T>
+        struct IsEnum<T, decltype(void(Enum<T>::Count))> : std::true_type {
+        };
+
+        /// @returns Name of an enumerator, nullptr if value is out of range.
+        template<class E>
+        const char *EnumName(E value) {
+           const size_t index = static_cast<size_t>(value);
+           return index < Enum<E>::Count ? Enum<E>::Names()[index] : nullptr;
+        }
+
+        /// @param name Enumerator name.
+        /// @param value Enumerator output.
+        /// @returns True if the name exists.
+        template<class E>
+        bool EnumValue(boost::string_view name, E &value) {
+           for (size_t i = 0; i < Enum<E>::Count; ++i) {
+              if (name == Enum<E>::Names()[i]) {
+                 value = static_cast<E>(i);
+                 return true;
+              }
+           }
+           return false;
+        }
+
+    } // namespace reflection
+
+} // namespace AMM
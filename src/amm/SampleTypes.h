@@ -0,0 +1,63 @@
+#pragma once
+
+#include "AMM_Standard.h"
+#include "AMM_StandardPubSubTypes.h"
+#include "AMM_Extended.h"
+#include "AMM_ExtendedPubSubTypes.h"
+
+namespace AMM {
+
+/// Sample types DDSManager uses for the topics that have bounded variants.
+///
+/// By default these are the standard types.  Building with AMM_BOUNDED_TYPES switches them to the
+/// Bounded types from AMM_Extended.idl, which serialize identically but cap name, unit and message
+/// lengths, so AmmDataType can preallocate every sample and publishing or receiving does not touch
+/// the heap once warmed up.  Modules built either way interoperate; strings longer than the bounds
+/// are truncated on assignment, and when received from a module built without AMM_BOUNDED_TYPES.
+/// Subscribers keep PREALLOCATED_WITH_REALLOC_MEMORY_MODE for that reason: in PREALLOCATED_MEMORY_MODE
+/// Fast-RTPS drops a sample larger than the preallocated payload instead of delivering it.
+///
+/// The Bounded types are declared in IDL/AMM_Extended.idl.  Their checked in code is not fastddsgen
+/// output: IDL/gen_bounded.py (the generate_bounded target) derives it from the generated code of the
+/// standard types, so regenerate it with generate_from_idl_standard, generate_from_idl_extended,
+/// generate_bounded and generate_reflection, in that order.
+///
+/// Code that has to compile both ways should use these names and access string fields through
+/// c_str() and size(), or assign them with operator=.
+#ifdef AMM_BOUNDED_TYPES
+    typedef BoundedUUID UUIDSample;
+
+    typedef BoundedLog LogSample;
+    typedef BoundedLogPubSubType LogSamplePubSubType;
+
+    typedef BoundedPhysiologyValue PhysiologyValueSample;
+    typedef BoundedPhysiologyValuePubSubType PhysiologyValueSamplePubSubType;
+
+    typedef BoundedPhysiologyWaveform PhysiologyWaveformSample;
+    typedef BoundedPhysiologyWaveformPubSubType PhysiologyWaveformSamplePubSubType;
+
+    typedef BoundedStatus StatusSample;
+    typedef BoundedStatusPubSubType StatusSamplePubSubType;
+
+    typedef BoundedCommand CommandSample;
+    typedef BoundedCommandPubSubType CommandSamplePubSubType;
+#else
+    typedef UUID UUIDSample;
+
+    typedef Log LogSample;
+    typedef LogPubSubType LogSamplePubSubType;
+
+    typedef PhysiologyValue PhysiologyValueSample;
+    typedef PhysiologyValuePubSubType PhysiologyValueSamplePubSubType;
+
+    typedef PhysiologyWaveform PhysiologyWaveformSample;
+    typedef PhysiologyWaveformPubSubType PhysiologyWaveformSamplePubSubType;
+
+    typedef Status StatusSample;
+    typedef StatusPubSubType StatusSamplePubSubType;
+
+    typedef Command CommandSample;
+    typedef CommandPubSubType CommandSamplePubSubType;
+#endif
+
+} // namespace AMM
@@ -0,0 +1,112 @@
+#include "StartupTimeline.h"
+
+#include <cstdio>
+
+namespace AMM {
+
+   StartupTimeline::StartupTimeline() : m_start(std::chrono::steady_clock::now()) {
+      for (int i = 0; i < STAGE_COUNT; ++i) {
+         m_elapsed[i] = std::chrono::steady_clock::duration::zero();
+         m_isReached[i] = false;
+      }
+   }
+
+   void StartupTimeline::Mark(Stage stage) {
+      const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+      std::lock_guard<std::mutex> lock(m_mutex);
+      MarkLocked(stage, now);
+   }
+
+   void StartupTimeline::MarkLocked(Stage stage, std::chrono::steady_clock::time_point now) {
+      if (m_isReached[stage]) return;
+      m_elapsed[stage] = now - m_start;
+      m_isReached[stage] = true;
+      m_stageReached.notify_all();
+   }
+
+   bool StartupTimeline::Reached(Stage stage) const {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_isReached[stage];
+   }
+
+   double StartupTimeline::Elapsed(Stage stage) const {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_isReached[stage]) return -1.0;
+      return std::chrono::duration<double, std::milli>(m_elapsed[stage]).count();
+   }
+
+   void StartupTimeline::ExpectEndpoints(const std::set<const void *> &endpoints) {
+      const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_expected = endpoints;
+      m_expectedMatched = 0;
+      for (const void *endpoint : m_expected) {
+         if (m_matched.count(endpoint) != 0) ++m_expectedMatched;
+      }
+      if (!m_expected.empty() && m_expectedMatched == m_expected.size()) MarkLocked(ENDPOINTS_MATCHED, now);
+   }
+
+   void StartupTimeline::EndpointMatched(const void *endpoint) {
+      const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_matched.insert(endpoint).second || m_expected.count(endpoint) == 0) return;
+      ++m_expectedMatched;
+      if (m_expectedMatched == m_expected.size()) MarkLocked(ENDPOINTS_MATCHED, now);
+   }
+
+   std::size_t StartupTimeline::MatchedEndpoints() const {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_expectedMatched;
+   }
+
+   std::size_t StartupTimeline::ExpectedEndpoints() const {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_expected.size();
+   }
+
+   bool StartupTimeline::Wait(Stage stage, std::chrono::milliseconds timeout) const {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      return m_stageReached.wait_for(lock, timeout, [this, stage] { return m_isReached[stage]; });
+   }
+
+   std::string StartupTimeline::Format() const {
+      std::string text;
+      char line[128];
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+      for (int i = 0; i < STAGE_COUNT; ++i) {
+         const Stage stage = static_cast<Stage>(i);
+         if (m_isReached[i]) {
+            std::snprintf(line, sizeof(line), "%-24s %10.1f ms\n", StageName(stage),
+               std::chrono::duration<double, std::milli>(m_elapsed[i]).count());
+         } else {
+            std::snprintf(line, sizeof(line), "%-24s %10s\n", StageName(stage), "-");
+         }
+         text += line;
+      }
+
+      std::snprintf(line, sizeof(line), "%-24s %7zu of %zu\n", "matched endpoints", m_expectedMatched, m_expected.size());
+      text += line;
+      return text;
+   }
+
+   const char *StartupTimeline::StageName(Stage stage) {
+      switch (stage) {
+         case PROFILE_LOADED:
+            return "profile loaded";
+         case PARTICIPANT_CREATED:
+            return "participant created";
+         case TYPES_REGISTERED:
+            return "types registered";
+         case ENDPOINTS_CREATED:
+            return "endpoints created";
+         case PARTICIPANT_DISCOVERED:
+            return "participant discovered";
+         case ENDPOINTS_MATCHED:
+            return "endpoints matched";
+         default:
+            return "unknown";
+      }
+   }
+
+} // namespace AMM
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <string>
+
+namespace AMM {
+
+    /// One topic of a DDSManager::Setup call.
+    struct TopicSetup {
+        enum Role {
+            /// Create a Publisher for the topic.
+            PUBLISH = 1,
+
+            /// Create a Subscriber for the topic.  Callbacks are bound afterwards with the topic's
+            /// Create Subscriber method, which keeps the Subscriber created here.
+            SUBSCRIBE = 2
+        };
+
+        /// Topic name, e.g. "Physiology Value".
+        std::string topic;
+
+        /// Combination of Role flags.  Zero only registers the type.
+        unsigned roles;
+    };
+
+    /// Milestones of a module's start up, measured from the construction of its DDSManager.
+    ///
+    /// DDSManager marks the local stages itself and the remote ones from its participant, publisher
+    /// and subscriber listeners, so this is updated from DDS threads and safe to read from any thread.
+    class StartupTimeline {
+
+    public:
+        enum Stage {
+            /// XML profiles file loaded.
+            PROFILE_LOADED,
+
+            /// Domain Participant created.
+            PARTICIPANT_CREATED,
+
+            /// Types of the topics passed to DDSManager::Setup registered.
+            TYPES_REGISTERED,
+
+            /// Publishers and Subscribers of DDSManager::Setup created.
+            ENDPOINTS_CREATED,
+
+            /// First remote participant discovered.
+            PARTICIPANT_DISCOVERED,
+
+            /// Every endpoint DDSManager::Setup created matched at least one remote endpoint.
+            ENDPOINTS_MATCHED,
+
+            STAGE_COUNT
+        };
+
+        /// Starts the timeline now.
+        StartupTimeline();
+
+        /// Record that a stage was reached.  Only the first call per stage counts.
+        /// @param stage Stage reached.
+        void Mark(Stage stage);
+
+        /// @param stage Stage.
+        /// @returns True if the stage was reached.
+        bool Reached(Stage stage) const;
+
+        /// @param stage Stage.
+        /// @returns Milliseconds from the start to the stage, or -1 if it was not reached.
+        double Elapsed(Stage stage) const;
+
+        /// Set the local endpoints that have to match before ENDPOINTS_MATCHED is reached.
+        /// Matches of other endpoints, before or after, do not count towards it.
+        /// @param endpoints Local Publishers and Subscribers.
+        void ExpectEndpoints(const std::set<const void *> &endpoints);
+
+        /// Record that a local endpoint matched a remote one.
+        /// @param endpoint Local Publisher or Subscriber.
+        void EndpointMatched(const void *endpoint);
+
+        /// @returns Number of expected local endpoints that matched at least once.
+        std::size_t MatchedEndpoints() const;
+
+        /// @returns Number of local endpoints expected to match.
+        std::size_t ExpectedEndpoints() const;
+
+        /// Block until a stage is reached.
+        /// @param stage Stage to wait for.
+        /// @param timeout Longest time to wait.
+        /// @returns True if the stage was reached, false on time out.
+        bool Wait(Stage stage, std::chrono::milliseconds timeout) const;
+
+        /// @returns One line per stage with its time, as text.
+        std::string Format() const;
+
+        /// @param stage Stage.
+        /// @returns Short name of the stage.
+        static const char *StageName(Stage stage);
+
+    private:
+        void MarkLocked(Stage stage, std::chrono::steady_clock::time_point now);
+
+        std::chrono::steady_clock::time_point m_start;
+
+        mutable std::mutex m_mutex;
+
+        mutable std::condition_variable m_stageReached;
+
+        std::chrono::steady_clock::duration m_elapsed[STAGE_COUNT];
+
+        bool m_isReached[STAGE_COUNT];
+
+        /// Local endpoints that matched at least once.
+        std::set<const void *> m_matched;
+
+        /// Local endpoints ENDPOINTS_MATCHED waits for.
+        std::set<const void *> m_expected;
+
+        /// Number of m_expected in m_matched.
+        std::size_t m_expectedMatched = 0;
+
+    }; // class StartupTimeline
+
+} // namespace AMM
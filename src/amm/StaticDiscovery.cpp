@@ -0,0 +1,235 @@
+#include "StaticDiscovery.h"
+
+#include <fstream>
+#include <sstream>
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+
+#include <fastrtps/Domain.h>
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
+#include "PayloadCodec.h"
+
+namespace AMM {
+
+   namespace {
+
+      /// Topics in DDSManager order.  Endpoint ids derive from the position, so only append.
+      const char *const TOPICS[] = {
+         "Assessment",
+         "Event Fragment",
+         "Event Record",
+         "Fragment Amendment Request",
+         "Log",
+         "Module Configuration",
+         "Omitted Event",
+         "Operational Description",
+         "Physiology Modification",
+         "Physiology Value",
+         "Physiology Waveform",
+         "Render Modification",
+         "Simulation Control",
+         "Status",
+         "Tick",
+         "Instrument Data",
+         "Command",
+         "Physiology Frame",
+      };
+
+      std::string escape(const std::string &text) {
+         std::string out;
+         for (char c : text) {
+            switch (c) {
+               case '&': out += "&amp;"; break;
+               case '<': out += "&lt;"; break;
+               case '>': out += "&gt;"; break;
+               case '"': out += "&quot;"; break;
+               default: out += c; break;
+            }
+         }
+         return out;
+      }
+
+      /// Endpoint QoS must be the same as the one AmmDataType creates the endpoint with.
+      void appendEndpoint(std::string &xml, const std::string &topic, bool publisher) {
+         const char *tag = publisher ? "writer" : "reader";
+         const int16_t id = StaticDiscovery::EndpointId(topic, publisher);
+
+         // Publishers are reliable and transient local, except Physiology Waveform which is best
+         // effort and Physiology Frame which is best effort and volatile; Subscribers keep the
+         // Fast-RTPS defaults, best effort and volatile.  Status writers offer an automatic liveliness
+         // lease of one second; readers are listed with the default infinite lease, which a reader
+         // requesting the one second lease (see AmmDataType::RequestLivelinessLease) still matches.
+         const bool frame = topic == "Physiology Frame";
+         const bool reliable = publisher && !frame && topic != "Physiology Waveform";
+         const char *reliability = reliable ? "RELIABLE_RELIABILITY_QOS" : "BEST_EFFORT_RELIABILITY_QOS";
+         const char *durability = publisher && !frame ? "TRANSIENT_LOCAL_DURABILITY_QOS" : "VOLATILE_DURABILITY_QOS";
+
+         std::ostringstream out;
+         out << "    <" << tag << ">\n"
+             << "      <userId>" << id << "</userId>\n"
+             << "      <entityID>" << id << "</entityID>\n"
+             << "      <topicName>" << escape(topic) << "</topicName>\n"
+             << "      <topicDataType>" << escape(topic) << "</topicDataType>\n"
+             << "      <topicKind>NO_KEY</topicKind>\n"
+             << "      <reliabilityQos>" << reliability << "</reliabilityQos>\n"
+             << "      <durabilityQos>" << durability << "</durabilityQos>\n"
+             << (publisher && topic == "Status"
+                    ? "      <livelinessQos kind=\"AUTOMATIC_LIVELINESS_QOS\" leaseDuration_ms=\"1000\"/>\n" : "")
+             << "    </" << tag << ">\n";
+         xml += out.str();
+      }
+
+   } // namespace
+
+   constexpr int16_t StaticDiscovery::FIRST_ENDPOINT_ID;
+
+   int StaticDiscovery::ParseManifest(
+      const std::string &xml, std::vector<ModuleManifest> &modules, std::string &errmsg
+   ) {
+      boost::property_tree::ptree tree;
+      try {
+         std::istringstream stream(xml);
+         boost::property_tree::read_xml(stream, tree, boost::property_tree::xml_parser::trim_whitespace);
+      } catch (boost::property_tree::xml_parser_error &e) {
+         errmsg = "Module manifest is not valid XML -- ";
+         errmsg.append(e.what());
+         return 1;
+      }
+
+      boost::optional<boost::property_tree::ptree &> root = tree.get_child_optional("manifest");
+      if (!root) {
+         errmsg = "Module manifest has no manifest element.";
+         return 1;
+      }
+
+      std::vector<ModuleManifest> parsed;
+      for (const auto &child : *root) {
+         if (child.first != "module") continue;
+
+         ModuleManifest module;
+         module.name = child.second.get<std::string>("<xmlattr>.name", "");
+         if (module.name.empty()) {
+            errmsg = "Module manifest has a module without a name.";
+            return 1;
+         }
+
+         for (const auto &endpoint : child.second) {
+            unsigned role;
+            if (endpoint.first == "publish") {
+               role = TopicSetup::PUBLISH;
+            } else if (endpoint.first == "subscribe") {
+               role = TopicSetup::SUBSCRIBE;
+            } else {
+               continue;
+            }
+
+            const std::string topic = endpoint.second.get_value<std::string>();
+            if (EndpointId(topic, true) < 0) {
+               errmsg = "Module manifest lists unknown topic " + topic + " for " + module.name + ".";
+               return 1;
+            }
+
+            bool merged = false;
+            for (TopicSetup &setup : module.topics) {
+               if (setup.topic == topic) {
+                  setup.roles |= role;
+                  merged = true;
+               }
+            }
+            if (!merged) module.topics.push_back(TopicSetup{topic, role});
+         }
+
+         parsed.push_back(module);
+      }
+
+      modules.swap(parsed);
+      return 0;
+   }
+
+   int StaticDiscovery::LoadManifest(
+      const std::string &path, std::vector<ModuleManifest> &modules, std::string &errmsg
+   ) {
+      std::ifstream file(path);
+      if (!file) {
+         errmsg = "Unable to open module manifest " + path + ".";
+         return 1;
+      }
+      std::stringstream contents;
+      contents << file.rdbuf();
+      return ParseManifest(contents.str(), modules, errmsg);
+   }
+
+   std::vector<TopicSetup> StaticDiscovery::TopicsOf(
+      const std::vector<ModuleManifest> &modules, const std::string &module
+   ) {
+      for (const ModuleManifest &entry : modules) {
+         if (entry.name == module) return entry.topics;
+      }
+      return std::vector<TopicSetup>();
+   }
+
+   int16_t StaticDiscovery::EndpointId(const std::string &topic, bool publisher) {
+      int16_t index = 0;
+      for (const char *name : TOPICS) {
+         if (topic == name) return static_cast<int16_t>(FIRST_ENDPOINT_ID + 2 * index + (publisher ? 0 : 1));
+         ++index;
+      }
+      return -1;
+   }
+
+   std::string StaticDiscovery::GenerateXml(const std::vector<ModuleManifest> &modules, const std::string &localModule) {
+      std::string xml = "<staticdiscovery>\n";
+      for (const ModuleManifest &module : modules) {
+         if (module.name == localModule) continue;
+
+         xml += "  <participant>\n";
+         xml += "    <name>" + escape(module.name) + "</name>\n";
+         for (const TopicSetup &setup : module.topics) {
+            if (setup.roles & TopicSetup::PUBLISH) appendEndpoint(xml, setup.topic, true);
+            if (setup.roles & TopicSetup::SUBSCRIBE) appendEndpoint(xml, setup.topic, false);
+         }
+         xml += "  </participant>\n";
+      }
+      xml += "</staticdiscovery>\n";
+      return xml;
+   }
+
+   eprosima::fastrtps::Participant *StaticDiscovery::CreateParticipant(
+      const std::string &profileName, const std::vector<ModuleManifest> &modules,
+      eprosima::fastrtps::ParticipantListener *listener, std::string &errmsg
+   ) {
+      eprosima::fastrtps::ParticipantAttributes attributes;
+      if (eprosima::fastrtps::xmlparser::XMLProfileManager::fillParticipantAttributes(profileName, attributes) !=
+          eprosima::fastrtps::xmlparser::XMLP_ret::XML_OK) {
+         errmsg = "Unable to find participant profile " + profileName + ".";
+         return nullptr;
+      }
+
+      const std::string localModule = attributes.rtps.getName();
+      if (TopicsOf(modules, localModule).empty()) {
+         errmsg = "Module manifest has no topics for " + localModule + ".";
+         return nullptr;
+      }
+
+      attributes.rtps.builtin.discovery_config.use_SIMPLE_EndpointDiscoveryProtocol = false;
+      attributes.rtps.builtin.discovery_config.use_STATIC_EndpointDiscoveryProtocol = true;
+      attributes.rtps.builtin.discovery_config.static_edp_xml_config(
+         ("data://" + GenerateXml(modules, localModule)).c_str()
+      );
+
+      PayloadCodec::Advertise(attributes.rtps.properties);
+
+      eprosima::fastrtps::Participant *participant =
+         eprosima::fastrtps::Domain::createParticipant(attributes, listener);
+      if (participant == nullptr) errmsg = "Unable to create FastRTPS domain participant with static discovery.";
+      return participant;
+   }
+
+   bool StaticDiscovery::IsEnabled(const eprosima::fastrtps::Participant *participant) {
+      return participant != nullptr &&
+             participant->getAttributes().rtps.builtin.discovery_config.use_STATIC_EndpointDiscoveryProtocol;
+   }
+
+} // namespace AMM
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fastrtps/attributes/ParticipantAttributes.h>
+#include <fastrtps/participant/Participant.h>
+#include <fastrtps/participant/ParticipantListener.h>
+
+#include "StartupTimeline.h"
+
+namespace AMM {
+
+    /// Topics one module publishes and subscribes to, as listed in a module manifest.
+    struct ModuleManifest {
+        /// Participant name of the module, as set in its XML profile.
+        std::string name;
+
+        std::vector<TopicSetup> topics;
+    };
+
+    /// Static endpoint discovery for deployments whose module set is known ahead of time.
+    ///
+    /// Simple endpoint discovery has every participant announce every endpoint to every other
+    /// participant and match them one by one, which takes seconds to settle on a full manikin.  With a
+    /// manifest listing each module and its topics, every participant is told the remote endpoints up
+    /// front through Fast-RTPS static EDP, so endpoints match as soon as their participant is discovered
+    /// and no endpoint announcements are sent.  Participant discovery itself still runs.
+    ///
+    /// A manifest is XML:
+    /// @code
+    /// <manifest>
+    ///    <module name="AMM_PhysiologyEngine">
+    ///       <publish>Physiology Value</publish>
+    ///       <subscribe>Simulation Control</subscribe>
+    ///    </module>
+    /// </manifest>
+    /// @endcode
+    /// Every module of the deployment must use the same manifest, and create exactly the endpoints it
+    /// lists for itself (DDSManager::ManifestTopics); endpoints missing from the manifest never match.
+    class StaticDiscovery {
+
+    public:
+        /// Endpoint ids start here, clear of the ids Fast-RTPS assigns to endpoints created without one.
+        static constexpr int16_t FIRST_ENDPOINT_ID = 256;
+
+        /// Parse a manifest.
+        /// @param xml Manifest text.
+        /// @param modules Modules output.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        static int ParseManifest(const std::string &xml, std::vector<ModuleManifest> &modules, std::string &errmsg);
+
+        /// Read and parse a manifest file.
+        /// @param path Manifest file.
+        /// @param modules Modules output.
+        /// @param errmsg Error message output.
+        /// @returns 0 if successful.
+        static int LoadManifest(const std::string &path, std::vector<ModuleManifest> &modules, std::string &errmsg);
+
+        /// @param modules Manifest.
+        /// @param module Participant name of a module.
+        /// @returns Topics of the module, empty if it is not in the manifest.
+        static std::vector<TopicSetup> TopicsOf(const std::vector<ModuleManifest> &modules, const std::string &module);
+
+        /// Id of an endpoint, the same in every module.
+        /// @param topic Topic name.
+        /// @param publisher True for the Publisher, false for the Subscriber.
+        /// @returns Id used as both user defined id and entity id, or -1 if the topic is unknown.
+        static int16_t EndpointId(const std::string &topic, bool publisher);
+
+        /// Generate the static EDP description of every module except the local one.
+        /// @param modules Manifest.
+        /// @param localModule Participant name of this module.
+        /// @returns Fast-RTPS static discovery XML.
+        static std::string GenerateXml(const std::vector<ModuleManifest> &modules, const std::string &localModule);
+
+        /// Create a participant from an XML profile, switched to static endpoint discovery.
+        /// @param profileName Participant profile, already loaded.
+        /// @param modules Manifest.
+        /// @param listener Participant listener, may be null.
+        /// @param errmsg Error message output.
+        /// @returns Participant, or null on error.
+        static eprosima::fastrtps::Participant *CreateParticipant(
+           const std::string &profileName, const std::vector<ModuleManifest> &modules,
+           eprosima::fastrtps::ParticipantListener *listener, std::string &errmsg
+        );
+
+        /// @param participant Participant.
+        /// @returns True if the participant uses static endpoint discovery.
+        static bool IsEnabled(const eprosima::fastrtps::Participant *participant);
+
+    }; // class StaticDiscovery
+
+} // namespace AMM
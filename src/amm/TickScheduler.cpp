@@ -0,0 +1,264 @@
+#include "TickScheduler.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace AMM {
+
+   struct TickScheduler::TaskEntry {
+      TaskId id;
+      bool byFrame;
+      int64_t periodFrames;
+      float periodSeconds;
+      std::chrono::microseconds deadline;
+      Task task;
+
+      // Only touched by the scheduler thread.
+      bool hasRun = false;
+      int64_t lastFrame = 0;
+      float lastTime = 0.0f;
+      float nextTime = 0.0f;
+      double lastLatencyUs = 0.0;
+
+      // Guarded by m_taskMutex.
+      bool removed = false;
+      TaskStats stats;
+   };
+
+   namespace {
+
+      inline double micros(std::chrono::steady_clock::duration d) {
+         return std::chrono::duration<double, std::micro>(d).count();
+      }
+
+   } // namespace
+
+   TickScheduler::TickScheduler() : m_running(false) {
+   }
+
+   TickScheduler::~TickScheduler() {
+      Stop();
+   }
+
+   int TickScheduler::Start() {
+      std::lock_guard<std::mutex> lock(m_tickMutex);
+      if (m_thread.joinable()) return 0;
+      if (m_stopping) return 1;
+
+      m_stopRequested = false;
+      try {
+         m_thread = std::thread(&TickScheduler::Run, this);
+      } catch (std::exception &) {
+         return 1;
+      }
+      m_running = true;
+      return 0;
+   }
+
+   int TickScheduler::Stop() {
+      std::thread thread;
+      {
+         std::lock_guard<std::mutex> lock(m_tickMutex);
+         if (!m_thread.joinable()) return 0;
+         // A task cannot join its own thread, and Run still uses this object after the task returns.
+         if (m_thread.get_id() == std::this_thread::get_id()) return 1;
+         m_stopRequested = true;
+         m_stopping = true;
+         // Only this call joins; a concurrent Stop finds no thread left.
+         thread = std::move(m_thread);
+      }
+      m_tickCondition.notify_one();
+
+      thread.join();
+
+      std::lock_guard<std::mutex> lock(m_tickMutex);
+      m_stopping = false;
+      m_running = false;
+      return 0;
+   }
+
+   bool TickScheduler::IsRunning() const {
+      return m_running;
+   }
+
+   void TickScheduler::OnTick(const AMM::Tick &tick) {
+      const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+      {
+         std::lock_guard<std::mutex> lock(m_tickMutex);
+         ++m_stats.ticksReceived;
+         if (m_hasPending) ++m_stats.ticksCoalesced;
+         m_pending.frame = tick.frame();
+         m_pending.time = tick.time();
+         m_pending.received = now;
+         m_hasPending = true;
+      }
+      m_tickCondition.notify_one();
+   }
+
+   TickScheduler::TaskId TickScheduler::AddFrameTask(
+      int64_t frames, Task task, std::chrono::microseconds deadline
+   ) {
+      if (frames < 1 || !task) return 0;
+      return AddTask(true, frames, 0.0f, std::move(task), deadline);
+   }
+
+   TickScheduler::TaskId TickScheduler::AddTimeTask(
+      float seconds, Task task, std::chrono::microseconds deadline
+   ) {
+      if (!(seconds > 0.0f) || !task) return 0;
+      return AddTask(false, 0, seconds, std::move(task), deadline);
+   }
+
+   TickScheduler::TaskId TickScheduler::AddTask(
+      bool byFrame, int64_t frames, float seconds, Task task, std::chrono::microseconds deadline
+   ) {
+      std::shared_ptr<TaskEntry> entry = std::make_shared<TaskEntry>();
+      entry->byFrame = byFrame;
+      entry->periodFrames = frames;
+      entry->periodSeconds = seconds;
+      entry->deadline = deadline;
+      entry->task = std::move(task);
+
+      std::lock_guard<std::mutex> lock(m_taskMutex);
+      entry->id = m_nextId++;
+      m_tasks.push_back(entry);
+      return entry->id;
+   }
+
+   int TickScheduler::RemoveTask(TaskId id) {
+      std::unique_lock<std::mutex> lock(m_taskMutex);
+      auto it = std::find_if(m_tasks.begin(), m_tasks.end(),
+         [id](const std::shared_ptr<TaskEntry> &t) { return t->id == id; });
+      if (it == m_tasks.end()) return 1;
+
+      // The scheduler thread may hold a reference in its snapshot, the flag stops it from running.
+      (*it)->removed = true;
+      m_tasks.erase(it);
+
+      // A task removing itself is still on the stack of the scheduler thread, which cannot wait for it.
+      if (std::this_thread::get_id() != m_schedulerThread) {
+         m_taskDone.wait(lock, [this, id] { return m_runningTask != id; });
+      }
+      return 0;
+   }
+
+   int TickScheduler::GetTaskStats(TaskId id, TaskStats &stats) const {
+      std::lock_guard<std::mutex> lock(m_taskMutex);
+      for (const auto &t : m_tasks) {
+         if (t->id == id) {
+            stats = t->stats;
+            return 0;
+         }
+      }
+      return 1;
+   }
+
+   TickScheduler::SchedulerStats TickScheduler::GetSchedulerStats() const {
+      std::lock_guard<std::mutex> lock(m_tickMutex);
+      return m_stats;
+   }
+
+   void TickScheduler::Run() {
+      for (;;) {
+         PendingTick tick;
+         {
+            std::unique_lock<std::mutex> lock(m_tickMutex);
+            m_tickCondition.wait(lock, [this] { return m_hasPending || m_stopRequested; });
+            if (m_stopRequested) return;
+            tick = m_pending;
+            m_hasPending = false;
+
+            if (m_hasLastFrame && tick.frame <= m_lastFrame) {
+               ++m_stats.ticksOutOfOrder;
+            }
+            m_lastFrame = tick.frame;
+            m_hasLastFrame = true;
+         }
+         Dispatch(tick);
+      }
+   }
+
+   void TickScheduler::Dispatch(const PendingTick &tick) {
+      {
+         std::lock_guard<std::mutex> lock(m_taskMutex);
+         m_snapshot.assign(m_tasks.begin(), m_tasks.end());
+      }
+
+      for (const auto &entry : m_snapshot) {
+         TaskEntry &t = *entry;
+         TickContext ctx;
+         ctx.frame = tick.frame;
+         ctx.time = tick.time;
+         ctx.received = tick.received;
+
+         if (!t.hasRun) {
+            ctx.elapsedFrames = 0;
+            ctx.elapsedTime = 0.0f;
+            t.nextTime = tick.time + t.periodSeconds;
+         } else {
+            ctx.elapsedFrames = tick.frame - t.lastFrame;
+            ctx.elapsedTime = tick.time - t.lastTime;
+
+            // A frame or time going backwards means the simulation was reset, start over.
+            const bool reset = ctx.elapsedFrames < 0 || ctx.elapsedTime < 0.0f;
+            if (t.byFrame) {
+               if (!reset && ctx.elapsedFrames < t.periodFrames) continue;
+            } else if (reset) {
+               t.nextTime = tick.time + t.periodSeconds;
+            } else {
+               if (tick.time < t.nextTime) continue;
+               // Run once for however many periods passed, then stay on the original grid.
+               const float periods = std::floor((tick.time - t.nextTime) / t.periodSeconds) + 1.0f;
+               t.nextTime += periods * t.periodSeconds;
+            }
+         }
+
+         {
+            std::lock_guard<std::mutex> lock(m_taskMutex);
+            if (t.removed) continue;
+            m_runningTask = t.id;
+            m_schedulerThread = std::this_thread::get_id();
+         }
+
+         // A throwing task must not take the scheduler thread, and with it the module, down.
+         bool threw = false;
+         const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+         try {
+            t.task(ctx);
+         } catch (...) {
+            threw = true;
+         }
+         const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+         const double latency = micros(start - tick.received);
+         const double duration = micros(end - start);
+         const bool missed = t.deadline.count() > 0 && (end - tick.received) > t.deadline;
+
+         {
+            std::lock_guard<std::mutex> lock(m_taskMutex);
+            TaskStats &s = t.stats;
+            ++s.runs;
+            if (missed) ++s.deadlineMisses;
+            s.meanLatencyUs += (latency - s.meanLatencyUs) / s.runs;
+            s.maxLatencyUs = std::max(s.maxLatencyUs, latency);
+            s.meanDurationUs += (duration - s.meanDurationUs) / s.runs;
+            s.maxDurationUs = std::max(s.maxDurationUs, duration);
+            if (threw) ++s.exceptions;
+            if (t.hasRun) {
+               s.jitterUs += (std::fabs(latency - t.lastLatencyUs) - s.jitterUs) / 16.0;
+            }
+            m_runningTask = 0;
+         }
+         m_taskDone.notify_all();
+
+         t.hasRun = true;
+         t.lastFrame = tick.frame;
+         t.lastTime = tick.time;
+         t.lastLatencyUs = latency;
+      }
+
+      // Drop references so removed tasks are freed promptly.
+      m_snapshot.clear();
+   }
+
+} // namespace AMM
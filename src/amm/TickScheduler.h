@@ -0,0 +1,205 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "AMM_Extended.h"
+
+namespace AMM {
+
+    /// Runs periodic module work aligned to simulation frames.
+    ///
+    /// The scheduler is fed every received Tick (see DDSManager::CreateTickSubscriber(TickScheduler *)
+    /// or call OnTick from an existing Tick callback) and runs registered tasks on its own thread,
+    /// either every N frames or every T simulated seconds.  The DDS callback only stores the tick
+    /// and wakes the scheduler thread, so slow tasks never hold up the DDS receive thread.
+    ///
+    /// If the scheduler thread falls behind, pending ticks are coalesced into the most recent one.
+    /// Tasks are due based on frame and time deltas, so a coalesced tick still runs every task that
+    /// became due in between, once.
+    class TickScheduler {
+
+    public:
+        /// Identifies a registered task.  Never 0 for a valid task.
+        typedef uint64_t TaskId;
+
+        /// Frame information passed to a running task.
+        struct TickContext {
+            /// Frame of the tick that made the task due.
+            int64_t frame;
+
+            /// Simulation time in seconds of that tick.
+            float time;
+
+            /// Frames elapsed since this task last ran, 0 on the first run.
+            int64_t elapsedFrames;
+
+            /// Simulation seconds elapsed since this task last ran, 0 on the first run.
+            float elapsedTime;
+
+            /// Wall clock instant the tick was received.
+            std::chrono::steady_clock::time_point received;
+        };
+
+        typedef std::function<void(const TickContext &)> Task;
+
+        /// Timing statistics for one task.  Latencies are measured from tick arrival to task start.
+        struct TaskStats {
+            uint64_t runs = 0;
+
+            /// Runs that completed later than the task deadline after tick arrival.
+            uint64_t deadlineMisses = 0;
+
+            double meanLatencyUs = 0.0;
+
+            double maxLatencyUs = 0.0;
+
+            /// Smoothed variation of the start latency between consecutive runs (RFC 3550 style).
+            double jitterUs = 0.0;
+
+            double meanDurationUs = 0.0;
+
+            double maxDurationUs = 0.0;
+
+            /// Runs that ended with an exception thrown by the task.
+            uint64_t exceptions = 0;
+        };
+
+        /// Statistics for the scheduler as a whole.
+        struct SchedulerStats {
+            uint64_t ticksReceived = 0;
+
+            /// Ticks replaced by a newer tick before the scheduler thread picked them up.
+            uint64_t ticksCoalesced = 0;
+
+            /// Ticks whose frame did not move forward, e.g. a duplicate or a simulation reset.
+            uint64_t ticksOutOfOrder = 0;
+        };
+
+        TickScheduler();
+
+        /// Stops the scheduler thread if still running.  Must not be destroyed from one of its tasks.
+        ~TickScheduler();
+
+        TickScheduler(const TickScheduler &) = delete;
+
+        TickScheduler &operator=(const TickScheduler &) = delete;
+
+        /// Start the scheduler thread.
+        /// @returns 0 if successful or already running.
+        int Start();
+
+        /// Stop the scheduler thread.  Tasks already running are allowed to finish.
+        /// Waits for the thread to exit, so it cannot be called from a task.
+        /// @returns 0 if successful or not running, 1 if called from a task.
+        int Stop();
+
+        /// State of whether the scheduler thread is running.
+        bool IsRunning() const;
+
+        /// Hand a received tick to the scheduler.  Cheap and safe to call from the DDS callback.
+        /// @param tick Received tick.
+        void OnTick(const AMM::Tick &tick);
+
+        /// Register a task that runs every N frames.
+        /// @param frames Period in frames, at least 1.
+        /// @param task Function run on the scheduler thread.
+        /// @param deadline Time after tick arrival by which the task should have completed, 0 to disable.
+        /// @returns Id of the new task, 0 if the period is invalid.
+        TaskId AddFrameTask(
+           int64_t frames, Task task, std::chrono::microseconds deadline = std::chrono::microseconds::zero()
+        );
+
+        /// Register a task that runs every T simulated seconds.
+        /// @param seconds Period in simulated seconds, greater than 0.
+        /// @param task Function run on the scheduler thread.
+        /// @param deadline Time after tick arrival by which the task should have completed, 0 to disable.
+        /// @returns Id of the new task, 0 if the period is invalid.
+        TaskId AddTimeTask(
+           float seconds, Task task, std::chrono::microseconds deadline = std::chrono::microseconds::zero()
+        );
+
+        /// Unregister a task.  If the task is running on the scheduler thread, waits for it to return, so
+        /// state the task uses can be freed afterwards.  From within a task, including the task being
+        /// removed, it returns at once and the task is not run again.
+        /// @param id Task to remove.
+        /// @returns 0 if successful, 1 if no such task exists.
+        int RemoveTask(TaskId id);
+
+        /// Copy the statistics of a task.
+        /// @param id Task to query.
+        /// @param stats Statistics output.
+        /// @returns 0 if successful, 1 if no such task exists.
+        int GetTaskStats(TaskId id, TaskStats &stats) const;
+
+        /// @returns Statistics for the scheduler as a whole.
+        SchedulerStats GetSchedulerStats() const;
+
+    private:
+        struct TaskEntry;
+
+        struct PendingTick {
+            int64_t frame;
+            float time;
+            std::chrono::steady_clock::time_point received;
+        };
+
+        TaskId AddTask(bool byFrame, int64_t frames, float seconds, Task task, std::chrono::microseconds deadline);
+
+        void Run();
+
+        void Dispatch(const PendingTick &tick);
+
+        /// Protects the pending tick, the running flag and the scheduler statistics.
+        mutable std::mutex m_tickMutex;
+
+        std::condition_variable m_tickCondition;
+
+        PendingTick m_pending;
+
+        bool m_hasPending = false;
+
+        bool m_stopRequested = false;
+
+        /// Set while Stop joins the thread, so Start cannot start a second one meanwhile.
+        bool m_stopping = false;
+
+        SchedulerStats m_stats;
+
+        /// Protects the task table and task statistics.  Never held while a task runs.
+        mutable std::mutex m_taskMutex;
+
+        std::vector<std::shared_ptr<TaskEntry>> m_tasks;
+
+        /// Reused by the scheduler thread to iterate the task table without holding m_taskMutex.
+        std::vector<std::shared_ptr<TaskEntry>> m_snapshot;
+
+        /// Task the scheduler thread is running, 0 if none.  Guarded by m_taskMutex.
+        TaskId m_runningTask = 0;
+
+        /// Guarded by m_taskMutex.
+        std::thread::id m_schedulerThread;
+
+        /// Signalled when the running task returns.
+        std::condition_variable m_taskDone;
+
+        TaskId m_nextId = 1;
+
+        int64_t m_lastFrame = 0;
+
+        bool m_hasLastFrame = false;
+
+        std::thread m_thread;
+
+        std::atomic<bool> m_running;
+
+    }; // class TickScheduler
+
+} // namespace AMM
@@ -0,0 +1,166 @@
+#include "TopicMemory.h"
+
+#include <cstdio>
+#include <map>
+#include <mutex>
+
+namespace AMM {
+
+   namespace {
+
+      struct TopicRate {
+         const char *topic;
+         TopicMemory::Rate rate;
+      };
+
+      /// Built in expected rates, topics not listed are RATE_MEDIUM.
+      const TopicRate RATES[] = {
+         {"Instrument Data",         TopicMemory::RATE_HIGH},
+         {"Module Configuration",    TopicMemory::RATE_LOW},
+         {"Operational Description", TopicMemory::RATE_LOW},
+         {"Physiology Frame",        TopicMemory::RATE_HIGH},
+         {"Physiology Value",        TopicMemory::RATE_HIGH},
+         {"Physiology Waveform",     TopicMemory::RATE_HIGH},
+         {"Tick",                    TopicMemory::RATE_HIGH},
+      };
+
+      std::mutex &overridesMutex() {
+         static std::mutex mutex;
+         return mutex;
+      }
+
+      std::map<std::string, TopicMemory::Rate> &overrides() {
+         static std::map<std::string, TopicMemory::Rate> rates;
+         return rates;
+      }
+
+      bool preallocates(eprosima::fastrtps::rtps::MemoryManagementPolicy_t policy) {
+         return policy == eprosima::fastrtps::rtps::PREALLOCATED_MEMORY_MODE ||
+                policy == eprosima::fastrtps::rtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+      }
+
+   } // namespace
+
+   constexpr uint32_t TopicMemory::DYNAMIC_THRESHOLD;
+
+   TopicMemory::Rate TopicMemory::ExpectedRate(const std::string &topicName) {
+      {
+         std::lock_guard<std::mutex> lock(overridesMutex());
+         auto it = overrides().find(topicName);
+         if (it != overrides().end()) return it->second;
+      }
+
+      for (const TopicRate &entry : RATES) {
+         if (topicName == entry.topic) return entry.rate;
+      }
+      return RATE_MEDIUM;
+   }
+
+   void TopicMemory::SetExpectedRate(const std::string &topicName, Rate rate) {
+      std::lock_guard<std::mutex> lock(overridesMutex());
+      overrides()[topicName] = rate;
+   }
+
+   TopicMemory::Policy TopicMemory::Choose(uint32_t payloadSize, bool bounded, Rate rate) {
+      Policy policy;
+
+      // Every AMM topic is KEEP_LAST 1, the extra samples only cover writes and takes in flight.
+      policy.depth = 1;
+      policy.extraSamples = 1;
+      switch (rate) {
+         case RATE_HIGH:
+            policy.allocatedSamples = 4;
+            policy.maxSamples = 32;
+            break;
+         case RATE_LOW:
+            policy.allocatedSamples = 1;
+            policy.maxSamples = 4;
+            break;
+         default:
+            policy.allocatedSamples = 1;
+            policy.maxSamples = 8;
+            break;
+      }
+
+      if (payloadSize > DYNAMIC_THRESHOLD) {
+         policy.memory = rate == RATE_LOW ? eprosima::fastrtps::rtps::DYNAMIC_RESERVE_MEMORY_MODE
+                                          : eprosima::fastrtps::rtps::DYNAMIC_REUSABLE_MEMORY_MODE;
+      } else if (bounded) {
+         policy.memory = eprosima::fastrtps::rtps::PREALLOCATED_MEMORY_MODE;
+      } else {
+         policy.memory = eprosima::fastrtps::rtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+      }
+      return policy;
+   }
+
+   void TopicMemory::Apply(const Policy &policy, eprosima::fastrtps::TopicAttributes &topic) {
+      topic.historyQos.kind = eprosima::fastrtps::KEEP_LAST_HISTORY_QOS;
+      topic.historyQos.depth = policy.depth;
+      topic.resourceLimitsQos.allocated_samples = policy.allocatedSamples;
+      topic.resourceLimitsQos.max_samples = policy.maxSamples;
+      topic.resourceLimitsQos.max_instances = 1;
+      topic.resourceLimitsQos.max_samples_per_instance = policy.maxSamples;
+      topic.resourceLimitsQos.extra_samples = policy.extraSamples;
+   }
+
+   EndpointMemory TopicMemory::Describe(
+      const std::string &topicName, bool publisher, uint32_t payloadSize, const Policy &policy
+   ) {
+      EndpointMemory endpoint;
+      endpoint.topic = topicName;
+      endpoint.publisher = publisher;
+      endpoint.policy = policy.memory;
+      endpoint.payloadSize = payloadSize;
+      endpoint.allocatedSamples = policy.allocatedSamples;
+      endpoint.maxSamples = policy.maxSamples;
+
+      const std::size_t extra = static_cast<std::size_t>(policy.extraSamples);
+      if (preallocates(policy.memory)) {
+         endpoint.reservedBytes = (static_cast<std::size_t>(policy.allocatedSamples) + extra) * payloadSize;
+      }
+      endpoint.maxBytes = (static_cast<std::size_t>(policy.maxSamples) + extra) * payloadSize;
+      return endpoint;
+   }
+
+   std::string TopicMemory::Format(const std::vector<EndpointMemory> &endpoints) {
+      std::string text;
+      char line[192];
+
+      std::snprintf(line, sizeof(line), "%-28s %-10s %-18s %8s %6s %6s %10s %10s\n",
+         "Topic", "Endpoint", "Policy", "Payload", "Alloc", "Max", "Reserved", "Max bytes");
+      text += line;
+
+      std::size_t reserved = 0;
+      std::size_t maximum = 0;
+      for (const EndpointMemory &endpoint : endpoints) {
+         std::snprintf(line, sizeof(line), "%-28s %-10s %-18s %8u %6d %6d %10zu %10zu\n",
+            endpoint.topic.c_str(), endpoint.publisher ? "publisher" : "subscriber",
+            PolicyName(endpoint.policy), endpoint.payloadSize, endpoint.allocatedSamples,
+            endpoint.maxSamples, endpoint.reservedBytes, endpoint.maxBytes);
+         text += line;
+         reserved += endpoint.reservedBytes;
+         maximum += endpoint.maxBytes;
+      }
+
+      std::snprintf(line, sizeof(line), "%-28s %-10zu %-18s %8s %6s %6s %10zu %10zu\n",
+         "Total", endpoints.size(), "", "", "", "", reserved, maximum);
+      text += line;
+      return text;
+   }
+
+   const char *TopicMemory::PolicyName(eprosima::fastrtps::rtps::MemoryManagementPolicy_t policy) {
+      switch (policy) {
+         case eprosima::fastrtps::rtps::PREALLOCATED_MEMORY_MODE:
+            return "preallocated";
+         case eprosima::fastrtps::rtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
+            return "prealloc+realloc";
+         case eprosima::fastrtps::rtps::DYNAMIC_RESERVE_MEMORY_MODE:
+            return "dynamic";
+         case eprosima::fastrtps::rtps::DYNAMIC_REUSABLE_MEMORY_MODE:
+            return "dynamic reusable";
+         default:
+            return "unknown";
+      }
+   }
+
+} // namespace AMM
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fastrtps/attributes/TopicAttributes.h>
+#include <fastrtps/rtps/resources/ResourceManagement.h>
+
+namespace AMM {
+
+    /// History memory reserved by one publisher or subscriber.
+    struct EndpointMemory {
+        std::string topic;
+
+        /// True for a publisher, false for a subscriber.
+        bool publisher = false;
+
+        eprosima::fastrtps::rtps::MemoryManagementPolicy_t policy =
+           eprosima::fastrtps::rtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+
+        /// Largest serialized sample, encapsulation included.
+        uint32_t payloadSize = 0;
+
+        int32_t allocatedSamples = 0;
+
+        int32_t maxSamples = 0;
+
+        /// Payload bytes allocated when the endpoint is created.
+        std::size_t reservedBytes = 0;
+
+        /// Payload bytes held with a full history of maximum size samples.
+        std::size_t maxBytes = 0;
+    };
+
+    /// Chooses the history memory policy and resource limits of each topic.
+    ///
+    /// Fast-RTPS defaults to preallocating 100 samples of the maximum serialized size for every
+    /// endpoint, which for Module Configuration alone is 1.3 MB.  Every AMM topic keeps the last
+    /// sample only, so a handful of samples is enough; how many depends on how fast the topic is
+    /// written.  The memory mode depends on the sample size:
+    /// - publishers of bounded types that fit in DYNAMIC_THRESHOLD are fully preallocated,
+    /// - larger types are allocated per sample at their actual size, reusing the buffers on
+    ///   medium and high rate topics,
+    /// - everything else is preallocated at the maximum size and grows if a sample is larger.
+    ///
+    /// The expected rate of the standard topics is built in and can be overridden per process with
+    /// SetExpectedRate before the topic's publisher or subscriber is created.
+    class TopicMemory {
+
+    public:
+        enum Rate {
+            /// A few samples over the whole run, e.g. Module Configuration.
+            RATE_LOW,
+
+            /// Event driven, up to a few per second.
+            RATE_MEDIUM,
+
+            /// Every simulation frame or faster.
+            RATE_HIGH
+        };
+
+        /// Memory settings for one endpoint.
+        struct Policy {
+            eprosima::fastrtps::rtps::MemoryManagementPolicy_t memory;
+
+            /// History depth, KEEP_LAST.
+            int32_t depth;
+
+            int32_t allocatedSamples;
+
+            int32_t maxSamples;
+
+            int32_t extraSamples;
+        };
+
+        /// Payloads larger than this are not preallocated.
+        static constexpr uint32_t DYNAMIC_THRESHOLD = 4096;
+
+        /// @param topicName Topic name.
+        /// @returns Expected rate of the topic, RATE_MEDIUM for unknown topics.
+        static Rate ExpectedRate(const std::string &topicName);
+
+        /// Override the expected rate of a topic for this process.
+        /// @param topicName Topic name.
+        /// @param rate Expected rate.
+        static void SetExpectedRate(const std::string &topicName, Rate rate);
+
+        /// @param payloadSize Largest serialized sample of the topic's type, encapsulation included.
+        /// @param bounded State of whether no sample of the endpoint can exceed payloadSize.  Only true for
+        /// publishers of bounded types, a subscriber may receive a longer sample from an unbounded writer.
+        /// @param rate Expected rate of the topic.
+        /// @returns Memory settings for an endpoint of the topic.
+        static Policy Choose(uint32_t payloadSize, bool bounded, Rate rate);
+
+        /// Write a policy into publisher or subscriber topic attributes.
+        /// @param policy Memory settings.
+        /// @param topic Topic attributes output.
+        static void Apply(const Policy &policy, eprosima::fastrtps::TopicAttributes &topic);
+
+        /// @param topicName Topic name.
+        /// @param publisher True for a publisher, false for a subscriber.
+        /// @param payloadSize Largest serialized sample, encapsulation included.
+        /// @param policy Memory settings the endpoint was created with.
+        /// @returns Memory the endpoint reserves.
+        static EndpointMemory Describe(
+           const std::string &topicName, bool publisher, uint32_t payloadSize, const Policy &policy
+        );
+
+        /// @param endpoints Endpoints to report.
+        /// @returns One line per endpoint and a total, as text.
+        static std::string Format(const std::vector<EndpointMemory> &endpoints);
+
+        /// @param policy Memory management policy.
+        /// @returns Short name of the policy.
+        static const char *PolicyName(eprosima::fastrtps::rtps::MemoryManagementPolicy_t policy);
+
+    }; // class TopicMemory
+
+} // namespace AMM
@@ -42,9 +42,11 @@ namespace AMM {
       const std::string Status                   = "Status";
 
       // AMM 1.0 Extended Data types
-      const std::string Tick           = "Tick";
-      const std::string Command        = "Command";
-      const std::string InstrumentData = "InstrumentData";
+      const std::string Tick            = "Tick";
+      const std::string Command         = "Command";
+      const std::string InstrumentData  = "InstrumentData";
+      const std::string PhysFrame       = "Physiology Frame";
+      const std::string PhysiologyFrame = "Physiology Frame";
    }
 
 } // namespace AMM
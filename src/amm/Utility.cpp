@@ -1,20 +1,187 @@
 #include "Utility.h"
 
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace AMM {
 
-   std::string Utility::read_file_to_string(const std::string &filename) {
-      std::ifstream t(filename);
-      std::string str;
+   Utility::MappedFile::MappedFile(const std::string &filename) {
+      Open(filename);
+   }
+
+   Utility::MappedFile::~MappedFile() {
+      Close();
+   }
+
+   Utility::MappedFile::MappedFile(MappedFile &&other) noexcept {
+      *this = std::move(other);
+   }
+
+   Utility::MappedFile &Utility::MappedFile::operator=(MappedFile &&other) noexcept {
+      if (this != &other) {
+         Close();
+         m_open = other.m_open;
+         m_size = other.m_size;
+         m_filename = std::move(other.m_filename);
+         m_mapping = other.m_mapping;
+         m_buffer = std::move(other.m_buffer);
+         // A buffer's data pointer survives the move, a mapping is simply handed over.
+         m_data = m_mapping ? other.m_data : (m_buffer.empty() ? "" : m_buffer.data());
+
+         other.m_open = false;
+         other.m_data = nullptr;
+         other.m_size = 0;
+         other.m_mapping = nullptr;
+      }
+      return *this;
+   }
+
+   int Utility::MappedFile::Open(const std::string &filename) {
+      std::string errmsg;
+      return Open(filename, errmsg);
+   }
+
+   int Utility::MappedFile::Open(const std::string &filename, std::string &errmsg) {
+      Close();
+      m_filename = filename;
+
+      // Fall back to reading when the file cannot be mapped, e.g. pipes or some network file systems.
+      if (Map(errmsg) != 0 && Read(errmsg) != 0) {
+         m_filename.clear();
+         return 1;
+      }
+
+      m_open = true;
+      return 0;
+   }
+
+   void Utility::MappedFile::Close() {
+      if (m_mapping != nullptr) {
+#ifdef _WIN32
+         UnmapViewOfFile(m_mapping);
+#else
+         munmap(m_mapping, m_size);
+#endif
+         m_mapping = nullptr;
+      }
+      std::vector<char>().swap(m_buffer);
+      m_data = nullptr;
+      m_size = 0;
+      m_open = false;
+      m_filename.clear();
+   }
+
+#ifdef _WIN32
+   int Utility::MappedFile::Map(std::string &errmsg) {
+      HANDLE file = CreateFileA(m_filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                                OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+      if (file == INVALID_HANDLE_VALUE) {
+         errmsg = "Unable to open " + m_filename;
+         return 1;
+      }
+
+      LARGE_INTEGER size;
+      if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+         CloseHandle(file);
+         errmsg = "Unable to map " + m_filename;
+         return 1;
+      }
+
+      // The view keeps the file mapped after both handles are closed.
+      HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+      if (mapping) CloseHandle(mapping);
+      CloseHandle(file);
+
+      if (view == nullptr) {
+         errmsg = "Unable to map " + m_filename;
+         return 1;
+      }
+
+      m_mapping = view;
+      m_data = static_cast<const char *>(view);
+      m_size = static_cast<size_t>(size.QuadPart);
+      return 0;
+   }
+#else
+   int Utility::MappedFile::Map(std::string &errmsg) {
+      int fd = ::open(m_filename.c_str(), O_RDONLY);
+      if (fd < 0) {
+         errmsg = "Unable to open " + m_filename + ": " + std::strerror(errno);
+         return 1;
+      }
+
+      struct stat st;
+      if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+         ::close(fd);
+         errmsg = "Unable to map " + m_filename;
+         return 1;
+      }
+
+      // The mapping stays valid after the descriptor is closed.
+      void *view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      ::close(fd);
+
+      if (view == MAP_FAILED) {
+         errmsg = "Unable to map " + m_filename + ": " + std::strerror(errno);
+         return 1;
+      }
+
+      // Parsers walk state and scenario files front to back.
+      madvise(view, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
 
-      // Preallocate the memory up front
-      t.seekg(0, std::ios::end);
-      str.reserve(t.tellg());
-      t.seekg(0, std::ios::beg);
+      m_mapping = view;
+      m_data = static_cast<const char *>(view);
+      m_size = static_cast<size_t>(st.st_size);
+      return 0;
+   }
+#endif
+
+   int Utility::MappedFile::Read(std::string &errmsg) {
+      std::vector<char> buffer;
+      int result = read_file_chunked(m_filename, [&buffer](const char *chunk, size_t size) {
+         buffer.insert(buffer.end(), chunk, chunk + size);
+         return true;
+      });
+
+      if (result != 0) {
+         errmsg = "Unable to read " + m_filename;
+         return 1;
+      }
+
+      m_buffer.swap(buffer);
+      m_data = m_buffer.empty() ? "" : m_buffer.data();
+      m_size = m_buffer.size();
+      return 0;
+   }
+
+   int Utility::read_file_chunked(const std::string &filename,
+                                  const std::function<bool(const char *, size_t)> &callback,
+                                  size_t chunkSize) {
+      std::ifstream in(filename, std::ios::binary);
+      if (!in) return 1;
 
-      str.assign((std::istreambuf_iterator<char>(t)),
-      std::istreambuf_iterator<char>());
-      t.close();
-      return str;
+      std::vector<char> chunk(chunkSize > 0 ? chunkSize : 1);
+      while (in) {
+         in.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+         const std::streamsize count = in.gcount();
+         if (count > 0 && !callback(chunk.data(), static_cast<size_t>(count))) break;
+      }
+      return in.bad() ? 1 : 0;
+   }
+
+   std::string Utility::read_file_to_string(const std::string &filename) {
+      MappedFile file(filename);
+      return file.IsOpen() ? file.str() : std::string();
    }
 
    void Utility::add_once(std::vector<std::string> &vec, const std::string &element) {
@@ -51,24 +218,6 @@ namespace AMM {
       };
 
 
-   std::string Utility::decode64(const std::string &val) {
-      using namespace boost::archive::iterators;
-      using It =
-      transform_width<binary_from_base64<std::string::const_iterator>, 8, 6>;
-      return boost::algorithm::trim_right_copy_if(
-         std::string(It(std::begin(val)), It(std::end(val))),
-         [](char c) { return c == '\0'; });
-      }
-
-
-   std::string Utility::encode64(const std::string &val) {
-      using namespace boost::archive::iterators;
-      using It =
-      base64_from_binary<transform_width<std::string::const_iterator, 6, 8>>;
-      auto tmp = std::string(It(std::begin(val)), It(std::end(val)));
-      return tmp.append((3 - val.size() % 3) % 3, '=');
-   }
-
    std::string Utility::getTimestampedFilename(const std::string &basePathname, const std::string &ext) {
       std::ostringstream filename;
       filename << basePathname << static_cast<unsigned long>(::time(0)) << ext;
@@ -77,65 +226,110 @@ namespace AMM {
 
    std::map<std::string, std::vector<uint8_t>> Utility::parse_key_value(std::vector<uint8_t> kv) {
       std::map<std::string, std::vector<uint8_t>> m;
+      KeyValues pairs;
+
+      // An invalid blob is not a failure, the participant_qos userData can be used by other
+      // participants in the system for something else.
+      if (parse_key_value(kv.data(), kv.size(), pairs) == 0) {
+         for (const KeyValue &pair : pairs) {
+            m[pair.first.to_string()].assign(pair.second.begin(), pair.second.end());
+         }
+      }
+      return m;
+   }
+
+   int Utility::parse_key_value(const uint8_t *data, size_t size, KeyValues &out) {
+      out.clear();
+      if (size == 0) return 1;
+
+      const char *text = reinterpret_cast<const char *>(data);
       bool keyfound = false;
-      std::string key;
-      std::vector<uint8_t> value;
+      size_t keyStart = 0;
+      size_t keyLength = 0;
+      size_t valueStart = 0;
       uint8_t prev = '\0';
 
-      if (kv.size() == 0) {
-         goto not_valid;
-      }
+      // A value ends at a ';' followed by anything but ';'.  Within a run of ';' all but the last
+      // belong to the value, so a value is always one contiguous slice of the input.
+      auto store = [&](size_t valueEnd) {
+         const boost::string_view key(text + keyStart, keyLength);
+         const boost::string_view value(text + valueStart, valueEnd - valueStart);
+         for (KeyValue &pair : out) {
+            if (pair.first == key) {
+               pair.second = value;
+               return;
+            }
+         }
+         out.emplace_back(key, value);
+      };
 
-      for (uint8_t u8 : kv) {
+      for (size_t i = 0; i < size; ++i) {
+         if (keyfound && prev != ';' && data[i] != ';') {
+            // Plain value bytes, skip to the next ';'.
+            const void *semicolon = std::memchr(data + i, ';', size - i);
+            if (semicolon == nullptr) {
+               prev = data[size - 1];
+               break;
+            }
+            i = static_cast<size_t>(static_cast<const uint8_t *>(semicolon) - data);
+            prev = data[i - 1];
+         }
+         const uint8_t u8 = data[i];
          if (keyfound) {
             if ((u8 == ';') && (prev != ';')) {
                prev = u8;
                continue;
             } else if ((u8 != ';') && (prev == ';')) {
-               if (value.size() == 0) {
+               if (i - 1 == valueStart) {
                   goto not_valid;
                }
-               m[key] = value;
-
-               key.clear();
-               value.clear();
+               store(i - 1);
+               keyLength = 0;
                keyfound = false;
-            } else {
-               value.push_back(u8);
             }
          }
          if (!keyfound) {
             if (u8 == '=') {
-               if (key.size() == 0) {
+               if (keyLength == 0) {
                   goto not_valid;
                }
                keyfound = true;
+               valueStart = i + 1;
             } else if (isalnum(u8)) {
-               key.push_back(u8);
-            } else if ((u8 == '\0') && (key.size() == 0) && (m.size() > 0)) {
+               if (keyLength == 0) keyStart = i;
+               ++keyLength;
+            } else if ((u8 == '\0') && (keyLength == 0) && !out.empty()) {
                break; // accept trailing '\0' characters
-            } else if ((prev != ';') || (key.size() > 0)) {
+            } else if ((prev != ';') || (keyLength > 0)) {
                goto not_valid;
             }
          }
          prev = u8;
       }
       if (keyfound) {
-         if (value.size() == 0) {
+         const size_t valueEnd = size - (prev == ';' ? 1 : 0);
+         if (valueEnd == valueStart) {
             goto not_valid;
          }
-         m[key] = value;
-      } else if (key.size() > 0) {
+         store(valueEnd);
+      } else if (keyLength > 0) {
          goto not_valid;
       }
-      return m;
+      return 0;
+
       not_valid:
-      // This is not a failure this is something that can happen because the
-      // participant_qos userData
-      // is used. Other participants in the system not created by rmw could use
-      // userData for something
-      // else.
-      return std::map<std::string, std::vector<uint8_t>>();
+      out.clear();
+      return 1;
+   }
+
+   bool Utility::find_key_value(const KeyValues &kv, boost::string_view key, boost::string_view &value) {
+      for (const KeyValue &pair : kv) {
+         if (pair.first == key) {
+            value = pair.second;
+            return true;
+         }
+      }
+      return false;
    }
 
 
@@ -6,11 +6,15 @@
 #include <iostream>
 #include <sstream>
 #include <cstdio>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 #include <map>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/utility/string_view.hpp>
 #include <boost/archive/iterators/base64_from_binary.hpp>
 #include <boost/archive/iterators/binary_from_base64.hpp>
 #include <boost/archive/iterators/transform_width.hpp>
@@ -24,6 +28,94 @@ namespace AMM {
     class Utility {
 
     public:
+        /**
+        * Read-only view of a whole file.  The file is memory mapped when possible, otherwise it is
+        * read in large chunks into a buffer owned by the object.  The view stays valid until the
+        * object is closed or destroyed; mapped pages are loaded on demand and never copied.
+        */
+        class MappedFile {
+        public:
+            MappedFile() = default;
+
+            /**
+            * Open filename, check IsOpen() for success
+            *
+            * @param filename
+            */
+            explicit MappedFile(const std::string &filename);
+
+            ~MappedFile();
+
+            MappedFile(const MappedFile &) = delete;
+
+            MappedFile &operator=(const MappedFile &) = delete;
+
+            MappedFile(MappedFile &&other) noexcept;
+
+            MappedFile &operator=(MappedFile &&other) noexcept;
+
+            /**
+            * Open a file, closing any file already open
+            *
+            * @param filename
+            * @return 0 if successful
+            */
+            int Open(const std::string &filename);
+
+            /**
+            * Open a file, closing any file already open
+            *
+            * @param filename
+            * @param errmsg Error message output
+            * @return 0 if successful
+            */
+            int Open(const std::string &filename, std::string &errmsg);
+
+            void Close();
+
+            bool IsOpen() const { return m_open; }
+
+            /**
+            * @return True if the view is a memory mapping, false if the file was read into a buffer
+            */
+            bool IsMapped() const { return m_mapping != nullptr; }
+
+            /**
+            * @return Start of the file content, not null terminated
+            */
+            const char *data() const { return m_data; }
+
+            size_t size() const { return m_size; }
+
+            std::string str() const { return std::string(m_data, m_size); }
+
+        private:
+            int Map(std::string &errmsg);
+
+            int Read(std::string &errmsg);
+
+            const char *m_data = nullptr;
+            size_t m_size = 0;
+            bool m_open = false;
+            std::string m_filename;
+
+            /// Start of the mapping, null when the content is in m_buffer.
+            void *m_mapping = nullptr;
+            std::vector<char> m_buffer;
+        };
+
+        /**
+        * Stream a file through a callback in fixed size chunks, without holding the whole file in memory
+        *
+        * @param filename
+        * @param callback Called with each chunk in order, return false to stop early
+        * @param chunkSize
+        * @return 0 if the whole file was read or the callback stopped, 1 if the file could not be read
+        */
+        static int read_file_chunked(const std::string &filename,
+                                     const std::function<bool(const char *, size_t)> &callback,
+                                     size_t chunkSize = 1 << 20);
+
         /**
         * Read a file into a string
         *
@@ -50,10 +142,11 @@ namespace AMM {
         static std::vector <std::string> explode(const std::string &delimiter, const std::string &str);
 
         /**
-        * Decode a string from base64
+        * Decode a string from base64.  Trailing NUL bytes are removed from the result.
         *
         * @param val
         * @return
+        * @throws std::invalid_argument if val is not valid base64
         */
         static std::string decode64(const std::string &val);
 
@@ -65,6 +158,41 @@ namespace AMM {
         */
         static std::string encode64(const std::string &val);
 
+        /**
+        * @param size Number of bytes to encode
+        * @return Number of characters encode64 writes for size bytes, padding included
+        */
+        static size_t encode64_length(size_t size) { return (size + 2) / 3 * 4; }
+
+        /**
+        * @param size Number of base64 characters
+        * @return Buffer size that always fits decode64 output for size characters
+        */
+        static size_t decode64_max_length(size_t size) { return (size + 3) / 4 * 3; }
+
+        /**
+        * Encode bytes as padded base64 into a caller provided buffer, using AVX2 or SSSE3 when the CPU
+        * supports them.
+        *
+        * @param in
+        * @param size
+        * @param out At least encode64_length(size) characters, not null terminated
+        * @return Number of characters written
+        */
+        static size_t encode64(const uint8_t *in, size_t size, char *out);
+
+        /**
+        * Decode base64 into a caller provided buffer, using AVX2 or SSSE3 when the CPU supports them.
+        * Padding is optional.  Unlike decode64(const std::string &), trailing NUL bytes are kept.
+        *
+        * @param in
+        * @param size
+        * @param out At least decode64_max_length(size) bytes
+        * @param written Number of bytes written
+        * @return 0 if successful, 1 if the input is not valid base64
+        */
+        static int decode64(const char *in, size_t size, uint8_t *out, size_t &written);
+
         /**
         * Get a filename with an embedded now timestamp
         *
@@ -82,6 +210,33 @@ namespace AMM {
         */
         static std::map <std::string, std::vector<uint8_t>> parse_key_value(std::vector <uint8_t> kv);
 
+        /// A key and its value, both pointing into the parsed buffer.
+        typedef std::pair<boost::string_view, boost::string_view> KeyValue;
+
+        /// Parsed key/value pairs in input order, stored inline for typical sizes.
+        typedef boost::container::small_vector<KeyValue, 8> KeyValues;
+
+        /**
+        * Parse "key=value;key=value" data, e.g. participant user data, without copying.  Accepts the
+        * same input as parse_key_value; a later duplicate key replaces the earlier value.
+        *
+        * @param data
+        * @param size
+        * @param out Parsed pairs, valid as long as data is.  Cleared if the input is not valid.
+        * @return 0 if successful, 1 if the input is empty or not valid
+        */
+        static int parse_key_value(const uint8_t *data, size_t size, KeyValues &out);
+
+        /**
+        * Look up a key in parsed pairs
+        *
+        * @param kv
+        * @param key
+        * @param value Value output
+        * @return True if the key exists
+        */
+        static bool find_key_value(const KeyValues &kv, boost::string_view key, boost::string_view &value);
+
 
         /// Returns the string repensentation of an Assessment Value.
         static std::string EAssessmentValueStr(int value);
@@ -0,0 +1,187 @@
+#include "Uuid.h"
+
+#include <cstring>
+#include <random>
+
+#include <boost/uuid/name_generator_sha1.hpp>
+#include <boost/uuid/uuid.hpp>
+
+namespace AMM {
+
+   namespace {
+
+      std::mt19937_64 make_seeded_engine() {
+         std::random_device rd;
+         std::seed_seq seq{rd(), rd(), rd(), rd(), rd(), rd(), rd(), rd()};
+         return std::mt19937_64(seq);
+      }
+
+      std::mt19937_64 &thread_engine() {
+         // Seeded from the entropy source once per thread rather than once per id.
+         thread_local std::mt19937_64 engine = make_seeded_engine();
+         return engine;
+      }
+
+      const char HEX_DIGITS[] = "0123456789abcdef";
+
+      // Namespace for name based ids derived from legacy, non-UUID id strings.
+      const boost::uuids::uuid LEGACY_ID_NAMESPACE = {{
+         0x8c, 0x4e, 0x1d, 0x52, 0x6b, 0x0a, 0x4f, 0x3e,
+         0x9a, 0x27, 0x5d, 0x61, 0xc0, 0x38, 0x7e, 0x14
+      }};
+
+      inline int hex_value(char c) {
+         if (c >= '0' && c <= '9') return c - '0';
+         if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+         if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+         return -1;
+      }
+
+      inline void load_words(const std::array<uint8_t, 16> &bytes, uint64_t &hi, uint64_t &lo) {
+         std::memcpy(&hi, bytes.data(), sizeof(hi));
+         std::memcpy(&lo, bytes.data() + sizeof(hi), sizeof(lo));
+      }
+
+   } // namespace
+
+   void UuidGenerator::Generate(uint8_t *out) {
+      std::mt19937_64 &engine = thread_engine();
+      const uint64_t hi = engine();
+      const uint64_t lo = engine();
+      std::memcpy(out, &hi, sizeof(hi));
+      std::memcpy(out + sizeof(hi), &lo, sizeof(lo));
+
+      // RFC 4122 version 4, variant 1
+      out[6] = static_cast<uint8_t>((out[6] & 0x0F) | 0x40);
+      out[8] = static_cast<uint8_t>((out[8] & 0x3F) | 0x80);
+   }
+
+   void UuidGenerator::Format(const uint8_t *uuid, char *out) {
+      for (int i = 0; i < 16; ++i) {
+         if (i == 4 || i == 6 || i == 8 || i == 10) {
+            *out++ = '-';
+         }
+         *out++ = HEX_DIGITS[uuid[i] >> 4];
+         *out++ = HEX_DIGITS[uuid[i] & 0x0F];
+      }
+      *out = '\0';
+   }
+
+   std::string UuidGenerator::GenerateString() {
+      uint8_t uuid[16];
+      char buffer[BUFFER_SIZE];
+      Generate(uuid);
+      Format(uuid, buffer);
+      return std::string(buffer, STRING_LENGTH);
+   }
+
+   void UuidGenerator::GenerateStrings(std::size_t n, char *out, std::size_t stride) {
+      uint8_t uuid[16];
+      for (std::size_t i = 0; i < n; ++i) {
+         Generate(uuid);
+         Format(uuid, out + i * stride);
+      }
+   }
+
+   BinaryUuid BinaryUuid::Generate() {
+      BinaryUuid uuid;
+      UuidGenerator::Generate(uuid.bytes.data());
+      return uuid;
+   }
+
+   bool BinaryUuid::Parse(const char *str, std::size_t len, BinaryUuid &out) {
+      if (len >= 2 && str[0] == '{' && str[len - 1] == '}') {
+         ++str;
+         len -= 2;
+      }
+
+      const bool dashed = (len == UuidGenerator::STRING_LENGTH);
+      if (!dashed && len != 32) {
+         return false;
+      }
+
+      BinaryUuid parsed;
+      std::size_t pos = 0;
+      for (int i = 0; i < 16; ++i) {
+         if (dashed && (i == 4 || i == 6 || i == 8 || i == 10)) {
+            if (str[pos++] != '-') {
+               return false;
+            }
+         }
+         const int hi = hex_value(str[pos++]);
+         const int lo = hex_value(str[pos++]);
+         if (hi < 0 || lo < 0) {
+            return false;
+         }
+         parsed.bytes[i] = static_cast<uint8_t>((hi << 4) | lo);
+      }
+
+      out = parsed;
+      return true;
+   }
+
+   BinaryUuid BinaryUuid::FromString(const std::string &str) {
+      BinaryUuid uuid;
+      if (Parse(str.data(), str.size(), uuid)) {
+         return uuid;
+      }
+
+      boost::uuids::name_generator_sha1 gen(LEGACY_ID_NAMESPACE);
+      const boost::uuids::uuid named = gen(str);
+      std::memcpy(uuid.bytes.data(), named.data, 16);
+      return uuid;
+   }
+
+   BinaryUuid BinaryUuid::FromUuid(const AMM::UUID &uuid) {
+      return FromString(uuid.id());
+   }
+
+   BinaryUuid BinaryUuid::FromCompact(const AMM::CompactUUID &uuid) {
+      BinaryUuid binary;
+      binary.bytes = uuid.id();
+      return binary;
+   }
+
+   std::string BinaryUuid::ToString() const {
+      char buffer[UuidGenerator::BUFFER_SIZE];
+      UuidGenerator::Format(bytes.data(), buffer);
+      return std::string(buffer, UuidGenerator::STRING_LENGTH);
+   }
+
+   AMM::UUID BinaryUuid::ToUuid() const {
+      AMM::UUID uuid;
+      uuid.id(ToString());
+      return uuid;
+   }
+
+   AMM::CompactUUID BinaryUuid::ToCompact() const {
+      AMM::CompactUUID uuid;
+      uuid.id(bytes);
+      return uuid;
+   }
+
+   bool BinaryUuid::IsNil() const {
+      uint64_t hi, lo;
+      load_words(bytes, hi, lo);
+      return (hi | lo) == 0;
+   }
+
+   bool BinaryUuid::operator==(const BinaryUuid &other) const {
+      uint64_t a_hi, a_lo, b_hi, b_lo;
+      load_words(bytes, a_hi, a_lo);
+      load_words(other.bytes, b_hi, b_lo);
+      return a_hi == b_hi && a_lo == b_lo;
+   }
+
+   bool BinaryUuid::operator<(const BinaryUuid &other) const {
+      return std::memcmp(bytes.data(), other.bytes.data(), 16) < 0;
+   }
+
+   std::size_t BinaryUuidHash::operator()(const BinaryUuid &uuid) const {
+      // Version 4 ids are already uniformly random, folding the two words is enough.
+      uint64_t hi, lo;
+      load_words(uuid.bytes, hi, lo);
+      return static_cast<std::size_t>(hi ^ (lo * 0x9E3779B97F4A7C15ULL));
+   }
+
+} // namespace AMM
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "AMM_Standard.h"
+#include "AMM_Extended.h"
+
+namespace AMM {
+
+    /// Random (version 4) UUID generation for module, event and fragment ids.
+    ///
+    /// Every thread owns its own 64-bit Mersenne Twister, seeded once from the OS entropy
+    /// source on first use, so generating an id after that is a couple of engine draws and
+    /// a table lookup per hex digit.
+    class UuidGenerator {
+
+    public:
+        /// Length of the canonical 8-4-4-4-12 textual form, excluding the null terminator.
+        static const std::size_t STRING_LENGTH = 36;
+
+        /// Size of a buffer that holds the textual form plus its null terminator.
+        static const std::size_t BUFFER_SIZE = STRING_LENGTH + 1;
+
+        /**
+        * Generate the raw bytes of a random UUID
+        *
+        * @param out Destination of at least 16 bytes
+        */
+        static void Generate(uint8_t *out);
+
+        /**
+        * Format raw UUID bytes in lower-case canonical form, followed by a null terminator
+        *
+        * @param uuid 16 raw bytes
+        * @param out Destination of at least BUFFER_SIZE chars
+        */
+        static void Format(const uint8_t *uuid, char *out);
+
+        /**
+        * Generate a random UUID in canonical textual form
+        *
+        * @return
+        */
+        static std::string GenerateString();
+
+        /**
+        * Generate a batch of random UUIDs into caller provided buffers
+        *
+        * @param n Number of UUIDs to generate
+        * @param out Destination, the i-th UUID is written at out + i * stride
+        * @param stride Distance between consecutive buffers, at least BUFFER_SIZE
+        */
+        static void GenerateStrings(std::size_t n, char *out, std::size_t stride = BUFFER_SIZE);
+
+    }; // class UuidGenerator
+
+    /// Binary (16 byte) form of a UUID.
+    ///
+    /// Equality is a compare of two 64-bit words instead of a string compare, and the value
+    /// converts to and from both the textual AMM::UUID that every existing peer publishes and
+    /// the AMM::CompactUUID wire type.  Converting from text is lossy, see FromString: only ids
+    /// already in canonical lower-case form come back unchanged from ToString.
+    struct BinaryUuid {
+
+        /// Raw bytes in RFC 4122 (network) order.
+        std::array<uint8_t, 16> bytes{};
+
+        /**
+        * Generate a random UUID
+        *
+        * @return
+        */
+        static BinaryUuid Generate();
+
+        /**
+        * Parse a textual UUID.  Accepts upper or lower case hex, with or without the
+        * canonical dashes and with or without surrounding braces.
+        *
+        * @param str
+        * @param len
+        * @param out Parsed value, untouched on failure
+        * @return True if str is a well formed UUID
+        */
+        static bool Parse(const char *str, std::size_t len, BinaryUuid &out);
+
+        /**
+        * Convert a textual id to binary.  Ids that are not UUIDs (older modules sometimes
+        * publish plain names) are mapped to a name based (version 5) UUID, so the same
+        * legacy id always maps to the same binary value.
+        *
+        * The mapping is lossy: a legacy id cannot be recovered from its name based UUID, and
+        * upper case, braced or undashed UUIDs come back from ToString in canonical lower-case
+        * form.  Keep the original string if it has to be echoed back to its sender.
+        *
+        * @param str
+        * @return
+        */
+        static BinaryUuid FromString(const std::string &str);
+
+        /// Converts the textual IDL UUID, see FromString.
+        static BinaryUuid FromUuid(const AMM::UUID &uuid);
+
+        /// Converts the binary IDL UUID.
+        static BinaryUuid FromCompact(const AMM::CompactUUID &uuid);
+
+        /// Canonical lower-case textual form.
+        std::string ToString() const;
+
+        /// Textual IDL UUID, as understood by every peer.  Canonical form, not necessarily the
+        /// string this value was parsed from.
+        AMM::UUID ToUuid() const;
+
+        /// Binary IDL UUID.
+        AMM::CompactUUID ToCompact() const;
+
+        /// True if every byte is zero.
+        bool IsNil() const;
+
+        bool operator==(const BinaryUuid &other) const;
+
+        bool operator!=(const BinaryUuid &other) const { return !(*this == other); }
+
+        bool operator<(const BinaryUuid &other) const;
+    };
+
+    /// Hash functor so BinaryUuid can key unordered containers.
+    struct BinaryUuidHash {
+        std::size_t operator()(const BinaryUuid &uuid) const;
+    };
+
+} // namespace AMM
@@ -0,0 +1,383 @@
+#pragma once
+#include <plog/Appenders/IAppender.h>
+#include <plog/Util.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace plog
+{
+    namespace overflowPolicy
+    {
+        enum Type
+        {
+            kDrop,      // drop the record, the number of dropped records is reported later
+            kBlock,     // wait for the consumer to make room
+            kSample     // wait for one out of every sampleRate records and for errors, drop the rest
+        };
+    }
+
+    // Hands records to a wrapped appender on a background thread.
+    //
+    // Producers copy the record into a bounded lock-free ring buffer (multiple producers, one
+    // consumer) and return; formatting and I/O happen on the consumer thread. Records are passed
+    // on in the order they were queued. Whatever is queued is written before the destructor returns.
+    //
+    // The optional idle handler runs on the consumer thread whenever the queue has been drained,
+    // and at least every 10 ms while it stays empty, e.g. to let the wrapped appender flush a batch.
+    class AsyncAppender : public IAppender
+    {
+    public:
+        AsyncAppender(IAppender* appender, size_t capacity = 8192, overflowPolicy::Type policy = overflowPolicy::kDrop, size_t sampleRate = 16,
+            std::function<void()> onIdle = std::function<void()>())
+            : m_appender(appender)
+            , m_slots(roundUpToPowerOfTwo(capacity))
+            , m_mask(m_slots.size() - 1)
+            , m_policy(policy)
+            , m_sampleRate(sampleRate > 0 ? sampleRate : 1)
+            , m_onIdle(onIdle)
+            , m_enqueuePos(0)
+            , m_dequeuePos(0)
+            , m_overflowCount(0)
+            , m_dropped(0)
+            , m_idle(false)
+            , m_stop(false)
+        {
+            for (size_t i = 0; i < m_slots.size(); ++i)
+            {
+                m_slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            m_thread = std::thread(&AsyncAppender::run, this);
+        }
+
+        virtual ~AsyncAppender()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_wakeMutex);
+                m_stop.store(true);
+            }
+            m_wake.notify_one();
+            m_thread.join();
+
+            // Records queued while the consumer was exiting.
+            drain();
+        }
+
+        virtual void write(const Record& record)
+        {
+            if (tryPush(record))
+            {
+                wakeConsumer();
+                return;
+            }
+
+            bool wait = m_policy == overflowPolicy::kBlock;
+
+            if (m_policy == overflowPolicy::kSample)
+            {
+                wait = record.getSeverity() <= error || m_overflowCount.fetch_add(1, std::memory_order_relaxed) % m_sampleRate == 0;
+            }
+
+            if (!wait)
+            {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            for (unsigned spins = 0; !tryPush(record); ++spins)
+            {
+                wakeConsumer();
+
+                if (spins < 64)
+                {
+                    std::this_thread::yield();
+                }
+                else
+                {
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+            }
+
+            wakeConsumer();
+        }
+
+        // Blocks until every record queued before the call has been written.
+        void flush()
+        {
+            const size_t target = m_enqueuePos.load(std::memory_order_acquire);
+
+            while (m_dequeuePos.load(std::memory_order_acquire) < target)
+            {
+                wakeConsumer();
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        }
+
+        // Number of records dropped since the last drop report.
+        size_t getDroppedCount() const
+        {
+            return m_dropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        struct Slot
+        {
+            std::atomic<size_t>     sequence;
+            Severity                severity;
+            util::Time              time;
+            unsigned int            tid;
+            const void*             object;
+            size_t                  line;
+            const char*             func;
+            const char*             file;
+            util::nstring           message;
+        };
+
+        // Presents a queued slot to the wrapped appender as a Record.
+        class QueuedRecord : public Record
+        {
+        public:
+            QueuedRecord() : Record(none, "", 0, "", 0), m_slot()
+            {
+            }
+
+            void set(const Slot* slot)
+            {
+                m_slot = slot;
+            }
+
+            virtual const util::Time& getTime() const
+            {
+                return m_slot->time;
+            }
+
+            virtual Severity getSeverity() const
+            {
+                return m_slot->severity;
+            }
+
+            virtual unsigned int getTid() const
+            {
+                return m_slot->tid;
+            }
+
+            virtual const void* getObject() const
+            {
+                return m_slot->object;
+            }
+
+            virtual size_t getLine() const
+            {
+                return m_slot->line;
+            }
+
+            virtual const util::nchar* getMessage() const
+            {
+                return m_slot->message.c_str();
+            }
+
+            virtual const char* getFunc() const
+            {
+                m_func = util::processFuncName(m_slot->func);
+                return m_func.c_str();
+            }
+
+            virtual const char* getFile() const
+            {
+                return m_slot->file;
+            }
+
+            virtual const char* getRawFunc() const
+            {
+                return m_slot->func;
+            }
+
+        private:
+            const Slot*         m_slot;
+            mutable std::string m_func;
+        };
+
+        static size_t roundUpToPowerOfTwo(size_t n)
+        {
+            size_t size = 2;
+
+            while (size < n)
+            {
+                size <<= 1;
+            }
+
+            return size;
+        }
+
+        bool tryPush(const Record& record)
+        {
+            size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+            Slot* slot;
+
+            for (;;)
+            {
+                slot = &m_slots[pos & m_mask];
+                const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+                const ptrdiff_t diff = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false; // full
+                }
+                else
+                {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            slot->severity = record.getSeverity();
+            slot->time = record.getTime();
+            slot->tid = record.getTid();
+            slot->object = record.getObject();
+            slot->line = record.getLine();
+            slot->func = record.getRawFunc(); // static storage, processed only when formatting
+            slot->file = record.getFile();
+            slot->message.assign(record.getMessage()); // reuses the capacity left by earlier records
+
+            slot->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool popInto(QueuedRecord& record)
+        {
+            const size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+            Slot& slot = m_slots[pos & m_mask];
+
+            if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+            {
+                return false;
+            }
+
+            record.set(&slot);
+            m_appender->write(record);
+
+            slot.sequence.store(pos + m_slots.size(), std::memory_order_release);
+            m_dequeuePos.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        void drain()
+        {
+            QueuedRecord record;
+
+            while (popInto(record))
+            {
+            }
+
+            reportDropped();
+        }
+
+        void reportDropped()
+        {
+            const size_t dropped = m_dropped.exchange(0, std::memory_order_relaxed);
+
+            if (dropped > 0)
+            {
+                Record record(warning, "plog::AsyncAppender::reportDropped", __LINE__, __FILE__, 0);
+                record << "AsyncAppender dropped " << dropped << " log records, the queue was full";
+                m_appender->write(record);
+            }
+        }
+
+        void wakeConsumer()
+        {
+            if (m_idle.load())
+            {
+                m_wake.notify_one();
+            }
+        }
+
+        void run()
+        {
+            QueuedRecord record;
+
+            for (;;)
+            {
+                // At most one queue length per batch so drops are reported while producers keep it full.
+                size_t written = 0;
+
+                while (written < m_slots.size() && popInto(record))
+                {
+                    ++written;
+                }
+
+                if (written > 0)
+                {
+                    reportDropped();
+                    continue;
+                }
+
+                if (m_onIdle)
+                {
+                    m_onIdle();
+                }
+
+                if (m_stop.load())
+                {
+                    break;
+                }
+
+                std::unique_lock<std::mutex> lock(m_wakeMutex);
+                m_idle.store(true);
+
+                // A producer that queued just before m_idle was set does not notify, the timeout covers that.
+                if (!m_stop.load() && isEmpty())
+                {
+                    m_wake.wait_for(lock, std::chrono::milliseconds(10));
+                }
+
+                m_idle.store(false);
+            }
+
+            drain();
+        }
+
+        bool isEmpty() const
+        {
+            const size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+            return m_slots[pos & m_mask].sequence.load(std::memory_order_acquire) != pos + 1;
+        }
+
+    private:
+        IAppender*                  m_appender;
+        std::vector<Slot>           m_slots;
+        const size_t                m_mask;
+        const overflowPolicy::Type  m_policy;
+        const size_t                m_sampleRate;
+        std::function<void()>       m_onIdle;
+
+        // Producer and consumer positions on separate cache lines. Padded rather than alignas(64),
+        // so the appender has no extended alignment and plain new works before C++17.
+        char                        m_pad0[64];
+        std::atomic<size_t>         m_enqueuePos;
+        char                        m_pad1[64 - sizeof(std::atomic<size_t>)];
+        std::atomic<size_t>         m_dequeuePos;
+        char                        m_pad2[64 - sizeof(std::atomic<size_t>)];
+        std::atomic<size_t>         m_overflowCount;
+        char                        m_pad3[64 - sizeof(std::atomic<size_t>)];
+        std::atomic<size_t>         m_dropped;
+
+        std::atomic<bool>           m_idle;
+        std::atomic<bool>           m_stop;
+        std::mutex                  m_wakeMutex;
+        std::condition_variable     m_wake;
+        std::thread                 m_thread;
+    };
+}
@@ -0,0 +1,444 @@
+#pragma once
+#include <plog/Appenders/IAppender.h>
+#include <plog/Converters/UTF8Converter.h>
+#include <plog/Util.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <ctime>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#ifdef PLOG_ENABLE_ZLIB
+#   include <zlib.h>
+#endif
+
+namespace plog
+{
+    namespace fsyncPolicy
+    {
+        enum Type
+        {
+            kNever,     // leave it to the operating system
+            kOnRotate,  // sync a file before it is rotated or closed
+            kOnFlush    // sync after every buffer written
+        };
+    }
+
+    struct BufferedFileOptions
+    {
+        BufferedFileOptions()
+            : maxFileSize(0)
+            , maxFiles(0)
+            , rotationPeriod(0)
+            , bufferSize(64 * 1024)
+            , flushInterval(1000)
+            , fsync(fsyncPolicy::kOnRotate)
+            , compress(false)
+        {
+        }
+
+        // Rotate once the file is larger, 0 for no size based rotation. Checked after each buffer is written.
+        size_t                      maxFileSize;
+
+        // Number of files kept including the active one, as for RollingFileAppender. No rotation if 0.
+        int                         maxFiles;
+
+        // Rotate at every multiple of this many seconds since the epoch (UTC), e.g. 3600 or 86400. 0 for none.
+        int                         rotationPeriod;
+
+        // Buffered bytes that trigger a write.
+        size_t                      bufferSize;
+
+        // Longest time records stay buffered.
+        std::chrono::milliseconds   flushInterval;
+
+        fsyncPolicy::Type           fsync;
+
+        // gzip rotated files on a background thread. Needs PLOG_ENABLE_ZLIB, otherwise they are kept as they are.
+        bool                        compress;
+    };
+
+    // RollingFileAppender that keeps file I/O off the logging threads.
+    //
+    // write() formats the record and appends it to a memory buffer. A writer thread writes the buffer
+    // when it reaches bufferSize, when flushInterval expires and on flush(), and rotates files by size
+    // and by time. Renaming the rotated chain and compressing the newest rotated file happens on a
+    // separate thread, so a slow compression never delays log writes.
+    template<class Formatter, class Converter = UTF8Converter>
+    class BufferedRollingFileAppender : public IAppender
+    {
+    public:
+        BufferedRollingFileAppender(const util::nchar* fileName, const BufferedFileOptions& options = BufferedFileOptions())
+            : m_options(options)
+        {
+            util::splitFileName(fileName, m_fileNameNoExt, m_fileExt);
+            start();
+        }
+
+#ifdef _WIN32
+        BufferedRollingFileAppender(const char* fileName, const BufferedFileOptions& options = BufferedFileOptions())
+            : m_options(options)
+        {
+            util::splitFileName(util::toWide(fileName).c_str(), m_fileNameNoExt, m_fileExt);
+            start();
+        }
+#endif
+
+        virtual ~BufferedRollingFileAppender()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_one();
+            m_writer.join();
+
+            {
+                std::lock_guard<std::mutex> lock(m_rotateMutex);
+                m_rotateStop = true;
+            }
+            m_rotateWake.notify_one();
+            m_rotator.join();
+        }
+
+        virtual void write(const Record& record)
+        {
+            const std::string line = Converter::convert(Formatter::format(record));
+
+            bool wake;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_buffer.append(line);
+                wake = m_buffer.size() >= m_options.bufferSize;
+            }
+
+            if (wake)
+            {
+                m_wake.notify_one();
+            }
+        }
+
+        // Blocks until everything written before the call is in the file.
+        void flush()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            const size_t ticket = ++m_flushRequested;
+            m_wake.notify_one();
+            m_flushed.wait(lock, [this, ticket] { return m_flushCompleted >= ticket; });
+        }
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+
+        void start()
+        {
+            m_fileSize = 0;
+            m_rotateAt = 0;
+            m_rotatedCount = 0;
+            m_flushRequested = 0;
+            m_flushCompleted = 0;
+            m_stop = false;
+            m_rotateStop = false;
+
+            if (m_options.maxFileSize > 0)
+            {
+                m_options.maxFileSize = (std::max)(m_options.maxFileSize, static_cast<size_t>(1000)); // same lower limit as RollingFileAppender
+            }
+            m_buffer.reserve(m_options.bufferSize * 2);
+            m_pending.reserve(m_options.bufferSize * 2);
+
+            m_writer = std::thread(&BufferedRollingFileAppender::runWriter, this);
+            m_rotator = std::thread(&BufferedRollingFileAppender::runRotator, this);
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // Writer thread
+
+        void runWriter()
+        {
+            openLogFile();
+
+            Clock::time_point nextFlush = Clock::now() + m_options.flushInterval;
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            for (;;)
+            {
+                m_wake.wait_until(lock, (std::min)(nextFlush, rotationDeadline()), [this] {
+                    return m_stop || m_flushRequested > m_flushCompleted || m_buffer.size() >= m_options.bufferSize;
+                });
+
+                const size_t ticket = m_flushRequested;
+                const bool stop = m_stop;
+                m_pending.swap(m_buffer);
+                lock.unlock();
+
+                writePending();
+                nextFlush = Clock::now() + m_options.flushInterval;
+
+                lock.lock();
+                m_flushCompleted = ticket;
+                m_flushed.notify_all();
+
+                if (stop && m_buffer.empty())
+                {
+                    break;
+                }
+            }
+
+            if (m_options.fsync != fsyncPolicy::kNever)
+            {
+                m_file.sync();
+            }
+            m_file.close();
+        }
+
+        void writePending()
+        {
+            if (!m_pending.empty())
+            {
+                const int bytesWritten = m_file.write(m_pending);
+
+                if (bytesWritten > 0)
+                {
+                    m_fileSize += bytesWritten;
+                }
+
+                if (m_options.fsync == fsyncPolicy::kOnFlush)
+                {
+                    m_file.sync();
+                }
+
+                m_pending.clear();
+            }
+
+            if (m_options.maxFiles <= 0)
+            {
+                return;
+            }
+
+            const bool bySize = m_options.maxFileSize > 0 && m_fileSize > static_cast<off_t>(m_options.maxFileSize);
+            const bool byTime = m_rotateAt != 0 && std::time(NULL) >= m_rotateAt;
+
+            if (bySize || byTime)
+            {
+                rollLogFile();
+            }
+        }
+
+        // Moves the active file out of the way and opens a new one; the rotator thread does the rest.
+        void rollLogFile()
+        {
+            if (m_options.fsync != fsyncPolicy::kNever)
+            {
+                m_file.sync();
+            }
+            m_file.close();
+
+            util::nostringstream ss;
+            ss << m_fileNameNoExt << PLOG_NSTR(".rotating.") << ++m_rotatedCount;
+            if (!m_fileExt.empty())
+            {
+                ss << '.' << m_fileExt;
+            }
+
+            const util::nstring rotated = ss.str();
+            util::File::rename(buildFileName().c_str(), rotated.c_str());
+
+            {
+                std::lock_guard<std::mutex> lock(m_rotateMutex);
+                m_rotateQueue.push_back(rotated);
+            }
+            m_rotateWake.notify_one();
+
+            openLogFile();
+        }
+
+        void openLogFile()
+        {
+            m_fileSize = m_file.open(buildFileName().c_str());
+
+            if (0 == m_fileSize)
+            {
+                const int bytesWritten = m_file.write(Converter::header(Formatter::header()));
+
+                if (bytesWritten > 0)
+                {
+                    m_fileSize += bytesWritten;
+                }
+            }
+
+            if (m_options.rotationPeriod > 0)
+            {
+                const time_t period = m_options.rotationPeriod;
+                m_rotateAt = (std::time(NULL) / period + 1) * period;
+            }
+        }
+
+        Clock::time_point rotationDeadline() const
+        {
+            if (m_rotateAt == 0 || m_options.maxFiles <= 0)
+            {
+                return Clock::time_point::max();
+            }
+
+            const time_t now = std::time(NULL);
+            return Clock::now() + std::chrono::seconds(m_rotateAt > now ? m_rotateAt - now : 0);
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // Rotator thread
+
+        void runRotator()
+        {
+            std::unique_lock<std::mutex> lock(m_rotateMutex);
+
+            for (;;)
+            {
+                m_rotateWake.wait(lock, [this] { return m_rotateStop || !m_rotateQueue.empty(); });
+
+                if (m_rotateQueue.empty())
+                {
+                    break;
+                }
+
+                const util::nstring rotated = m_rotateQueue.front();
+                m_rotateQueue.pop_front();
+                lock.unlock();
+
+                shiftRotatedFiles(rotated);
+
+                lock.lock();
+            }
+        }
+
+        void shiftRotatedFiles(const util::nstring& rotated)
+        {
+            const int maxFiles = m_options.maxFiles;
+
+            if (maxFiles <= 1)
+            {
+                util::File::unlink(rotated.c_str());
+                return;
+            }
+
+            util::File::unlink(buildFileName(maxFiles - 1).c_str());
+            util::File::unlink(gzName(buildFileName(maxFiles - 1)).c_str());
+
+            for (int fileNumber = maxFiles - 2; fileNumber >= 1; --fileNumber)
+            {
+                const util::nstring currentFileName = buildFileName(fileNumber);
+                const util::nstring nextFileName = buildFileName(fileNumber + 1);
+
+                util::File::rename(currentFileName.c_str(), nextFileName.c_str());
+                util::File::rename(gzName(currentFileName).c_str(), gzName(nextFileName).c_str());
+            }
+
+            const util::nstring firstFileName = buildFileName(1);
+
+            if (m_options.compress && compressFile(rotated, gzName(firstFileName)))
+            {
+                util::File::unlink(rotated.c_str());
+            }
+            else
+            {
+                util::File::rename(rotated.c_str(), firstFileName.c_str());
+            }
+        }
+
+        static util::nstring gzName(const util::nstring& fileName)
+        {
+            return fileName + PLOG_NSTR(".gz");
+        }
+
+#ifdef PLOG_ENABLE_ZLIB
+        static bool compressFile(const util::nstring& source, const util::nstring& target)
+        {
+            std::ifstream in(source.c_str(), std::ios::binary);
+#ifdef _WIN32
+            gzFile out = in ? gzopen_w(target.c_str(), "wb6") : NULL;
+#else
+            gzFile out = in ? gzopen(target.c_str(), "wb6") : NULL;
+#endif
+            if (!out)
+            {
+                return false;
+            }
+
+            char chunk[64 * 1024];
+            bool ok = true;
+
+            while (ok && in)
+            {
+                in.read(chunk, sizeof(chunk));
+                const std::streamsize count = in.gcount();
+                ok = count == 0 || gzwrite(out, chunk, static_cast<unsigned>(count)) == count;
+            }
+
+            ok = gzclose(out) == Z_OK && ok;
+
+            if (!ok)
+            {
+                util::File::unlink(target.c_str());
+            }
+            return ok;
+        }
+#else
+        static bool compressFile(const util::nstring&, const util::nstring&)
+        {
+            return false;
+        }
+#endif
+
+        util::nstring buildFileName(int fileNumber = 0) const
+        {
+            util::nostringstream ss;
+            ss << m_fileNameNoExt;
+
+            if (fileNumber > 0)
+            {
+                ss << '.' << fileNumber;
+            }
+
+            if (!m_fileExt.empty())
+            {
+                ss << '.' << m_fileExt;
+            }
+
+            return ss.str();
+        }
+
+    private:
+        BufferedFileOptions         m_options;
+        util::nstring               m_fileExt;
+        util::nstring               m_fileNameNoExt;
+
+        // Shared between logging threads and the writer thread.
+        std::mutex                  m_mutex;
+        std::condition_variable     m_wake;
+        std::condition_variable     m_flushed;
+        std::string                 m_buffer;
+        size_t                      m_flushRequested;
+        size_t                      m_flushCompleted;
+        bool                        m_stop;
+
+        // Writer thread only.
+        std::string                 m_pending;
+        util::File                  m_file;
+        off_t                       m_fileSize;
+        time_t                      m_rotateAt;
+        unsigned                    m_rotatedCount;
+
+        // Shared between the writer and rotator threads.
+        std::mutex                  m_rotateMutex;
+        std::condition_variable     m_rotateWake;
+        std::deque<util::nstring>   m_rotateQueue;
+        bool                        m_rotateStop;
+
+        std::thread                 m_writer;
+        std::thread                 m_rotator;
+    };
+}
@@ -0,0 +1,692 @@
+#pragma once
+#include <plog/Record.h>
+#include <plog/Severity.h>
+#include <plog/Util.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+// Deferred-formatting binary log
+//
+// PLOG_BIN(severity, "pressure {} over {} mmHg", value, limit) copies a call site id, a timestamp and
+// the raw arguments into a per-thread buffer; nothing is formatted. Full buffers are appended to a
+// binary file, which plog::binary::Reader (and the amm_log_decode tool) later renders through any
+// plog formatter. Arguments may be integers, floating point values, bool, char, pointers, C strings
+// and std::string. The format uses {} placeholders.
+//
+// File layout, all integers little endian:
+//   "PLOGBIN1"                                              start of a session, site ids restart
+//   'S' id:u32 severity:u8 line:u32 file func format types   call site, strings are u32 length + bytes
+//   'C' tid:u32 size:u32 events[size]                        buffer of one thread
+// with each event being id:u32 time_ns:u64 args, strings again as u32 length + bytes.
+
+#define PLOG_BIN(severity, ...) \
+    do \
+    { \
+        if (plog::binary::checkSeverity(severity)) \
+        { \
+            static plog::binary::Site plog_bin_site_ = { severity, __LINE__, PLOG_BIN_FILE(), PLOG_BIN_FUNC() }; \
+            plog::binary::log(plog_bin_site_, __VA_ARGS__); \
+        } \
+    } while (0)
+
+#ifdef _MSC_VER
+#   define PLOG_BIN_FUNC()      __FUNCTION__
+#else
+#   define PLOG_BIN_FUNC()      __PRETTY_FUNCTION__
+#endif
+
+#ifdef PLOG_CAPTURE_FILE
+#   define PLOG_BIN_FILE()      __FILE__
+#else
+#   define PLOG_BIN_FILE()      ""
+#endif
+
+#define PLOG_BIN_VERBOSE(...)   PLOG_BIN(plog::verbose, __VA_ARGS__)
+#define PLOG_BIN_DEBUG(...)     PLOG_BIN(plog::debug, __VA_ARGS__)
+#define PLOG_BIN_INFO(...)      PLOG_BIN(plog::info, __VA_ARGS__)
+#define PLOG_BIN_WARNING(...)   PLOG_BIN(plog::warning, __VA_ARGS__)
+#define PLOG_BIN_ERROR(...)     PLOG_BIN(plog::error, __VA_ARGS__)
+#define PLOG_BIN_FATAL(...)     PLOG_BIN(plog::fatal, __VA_ARGS__)
+
+namespace plog
+{
+    namespace binary
+    {
+        static const char kMagic[8] = { 'P', 'L', 'O', 'G', 'B', 'I', 'N', '1' };
+
+        // Per-thread buffer size. A buffer is written to the file when full, when its thread exits and on flush().
+        static const size_t kBufferSize = 64 * 1024;
+
+        namespace argType
+        {
+            enum Type
+            {
+                kBool = 'b',
+                kChar = 'c',
+                kInt32 = 'i',
+                kUInt32 = 'u',
+                kInt64 = 'l',
+                kUInt64 = 'm',
+                kDouble = 'd',
+                kPointer = 'p',
+                kString = 's'
+            };
+        }
+
+        struct Site
+        {
+            Severity                severity;
+            uint32_t                line;
+            const char*             file;
+            const char*             func;
+            std::atomic<uint32_t>   id; // 0 until registered
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+        // Argument encoding
+
+        template<class T, class Enable = void>
+        struct Arg;
+
+        template<class T>
+        struct Arg<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value>::type>
+        {
+            typedef typename std::conditional<sizeof(T) <= 4,
+                typename std::conditional<std::is_signed<T>::value, int32_t, uint32_t>::type,
+                typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type>::type Stored;
+
+            static const char code = sizeof(T) <= 4 ? (std::is_signed<T>::value ? argType::kInt32 : argType::kUInt32)
+                                                    : (std::is_signed<T>::value ? argType::kInt64 : argType::kUInt64);
+
+            static size_t size(T) { return sizeof(Stored); }
+
+            static char* write(char* p, T value)
+            {
+                const Stored stored = static_cast<Stored>(value);
+                std::memcpy(p, &stored, sizeof(stored));
+                return p + sizeof(stored);
+            }
+        };
+
+        template<class T>
+        struct Arg<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+        {
+            static const char code = argType::kDouble;
+
+            static size_t size(T) { return sizeof(double); }
+
+            static char* write(char* p, T value)
+            {
+                const double stored = static_cast<double>(value);
+                std::memcpy(p, &stored, sizeof(stored));
+                return p + sizeof(stored);
+            }
+        };
+
+        template<>
+        struct Arg<bool>
+        {
+            static const char code = argType::kBool;
+
+            static size_t size(bool) { return 1; }
+
+            static char* write(char* p, bool value)
+            {
+                *p = value ? 1 : 0;
+                return p + 1;
+            }
+        };
+
+        template<>
+        struct Arg<char>
+        {
+            static const char code = argType::kChar;
+
+            static size_t size(char) { return 1; }
+
+            static char* write(char* p, char value)
+            {
+                *p = value;
+                return p + 1;
+            }
+        };
+
+        inline char* writeString(char* p, const char* str, uint32_t len)
+        {
+            std::memcpy(p, &len, sizeof(len));
+            std::memcpy(p + sizeof(len), str, len);
+            return p + sizeof(len) + len;
+        }
+
+        template<>
+        struct Arg<const char*>
+        {
+            static const char code = argType::kString;
+
+            static size_t size(const char* value) { return sizeof(uint32_t) + (value ? std::strlen(value) : 6); }
+
+            static char* write(char* p, const char* value)
+            {
+                return value ? writeString(p, value, static_cast<uint32_t>(std::strlen(value))) : writeString(p, "(null)", 6);
+            }
+        };
+
+        template<>
+        struct Arg<char*> : Arg<const char*>
+        {
+        };
+
+        template<size_t N>
+        struct Arg<char[N]> : Arg<const char*>
+        {
+        };
+
+        template<>
+        struct Arg<std::string>
+        {
+            static const char code = argType::kString;
+
+            static size_t size(const std::string& value) { return sizeof(uint32_t) + value.size(); }
+
+            static char* write(char* p, const std::string& value)
+            {
+                return writeString(p, value.data(), static_cast<uint32_t>(value.size()));
+            }
+        };
+
+        template<class T>
+        struct Arg<T*, typename std::enable_if<!std::is_same<typename std::remove_cv<T>::type, char>::value>::type>
+        {
+            static const char code = argType::kPointer;
+
+            static size_t size(const T*) { return sizeof(uint64_t); }
+
+            static char* write(char* p, const T* value)
+            {
+                const uint64_t stored = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value));
+                std::memcpy(p, &stored, sizeof(stored));
+                return p + sizeof(stored);
+            }
+        };
+
+        template<class T>
+        struct ArgOf : Arg<typename std::remove_cv<typename std::remove_reference<T>::type>::type>
+        {
+        };
+
+        inline size_t argsSize()
+        {
+            return 0;
+        }
+
+        template<class T, class... Rest>
+        inline size_t argsSize(const T& value, const Rest&... rest)
+        {
+            return ArgOf<T>::size(value) + argsSize(rest...);
+        }
+
+        inline char* writeArgs(char* p)
+        {
+            return p;
+        }
+
+        template<class T, class... Rest>
+        inline char* writeArgs(char* p, const T& value, const Rest&... rest)
+        {
+            return writeArgs(ArgOf<T>::write(p, value), rest...);
+        }
+
+        template<class... Args>
+        inline const char* argCodes()
+        {
+            static const char codes[] = { ArgOf<Args>::code..., 0 };
+            return codes;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // Writer
+
+        class Writer : util::NonCopyable
+        {
+        public:
+            Writer(const util::nchar* fileName, Severity maxSeverity) : m_maxSeverity(maxSeverity), m_nextId(1)
+            {
+                m_file.open(fileName);
+                m_file.write(kMagic, sizeof(kMagic));
+            }
+
+            bool checkSeverity(Severity severity) const
+            {
+                return severity <= m_maxSeverity;
+            }
+
+            uint32_t registerSite(Site& site, const char* format, const char* types)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                uint32_t id = site.id.load(std::memory_order_relaxed);
+                if (id != 0)
+                {
+                    return id;
+                }
+
+                id = m_nextId++;
+
+                std::vector<char> def;
+                def.push_back('S');
+                append(def, &id, sizeof(id));
+                def.push_back(static_cast<char>(site.severity));
+                append(def, &site.line, sizeof(site.line));
+                appendString(def, site.file);
+                appendString(def, site.func);
+                appendString(def, format);
+                appendString(def, types);
+                m_file.write(&def[0], def.size());
+
+                // The definition is in the file before any event that uses the id can be.
+                site.id.store(id, std::memory_order_release);
+                return id;
+            }
+
+            void writeChunk(uint32_t tid, const char* data, uint32_t size)
+            {
+                char header[1 + 2 * sizeof(uint32_t)];
+                header[0] = 'C';
+                std::memcpy(header + 1, &tid, sizeof(tid));
+                std::memcpy(header + 1 + sizeof(tid), &size, sizeof(size));
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_file.write(header, sizeof(header));
+                m_file.write(data, size);
+            }
+
+        private:
+            static void append(std::vector<char>& out, const void* data, size_t size)
+            {
+                const char* p = static_cast<const char*>(data);
+                out.insert(out.end(), p, p + size);
+            }
+
+            static void appendString(std::vector<char>& out, const char* str)
+            {
+                const uint32_t len = static_cast<uint32_t>(std::strlen(str));
+                append(out, &len, sizeof(len));
+                append(out, str, len);
+            }
+
+        private:
+            util::File  m_file;
+            Severity    m_maxSeverity;
+            uint32_t    m_nextId;
+            std::mutex  m_mutex;
+        };
+
+        inline std::atomic<Writer*>& writerInstance()
+        {
+            static std::atomic<Writer*> writer(NULL);
+            return writer;
+        }
+
+        // Starts a binary log session in fileName (appended to an existing file). Call once, before logging.
+        inline void init(Severity maxSeverity, const util::nchar* fileName)
+        {
+            static Writer writer(fileName, maxSeverity);
+            writerInstance().store(&writer, std::memory_order_release);
+        }
+
+        inline bool checkSeverity(Severity severity)
+        {
+            Writer* writer = writerInstance().load(std::memory_order_acquire);
+            return writer && writer->checkSeverity(severity);
+        }
+
+        class ThreadBuffer : util::NonCopyable
+        {
+        public:
+            ThreadBuffer() : m_used(0), m_tid(util::gettid())
+            {
+            }
+
+            ~ThreadBuffer()
+            {
+                flush();
+            }
+
+            // Space for size bytes, or NULL if an event that large can never fit.
+            char* reserve(size_t size)
+            {
+                if (m_used + size > kBufferSize)
+                {
+                    if (size > kBufferSize)
+                    {
+                        return NULL;
+                    }
+
+                    flush();
+                }
+
+                char* p = m_data + m_used;
+                m_used += size;
+                return p;
+            }
+
+            void flush()
+            {
+                Writer* writer = writerInstance().load(std::memory_order_acquire);
+
+                if (writer && m_used > 0)
+                {
+                    writer->writeChunk(m_tid, m_data, static_cast<uint32_t>(m_used));
+                }
+
+                m_used = 0;
+            }
+
+        private:
+            size_t          m_used;
+            unsigned int    m_tid;
+            char            m_data[kBufferSize];
+        };
+
+        inline ThreadBuffer& threadBuffer()
+        {
+            static thread_local ThreadBuffer buffer;
+            return buffer;
+        }
+
+        // Writes the calling thread's buffered events to the file.
+        inline void flush()
+        {
+            threadBuffer().flush();
+        }
+
+        template<size_t N, class... Args>
+        inline void log(Site& site, const char (&format)[N], const Args&... args)
+        {
+            uint32_t id = site.id.load(std::memory_order_acquire);
+
+            if (id == 0)
+            {
+                id = writerInstance().load(std::memory_order_acquire)->registerSite(site, format, argCodes<Args...>());
+            }
+
+            const size_t size = sizeof(uint32_t) + sizeof(uint64_t) + argsSize(args...);
+            char* p = threadBuffer().reserve(size);
+
+            if (!p)
+            {
+                return;
+            }
+
+            const uint64_t time = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+
+            std::memcpy(p, &id, sizeof(id));
+            std::memcpy(p + sizeof(id), &time, sizeof(time));
+            writeArgs(p + sizeof(id) + sizeof(time), args...);
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // Reader
+
+        // A decoded event, usable with any plog formatter.
+        class DecodedRecord : public Record
+        {
+        public:
+            DecodedRecord() : Record(none, "", 0, "", 0), m_severity(none), m_tid(0), m_line(0), m_timeNs(0)
+            {
+                m_time.time = 0;
+                m_time.millitm = 0;
+            }
+
+            virtual const util::Time& getTime() const { return m_time; }
+            virtual Severity getSeverity() const { return m_severity; }
+            virtual unsigned int getTid() const { return m_tid; }
+            virtual const void* getObject() const { return 0; }
+            virtual size_t getLine() const { return m_line; }
+            virtual const util::nchar* getMessage() const { return m_message.c_str(); }
+            virtual const char* getFile() const { return m_file.c_str(); }
+            virtual const char* getRawFunc() const { return m_rawFunc.c_str(); }
+
+            virtual const char* getFunc() const
+            {
+                m_func = util::processFuncName(m_rawFunc.c_str());
+                return m_func.c_str();
+            }
+
+            // Nanoseconds since the epoch.
+            uint64_t getTimeNs() const { return m_timeNs; }
+
+        private:
+            friend class Reader;
+
+            util::Time          m_time;
+            Severity            m_severity;
+            unsigned int        m_tid;
+            size_t              m_line;
+            uint64_t            m_timeNs;
+            util::nstring       m_message;
+            std::string         m_file;
+            std::string         m_rawFunc;
+            mutable std::string m_func;
+        };
+
+        class Reader
+        {
+        public:
+            // Takes the whole file content.
+            explicit Reader(const std::string& data) : m_data(data), m_pos(0), m_chunkEnd(0), m_tid(0), m_valid(true)
+            {
+            }
+
+            // False once the input turned out to be malformed or truncated.
+            bool valid() const
+            {
+                return m_valid;
+            }
+
+            // Decodes the next event into record, false at the end of the input.
+            bool next(DecodedRecord& record)
+            {
+                while (m_valid)
+                {
+                    if (m_pos < m_chunkEnd)
+                    {
+                        return readEvent(record);
+                    }
+
+                    if (m_pos >= m_data.size())
+                    {
+                        return false;
+                    }
+
+                    if (m_data.compare(m_pos, sizeof(kMagic), kMagic, sizeof(kMagic)) == 0)
+                    {
+                        m_sites.clear();
+                        m_pos += sizeof(kMagic);
+                        continue;
+                    }
+
+                    const char tag = m_data[m_pos++];
+
+                    if (tag == 'S')
+                    {
+                        readSite();
+                    }
+                    else if (tag == 'C')
+                    {
+                        uint32_t size = 0;
+                        m_valid = read(m_tid) && read(size) && m_pos + size <= m_data.size();
+                        m_chunkEnd = m_pos + size;
+                    }
+                    else
+                    {
+                        m_valid = false;
+                    }
+                }
+
+                return false;
+            }
+
+        private:
+            struct SiteDef
+            {
+                Severity    severity;
+                uint32_t    line;
+                std::string file;
+                std::string func;
+                std::string format;
+                std::string types;
+            };
+
+            template<class T>
+            bool read(T& value)
+            {
+                if (m_pos + sizeof(T) > m_data.size())
+                {
+                    return false;
+                }
+
+                std::memcpy(&value, m_data.data() + m_pos, sizeof(T));
+                m_pos += sizeof(T);
+                return true;
+            }
+
+            bool readString(std::string& str)
+            {
+                uint32_t len = 0;
+
+                if (!read(len) || m_pos + len > m_data.size())
+                {
+                    return false;
+                }
+
+                str.assign(m_data, m_pos, len);
+                m_pos += len;
+                return true;
+            }
+
+            void readSite()
+            {
+                uint32_t id = 0;
+                uint8_t severity = 0;
+                SiteDef site;
+
+                m_valid = read(id) && read(severity) && read(site.line) && readString(site.file)
+                    && readString(site.func) && readString(site.format) && readString(site.types);
+
+                site.severity = static_cast<Severity>(severity);
+                m_sites[id] = site;
+            }
+
+            bool readEvent(DecodedRecord& record)
+            {
+                uint32_t id = 0;
+                uint64_t time = 0;
+
+                if (!read(id) || !read(time))
+                {
+                    m_valid = false;
+                    return false;
+                }
+
+                std::unordered_map<uint32_t, SiteDef>::const_iterator site = m_sites.find(id);
+
+                if (site == m_sites.end())
+                {
+                    m_valid = false;
+                    return false;
+                }
+
+                record.m_severity = site->second.severity;
+                record.m_line = site->second.line;
+                record.m_file = site->second.file;
+                record.m_rawFunc = site->second.func;
+                record.m_tid = m_tid;
+                record.m_timeNs = time;
+                record.m_time.time = static_cast<time_t>(time / 1000000000);
+                record.m_time.millitm = static_cast<unsigned short>(time / 1000000 % 1000);
+
+                std::string message;
+                m_valid = render(site->second, message);
+
+#ifdef _WIN32
+                record.m_message = util::toWide(message.c_str());
+#else
+                record.m_message.swap(message);
+#endif
+                return m_valid;
+            }
+
+            bool renderArg(char type, std::ostringstream& out)
+            {
+                switch (type)
+                {
+                case argType::kBool: { uint8_t v; if (!read(v)) return false; out << (v ? "true" : "false"); return true; }
+                case argType::kChar: { char v; if (!read(v)) return false; out << v; return true; }
+                case argType::kInt32: { int32_t v; if (!read(v)) return false; out << v; return true; }
+                case argType::kUInt32: { uint32_t v; if (!read(v)) return false; out << v; return true; }
+                case argType::kInt64: { int64_t v; if (!read(v)) return false; out << v; return true; }
+                case argType::kUInt64: { uint64_t v; if (!read(v)) return false; out << v; return true; }
+                case argType::kDouble: { double v; if (!read(v)) return false; out << v; return true; }
+                case argType::kPointer: { uint64_t v; if (!read(v)) return false; out << reinterpret_cast<const void*>(static_cast<uintptr_t>(v)); return true; }
+                case argType::kString: { std::string v; if (!readString(v)) return false; out << v; return true; }
+                default: return false;
+                }
+            }
+
+            bool render(const SiteDef& site, std::string& message)
+            {
+                std::ostringstream out;
+                const std::string& format = site.format;
+                size_t arg = 0;
+
+                for (size_t i = 0; i < format.size(); ++i)
+                {
+                    if (format[i] == '{' && i + 1 < format.size() && format[i + 1] == '}' && arg < site.types.size())
+                    {
+                        if (!renderArg(site.types[arg++], out))
+                        {
+                            return false;
+                        }
+                        ++i;
+                    }
+                    else
+                    {
+                        out << format[i];
+                    }
+                }
+
+                // More arguments than placeholders.
+                while (arg < site.types.size())
+                {
+                    out << ' ';
+                    if (!renderArg(site.types[arg++], out))
+                    {
+                        return false;
+                    }
+                }
+
+                message = out.str();
+                return true;
+            }
+
+        private:
+            const std::string&                      m_data;
+            size_t                                  m_pos;
+            size_t                                  m_chunkEnd;
+            uint32_t                                m_tid;
+            bool                                    m_valid;
+            std::unordered_map<uint32_t, SiteDef>   m_sites;
+        };
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <plog/Record.h>
+#include <plog/Util.h>
+#include <plog/Formatters/FastFormat.h>
+
+namespace plog
+{
+    // Produces the same text as CsvFormatter without streams. The message is quoted and its quotes
+    // doubled in a single pass.
+    template<bool useUtcTime>
+    class FastCsvFormatterImpl
+    {
+    public:
+        static util::nstring header()
+        {
+            return PLOG_NSTR("Date;Time;Severity;TID;This;Function;Message\n");
+        }
+
+        static util::nstring format(const Record& record)
+        {
+            util::nstring& out = fastFormat::scratch();
+            formatTo(record, out);
+            return out;
+        }
+
+        // Appends the formatted record to out.
+        static void formatTo(const Record& record, util::nstring& out)
+        {
+            fastFormat::appendSecondPrefix<useUtcTime, '/', ';'>(out, record.getTime().time);
+            fastFormat::appendMillis(out, record.getTime().millitm);
+            out.push_back(';');
+            fastFormat::appendNarrow(out, severityToString(record.getSeverity()));
+            out.push_back(';');
+            fastFormat::appendUInt(out, record.getTid());
+            out.push_back(';');
+            fastFormat::appendPointer(out, record.getObject());
+            out.push_back(';');
+            fastFormat::appendNarrow(out, record.getFunc());
+            out.push_back('@');
+            fastFormat::appendUInt(out, record.getLine());
+            out.push_back(';');
+
+            const util::nchar* message = record.getMessage();
+            const util::nchar* end = message;
+
+            while (*end && static_cast<size_t>(end - message) < kMaxMessageSize)
+            {
+                ++end;
+            }
+
+            out.push_back('"');
+
+            for (const util::nchar* p = message; p != end; ++p)
+            {
+                if (*p == '"')
+                {
+                    out.push_back('"');
+                }
+                out.push_back(*p);
+            }
+
+            if (*end)
+            {
+                out.append(PLOG_NSTR("..."));
+            }
+
+            out.append(PLOG_NSTR("\"\n"));
+        }
+
+        static const size_t kMaxMessageSize = 32000;
+    };
+
+    class FastCsvFormatter : public FastCsvFormatterImpl<false> {};
+    class FastCsvFormatterUtcTime : public FastCsvFormatterImpl<true> {};
+}
@@ -0,0 +1,169 @@
+#pragma once
+#include <plog/Util.h>
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+
+namespace plog
+{
+    // Helpers shared by FastTxtFormatter and FastCsvFormatter. They append to a util::nstring
+    // without going through a stream.
+    namespace fastFormat
+    {
+        static const char kDigitPairs[] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+
+        inline void appendUInt(util::nstring& out, unsigned long long value)
+        {
+            util::nchar digits[20];
+            util::nchar* p = digits + sizeof(digits) / sizeof(digits[0]);
+
+            while (value >= 100)
+            {
+                const unsigned pair = static_cast<unsigned>(value % 100) * 2;
+                value /= 100;
+                *--p = kDigitPairs[pair + 1];
+                *--p = kDigitPairs[pair];
+            }
+
+            if (value >= 10)
+            {
+                const unsigned pair = static_cast<unsigned>(value) * 2;
+                *--p = kDigitPairs[pair + 1];
+                *--p = kDigitPairs[pair];
+            }
+            else
+            {
+                *--p = static_cast<util::nchar>('0' + value);
+            }
+
+            out.append(p, digits + sizeof(digits) / sizeof(digits[0]));
+        }
+
+        // Appends value as exactly two digits, value must be below 100.
+        inline void append2(util::nchar* out, unsigned value)
+        {
+            out[0] = kDigitPairs[value * 2];
+            out[1] = kDigitPairs[value * 2 + 1];
+        }
+
+        inline void appendNarrow(util::nstring& out, const char* str)
+        {
+#ifdef _WIN32
+            for (; *str; ++str)
+            {
+                out.push_back(static_cast<util::nchar>(static_cast<unsigned char>(*str)));
+            }
+#else
+            out.append(str);
+#endif
+        }
+
+        // Same text as streaming the pointer into a util::nostringstream.
+        inline void appendPointer(util::nstring& out, const void* ptr)
+        {
+            uintptr_t value = reinterpret_cast<uintptr_t>(ptr);
+
+#ifdef _WIN32
+            static const char kHex[] = "0123456789ABCDEF";
+
+            util::nchar digits[sizeof(void*) * 2];
+            for (size_t i = sizeof(digits) / sizeof(digits[0]); i > 0; --i, value >>= 4)
+            {
+                digits[i - 1] = kHex[value & 0xf];
+            }
+            out.append(digits, sizeof(digits) / sizeof(digits[0]));
+#else
+            static const char kHex[] = "0123456789abcdef";
+
+            if (value == 0)
+            {
+                out.push_back('0');
+                return;
+            }
+
+            util::nchar digits[sizeof(void*) * 2];
+            util::nchar* end = digits + sizeof(digits) / sizeof(digits[0]);
+            util::nchar* p = end;
+
+            for (; value != 0; value >>= 4)
+            {
+                *--p = kHex[value & 0xf];
+            }
+
+            out.append("0x");
+            out.append(p, end);
+#endif
+        }
+
+        // The "date<dateSep>time" part of a timestamp up to and including the seconds, rebuilt only
+        // when the second changes. Kept per thread and per formatter.
+        template<bool useUtcTime, char dateSeparator, char timeSeparator>
+        inline void appendSecondPrefix(util::nstring& out, time_t time)
+        {
+            struct Cache
+            {
+                time_t          second;
+                util::nchar     text[32];
+                size_t          size;
+            };
+
+            static thread_local Cache cache = { static_cast<time_t>(-1), {}, 0 };
+
+            if (cache.second != time)
+            {
+                tm t;
+                (useUtcTime ? util::gmtime_s : util::localtime_s)(&t, &time);
+
+                util::nstring text;
+                appendUInt(text, static_cast<unsigned long long>(t.tm_year + 1900));
+
+                util::nchar rest[15];
+                rest[0] = dateSeparator;
+                append2(rest + 1, static_cast<unsigned>(t.tm_mon + 1));
+                rest[3] = dateSeparator;
+                append2(rest + 4, static_cast<unsigned>(t.tm_mday));
+                rest[6] = timeSeparator;
+                append2(rest + 7, static_cast<unsigned>(t.tm_hour));
+                rest[9] = ':';
+                append2(rest + 10, static_cast<unsigned>(t.tm_min));
+                rest[12] = ':';
+                append2(rest + 13, static_cast<unsigned>(t.tm_sec));
+                text.append(rest, 15);
+
+                cache.size = (std::min)(text.size(), sizeof(cache.text) / sizeof(cache.text[0]));
+                std::copy(text.begin(), text.begin() + cache.size, cache.text);
+                cache.second = time;
+            }
+
+            out.append(cache.text, cache.size);
+        }
+
+        // Appends ".mmm".
+        inline void appendMillis(util::nstring& out, unsigned short millitm)
+        {
+            util::nchar text[4];
+            text[0] = '.';
+            text[1] = static_cast<util::nchar>('0' + millitm / 100 % 10);
+            append2(text + 2, millitm % 100);
+            out.append(text, 4);
+        }
+
+        // Per thread scratch buffer, reused across records so formatting does not allocate once warm.
+        inline util::nstring& scratch()
+        {
+            static thread_local util::nstring buffer;
+            buffer.clear();
+            return buffer;
+        }
+    }
+}
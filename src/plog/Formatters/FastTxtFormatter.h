@@ -0,0 +1,52 @@
+#pragma once
+#include <plog/Record.h>
+#include <plog/Util.h>
+#include <plog/Formatters/FastFormat.h>
+
+namespace plog
+{
+    // Produces the same text as TxtFormatter without streams. The date and time up to the second
+    // are formatted once per second and thread, everything else is appended to a reused buffer.
+    template<bool useUtcTime>
+    class FastTxtFormatterImpl
+    {
+    public:
+        static util::nstring header()
+        {
+            return util::nstring();
+        }
+
+        static util::nstring format(const Record& record)
+        {
+            util::nstring& out = fastFormat::scratch();
+            formatTo(record, out);
+            return out;
+        }
+
+        // Appends the formatted record to out.
+        static void formatTo(const Record& record, util::nstring& out)
+        {
+            fastFormat::appendSecondPrefix<useUtcTime, '-', ' '>(out, record.getTime().time);
+            fastFormat::appendMillis(out, record.getTime().millitm);
+            out.push_back(' ');
+
+            const char* severity = severityToString(record.getSeverity());
+            const size_t severityLength = std::strlen(severity);
+            fastFormat::appendNarrow(out, severity);
+            out.append(severityLength < 5 ? 6 - severityLength : 1, ' ');
+
+            out.push_back('[');
+            fastFormat::appendUInt(out, record.getTid());
+            out.append(PLOG_NSTR("] ["));
+            fastFormat::appendNarrow(out, record.getFunc());
+            out.push_back('@');
+            fastFormat::appendUInt(out, record.getLine());
+            out.append(PLOG_NSTR("] "));
+            out.append(record.getMessage());
+            out.push_back('\n');
+        }
+    };
+
+    class FastTxtFormatter : public FastTxtFormatterImpl<false> {};
+    class FastTxtFormatterUtcTime : public FastTxtFormatterImpl<true> {};
+}
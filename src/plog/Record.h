@@ -219,6 +219,12 @@ namespace plog
             return m_file;
         }
 
+        // Function name as given to the logging macro, before processing. Has static storage duration.
+        virtual const char* getRawFunc() const
+        {
+            return m_func;
+        }
+
         virtual ~Record() // virtual destructor to satisfy -Wnon-virtual-dtor warning
         {
         }
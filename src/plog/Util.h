@@ -297,6 +297,16 @@ namespace plog
 #endif
             }
 
+            // Forces written data to disk.
+            int sync()
+            {
+#ifdef _WIN32
+                return m_file != -1 ? ::_commit(m_file) : -1;
+#else
+                return m_file != -1 ? ::fsync(m_file) : -1;
+#endif
+            }
+
             void close()
             {
                 if (m_file != -1)
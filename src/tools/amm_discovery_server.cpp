@@ -0,0 +1,104 @@
+// Discovery server for AMM modules started with a discovery server address, see AMM::DiscoveryServer.
+//
+//    amm_discovery_server [--listen host[:port]] [--domain id]
+//
+// Listens on 0.0.0.0:11811 in domain 15 by default and runs until interrupted, printing every
+// participant that joins or leaves.  Each client exchanges discovery data with the server only, so
+// discovery traffic grows with the number of participants instead of its square.
+
+#include "amm/DiscoveryServer.h"
+
+#include <fastrtps/Domain.h>
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace {
+
+   /// Default domain ID for AMM Modules, as in DDSManager.
+   const uint32_t DOMAIN_ID = 15;
+
+   /// Largest domain ID the default RTPS port mapping allows.
+   const unsigned long MAX_DOMAIN_ID = 232;
+
+   std::atomic<bool> running(true);
+
+   void Stop(int) {
+      running = false;
+   }
+
+   class Listener : public eprosima::fastrtps::ParticipantListener {
+   public:
+      void onParticipantDiscovery(
+         eprosima::fastrtps::Participant *, eprosima::fastrtps::rtps::ParticipantDiscoveryInfo &&info
+      ) override {
+         switch (info.status) {
+            case eprosima::fastrtps::rtps::ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT:
+               std::cout << "Joined: " << info.info.m_participantName.c_str() << " (" << ++participants
+                         << " participants)" << std::endl;
+               break;
+            case eprosima::fastrtps::rtps::ParticipantDiscoveryInfo::REMOVED_PARTICIPANT:
+            case eprosima::fastrtps::rtps::ParticipantDiscoveryInfo::DROPPED_PARTICIPANT:
+               std::cout << "Left: " << info.info.m_participantName.c_str() << " (" << --participants
+                         << " participants)" << std::endl;
+               break;
+            default:
+               break;
+         }
+      }
+
+      std::atomic<int> participants{0};
+   };
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+   std::string address = "0.0.0.0";
+   uint32_t domainId = DOMAIN_ID;
+
+   for (int i = 1; i < argc; ++i) {
+      if (std::strcmp(argv[i], "--listen") == 0 && i + 1 < argc) {
+         address = argv[++i];
+      } else if (std::strcmp(argv[i], "--domain") == 0 && i + 1 < argc) {
+         const char *digits = argv[++i];
+         char *end = nullptr;
+         const unsigned long value = std::strtoul(digits, &end, 10);
+         // strtoul accepts a sign and leading spaces, a domain ID is digits only.
+         if (*digits < '0' || *digits > '9' || *end != '\0' || value > MAX_DOMAIN_ID) {
+            std::cerr << "Invalid domain ID " << digits << ", expected 0 to " << MAX_DOMAIN_ID << "." << std::endl;
+            return 2;
+         }
+         domainId = static_cast<uint32_t>(value);
+      } else {
+         std::cerr << "Usage: " << argv[0] << " [--listen host[:port]] [--domain id]" << std::endl;
+         return 2;
+      }
+   }
+
+   Listener listener;
+   std::string errmsg;
+   eprosima::fastrtps::Participant *server = AMM::DiscoveryServer::CreateServer(address, domainId, &listener, errmsg);
+   if (server == nullptr) {
+      std::cerr << errmsg << std::endl;
+      return 1;
+   }
+
+   std::signal(SIGINT, Stop);
+   std::signal(SIGTERM, Stop);
+
+   std::cout << "Discovery server listening on " << address << ", domain " << domainId << std::endl;
+   while (running) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(200));
+   }
+
+   std::cout << "Stopping with " << listener.participants << " participants" << std::endl;
+   eprosima::fastrtps::Domain::removeParticipant(server);
+   eprosima::fastrtps::Domain::stopAll();
+   return 0;
+}
@@ -0,0 +1,110 @@
+// Renders binary log files written through PLOG_BIN as text or CSV.
+//
+//    amm_log_decode [--csv] [--sort] <file>
+//
+// --sort orders records from all threads by timestamp, otherwise they are printed in the order
+// the per-thread buffers reached the file.
+
+#include <plog/BinaryLog.h>
+#include <plog/Formatters/CsvFormatter.h>
+#include <plog/Formatters/TxtFormatter.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+   template<class Formatter>
+   void Print(const plog::Record &record) {
+#ifdef _WIN32
+      std::wcout << Formatter::format(record);
+#else
+      std::cout << Formatter::format(record);
+#endif
+   }
+
+   template<class Formatter>
+   int Decode(const std::string &data, bool sort) {
+#ifdef _WIN32
+      std::wcout << Formatter::header();
+#else
+      std::cout << Formatter::header();
+#endif
+
+      plog::binary::Reader reader(data);
+
+      if (!sort) {
+         plog::binary::DecodedRecord record;
+         while (reader.next(record)) {
+            Print<Formatter>(record);
+         }
+      } else {
+         std::vector<std::unique_ptr<plog::binary::DecodedRecord>> records;
+         for (;;) {
+            std::unique_ptr<plog::binary::DecodedRecord> record(new plog::binary::DecodedRecord());
+            if (!reader.next(*record)) break;
+            records.push_back(std::move(record));
+         }
+
+         std::stable_sort(records.begin(), records.end(),
+            [](const std::unique_ptr<plog::binary::DecodedRecord> &a,
+               const std::unique_ptr<plog::binary::DecodedRecord> &b) {
+               return a->getTimeNs() < b->getTimeNs();
+            });
+
+         for (const auto &record : records) {
+            Print<Formatter>(*record);
+         }
+      }
+
+      if (!reader.valid()) {
+         std::cerr << "Stopped at malformed or truncated data" << std::endl;
+         return 1;
+      }
+      return 0;
+   }
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+   bool csv = false;
+   bool sort = false;
+   const char *path = nullptr;
+
+   for (int i = 1; i < argc; ++i) {
+      if (std::strcmp(argv[i], "--csv") == 0) {
+         csv = true;
+      } else if (std::strcmp(argv[i], "--sort") == 0) {
+         sort = true;
+      } else if (path == nullptr) {
+         path = argv[i];
+      } else {
+         path = nullptr;
+         break;
+      }
+   }
+
+   if (path == nullptr) {
+      std::cerr << "Usage: " << argv[0] << " [--csv] [--sort] <file>" << std::endl;
+      return 2;
+   }
+
+   std::ifstream in(path, std::ios::binary);
+   if (!in) {
+      std::cerr << "Unable to open " << path << std::endl;
+      return 1;
+   }
+
+   std::ostringstream contents;
+   contents << in.rdbuf();
+   const std::string data = contents.str();
+
+   return csv ? Decode<plog::CsvFormatter>(data, sort) : Decode<plog::TxtFormatter>(data, sort);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdio>
+
+/// Minimal assertions for the unit tests: a failed CHECK prints its location and the test
+/// keeps going, and main returns CHECK_RESULT() so ctest reports the failure.
+namespace check {
+
+    inline int &Failures() {
+       static int failures = 0;
+       return failures;
+    }
+
+} // namespace check
+
+#define CHECK(condition)                                                              \
+   do {                                                                               \
+      if (!(condition)) {                                                             \
+         std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+         ++check::Failures();                                                         \
+      }                                                                               \
+   } while (0)
+
+#define CHECK_RESULT() (check::Failures() == 0 ? 0 : 1)
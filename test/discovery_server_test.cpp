@@ -0,0 +1,262 @@
+// DiscoveryServer: address parsing, a loopback server with two clients that have to discover each other, and
+// how the participants each participant discovers grow with the network, with and without the server.
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastrtps/Domain.h>
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
+#include "amm/AMM_ExtendedPubSubTypes.h"
+#include "amm/DiscoveryServer.h"
+
+#include "Check.h"
+
+namespace {
+
+   /// Away from the AMM domain 15 and the default port, so a running lab is not disturbed.
+   const uint32_t DOMAIN_ID = 42;
+   const char *SERVER_ADDRESS = "127.0.0.1:11911";
+
+   const char *PROFILES =
+      "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>"
+      "<profiles xmlns=\"http://www.eprosima.com/XMLSchemas/fastRTPS_Profiles\">"
+      "<participant profile_name=\"amm_discovery_test_a\">"
+      "<domainId>42</domainId><rtps><name>amm_discovery_test_a</name></rtps>"
+      "</participant>"
+      "<participant profile_name=\"amm_discovery_test_b\">"
+      "<domainId>42</domainId><rtps><name>amm_discovery_test_b</name></rtps>"
+      "</participant>"
+      "</profiles>";
+
+   /// Names of the participants currently discovered.
+   class Listener : public eprosima::fastrtps::ParticipantListener {
+   public:
+      void onParticipantDiscovery(
+         eprosima::fastrtps::Participant *, eprosima::fastrtps::rtps::ParticipantDiscoveryInfo &&info
+      ) override {
+         typedef eprosima::fastrtps::rtps::ParticipantDiscoveryInfo Info;
+
+         std::lock_guard<std::mutex> lock(m_mutex);
+         const std::string name = info.info.m_participantName.c_str();
+         if (info.status == Info::DISCOVERED_PARTICIPANT) {
+            m_names.insert(name);
+         } else if (info.status == Info::REMOVED_PARTICIPANT || info.status == Info::DROPPED_PARTICIPANT) {
+            m_names.erase(name);
+         }
+         m_changed.notify_all();
+      }
+
+      /// @returns True if the participant was discovered within the timeout.
+      bool WaitFor(const std::string &name, std::chrono::seconds timeout) {
+         std::unique_lock<std::mutex> lock(m_mutex);
+         return m_changed.wait_for(lock, timeout, [&] { return m_names.count(name) != 0; });
+      }
+
+      /// @param prefix Start of the names to count, so other participants on the domain are not.
+      /// @returns Number of participants discovered whose names start with the prefix.
+      std::size_t Count(const std::string &prefix) {
+         std::lock_guard<std::mutex> lock(m_mutex);
+         std::size_t count = 0;
+         for (const std::string &name : m_names) {
+            if (name.compare(0, prefix.size(), prefix) == 0) ++count;
+         }
+         return count;
+      }
+
+   private:
+      std::mutex m_mutex;
+
+      std::condition_variable m_changed;
+
+      std::set<std::string> m_names;
+   };
+
+   void TestParseAddress() {
+      std::string host;
+      uint16_t port = 0;
+      std::string errmsg;
+
+      CHECK(AMM::DiscoveryServer::ParseAddress("192.168.1.10", host, port, errmsg) == 0);
+      CHECK(host == "192.168.1.10" && port == AMM::DiscoveryServer::DEFAULT_PORT);
+
+      CHECK(AMM::DiscoveryServer::ParseAddress("localhost:12000", host, port, errmsg) == 0);
+      CHECK(host == "127.0.0.1" && port == 12000);
+
+      CHECK(AMM::DiscoveryServer::ParseAddress("192.168.1.10:", host, port, errmsg) != 0);
+      CHECK(AMM::DiscoveryServer::ParseAddress("192.168.1.10:0", host, port, errmsg) != 0);
+      CHECK(AMM::DiscoveryServer::ParseAddress("192.168.1.10:65536", host, port, errmsg) != 0);
+      CHECK(AMM::DiscoveryServer::ParseAddress("192.168.1.10:11811x", host, port, errmsg) != 0);
+      CHECK(AMM::DiscoveryServer::ParseAddress("lab-host:11811", host, port, errmsg) != 0);
+   }
+
+   /// Give two participants a topic in common, the first publishing it and the second subscribing.
+   /// A discovery server only forwards a client the participants it shares a topic with.
+   /// @returns True if both endpoints were created.
+   bool ShareTopic(
+      eprosima::fastrtps::Participant *publishing, eprosima::fastrtps::Participant *subscribing,
+      const std::string &topicName
+   ) {
+      // Each participant keeps its type until it is removed.
+      static std::vector<std::unique_ptr<AMM::TickPubSubType>> types;
+
+      for (eprosima::fastrtps::Participant *participant : {publishing, subscribing}) {
+         types.emplace_back(new AMM::TickPubSubType());
+         if (!eprosima::fastrtps::Domain::registerType(participant, types.back().get())) return false;
+      }
+
+      eprosima::fastrtps::PublisherAttributes pa;
+      pa.topic.topicDataType = types.back()->getName();
+      pa.topic.topicName = topicName;
+      eprosima::fastrtps::SubscriberAttributes sa;
+      sa.topic.topicDataType = types.back()->getName();
+      sa.topic.topicName = topicName;
+      return eprosima::fastrtps::Domain::createPublisher(publishing, pa) != nullptr &&
+             eprosima::fastrtps::Domain::createSubscriber(subscribing, sa) != nullptr;
+   }
+
+   /// Number of participants each participant discovered in a network of pairs sharing a topic.
+   /// @param count Number of participants, even.
+   /// @param serverPort Port of a discovery server to use, 0 for simple discovery.
+   /// @returns Participants of the network discovered by each participant, the server not included, empty on
+   /// error.
+   std::vector<std::size_t> DiscoveredPerParticipant(std::size_t count, uint16_t serverPort) {
+      const std::string prefix =
+         "amm_discovery_growth_" + std::to_string(serverPort) + "_" + std::to_string(count) + "_";
+      const std::string address = "127.0.0.1:" + std::to_string(serverPort);
+
+      std::string profiles =
+         "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>"
+         "<profiles xmlns=\"http://www.eprosima.com/XMLSchemas/fastRTPS_Profiles\">";
+      for (std::size_t i = 0; i < count; ++i) {
+         const std::string name = prefix + std::to_string(i);
+         profiles += "<participant profile_name=\"" + name + "\"><domainId>42</domainId><rtps><name>" + name +
+                     "</name></rtps></participant>";
+      }
+      profiles += "</profiles>";
+      if (eprosima::fastrtps::xmlparser::XMLProfileManager::loadXMLString(profiles.c_str(), profiles.size()) !=
+          eprosima::fastrtps::xmlparser::XMLP_ret::XML_OK) {
+         return {};
+      }
+
+      std::string errmsg;
+      eprosima::fastrtps::Participant *server = nullptr;
+      if (serverPort != 0) {
+         server = AMM::DiscoveryServer::CreateServer(address, DOMAIN_ID, nullptr, errmsg);
+         if (server == nullptr) return {};
+      }
+
+      std::vector<std::unique_ptr<Listener>> listeners;
+      std::vector<eprosima::fastrtps::Participant *> participants;
+      bool created = true;
+      for (std::size_t i = 0; i < count && created; ++i) {
+         const std::string name = prefix + std::to_string(i);
+         listeners.emplace_back(new Listener());
+         eprosima::fastrtps::Participant *participant = serverPort != 0 ?
+            AMM::DiscoveryServer::CreateClient(name, address, listeners.back().get(), errmsg) :
+            eprosima::fastrtps::Domain::createParticipant(name, listeners.back().get());
+         created = participant != nullptr;
+         if (created) participants.push_back(participant);
+      }
+      for (std::size_t i = 0; i + 1 < participants.size() && created; i += 2) {
+         created = ShareTopic(participants[i], participants[i + 1], prefix + "pair_" + std::to_string(i / 2));
+      }
+
+      std::vector<std::size_t> discovered;
+      if (created) {
+         // Every participant has to find its partner, then anything else it would discover has time to arrive.
+         const std::chrono::seconds timeout(10);
+         for (std::size_t i = 0; i < count; ++i) {
+            CHECK(listeners[i]->WaitFor(prefix + std::to_string(i ^ 1), timeout));
+            if (server != nullptr) CHECK(listeners[i]->WaitFor(AMM::DiscoveryServer::PARTICIPANT_NAME, timeout));
+         }
+         std::this_thread::sleep_for(std::chrono::seconds(3));
+         for (std::size_t i = 0; i < count; ++i) discovered.push_back(listeners[i]->Count(prefix));
+      }
+
+      for (eprosima::fastrtps::Participant *participant : participants) {
+         eprosima::fastrtps::Domain::removeParticipant(participant);
+      }
+      if (server != nullptr) eprosima::fastrtps::Domain::removeParticipant(server);
+      return discovered;
+   }
+
+   std::size_t Sum(const std::vector<std::size_t> &counts) {
+      std::size_t sum = 0;
+      for (std::size_t count : counts) sum += count;
+      return sum;
+   }
+
+   /// With simple discovery every participant discovers every other one, so the discovery state and
+   /// traffic of the network grow with the square of its size.  Through a server each client only
+   /// learns of the server and the participants it shares a topic with, so they grow linearly.
+   void TestGrowth() {
+      const std::size_t n = 4;
+
+      const std::vector<std::size_t> simple = DiscoveredPerParticipant(n, 0);
+      const std::vector<std::size_t> simpleDouble = DiscoveredPerParticipant(2 * n, 0);
+      CHECK(simple.size() == n && simpleDouble.size() == 2 * n);
+      for (std::size_t count : simple) CHECK(count == n - 1);
+      for (std::size_t count : simpleDouble) CHECK(count == 2 * n - 1);
+      CHECK(Sum(simpleDouble) > 2 * Sum(simple));
+
+      const std::vector<std::size_t> server = DiscoveredPerParticipant(n, 11913);
+      const std::vector<std::size_t> serverDouble = DiscoveredPerParticipant(2 * n, 11914);
+      CHECK(server.size() == n && serverDouble.size() == 2 * n);
+      // Only the partner, besides the server.
+      for (std::size_t count : server) CHECK(count == 1);
+      for (std::size_t count : serverDouble) CHECK(count == 1);
+      CHECK(Sum(serverDouble) == 2 * Sum(server));
+   }
+
+   void TestLoopback() {
+      CHECK(eprosima::fastrtps::xmlparser::XMLProfileManager::loadXMLString(PROFILES, std::strlen(PROFILES)) ==
+            eprosima::fastrtps::xmlparser::XMLP_ret::XML_OK);
+
+      std::string errmsg;
+      Listener serverListener;
+      eprosima::fastrtps::Participant *server =
+         AMM::DiscoveryServer::CreateServer(SERVER_ADDRESS, DOMAIN_ID, &serverListener, errmsg);
+      CHECK(server != nullptr);
+
+      Listener listenerA;
+      Listener listenerB;
+      eprosima::fastrtps::Participant *clientA =
+         AMM::DiscoveryServer::CreateClient("amm_discovery_test_a", SERVER_ADDRESS, &listenerA, errmsg);
+      eprosima::fastrtps::Participant *clientB =
+         AMM::DiscoveryServer::CreateClient("amm_discovery_test_b", SERVER_ADDRESS, &listenerB, errmsg);
+      CHECK(clientA != nullptr);
+      CHECK(clientB != nullptr);
+
+      if (server != nullptr && clientA != nullptr && clientB != nullptr) {
+         CHECK(ShareTopic(clientA, clientB, "amm_discovery_test"));
+         // Clients only talk to the server, which has to forward each one the other.
+         const std::chrono::seconds timeout(10);
+         CHECK(serverListener.WaitFor("amm_discovery_test_a", timeout));
+         CHECK(serverListener.WaitFor("amm_discovery_test_b", timeout));
+         CHECK(listenerA.WaitFor(AMM::DiscoveryServer::PARTICIPANT_NAME, timeout));
+         CHECK(listenerA.WaitFor("amm_discovery_test_b", timeout));
+         CHECK(listenerB.WaitFor("amm_discovery_test_a", timeout));
+      }
+
+      if (clientA != nullptr) eprosima::fastrtps::Domain::removeParticipant(clientA);
+      if (clientB != nullptr) eprosima::fastrtps::Domain::removeParticipant(clientB);
+      if (server != nullptr) eprosima::fastrtps::Domain::removeParticipant(server);
+   }
+
+} // namespace
+
+int main() {
+   TestParseAddress();
+   TestLoopback();
+   TestGrowth();
+   eprosima::fastrtps::Domain::stopAll();
+   return CHECK_RESULT();
+}
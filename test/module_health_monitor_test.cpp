@@ -0,0 +1,190 @@
+// ModuleHealthMonitor: state transitions from Status and liveliness, modules with several Status writers,
+// and forgetting writers that went away.
+
+#include <string>
+#include <vector>
+
+#include "amm/ModuleHealthMonitor.h"
+
+#include "Check.h"
+
+namespace {
+
+   using eprosima::fastrtps::LivelinessChangedStatus;
+   using eprosima::fastrtps::SampleInfo_t;
+   using eprosima::fastrtps::rtps::GUID_t;
+   using AMM::ModuleHealthMonitor;
+
+   /// Every state change the handler was called with.
+   struct Changes {
+      struct Change {
+         std::string moduleId;
+
+         ModuleHealthMonitor::State previous;
+
+         ModuleHealthMonitor::State state;
+      };
+
+      std::vector<Change> changes;
+
+      void Attach(ModuleHealthMonitor &monitor) {
+         monitor.SetHandler([this](const ModuleHealthMonitor::Entry &entry, ModuleHealthMonitor::State previous) {
+            changes.push_back({entry.moduleId, previous, entry.state});
+         });
+      }
+
+      /// @returns True if the last change was of the module, to the state.
+      bool Last(const std::string &moduleId, ModuleHealthMonitor::State previous, ModuleHealthMonitor::State state) {
+         return !changes.empty() && changes.back().moduleId == moduleId && changes.back().previous == previous &&
+                changes.back().state == state;
+      }
+   };
+
+   GUID_t Writer(unsigned char participant) {
+      GUID_t guid;
+      guid.guidPrefix.value[0] = participant;
+      return guid;
+   }
+
+   void Publish(ModuleHealthMonitor &monitor, const std::string &moduleId, const std::string &capability,
+                AMM::StatusValue value, const GUID_t &writer) {
+      AMM::StatusSample status;
+      status.module_id().id(moduleId);
+      status.module_name("heart");
+      status.capability(capability);
+      status.value(value);
+
+      SampleInfo_t info;
+      info.sample_identity.writer_guid(writer);
+      monitor.OnStatus(status, &info);
+   }
+
+   /// Liveliness of a Status reader changing by one writer.
+   void Liveliness(ModuleHealthMonitor &monitor, const GUID_t &writer, int32_t aliveChange, int32_t notAliveChange) {
+      LivelinessChangedStatus status;
+      status.alive_count_change = aliveChange;
+      status.not_alive_count_change = notAliveChange;
+      status.last_publication_handle = writer;
+      monitor.OnLivelinessChanged(status);
+   }
+
+   void LoseLiveliness(ModuleHealthMonitor &monitor, const GUID_t &writer) { Liveliness(monitor, writer, -1, 1); }
+
+   void RecoverLiveliness(ModuleHealthMonitor &monitor, const GUID_t &writer) { Liveliness(monitor, writer, 1, -1); }
+
+   void Unmatch(ModuleHealthMonitor &monitor, const GUID_t &writer) { Liveliness(monitor, writer, -1, 0); }
+
+   void TestTransitions() {
+      ModuleHealthMonitor monitor;
+      Changes changes;
+      changes.Attach(monitor);
+      const GUID_t writer = Writer(1);
+
+      AMM::OperationalDescription description;
+      description.module_id().id("heart_1");
+      description.name("Heart");
+      monitor.OnOperationalDescription(description);
+      CHECK(changes.changes.empty());
+
+      ModuleHealthMonitor::Entry entry;
+      CHECK(monitor.Find("heart_1", entry) == 0);
+      CHECK(entry.state == ModuleHealthMonitor::UNKNOWN && entry.name == "Heart");
+
+      Publish(monitor, "heart_1", "pump", AMM::OPERATIONAL, writer);
+      CHECK(changes.Last("heart_1", ModuleHealthMonitor::UNKNOWN, ModuleHealthMonitor::OPERATIONAL));
+
+      // Repeating a Status is not a change.
+      for (int i = 0; i < 10; ++i) Publish(monitor, "heart_1", "pump", AMM::OPERATIONAL, writer);
+      CHECK(changes.changes.size() == 1);
+
+      Publish(monitor, "heart_1", "valve", AMM::EXIGENT, writer);
+      CHECK(changes.Last("heart_1", ModuleHealthMonitor::OPERATIONAL, ModuleHealthMonitor::EXIGENT));
+
+      LoseLiveliness(monitor, writer);
+      CHECK(changes.Last("heart_1", ModuleHealthMonitor::EXIGENT, ModuleHealthMonitor::LOST));
+
+      // Writers that never published a Status are not tracked.
+      LoseLiveliness(monitor, Writer(9));
+      CHECK(changes.changes.size() == 3);
+
+      RecoverLiveliness(monitor, writer);
+      CHECK(changes.Last("heart_1", ModuleHealthMonitor::LOST, ModuleHealthMonitor::EXIGENT));
+
+      Publish(monitor, "heart_1", "valve", AMM::INOPERATIVE, writer);
+      CHECK(changes.Last("heart_1", ModuleHealthMonitor::EXIGENT, ModuleHealthMonitor::INOPERATIVE));
+
+      CHECK(monitor.Find("heart_1", entry) == 0);
+      CHECK(entry.capabilities.size() == 2 && entry.alive);
+      CHECK(monitor.Snapshot().size() == 1);
+      CHECK(monitor.Remove("heart_1") == 0);
+      CHECK(monitor.Find("heart_1", entry) == 1);
+      CHECK(monitor.Remove("heart_1") == 1);
+   }
+
+   void TestSeveralWriters() {
+      ModuleHealthMonitor monitor;
+      Changes changes;
+      changes.Attach(monitor);
+      const GUID_t first = Writer(1);
+      const GUID_t second = Writer(2);
+
+      Publish(monitor, "heart_1", "pump", AMM::OPERATIONAL, first);
+      Publish(monitor, "heart_1", "valve", AMM::OPERATIONAL, second);
+      CHECK(changes.changes.size() == 1);
+
+      // One writer left alive keeps the module up.
+      LoseLiveliness(monitor, first);
+      CHECK(changes.changes.size() == 1);
+
+      LoseLiveliness(monitor, second);
+      CHECK(changes.Last("heart_1", ModuleHealthMonitor::OPERATIONAL, ModuleHealthMonitor::LOST));
+
+      RecoverLiveliness(monitor, second);
+      CHECK(changes.Last("heart_1", ModuleHealthMonitor::LOST, ModuleHealthMonitor::OPERATIONAL));
+
+      // A writer going away while another is alive is not a loss either.
+      RecoverLiveliness(monitor, first);
+      Unmatch(monitor, first);
+      CHECK(changes.changes.size() == 3);
+
+      Unmatch(monitor, second);
+      CHECK(changes.Last("heart_1", ModuleHealthMonitor::OPERATIONAL, ModuleHealthMonitor::LOST));
+   }
+
+   void TestGoneWriters() {
+      ModuleHealthMonitor monitor;
+      Changes changes;
+      changes.Attach(monitor);
+      const GUID_t writer = Writer(1);
+
+      Publish(monitor, "heart_1", "pump", AMM::OPERATIONAL, writer);
+      LoseLiveliness(monitor, writer);
+      CHECK(changes.Last("heart_1", ModuleHealthMonitor::OPERATIONAL, ModuleHealthMonitor::LOST));
+
+      // Removed while not alive, after which the writer is forgotten and its changes ignored.
+      Liveliness(monitor, writer, 0, -1);
+      CHECK(changes.changes.size() == 2);
+      RecoverLiveliness(monitor, writer);
+      CHECK(changes.changes.size() == 2);
+
+      // A new writer of the module brings it back.
+      Publish(monitor, "heart_1", "pump", AMM::OPERATIONAL, Writer(2));
+      CHECK(changes.Last("heart_1", ModuleHealthMonitor::LOST, ModuleHealthMonitor::OPERATIONAL));
+
+      // A Status without sample info does not track a writer, and cannot be lost.
+      AMM::StatusSample status;
+      status.module_id().id("lung_1");
+      status.capability("");
+      status.value(AMM::OPERATIONAL);
+      monitor.OnStatus(status, nullptr);
+      CHECK(changes.Last("lung_1", ModuleHealthMonitor::UNKNOWN, ModuleHealthMonitor::OPERATIONAL));
+   }
+
+} // namespace
+
+int main() {
+   TestTransitions();
+   TestSeveralWriters();
+   TestGoneWriters();
+   return CHECK_RESULT();
+}
@@ -0,0 +1,321 @@
+// PayloadCodec: LZ4 block round trips, malformed blocks and payloads, the capability gate on Encode as the
+// participant listener drives it, the capability on every kind of participant, and durable writers.
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fastrtps/Domain.h>
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
+#include "amm/AMM_StandardPubSubTypes.h"
+#include "amm/DDS_Listeners.h"
+#include "amm/DiscoveryServer.h"
+#include "amm/PayloadCodec.h"
+#include "amm/StaticDiscovery.h"
+
+#include "Check.h"
+
+namespace {
+
+   using eprosima::fastrtps::rtps::ParticipantDiscoveryInfo;
+   using eprosima::fastrtps::rtps::ParticipantProxyData;
+   using eprosima::fastrtps::rtps::RTPSParticipantAllocationAttributes;
+   using eprosima::fastrtps::rtps::SerializedPayload_t;
+
+   std::vector<uint8_t> Random(size_t size, unsigned seed) {
+      std::mt19937 rng(seed);
+      std::vector<uint8_t> data(size);
+      for (auto &byte : data) byte = static_cast<uint8_t>(rng());
+      return data;
+   }
+
+   std::vector<uint8_t> Repetitive(size_t size) {
+      const std::string record = "<data name=\"Cardiovascular_HeartRate\" value=\"72.000000\"/>\n";
+      std::vector<uint8_t> data(size);
+      for (size_t i = 0; i < size; ++i) data[i] = static_cast<uint8_t>(record[i % record.size()]);
+      return data;
+   }
+
+   /// Compresses and decompresses a block, checking it comes back identical.
+   void RoundTrip(const std::vector<uint8_t> &input) {
+      std::vector<uint8_t> compressed(AMM::lz4::CompressBound(input.size()));
+      const size_t size = AMM::lz4::Compress(input.data(), input.size(), compressed.data(), compressed.size());
+      CHECK(size > 0);
+
+      std::vector<uint8_t> output(input.size() + 1);
+      size_t written = 0;
+      CHECK(AMM::lz4::Decompress(compressed.data(), size, output.data(), output.size(), written) == 0);
+      CHECK(written == input.size());
+      CHECK(input.empty() || std::memcmp(output.data(), input.data(), input.size()) == 0);
+
+      // The exact size is enough room, one byte less is not.
+      CHECK(AMM::lz4::Decompress(compressed.data(), size, output.data(), input.size(), written) == 0);
+      if (!input.empty()) {
+         CHECK(AMM::lz4::Decompress(compressed.data(), size, output.data(), input.size() - 1, written) != 0);
+      }
+   }
+
+   void TestRoundTrips() {
+      const size_t sizes[] = {0, 1, 5, 12, 13, 64, 255, 256, 1000, 4096, 70000, 300000};
+      for (size_t size : sizes) {
+         RoundTrip(Random(size, static_cast<unsigned>(size)));
+         RoundTrip(Repetitive(size));
+         RoundTrip(std::vector<uint8_t>(size, 0));
+      }
+
+      // Repetitive input has to actually shrink.
+      const std::vector<uint8_t> input = Repetitive(64 * 1024);
+      std::vector<uint8_t> compressed(AMM::lz4::CompressBound(input.size()));
+      CHECK(AMM::lz4::Compress(input.data(), input.size(), compressed.data(), compressed.size()) < input.size() / 4);
+
+      // Too small an output buffer fails instead of overrunning it.
+      const std::vector<uint8_t> noise = Random(4096, 1);
+      CHECK(AMM::lz4::Compress(noise.data(), noise.size(), compressed.data(), noise.size() / 2) == 0);
+   }
+
+   void TestMalformedBlocks() {
+      const std::vector<uint8_t> input = Repetitive(8192);
+      std::vector<uint8_t> compressed(AMM::lz4::CompressBound(input.size()));
+      const size_t size = AMM::lz4::Compress(input.data(), input.size(), compressed.data(), compressed.size());
+      std::vector<uint8_t> output(input.size());
+      size_t written = 0;
+
+      // No truncation reads or writes out of bounds.  One ending on a sequence boundary is a valid,
+      // shorter block, which Decode rejects by the original length in its header.
+      for (size_t cut = 0; cut < size; ++cut) {
+         CHECK(AMM::lz4::Decompress(compressed.data(), cut, output.data(), output.size(), written) != 0 ||
+               written < input.size());
+      }
+
+      // A match reaching before the start of the output.
+      const uint8_t badOffset[] = {0x10, 'a', 0x10, 0x00, 'b', 'c', 'd', 'e', 'f'};
+      CHECK(AMM::lz4::Decompress(badOffset, sizeof(badOffset), output.data(), output.size(), written) != 0);
+
+      // A zero offset.
+      const uint8_t zeroOffset[] = {0x10, 'a', 0x00, 0x00, 0x50, 'b', 'c', 'd', 'e', 'f'};
+      CHECK(AMM::lz4::Decompress(zeroOffset, sizeof(zeroOffset), output.data(), output.size(), written) != 0);
+
+      // A literal run longer than the input.
+      const uint8_t longLiterals[] = {0xF0, 0xFF, 0xFF, 0x10, 'a', 'b'};
+      CHECK(AMM::lz4::Decompress(longLiterals, sizeof(longLiterals), output.data(), output.size(), written) != 0);
+
+      // Random bytes never crash; with ASan or valgrind this also checks the bounds.
+      std::mt19937 rng(7);
+      for (int i = 0; i < 2000; ++i) {
+         std::vector<uint8_t> garbage = Random(1 + rng() % 512, static_cast<unsigned>(i));
+         AMM::lz4::Decompress(garbage.data(), garbage.size(), output.data(), output.size(), written);
+         CHECK(written <= output.size());
+      }
+   }
+
+   void Fill(SerializedPayload_t &payload, const std::vector<uint8_t> &data) {
+      payload.reserve(static_cast<uint32_t>(data.size()));
+      std::memcpy(payload.data, data.data(), data.size());
+      payload.length = static_cast<uint32_t>(data.size());
+   }
+
+   bool Equals(const SerializedPayload_t &payload, const std::vector<uint8_t> &data) {
+      return payload.length == data.size() && std::memcmp(payload.data, data.data(), data.size()) == 0;
+   }
+
+   void TestPayloads() {
+      const std::vector<uint8_t> xml = Repetitive(16 * 1024);
+      SerializedPayload_t payload;
+
+      // Disabled by default: nothing changes.
+      Fill(payload, xml);
+      AMM::PayloadCodec::Encode(&payload);
+      CHECK(Equals(payload, xml));
+      CHECK(AMM::PayloadCodec::Decode(&payload) == &payload);
+
+      AMM::PayloadCodec::SetEnabled(true);
+
+      Fill(payload, xml);
+      AMM::PayloadCodec::Encode(&payload);
+      CHECK(payload.length < xml.size());
+      CHECK(payload.data[0] == 'A' && payload.data[1] == 'Z');
+      SerializedPayload_t *plain = AMM::PayloadCodec::Decode(&payload);
+      CHECK(plain != nullptr && plain != &payload);
+      if (plain != nullptr) CHECK(Equals(*plain, xml));
+
+      // Below the threshold and incompressible payloads are sent as they are.
+      const std::vector<uint8_t> small = Repetitive(AMM::PayloadCodec::Threshold() - 1);
+      Fill(payload, small);
+      AMM::PayloadCodec::Encode(&payload);
+      CHECK(Equals(payload, small));
+
+      const std::vector<uint8_t> noise = Random(8192, 3);
+      Fill(payload, noise);
+      AMM::PayloadCodec::Encode(&payload);
+      CHECK(Equals(payload, noise));
+
+      // Corrupt compressed payloads are rejected, not decoded into garbage.
+      const uint64_t errors = AMM::PayloadCodec::GetStats().errors;
+      Fill(payload, xml);
+      AMM::PayloadCodec::Encode(&payload);
+      const uint32_t length = payload.length;
+
+      payload.data[2] = 99;
+      CHECK(AMM::PayloadCodec::Decode(&payload) == nullptr);
+      payload.data[2] = 1;
+
+      payload.data[7] = 0x7F;
+      CHECK(AMM::PayloadCodec::Decode(&payload) == nullptr);
+      payload.data[7] = 0;
+
+      payload.data[4] ^= 1;
+      CHECK(AMM::PayloadCodec::Decode(&payload) == nullptr);
+      payload.data[4] ^= 1;
+
+      payload.length = length / 2;
+      CHECK(AMM::PayloadCodec::Decode(&payload) == nullptr);
+      payload.length = length;
+
+      CHECK(AMM::PayloadCodec::Decode(&payload) != nullptr);
+      CHECK(AMM::PayloadCodec::GetStats().errors == errors + 4);
+
+      AMM::PayloadCodec::SetEnabled(false);
+   }
+
+   /// Reports a discovery event through the participant listener every DDSManager uses.
+   void Discover(ParticipantProxyData &data, ParticipantDiscoveryInfo::DISCOVERY_STATUS status) {
+      static AMM::DDS_Listeners::ParticipantListener listener;
+      ParticipantDiscoveryInfo info(data);
+      info.status = status;
+      listener.onParticipantDiscovery(nullptr, std::move(info));
+   }
+
+   void TestCapability() {
+      RTPSParticipantAllocationAttributes allocation;
+      ParticipantProxyData capable(allocation);
+      capable.m_guid.guidPrefix.value[0] = 1;
+      capable.m_properties.push_back(
+         std::make_pair(std::string(AMM::PayloadCodec::CAPABILITY), std::string(AMM::PayloadCodec::CAPABILITY_VALUE))
+      );
+      ParticipantProxyData older(allocation);
+      older.m_guid.guidPrefix.value[0] = 2;
+
+      const std::vector<uint8_t> xml = Repetitive(16 * 1024);
+      SerializedPayload_t payload;
+      AMM::PayloadCodec::SetEnabled(true);
+
+      Discover(capable, ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT);
+      CHECK(AMM::PayloadCodec::PeersWithoutCapability() == 0);
+      Fill(payload, xml);
+      AMM::PayloadCodec::Encode(&payload);
+      CHECK(payload.length < xml.size());
+
+      // An older module, seen by two local participants, turns compression off until both lose it.
+      Discover(older, ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT);
+      Discover(older, ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT);
+      CHECK(AMM::PayloadCodec::PeersWithoutCapability() == 1);
+
+      const uint64_t withheld = AMM::PayloadCodec::GetStats().withheld;
+      Fill(payload, xml);
+      AMM::PayloadCodec::Encode(&payload);
+      CHECK(Equals(payload, xml));
+      CHECK(AMM::PayloadCodec::GetStats().withheld == withheld + 1);
+
+      Discover(older, ParticipantDiscoveryInfo::REMOVED_PARTICIPANT);
+      CHECK(AMM::PayloadCodec::PeersWithoutCapability() == 1);
+      Discover(older, ParticipantDiscoveryInfo::DROPPED_PARTICIPANT);
+      CHECK(AMM::PayloadCodec::PeersWithoutCapability() == 0);
+
+      Fill(payload, xml);
+      AMM::PayloadCodec::Encode(&payload);
+      CHECK(payload.length < xml.size());
+
+      // QoS changes are not discoveries.
+      Discover(older, ParticipantDiscoveryInfo::CHANGED_QOS_PARTICIPANT);
+      CHECK(AMM::PayloadCodec::PeersWithoutCapability() == 0);
+
+      AMM::PayloadCodec::SetEnabled(false);
+   }
+
+   /// Domain 42 keeps the test off the AMM domain of a running lab.
+   const char *PROFILES =
+      "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>"
+      "<profiles xmlns=\"http://www.eprosima.com/XMLSchemas/fastRTPS_Profiles\">"
+      "<participant profile_name=\"amm_codec_test\">"
+      "<domainId>42</domainId><rtps><name>amm_codec_test</name></rtps>"
+      "</participant>"
+      "</profiles>";
+
+   const char *MANIFEST =
+      "<manifest><module name=\"amm_codec_test\"><publish>Status</publish></module></manifest>";
+
+   bool Advertises(eprosima::fastrtps::Participant *participant) {
+      if (participant == nullptr) return false;
+      for (const auto &property : participant->getAttributes().rtps.properties.properties()) {
+         if (property.name() == AMM::PayloadCodec::CAPABILITY &&
+             property.value() == AMM::PayloadCodec::CAPABILITY_VALUE) {
+            return true;
+         }
+      }
+      return false;
+   }
+
+   void TestAdvertised() {
+      CHECK(eprosima::fastrtps::xmlparser::XMLProfileManager::loadXMLString(PROFILES, std::strlen(PROFILES)) ==
+            eprosima::fastrtps::xmlparser::XMLP_ret::XML_OK);
+      std::string errmsg;
+      AMM::DDS_Listeners::ParticipantListener listener;
+
+      eprosima::fastrtps::Participant *server =
+         AMM::DiscoveryServer::CreateServer("127.0.0.1:11912", 42, &listener, errmsg);
+      CHECK(Advertises(server));
+      eprosima::fastrtps::Participant *client =
+         AMM::DiscoveryServer::CreateClient("amm_codec_test", "127.0.0.1:11912", &listener, errmsg);
+      CHECK(Advertises(client));
+
+      std::vector<AMM::ModuleManifest> modules;
+      CHECK(AMM::StaticDiscovery::ParseManifest(MANIFEST, modules, errmsg) == 0);
+      eprosima::fastrtps::Participant *manifest =
+         AMM::StaticDiscovery::CreateParticipant("amm_codec_test", modules, &listener, errmsg);
+      CHECK(Advertises(manifest));
+
+      if (manifest != nullptr) eprosima::fastrtps::Domain::removeParticipant(manifest);
+      if (client != nullptr) eprosima::fastrtps::Domain::removeParticipant(client);
+      if (server != nullptr) eprosima::fastrtps::Domain::removeParticipant(server);
+   }
+
+   void TestDurableWriters() {
+      AMM::CompressedPubSubType<AMM::ModuleConfigurationPubSubType> type;
+      AMM::ModuleConfiguration configuration;
+      const std::vector<uint8_t> xml = Repetitive(8 * 1024);
+      configuration.capabilities_configuration(std::string(xml.begin(), xml.end()));
+
+      AMM::PayloadCodec::SetEnabled(true);
+
+      // A type starts out as for a durable writer, sending plain.
+      SerializedPayload_t payload(type.m_typeSize);
+      CHECK(type.serialize(&configuration, &payload));
+      CHECK(payload.length > xml.size() && payload.data[0] != 'A');
+
+      type.AllowEncoding(true);
+      SerializedPayload_t compressed(type.m_typeSize);
+      CHECK(type.serialize(&configuration, &compressed));
+      CHECK(compressed.length < xml.size() && compressed.data[0] == 'A' && compressed.data[1] == 'Z');
+
+      AMM::ModuleConfiguration decoded;
+      CHECK(type.deserialize(&compressed, &decoded));
+      CHECK(decoded.capabilities_configuration() == configuration.capabilities_configuration());
+
+      AMM::PayloadCodec::SetEnabled(false);
+   }
+
+} // namespace
+
+int main() {
+   TestRoundTrips();
+   TestMalformedBlocks();
+   TestPayloads();
+   TestCapability();
+   TestAdvertised();
+   TestDurableWriters();
+   eprosima::fastrtps::Domain::stopAll();
+   return CHECK_RESULT();
+}
@@ -0,0 +1,120 @@
+// Topic handler lifetime: 10,000 initialize, create endpoint and decommission cycles on two managers
+// sharing a participant and a type.  Resident memory has to stay flat after the first 1,000 cycles.
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include "amm_std.h"
+
+#include "Check.h"
+
+namespace {
+
+   const int CYCLES = 10000;
+
+   const int WARMUP_CYCLES = 1000;
+
+   /// Allocator and Fast-RTPS cache noise, far below what a handler leaked per cycle would add up to.
+   const long RSS_SLACK_KB = 1024;
+
+   /// Domain 42 keeps the test off the AMM domain of a running lab.
+   const char *PROFILES =
+      "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n"
+      "<profiles xmlns=\"http://www.eprosima.com/XMLSchemas/fastRTPS_Profiles\">\n"
+      "  <participant profile_name=\"amm_soak_test\">\n"
+      "    <domainId>42</domainId>\n"
+      "    <rtps><name>amm_soak_test</name></rtps>\n"
+      "  </participant>\n"
+      "</profiles>\n";
+
+   void OnTick(AMM::Tick &, eprosima::fastrtps::SampleInfo_t *) {}
+
+   void OnPhysiologyValue(AMM::PhysiologyValueSample &, eprosima::fastrtps::SampleInfo_t *) {}
+
+   /// @returns Resident set size in kB, 0 where it cannot be read.
+   long ResidentKb() {
+#ifdef __linux__
+      std::ifstream statm("/proc/self/statm");
+      long pages = 0;
+      long resident = 0;
+      statm >> pages >> resident;
+      return resident * (sysconf(_SC_PAGESIZE) / 1024);
+#else
+      return 0;
+#endif
+   }
+
+   /// One scenario reset: both managers bring their topics up and take them down again.
+   bool Cycle(AMM::DDSManager<void> &publisher, AMM::DDSManager<void> &subscriber) {
+      bool ok = true;
+      ok &= publisher.InitializeTick() == 0;
+      ok &= subscriber.InitializeTick() == 0;
+      ok &= publisher.InitializePhysiologyValue() == 0;
+      ok &= subscriber.InitializePhysiologyValue() == 0;
+
+      ok &= publisher.CreateTickPublisher() == 0;
+      ok &= subscriber.CreateTickSubscriber(OnTick) == 0;
+      ok &= publisher.CreatePhysiologyValuePublisher() == 0;
+      ok &= subscriber.CreatePhysiologyValueSubscriber(OnPhysiologyValue) == 0;
+
+      // Decommissioning one manager's topic keeps the shared type for the other.
+      ok &= publisher.DecommissionTick() == 0;
+      ok &= subscriber.IsTickInitialized();
+      ok &= subscriber.DecommissionTick() == 0;
+      ok &= publisher.DecommissionPhysiologyValue() == 0;
+      ok &= subscriber.DecommissionPhysiologyValue() == 0;
+      return ok;
+   }
+
+   /// @returns Path of a file in the temporary directory, unique to this process.
+   std::string TemporaryPath(const std::string &name) {
+      const char *directory = std::getenv("TMPDIR");
+      std::string path = directory != nullptr && *directory != '\0' ? directory : "/tmp";
+#ifdef __linux__
+      path += "/" + std::to_string(getpid()) + "_" + name;
+#else
+      path += "/" + name;
+#endif
+      return path;
+   }
+
+} // namespace
+
+int main() {
+   const std::string profilesFile = TemporaryPath("amm_soak_test_profiles.xml");
+   {
+      std::ofstream profiles(profilesFile);
+      profiles << PROFILES;
+   }
+
+   {
+      AMM::DDSManager<void> publisher(profilesFile, "amm_soak_test");
+      AMM::DDSManager<void> subscriber(profilesFile, "amm_soak_test");
+
+      long warm = 0;
+      int failed = 0;
+      for (int i = 0; i < CYCLES; ++i) {
+         if (!Cycle(publisher, subscriber)) ++failed;
+         if (i + 1 == WARMUP_CYCLES) warm = ResidentKb();
+      }
+      const long end = ResidentKb();
+
+      std::cout << "RSS after " << WARMUP_CYCLES << " cycles " << warm << " kB, after " << CYCLES << " cycles "
+                << end << " kB" << std::endl;
+      CHECK(failed == 0);
+      CHECK(end - warm < RSS_SLACK_KB);
+
+      publisher.Shutdown();
+      subscriber.Shutdown();
+   }
+
+   std::remove(profilesFile.c_str());
+   return CHECK_RESULT();
+}